@@ -101,6 +101,21 @@ void DoScalarDependentDefinitions(py::module m, T) {
     AddValueInstantiation<Class>(m);
   }
 
+  // BodyPairSpatialForce
+  {
+    using Class = BodyPairSpatialForce<T>;
+    constexpr auto& cls_doc = doc.BodyPairSpatialForce;
+    auto cls = DefineTemplateClassWithDefault<Class>(
+        m, "BodyPairSpatialForce", param, cls_doc.doc);
+    cls  // BR
+        .def_readonly(
+            "bodyA_index", &Class::bodyA_index, cls_doc.bodyA_index.doc)
+        .def_readonly(
+            "bodyB_index", &Class::bodyB_index, cls_doc.bodyB_index.doc)
+        .def_readonly("F_Ao_W", &Class::F_Ao_W, cls_doc.F_Ao_W.doc);
+    DefCopyAndDeepCopy(&cls);
+  }
+
   // ContactResults
   {
     using Class = ContactResults<T>;
@@ -117,6 +132,12 @@ void DoScalarDependentDefinitions(py::module m, T) {
             cls_doc.num_hydroelastic_contacts.doc)
         .def("hydroelastic_contact_info", &Class::hydroelastic_contact_info,
             py::arg("i"), cls_doc.hydroelastic_contact_info.doc)
+        .def("num_hydroelastic_body_pair_forces",
+            &Class::num_hydroelastic_body_pair_forces,
+            cls_doc.num_hydroelastic_body_pair_forces.doc)
+        .def("hydroelastic_body_pair_force",
+            &Class::hydroelastic_body_pair_force, py::arg("i"),
+            cls_doc.hydroelastic_body_pair_force.doc)
         .def("plant", &Class::plant, py_rvp::reference, cls_doc.plant.doc);
     DefCopyAndDeepCopy(&cls);
     AddValueInstantiation<Class>(m);
@@ -928,6 +949,17 @@ void DoScalarDependentDefinitions(py::module m, T) {
         .def("get_contact_surface_representation",
             &Class::get_contact_surface_representation,
             cls_doc.get_contact_surface_representation.doc)
+        .def("set_contact_results_reporting_level",
+            &Class::set_contact_results_reporting_level, py::arg("level"),
+            cls_doc.set_contact_results_reporting_level.doc)
+        .def("get_contact_results_reporting_level",
+            &Class::get_contact_results_reporting_level,
+            cls_doc.get_contact_results_reporting_level.doc)
+        .def("set_use_block_sparse_tamsi", &Class::set_use_block_sparse_tamsi,
+            py::arg("use_block_sparse_tamsi"),
+            cls_doc.set_use_block_sparse_tamsi.doc)
+        .def("get_use_block_sparse_tamsi", &Class::get_use_block_sparse_tamsi,
+            cls_doc.get_use_block_sparse_tamsi.doc)
         .def("set_penetration_allowance", &Class::set_penetration_allowance,
             py::arg("penetration_allowance") = 0.001,
             cls_doc.set_penetration_allowance.doc)
@@ -1330,6 +1362,15 @@ PYBIND11_MODULE(plant, m) {
             cls_doc.kPointContactOnly.doc);
   }
 
+  {
+    using Class = ContactResultsReportingLevel;
+    constexpr auto& cls_doc = doc.ContactResultsReportingLevel;
+    py::enum_<Class>(m, "ContactResultsReportingLevel", cls_doc.doc)
+        .value("kNetForces", Class::kNetForces, cls_doc.kNetForces.doc)
+        .value("kPairSummary", Class::kPairSummary, cls_doc.kPairSummary.doc)
+        .value("kFull", Class::kFull, cls_doc.kFull.doc);
+  }
+
   {
     using Class = MultibodyPlantConfig;
     constexpr auto& cls_doc = doc.MultibodyPlantConfig;
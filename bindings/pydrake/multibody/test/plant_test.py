@@ -60,6 +60,7 @@ from pydrake.multibody.plant import (
     ConnectContactResultsToDrakeVisualizer,
     ContactModel,
     ContactResults_,
+    ContactResultsReportingLevel,
     ContactResultsToLcmSystem,
     CoulombFriction_,
     ExternallyAppliedSpatialForce_,
@@ -2135,6 +2136,8 @@ class TestPlant(unittest.TestCase):
         # ContactResults
         contact_results = ContactResults()
         self.assertTrue(contact_results.num_point_pair_contacts() == 0)
+        self.assertTrue(
+            contact_results.num_hydroelastic_body_pair_forces() == 0)
         self.assertIsNone(contact_results.plant())
         copy.copy(contact_results)
 
@@ -2152,6 +2155,26 @@ class TestPlant(unittest.TestCase):
             plant.set_contact_model(model)
             self.assertEqual(plant.get_contact_model(), model)
 
+    def test_contact_results_reporting_level(self):
+        plant = MultibodyPlant_[float](0.1)
+        self.assertEqual(plant.get_contact_results_reporting_level(),
+                         ContactResultsReportingLevel.kFull)
+        levels = [
+            ContactResultsReportingLevel.kNetForces,
+            ContactResultsReportingLevel.kPairSummary,
+            ContactResultsReportingLevel.kFull,
+        ]
+        for level in levels:
+            plant.set_contact_results_reporting_level(level)
+            self.assertEqual(
+                plant.get_contact_results_reporting_level(), level)
+
+    def test_use_block_sparse_tamsi(self):
+        plant = MultibodyPlant_[float](0.1)
+        self.assertFalse(plant.get_use_block_sparse_tamsi())
+        plant.set_use_block_sparse_tamsi(use_block_sparse_tamsi=True)
+        self.assertTrue(plant.get_use_block_sparse_tamsi())
+
     def test_contact_surface_representation(self):
         for time_step in [0.0, 0.1]:
             plant = MultibodyPlant_[float](time_step)
@@ -0,0 +1,34 @@
+#include "drake/common/content_keyed_cache.h"
+
+#include <fstream>
+#include <vector>
+
+#include "drake/common/hash.h"
+
+namespace drake {
+namespace internal {
+
+ContentDigest DigestContents(const void* data, size_t size) {
+  FNV1aHasher hasher;
+  hasher(data, size);
+  return ContentDigest(static_cast<size_t>(hasher), size);
+}
+
+std::optional<ContentDigest> DigestFileContents(const std::string& filename) {
+  std::ifstream file(filename, std::ios::binary);
+  if (!file.is_open()) return std::nullopt;
+  FNV1aHasher hasher;
+  uint64_t size = 0;
+  std::vector<char> buffer(1 << 16);
+  while (file) {
+    file.read(buffer.data(), buffer.size());
+    const std::streamsize count = file.gcount();
+    hasher(buffer.data(), count);
+    size += count;
+  }
+  if (file.bad()) return std::nullopt;
+  return ContentDigest(static_cast<size_t>(hasher), size);
+}
+
+}  // namespace internal
+}  // namespace drake
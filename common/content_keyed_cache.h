@@ -0,0 +1,207 @@
+#pragma once
+
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/text_logging.h"
+#include "drake/common/timer.h"
+
+namespace drake {
+namespace internal {
+
+/* The digest of some content: a 64-bit FNV-1a hash of its bytes and its size
+ in bytes. */
+using ContentDigest = std::pair<size_t, uint64_t>;
+
+/* Returns the digest of the `size` bytes at `data`. */
+ContentDigest DigestContents(const void* data, size_t size);
+
+/* Returns the digest of the contents of the file named `filename`, or nullopt
+ if the file can't be read. The file is streamed, not read into memory. */
+std::optional<ContentDigest> DigestFileContents(const std::string& filename);
+
+/* Instrumentation of a ContentKeyedCache. */
+struct ContentKeyedCacheStats {
+  /* The number of requests that were served from the cache. */
+  int hits{0};
+  /* The number of requests that required computing a value. */
+  int misses{0};
+  /* The total wall-clock time (in seconds) spent computing values. */
+  double load_time{0};
+  /* The number of entries evicted to honor the byte budget. */
+  int evictions{0};
+  /* The number of bytes currently charged against the byte budget. */
+  int64_t bytes{0};
+};
+
+/* A thread-safe cache of immutable, shared values that are expensive to
+ compute from some content (typically a file), keyed on a digest of that
+ content rather than on where it came from. The Key is usually a
+ ContentDigest, possibly combined with whatever else the value depends on; it
+ must be ordered by `operator<`.
+
+ The cache is bounded by a byte budget, approximately: each entry is charged
+ the number of bytes given when it was added (typically the size of the
+ content, as a proxy for the size of the value), and once the budget is
+ exceeded the least recently used entries are evicted. The most recently used
+ entry is never evicted, so that a single value larger than the whole budget
+ is still cached until something else displaces it. Evicting an entry only
+ drops the cache's reference; values previously returned remain valid for as
+ long as their callers hold on to them.
+
+ If two threads request the same missing entry concurrently, the value is
+ computed once; the second thread blocks until it is available. If computing
+ the value throws, or produces nullptr, the exception or nullptr is passed to
+ all waiting callers and nothing is cached, so a subsequent request will try
+ again.
+
+ @tparam Key    The type of the keys.
+ @tparam Value  The type of the cached values; may be `void` for a cache of
+                type-erased values. */
+template <typename Key, typename Value>
+class ContentKeyedCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ContentKeyedCache)
+
+  using Stats = ContentKeyedCacheStats;
+
+  /* Constructs an empty cache whose entries are charged against a budget of
+   `max_bytes`. The `name` prefixes the cache's log messages.
+   @throws std::exception if max_bytes < 0. */
+  ContentKeyedCache(std::string name, int64_t max_bytes)
+      : name_(std::move(name)), max_bytes_(max_bytes) {
+    DRAKE_THROW_UNLESS(max_bytes >= 0);
+  }
+
+  /* Returns the value cached for `key`, or on a miss the value returned by
+   `compute()`, which is then cached and charged `bytes` against the budget.
+   On a miss, `describe()` must return a description of the value (e.g., the
+   name of the file it was computed from) for the debug log.
+   @tparam Compute   A callable returning std::shared_ptr<const Value>.
+   @tparam Describe  A callable returning something fmt can format. */
+  template <typename Compute, typename Describe>
+  std::shared_ptr<const Value> GetOrCompute(const Key& key, int64_t bytes,
+                                            const Compute& compute,
+                                            const Describe& describe) {
+    std::promise<std::shared_ptr<const Value>> promise;
+    std::optional<std::shared_future<std::shared_ptr<const Value>>> cached;
+    int64_t id{};
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto iter = entries_.find(key);
+      if (iter != entries_.end()) {
+        ++stats_.hits;
+        lru_.splice(lru_.begin(), lru_, iter->second.lru_position);
+        /* Copying the future keeps it valid even if the entry gets evicted. */
+        cached = iter->second.value;
+      } else {
+        ++stats_.misses;
+        id = next_id_++;
+        lru_.push_front(key);
+        entries_.emplace(key, Entry{id, promise.get_future().share(), bytes,
+                                    lru_.begin()});
+        stats_.bytes += bytes;
+        while (stats_.bytes > max_bytes_ && lru_.size() > 1) {
+          Erase(entries_.find(lru_.back()));
+          ++stats_.evictions;
+        }
+      }
+    }
+    /* The cached value may still be in flight; wait for it outside of the
+     lock. This rethrows if computing it failed. */
+    if (cached.has_value()) return cached->get();
+
+    SteadyTimer timer;
+    timer.Start();
+    std::shared_ptr<const Value> result;
+    try {
+      result = compute();
+    } catch (...) {
+      promise.set_exception(std::current_exception());
+      Forget(key, id);
+      throw;
+    }
+    promise.set_value(result);
+    if (result == nullptr) {
+      Forget(key, id);
+      return result;
+    }
+    const double elapsed = timer.Tick();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stats_.load_time += elapsed;
+    }
+    log()->debug("{}: computed {} in {:.3f} s.", name_, describe(), elapsed);
+    return result;
+  }
+
+  /* Returns a snapshot of the cache's statistics. */
+  Stats GetStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+  /* Returns the byte budget of this cache. */
+  int64_t max_bytes() const { return max_bytes_; }
+
+  /* Evicts all entries and resets the statistics. */
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+    stats_ = {};
+  }
+
+ private:
+  /* A cached value, or the promise of one while it is being computed. The id
+   distinguishes the entries created for the same key over time, so that a
+   failed computation never erases an entry that replaced its own (e.g., after
+   an eviction or a call to Clear()). */
+  struct Entry {
+    int64_t id{};
+    std::shared_future<std::shared_ptr<const Value>> value;
+    /* The number of bytes charged against the budget for this entry. */
+    int64_t bytes{};
+    /* The position of this entry's key in `lru_`. */
+    typename std::list<Key>::iterator lru_position;
+  };
+
+  /* Removes the entry at `iter`, refunding its bytes. Requires `mutex_` be
+   held. */
+  void Erase(typename std::map<Key, Entry>::iterator iter) {
+    stats_.bytes -= iter->second.bytes;
+    lru_.erase(iter->second.lru_position);
+    entries_.erase(iter);
+  }
+
+  /* Removes the entry for `key` if it is still the one with the given `id`. */
+  void Forget(const Key& key, int64_t id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entries_.find(key);
+    if (iter != entries_.end() && iter->second.id == id) {
+      Erase(iter);
+    }
+  }
+
+  const std::string name_;
+  const int64_t max_bytes_;
+  mutable std::mutex mutex_;
+  std::map<Key, Entry> entries_;
+  /* The keys of `entries_`, from the most to the least recently used. */
+  std::list<Key> lru_;
+  int64_t next_id_{0};
+  Stats stats_;
+};
+
+}  // namespace internal
+}  // namespace drake
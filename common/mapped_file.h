@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace internal {
+
+/* A read-only memory mapping of a whole file. Mapping a file is far cheaper
+ than reading it into a buffer; the pages are loaded on demand by the
+ operating system and can be read concurrently by many threads. */
+class MappedFile {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MappedFile)
+
+  /* Maps the named file. If the file can't be opened or isn't a regular file
+   (or is empty), the mapping is empty; use is_open() to tell the cases
+   apart. */
+  explicit MappedFile(const std::string& filename);
+
+  ~MappedFile();
+
+  /* Reports true if the file was opened (even if it is empty). */
+  bool is_open() const { return is_open_; }
+
+  const char* data() const { return data_; }
+  size_t size() const { return size_; }
+
+  /* The contents of the file. */
+  std::string_view contents() const { return {data_, size_}; }
+
+ private:
+  const char* data_{nullptr};
+  size_t size_{0};
+  bool is_open_{false};
+};
+
+}  // namespace internal
+}  // namespace drake
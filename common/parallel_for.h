@@ -0,0 +1,95 @@
+#pragma once
+
+#include <exception>
+#include <type_traits>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+namespace drake {
+namespace internal {
+
+/* Options for ParallelFor(). */
+struct ParallelForOptions {
+  /* Whether to run the loop on multiple threads at all. Callers pass false
+   for loops that are too small to amortize the cost of a parallel region, or
+   that would otherwise nest inside another one. */
+  bool parallelize{true};
+  /* The number of threads to use, or zero for OpenMP's default. */
+  int num_threads{0};
+  /* The number of consecutive iterations that a thread takes at a time. */
+  int chunk_size{1};
+};
+
+/* Returns true if a loop with `n` iterations over values of scalar type T
+ should run in parallel, i.e., with ParallelForOptions::parallelize. Loops
+ with fewer than `min_n` iterations run serially since the overhead of a
+ parallel region outweighs the work. Only T = double is parallelized. Loops
+ reached from within an active parallel region run serially so that the
+ threads are not oversubscribed. */
+template <typename T>
+bool ShouldParallelize(int n, int min_n) {
+  if (!std::is_same_v<T, double> || n < min_n) {
+    return false;
+  }
+#if defined(_OPENMP)
+  return !omp_in_parallel();
+#else
+  return false;
+#endif
+}
+
+/* Invokes `function(i)` for each i in [0, n), on multiple threads when Drake
+ is built with OpenMP and `options.parallelize` is true, and serially
+ otherwise.
+
+ Exceptions can't escape an OpenMP parallel region. When run in parallel, an
+ exception thrown by `function` is caught, the remaining iterations still run,
+ and then the exception thrown for the smallest i is rethrown. When run
+ serially, an exception propagates immediately. Either way, the caller sees
+ the same exception. No memory is allocated beyond what `function` does. */
+template <typename Function>
+void ParallelFor(int n, const Function& function,
+                 const ParallelForOptions& options = {}) {
+#if defined(_OPENMP)
+  const bool parallel = options.parallelize && n > 1;
+#else
+  const bool parallel = false;
+#endif
+  if (!parallel) {
+    for (int i = 0; i < n; ++i) function(i);
+    return;
+  }
+
+  std::exception_ptr first_exception;
+  int first_exception_index = n;
+#if defined(_OPENMP)
+  const int threads =
+      options.num_threads > 0 ? options.num_threads : omp_get_max_threads();
+#endif
+  [[maybe_unused]] const int chunk = options.chunk_size > 0
+                                         ? options.chunk_size : 1;
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(threads) schedule(dynamic, chunk)
+#endif
+  for (int i = 0; i < n; ++i) {
+    try {
+      function(i);
+    } catch (...) {
+#if defined(_OPENMP)
+#pragma omp critical(drake_parallel_for_exception)
+#endif
+      {
+        if (i < first_exception_index) {
+          first_exception_index = i;
+          first_exception = std::current_exception();
+        }
+      }
+    }
+  }
+  if (first_exception != nullptr) std::rethrow_exception(first_exception);
+}
+
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,167 @@
+#include "drake/common/content_keyed_cache.h"
+
+#include <fstream>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace internal {
+namespace {
+
+using Cache = ContentKeyedCache<int, int>;
+
+/* Requests `key` from `cache`, charged `bytes`, computing `value` on a miss. */
+std::shared_ptr<const int> Get(Cache* cache, int key, int value,
+                               int64_t bytes = 1) {
+  return cache->GetOrCompute(
+      key, bytes,
+      [value]() {
+        return std::make_shared<const int>(value);
+      },
+      [key]() {
+        return key;
+      });
+}
+
+GTEST_TEST(ContentKeyedCacheTest, HitsAndMisses) {
+  Cache cache("test", 100);
+  EXPECT_EQ(*Get(&cache, 1, 10), 10);
+  EXPECT_EQ(*Get(&cache, 1, 11), 10);
+  EXPECT_EQ(*Get(&cache, 2, 20), 20);
+  const Cache::Stats stats = cache.GetStats();
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.misses, 2);
+  EXPECT_EQ(stats.bytes, 2);
+  EXPECT_GE(stats.load_time, 0.0);
+
+  std::shared_ptr<const int> held = Get(&cache, 1, 12);
+  cache.Clear();
+  EXPECT_EQ(cache.GetStats().misses, 0);
+  EXPECT_EQ(cache.GetStats().bytes, 0);
+  EXPECT_EQ(*held, 10);
+  EXPECT_EQ(*Get(&cache, 1, 13), 13);
+}
+
+/* The least recently used entries are evicted to honor the budget, but never
+ the most recently used one. */
+GTEST_TEST(ContentKeyedCacheTest, EvictionHonorsBudget) {
+  Cache cache("test", 10);
+  EXPECT_EQ(cache.max_bytes(), 10);
+  Get(&cache, 1, 10, 5);
+  Get(&cache, 2, 20, 5);
+  // Touch 1, so that 2 becomes the least recently used.
+  Get(&cache, 1, 11, 5);
+  Get(&cache, 3, 30, 5);
+  EXPECT_EQ(cache.GetStats().evictions, 1);
+  EXPECT_EQ(cache.GetStats().bytes, 10);
+  EXPECT_EQ(*Get(&cache, 1, 12, 5), 10);
+  EXPECT_EQ(*Get(&cache, 2, 21, 5), 21);
+
+  // An entry larger than the whole budget displaces everything else, but is
+  // itself kept.
+  Get(&cache, 4, 40, 50);
+  EXPECT_EQ(cache.GetStats().bytes, 50);
+  EXPECT_EQ(*Get(&cache, 4, 41, 50), 40);
+
+  EXPECT_THROW(Cache("test", -1), std::exception);
+}
+
+GTEST_TEST(ContentKeyedCacheTest, FailuresAreNotCached) {
+  Cache cache("test", 100);
+  auto fail = []() -> std::shared_ptr<const int> {
+    throw std::runtime_error("failed");
+  };
+  auto describe = []() { return "failure"; };
+  DRAKE_EXPECT_THROWS_MESSAGE(cache.GetOrCompute(1, 1, fail, describe),
+                              "failed");
+  EXPECT_EQ(cache.GetStats().bytes, 0);
+
+  auto null = []() { return std::shared_ptr<const int>(); };
+  EXPECT_EQ(cache.GetOrCompute(1, 1, null, describe), nullptr);
+  EXPECT_EQ(cache.GetStats().bytes, 0);
+
+  EXPECT_EQ(*Get(&cache, 1, 10), 10);
+  EXPECT_EQ(cache.GetStats().misses, 3);
+}
+
+/* A request that arrives while the same key is being computed waits for it,
+ and gets the same exception if computing it fails. */
+GTEST_TEST(ContentKeyedCacheTest, WaitersShareTheOutcome) {
+  Cache cache("test", 100);
+  std::promise<void> started;
+  std::promise<void> proceed;
+  std::shared_future<void> proceed_future = proceed.get_future().share();
+  auto first = std::async(std::launch::async, [&]() {
+    return cache.GetOrCompute(
+        1, 1,
+        [&]() -> std::shared_ptr<const int> {
+          started.set_value();
+          proceed_future.wait();
+          throw std::runtime_error("failed");
+        },
+        []() { return 1; });
+  });
+  started.get_future().wait();
+  auto second = std::async(std::launch::async, [&]() {
+    return Get(&cache, 1, 10);
+  });
+  // Give the second request time to find the in-flight entry.
+  while (cache.GetStats().hits == 0) std::this_thread::yield();
+  proceed.set_value();
+  EXPECT_THROW(first.get(), std::runtime_error);
+  EXPECT_THROW(second.get(), std::runtime_error);
+  EXPECT_EQ(cache.GetStats().misses, 1);
+  EXPECT_EQ(cache.GetStats().bytes, 0);
+}
+
+/* A computation that fails after its entry was replaced (here, by clearing
+ the cache and computing the key again) leaves the replacement alone. */
+GTEST_TEST(ContentKeyedCacheTest, StaleFailureKeepsReplacement) {
+  Cache cache("test", 100);
+  std::promise<void> started;
+  std::promise<void> proceed;
+  std::shared_future<void> proceed_future = proceed.get_future().share();
+  auto stale = std::async(std::launch::async, [&]() {
+    return cache.GetOrCompute(
+        1, 1,
+        [&]() -> std::shared_ptr<const int> {
+          started.set_value();
+          proceed_future.wait();
+          throw std::runtime_error("failed");
+        },
+        []() { return 1; });
+  });
+  started.get_future().wait();
+  cache.Clear();
+  EXPECT_EQ(*Get(&cache, 1, 10), 10);
+  proceed.set_value();
+  EXPECT_THROW(stale.get(), std::runtime_error);
+
+  EXPECT_EQ(*Get(&cache, 1, 11), 10);
+  EXPECT_EQ(cache.GetStats().hits, 1);
+  EXPECT_EQ(cache.GetStats().bytes, 1);
+}
+
+GTEST_TEST(ContentKeyedCacheTest, Digests) {
+  const std::string contents("some\0contents", 13);
+  const std::string filename = temp_directory() + "/file.txt";
+  std::ofstream(filename, std::ios::binary) << contents;
+  const std::optional<ContentDigest> digest = DigestFileContents(filename);
+  ASSERT_TRUE(digest.has_value());
+  EXPECT_EQ(*digest, DigestContents(contents.data(), contents.size()));
+  EXPECT_EQ(digest->second, contents.size());
+  EXPECT_NE(*digest, DigestContents(contents.data(), contents.size() - 1));
+  EXPECT_FALSE(DigestFileContents(filename + ".missing").has_value());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace drake
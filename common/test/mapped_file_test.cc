@@ -0,0 +1,45 @@
+#include "drake/common/mapped_file.h"
+
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+
+namespace drake {
+namespace internal {
+namespace {
+
+GTEST_TEST(MappedFileTest, Contents) {
+  const std::string filename = temp_directory() + "/file.txt";
+  std::ofstream(filename) << "some contents\n";
+  const MappedFile file(filename);
+  EXPECT_TRUE(file.is_open());
+  EXPECT_EQ(file.size(), 14);
+  EXPECT_EQ(file.contents(), "some contents\n");
+}
+
+GTEST_TEST(MappedFileTest, EmptyFile) {
+  const std::string filename = temp_directory() + "/empty.txt";
+  std::ofstream{filename};
+  const MappedFile file(filename);
+  EXPECT_TRUE(file.is_open());
+  EXPECT_EQ(file.size(), 0);
+  EXPECT_TRUE(file.contents().empty());
+}
+
+GTEST_TEST(MappedFileTest, MissingFile) {
+  const MappedFile missing(temp_directory() + "/missing.txt");
+  EXPECT_FALSE(missing.is_open());
+  EXPECT_EQ(missing.data(), nullptr);
+  EXPECT_EQ(missing.size(), 0);
+
+  // Directories can't be mapped.
+  const MappedFile directory(temp_directory());
+  EXPECT_FALSE(directory.is_open());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace drake
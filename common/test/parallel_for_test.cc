@@ -0,0 +1,82 @@
+#include "drake/common/parallel_for.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace internal {
+namespace {
+
+GTEST_TEST(ParallelForTest, VisitsEachIndexOnce) {
+  for (const bool parallelize : {false, true}) {
+    std::vector<int> visits(1000, 0);
+    ParallelForOptions options;
+    options.parallelize = parallelize;
+    options.chunk_size = 7;
+    ParallelFor(static_cast<int>(visits.size()), [&visits](int i) {
+      ++visits[i];
+    }, options);
+    for (int count : visits) EXPECT_EQ(count, 1);
+  }
+}
+
+GTEST_TEST(ParallelForTest, EmptyRange) {
+  int calls = 0;
+  ParallelFor(0, [&calls](int) { ++calls; });
+  EXPECT_EQ(calls, 0);
+}
+
+/* The exception for the smallest index is rethrown, whether or not the loop
+ ran in parallel. */
+GTEST_TEST(ParallelForTest, RethrowsFirstException) {
+  for (const bool parallelize : {false, true}) {
+    ParallelForOptions options;
+    options.parallelize = parallelize;
+    try {
+      ParallelFor(100, [](int i) {
+        if (i % 10 == 3) throw std::runtime_error(std::to_string(i));
+      }, options);
+      ADD_FAILURE() << "Expected an exception";
+    } catch (const std::runtime_error& e) {
+      EXPECT_EQ(std::string(e.what()), "3");
+    }
+  }
+}
+
+/* When run in parallel, the iterations after a failed one still run. */
+GTEST_TEST(ParallelForTest, ParallelRunsAllIterations) {
+#if defined(_OPENMP)
+  std::atomic<int> calls{0};
+  EXPECT_THROW(ParallelFor(100, [&calls](int i) {
+    ++calls;
+    if (i == 0) throw std::runtime_error("first");
+  }), std::runtime_error);
+  EXPECT_EQ(calls, 100);
+#endif
+}
+
+GTEST_TEST(ParallelForTest, ShouldParallelize) {
+  EXPECT_FALSE(ShouldParallelize<double>(10, 64));
+  EXPECT_FALSE(ShouldParallelize<float>(100, 64));
+#if defined(_OPENMP)
+  EXPECT_TRUE(ShouldParallelize<double>(64, 64));
+  // Not from within a parallel region.
+  ParallelForOptions options;
+  options.num_threads = 2;
+  std::atomic<int> nested{0};
+  ParallelFor(2, [&nested](int) {
+    if (ShouldParallelize<double>(100, 64)) ++nested;
+  }, options);
+  EXPECT_EQ(nested, 0);
+#else
+  EXPECT_FALSE(ShouldParallelize<double>(64, 64));
+#endif
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace drake
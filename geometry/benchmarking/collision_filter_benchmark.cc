@@ -0,0 +1,127 @@
+// @file
+// Benchmarks for the collision filter of a large scene, as a function of the
+// number of geometries: registering the geometries and their filters, copying
+// the filter (as cloning a Context does), and the CanCollideWith() queries the
+// broadphase callbacks make for every candidate pair. Each benchmark reports
+// the memory used by the filter's tables.
+
+#include <algorithm>
+#include <random>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/geometry/proximity/collision_filter.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace geometry {
+
+/* Use GeometrySetTester's friend status with GeometrySet to resolve the sets
+ in a declaration without a GeometryState. */
+class GeometrySetTester {
+ public:
+  static std::unordered_set<GeometryId> geometries(const GeometrySet& s) {
+    return s.geometries();
+  }
+};
+
+namespace internal {
+namespace {
+
+/* The geometries are grouped as if they were affixed to bodies with this many
+ geometries each; the geometries on a body are filtered with each other. */
+constexpr int kGeometriesPerBody = 4;
+
+/* Fixture whose filter has as many geometries as the first benchmark argument.
+ */
+class CollisionFilterFixture : public benchmark::Fixture {
+ public:
+  CollisionFilterFixture() { tools::performance::AddMinMaxStatistics(this); }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    ids_.clear();
+    for (int i = 0; i < state.range(0); ++i) {
+      ids_.push_back(GeometryId::get_new_id());
+    }
+  }
+
+ protected:
+  /* Returns a filter with all of the geometries registered and filtered the
+   way SceneGraph filters geometries affixed to the same frame. */
+  CollisionFilter MakeFilter() const {
+    CollisionFilter filter;
+    for (GeometryId id : ids_) filter.AddGeometry(id);
+    CollisionFilterDeclaration declaration;
+    for (size_t i = 0; i < ids_.size(); i += kGeometriesPerBody) {
+      const size_t end = std::min(ids_.size(), i + kGeometriesPerBody);
+      declaration.ExcludeWithin(GeometrySet(
+          std::vector<GeometryId>(ids_.begin() + i, ids_.begin() + end)));
+    }
+    filter.Apply(declaration, &GeometrySetTester::geometries,
+                 true /* is_invariant */);
+    return filter;
+  }
+
+  std::vector<GeometryId> ids_;
+};
+
+void Args(benchmark::internal::Benchmark* b) {
+  b->Arg(100)->Arg(1000)->Arg(10000)->ArgName("geometries");
+}
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(CollisionFilterFixture, Build)(benchmark::State& state) {
+  int64_t bytes = 0;
+  for (auto _ : state) {
+    const CollisionFilter filter = MakeFilter();
+    bytes = filter.table_bytes();
+  }
+  state.counters["table_bytes"] = bytes;
+}
+BENCHMARK_REGISTER_F(CollisionFilterFixture, Build)
+    ->Apply(Args)
+    ->Unit(benchmark::kMillisecond);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(CollisionFilterFixture, Copy)(benchmark::State& state) {
+  const CollisionFilter filter = MakeFilter();
+  for (auto _ : state) {
+    CollisionFilter copy(filter);
+    benchmark::DoNotOptimize(copy);
+  }
+  state.counters["table_bytes"] = filter.table_bytes();
+}
+BENCHMARK_REGISTER_F(CollisionFilterFixture, Copy)
+    ->Apply(Args)
+    ->Unit(benchmark::kMicrosecond);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(CollisionFilterFixture, CanCollideWith)
+(benchmark::State& state) {
+  const CollisionFilter filter = MakeFilter();
+  /* Random pairs, so that the lookups aren't trivially cached. */
+  std::mt19937 generator(1234);
+  std::uniform_int_distribution<int> index(0, ids_.size() - 1);
+  std::vector<std::pair<GeometryId, GeometryId>> pairs;
+  for (int i = 0; i < 1024; ++i) {
+    pairs.emplace_back(ids_[index(generator)], ids_[index(generator)]);
+  }
+  int i = 0;
+  for (auto _ : state) {
+    const auto& [id_A, id_B] = pairs[i++ % pairs.size()];
+    benchmark::DoNotOptimize(filter.CanCollideWith(id_A, id_B));
+  }
+  state.counters["table_bytes"] = filter.table_bytes();
+}
+BENCHMARK_REGISTER_F(CollisionFilterFixture, CanCollideWith)->Apply(Args);
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -0,0 +1,204 @@
+// @file
+// Benchmarks for reading large meshes from .obj and .vtk files, comparing the
+// existing readers (built on tinyobjloader and the VTK library) with the
+// parallel parsers in parallel_mesh_parsers.h. The files are generated on the
+// first run of each size: regular grids of triangles (for .obj) and of
+// tetrahedra (for .vtk), with coordinates written to six decimal places as
+// typical mesh tools do.
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+#include "drake/geometry/proximity/parallel_mesh_parsers.h"
+#include "drake/geometry/proximity/vtk_to_volume_mesh.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+/* A pseudo-random height, so that the coordinates aren't all short. */
+double Height(int i, int j) {
+  return 0.001 * ((i * 7919 + j * 104729) % 997);
+}
+
+/* Writes an .obj file with an n x n grid of vertices, each grid cell split
+ into two triangles. */
+void WriteObjGrid(const std::string& filename, int n) {
+  std::ofstream file(filename);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      file << fmt::format("v {:.6f} {:.6f} {:.6f}\n", double(i) / n,
+                          double(j) / n, Height(i, j));
+    }
+  }
+  for (int i = 0; i + 1 < n; ++i) {
+    for (int j = 0; j + 1 < n; ++j) {
+      // One-based indices of the cell's corners.
+      const int a = i * n + j + 1;
+      const int b = a + n;
+      file << fmt::format("f {} {} {}\nf {} {} {}\n", a, b, b + 1, a, b + 1,
+                          a + 1);
+    }
+  }
+}
+
+/* Writes a legacy .vtk file with an n x n x n grid of vertices, each grid cell
+ split into six tetrahedra around its main diagonal. */
+void WriteVtkGrid(const std::string& filename, int n) {
+  std::ofstream file(filename);
+  file << "# vtk DataFile Version 3.0\ngrid\nASCII\n"
+       << "DATASET UNSTRUCTURED_GRID\n"
+       << fmt::format("POINTS {} double\n", n * n * n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      for (int k = 0; k < n; ++k) {
+        file << fmt::format("{:.6f} {:.6f} {:.6f}\n", double(i) / n,
+                            double(j) / n, double(k) / n + Height(i, j));
+      }
+    }
+  }
+  const int num_cells = 6 * (n - 1) * (n - 1) * (n - 1);
+  file << fmt::format("CELLS {} {}\n", num_cells, 5 * num_cells);
+  auto index = [n](int i, int j, int k) {
+    return (i * n + j) * n + k;
+  };
+  for (int i = 0; i + 1 < n; ++i) {
+    for (int j = 0; j + 1 < n; ++j) {
+      for (int k = 0; k + 1 < n; ++k) {
+        const int v000 = index(i, j, k);
+        const int v111 = index(i + 1, j + 1, k + 1);
+        // The paths from v000 to v111 through the cell's edges.
+        const int path[6][2] = {
+            {index(i + 1, j, k), index(i + 1, j + 1, k)},
+            {index(i + 1, j, k), index(i + 1, j, k + 1)},
+            {index(i, j + 1, k), index(i + 1, j + 1, k)},
+            {index(i, j + 1, k), index(i, j + 1, k + 1)},
+            {index(i, j, k + 1), index(i + 1, j, k + 1)},
+            {index(i, j, k + 1), index(i, j + 1, k + 1)}};
+        for (const auto& [v1, v2] : path) {
+          file << fmt::format("4 {} {} {} {}\n", v000, v1, v2, v111);
+        }
+      }
+    }
+  }
+  file << fmt::format("CELL_TYPES {}\n", num_cells);
+  for (int c = 0; c < num_cells; ++c) file << "10\n";
+}
+
+/* Fixture that provides a mesh file whose resolution is given by the first
+ benchmark argument. */
+class MeshParsingFixture : public benchmark::Fixture {
+ public:
+  MeshParsingFixture() { tools::performance::AddMinMaxStatistics(this); }
+
+ protected:
+  /* Returns the name of the .obj file with the given resolution, writing it
+   if necessary. */
+  static const std::string& ObjFile(int n) {
+    return GetFile(fmt::format("grid_{}.obj", n),
+                   [n](const std::string& filename) {
+                     WriteObjGrid(filename, n);
+                   });
+  }
+
+  /* Returns the name of the .vtk file with the given resolution, writing it
+   if necessary. */
+  static const std::string& VtkFile(int n) {
+    return GetFile(fmt::format("grid_{}.vtk", n),
+                   [n](const std::string& filename) {
+                     WriteVtkGrid(filename, n);
+                   });
+  }
+
+  /* Records the file size and number of elements read per iteration. */
+  static void Report(const std::string& filename, int num_elements,
+                     benchmark::State* state) {
+    const int64_t file_size = std::ifstream(filename, std::ios::ate).tellg();
+    state->SetBytesProcessed(state->iterations() * file_size);
+    state->counters["elements"] = num_elements;
+  }
+
+ private:
+  template <typename Write>
+  static const std::string& GetFile(const std::string& name,
+                                    const Write& write) {
+    static const std::string dir = temp_directory();
+    static std::map<std::string, std::string> files;
+    auto iter = files.find(name);
+    if (iter == files.end()) {
+      const std::string filename = dir + "/" + name;
+      write(filename);
+      iter = files.emplace(name, filename).first;
+    }
+    return iter->second;
+  }
+};
+
+void ObjArgs(benchmark::internal::Benchmark* b) {
+  b->Arg(64)->Arg(256)->Arg(1024)->ArgName("grid")->Unit(
+      benchmark::kMillisecond);
+}
+
+void VtkArgs(benchmark::internal::Benchmark* b) {
+  b->Arg(8)->Arg(24)->Arg(64)->ArgName("grid")->Unit(benchmark::kMillisecond);
+}
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(MeshParsingFixture, ObjTinyObj)(benchmark::State& state) {
+  const std::string& filename = ObjFile(state.range(0));
+  int num_triangles = 0;
+  for (auto _ : state) {
+    num_triangles = ReadObjToTriangleSurfaceMesh(filename).num_triangles();
+  }
+  Report(filename, num_triangles, &state);
+}
+BENCHMARK_REGISTER_F(MeshParsingFixture, ObjTinyObj)->Apply(ObjArgs);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(MeshParsingFixture, ObjParallel)(benchmark::State& state) {
+  const std::string& filename = ObjFile(state.range(0));
+  int num_triangles = 0;
+  for (auto _ : state) {
+    num_triangles = ParseObjToTriangleSurfaceMesh(filename).num_triangles();
+  }
+  Report(filename, num_triangles, &state);
+}
+BENCHMARK_REGISTER_F(MeshParsingFixture, ObjParallel)->Apply(ObjArgs);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(MeshParsingFixture, VtkLibrary)(benchmark::State& state) {
+  const std::string& filename = VtkFile(state.range(0));
+  int num_tetrahedra = 0;
+  for (auto _ : state) {
+    num_tetrahedra = ReadVtkToVolumeMesh(filename).num_elements();
+  }
+  Report(filename, num_tetrahedra, &state);
+}
+BENCHMARK_REGISTER_F(MeshParsingFixture, VtkLibrary)->Apply(VtkArgs);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(MeshParsingFixture, VtkParallel)(benchmark::State& state) {
+  const std::string& filename = VtkFile(state.range(0));
+  int num_tetrahedra = 0;
+  for (auto _ : state) {
+    num_tetrahedra = ParseVtkToVolumeMesh(filename).num_elements();
+  }
+  Report(filename, num_tetrahedra, &state);
+}
+BENCHMARK_REGISTER_F(MeshParsingFixture, VtkParallel)->Apply(VtkArgs);
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
+
+BENCHMARK_MAIN();
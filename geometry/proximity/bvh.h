@@ -208,6 +208,14 @@ class Bvh {
 
   explicit Bvh(const MeshType& mesh);
 
+  /* Constructs a %Bvh from a tree that was previously built for the mesh (e.g.,
+   one that was written to a file and read back).
+   @pre `root_node` is not null.  */
+  explicit Bvh(std::unique_ptr<NodeType> root_node)
+      : root_node_(std::move(root_node)) {
+    DRAKE_DEMAND(root_node_ != nullptr);
+  }
+
   const NodeType& root_node() const { return *root_node_; }
 
   /* Perform a query of this %Bvh's mesh elements (measured and expressed in
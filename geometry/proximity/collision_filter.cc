@@ -16,10 +16,87 @@ CollisionFilter::CollisionFilter() {
   filter_history_.emplace_back(FilterState{}, FilterId::get_new_id());
 }
 
-// TODO(SeanCurtis-TRI): Multiple calls to Apply will lead to multiple
-//  constructions of std::unordered_set from GeometrySet (as opposed to
-//  re-using a single set). If this is a performance issue, revisit this so
-//  that I can operate on multiple filter states *per statement*.
+CollisionFilter::FilterState::FilterState(int num_slots,
+                                          PairRelationship relationship)
+    : num_slots_(num_slots) {
+  const int64_t num_cells =
+      static_cast<int64_t>(num_slots) * (num_slots - 1) / 2;
+  words_.resize((num_cells + kCellsPerWord - 1) / kCellsPerWord);
+  Fill(0, num_cells, relationship);
+}
+
+void CollisionFilter::FilterState::AddSlot(PairRelationship relationship) {
+  const int64_t begin = Cell(num_slots_, 0);
+  const int64_t end = begin + num_slots_;
+  ++num_slots_;
+  words_.resize((end + kCellsPerWord - 1) / kCellsPerWord);
+  Fill(begin, end, relationship);
+}
+
+void CollisionFilter::FilterState::ResetSlot(int slot,
+                                             PairRelationship relationship) {
+  DRAKE_DEMAND(slot < num_slots_);
+  /* The slot's own row is contiguous; its column is spread over the later
+   rows. */
+  const int64_t row = Cell(slot, 0);
+  Fill(row, row + slot, relationship);
+  for (int i = slot + 1; i < num_slots_; ++i) {
+    set(i, slot, relationship);
+  }
+}
+
+void CollisionFilter::FilterState::ForEachPair(
+    PairRelationship skip,
+    const std::function<void(int, int, PairRelationship)>& visitor) const {
+  /* A word in which every cell is `skip`. */
+  uint64_t skip_word = 0;
+  for (int k = 0; k < kCellsPerWord; ++k) {
+    skip_word |= static_cast<uint64_t>(skip) << (2 * k);
+  }
+  int64_t cell = 0;
+  for (int i = 1; i < num_slots_; ++i) {
+    for (int j = 0; j < i; ++j, ++cell) {
+      /* Skip over whole words of uninteresting cells at once; transient
+       declarations typically leave most of the table undefined. */
+      if (cell % kCellsPerWord == 0 && words_[cell / kCellsPerWord] == skip_word
+          && i - j >= kCellsPerWord) {
+        j += kCellsPerWord - 1;
+        cell += kCellsPerWord - 1;
+        continue;
+      }
+      const PairRelationship relationship = get(i, j);
+      if (relationship != skip) visitor(i, j, relationship);
+    }
+  }
+}
+
+void CollisionFilter::FilterState::Fill(int64_t begin, int64_t end,
+                                        PairRelationship relationship) {
+  if (begin >= end) return;
+  uint64_t pattern = 0;
+  for (int k = 0; k < kCellsPerWord; ++k) {
+    pattern |= static_cast<uint64_t>(relationship) << (2 * k);
+  }
+  /* Fill the partial words at either end cell by cell and the whole words in
+   between at once. */
+  int64_t cell = begin;
+  for (; cell < end && cell % kCellsPerWord != 0; ++cell) {
+    const int shift = 2 * (cell % kCellsPerWord);
+    uint64_t& word = words_[cell / kCellsPerWord];
+    word = (word & ~(uint64_t{3} << shift)) |
+           (static_cast<uint64_t>(relationship) << shift);
+  }
+  for (; cell + kCellsPerWord <= end; cell += kCellsPerWord) {
+    words_[cell / kCellsPerWord] = pattern;
+  }
+  for (; cell < end; ++cell) {
+    const int shift = 2 * (cell % kCellsPerWord);
+    uint64_t& word = words_[cell / kCellsPerWord];
+    word = (word & ~(uint64_t{3} << shift)) |
+           (static_cast<uint64_t>(relationship) << shift);
+  }
+}
+
 void CollisionFilter::Apply(const CollisionFilterDeclaration& declaration,
                             const CollisionFilter::ExtractIds& extract_ids,
                             bool is_invariant) {
@@ -28,17 +105,10 @@ void CollisionFilter::Apply(const CollisionFilterDeclaration& declaration,
         "You cannot attempt to modify the persistent collision filter "
         "configuration when there are active, transient filter declarations");
   }
-  // TODO(SeanCurtis-TRI): We're using a brute-force approach to update the
-  //  cached composite state and the persistent state. We assume it's cheaper
-  //  to "apply" the declaration twice than to apply once and copy. If this
-  //  introduces too much cost during configuration, we have a couple of options
-  //    - Find out if copying is faster.
-  //    - In the case where there is *only* persistent state, don't use the
-  //      copy as the persistent state *is* its own composite state.
-  /* Keep current configuration and persistent base in sync. */
-  Apply(declaration, extract_ids, is_invariant, &filter_state_);
+  /* Keep current configuration and persistent base in sync. Each statement's
+   geometry sets are resolved once and applied to both states. */
   Apply(declaration, extract_ids, is_invariant,
-        &filter_history_[0].filter_state);
+        {&filter_state_, &filter_history_[0].filter_state});
 }
 
 FilterId CollisionFilter::ApplyTransient(
@@ -49,25 +119,21 @@ FilterId CollisionFilter::ApplyTransient(
    a filter to be invariant. */
   const bool is_invariant = false;
 
-  /* Using the same brute-force approach as in Apply(), we need to apply the
-   declaration to our cached, composite result (filter_state_). Then we need
-   to add it to the history by:
+  /* As in Apply(), we need to apply the declaration to our cached, composite
+   result (filter_state_). We also need to add it to the history by:
 
      1. Creating a new FilterState instance (with all the registered geometry
         in final_state_).
-     2. Apply the declaration to that new state in the history. */
-  // TODO(SeanCurtis-TRI): The brute force approach introduces several costs.
-  //  In addition to the cost of converting GeometrySet --> set<GeometryId>
-  //  twice, we are instantiating a full FilterState for what might be a small
-  //  declaration and applying the declaration twice. If this cost is too high,
-  //  even for out-of-the-loop configuration, revisit how we represent the
-  //  history and maintain the composite copy.
-  Apply(declaration, extract_ids, is_invariant, &filter_state_);
+     2. Apply the declaration to that new state in the history.
+
+   The new state only depends on the registered geometry, so it can be created
+   first and the declaration applied to both states at once. The new state is a
+   single, packed allocation of N² bits. */
   filter_history_.emplace_back(
-      InitializeTransientState(filter_state_, kUndefined),
+      FilterState(filter_state_.num_slots(), kUndefined),
       FilterId::get_new_id());
   Apply(declaration, extract_ids, is_invariant,
-        &filter_history_.back().filter_state);
+        {&filter_state_, &filter_history_.back().filter_state});
   return filter_history_.back().id;
 }
 
@@ -92,20 +158,15 @@ bool CollisionFilter::RemoveDeclaration(FilterId id) {
     filter_history_.erase(it);
     filter_state_ = filter_history_[0].filter_state;
     for (size_t i = 1; i < filter_history_.size(); ++i) {
-      const FilterState& state = filter_history_[i].filter_state;
-      /* Note: If the filtered state in transient declarations was sparse, this
-       application algorithm would directly benefit. It only requires that the
-       persistent state has all of the required pairs. See the TODO in
-       AddGeometry() for more discussion. */
-      for (const auto& [source_id, source_map] : state) {
-        for (const auto& [pair_id, pair_relation] : source_map) {
-          if (pair_relation != kUndefined) {
-            if (filter_state_[source_id][pair_id] != kInvariantFilter) {
-              filter_state_[source_id][pair_id] = pair_relation;
+      /* Whole words of undefined pairs are skipped, so replaying a small
+       declaration is cheap. */
+      filter_history_[i].filter_state.ForEachPair(
+          kUndefined,
+          [this](int slot_A, int slot_B, PairRelationship pair_relation) {
+            if (filter_state_.get(slot_A, slot_B) != kInvariantFilter) {
+              filter_state_.set(slot_A, slot_B, pair_relation);
             }
-          }
-        }
-      }
+          });
     }
     return true;
   }
@@ -120,99 +181,140 @@ void CollisionFilter::Flatten() {
 }
 
 void CollisionFilter::AddGeometry(GeometryId new_id) {
+  DRAKE_DEMAND(slots_.count(new_id) == 0);
   /* Current and persistent configurations should simply add the id with
-   unfiltered status. */
-  AddGeometry(new_id, &filter_state_, kUnfiltered);
-  AddGeometry(new_id, &filter_history_[0].filter_state, kUnfiltered);
-  // TODO(SeanCurtis): Can I skip this work by allowing delta filter state to be
-  //  incomplete? If each transient delta *only* contains explicitly declared
-  //  changes, iterating through it would be faster. More complex, but faster.
-  /* Active transient history should add the id with undefined status. */
-  for (size_t i = 1; i < filter_history_.size(); ++i) {
-    AddGeometry(new_id, &filter_history_[i].filter_state, kUndefined);
+   unfiltered status; active transient history adds it with undefined status.
+   A slot freed by RemoveGeometry() is reused (and its stale cells reset)
+   before the tables are grown. */
+  int new_slot{};
+  if (!free_slots_.empty()) {
+    new_slot = free_slots_.back();
+    free_slots_.pop_back();
+    slot_ids_[new_slot] = new_id;
+    filter_state_.ResetSlot(new_slot, kUnfiltered);
+    filter_history_[0].filter_state.ResetSlot(new_slot, kUnfiltered);
+    for (size_t i = 1; i < filter_history_.size(); ++i) {
+      filter_history_[i].filter_state.ResetSlot(new_slot, kUndefined);
+    }
+  } else {
+    new_slot = static_cast<int>(slot_ids_.size());
+    slot_ids_.push_back(new_id);
+    filter_state_.AddSlot(kUnfiltered);
+    filter_history_[0].filter_state.AddSlot(kUnfiltered);
+    for (size_t i = 1; i < filter_history_.size(); ++i) {
+      filter_history_[i].filter_state.AddSlot(kUndefined);
+    }
   }
+  slots_[new_id] = new_slot;
 }
 
 void CollisionFilter::RemoveGeometry(GeometryId remove_id) {
-  /* Simply remove the geometry from everything. */
-  RemoveGeometry(remove_id, &filter_state_);
-  for (auto& delta : filter_history_) {
-    RemoveGeometry(remove_id, &delta.filter_state);
-  }
+  /* The geometry's cells are left as they are; they're reset when the slot is
+   reused. */
+  const int removed_slot = slot(remove_id);
+  slots_.erase(remove_id);
+  slot_ids_[removed_slot] = GeometryId{};
+  free_slots_.push_back(removed_slot);
 }
 
 bool CollisionFilter::CanCollideWith(GeometryId id_A, GeometryId id_B) const {
   if (id_A == id_B) return false;
-  if (id_A < id_B) {
-    return filter_state_.at(id_A).at(id_B) == kUnfiltered;
-  } else {
-    return filter_state_.at(id_B).at(id_A) == kUnfiltered;
+  return filter_state_.get(slot(id_A), slot(id_B)) == kUnfiltered;
+}
+
+int64_t CollisionFilter::table_bytes() const {
+  int64_t bytes = filter_state_.bytes();
+  for (const auto& delta : filter_history_) {
+    bytes += delta.filter_state.bytes();
   }
+  return bytes;
 }
 
 void CollisionFilter::AddFiltersBetween(
     const GeometrySet& set_A, const GeometrySet& set_B,
     const CollisionFilter::ExtractIds& extract_ids, bool is_invariant,
-    FilterState* state_out) {
-  const std::unordered_set<GeometryId> ids_A = extract_ids(set_A);
-  const std::unordered_set<GeometryId>& ids_B =
-      &set_A == &set_B ? ids_A : extract_ids(set_B);
-  for (GeometryId id_A : ids_A) {
-    for (GeometryId id_B : ids_B) {
-      AddFilteredPair(id_A, id_B, is_invariant, state_out);
-    }
-  }
+    const std::vector<FilterState*>& states_out) const {
+  ForEachPair(set_A, set_B, extract_ids,
+              [is_invariant, &states_out](int slot_A, int slot_B) {
+                for (FilterState* state_out : states_out) {
+                  AddFilteredPair(slot_A, slot_B, is_invariant, state_out);
+                }
+              });
 }
 
 void CollisionFilter::RemoveFiltersBetween(
     const GeometrySet& set_A, const GeometrySet& set_B,
-    const CollisionFilter::ExtractIds& extract_ids, FilterState* state_out) {
-  const std::unordered_set<GeometryId> ids_A = extract_ids(set_A);
-  const std::unordered_set<GeometryId>& ids_B =
-      &set_A == &set_B ? ids_A : extract_ids(set_B);
-  for (GeometryId id_A : ids_A) {
-    for (GeometryId id_B : ids_B) {
-      RemoveFilteredPair(id_A, id_B, state_out);
+    const CollisionFilter::ExtractIds& extract_ids,
+    const std::vector<FilterState*>& states_out) const {
+  ForEachPair(set_A, set_B, extract_ids,
+              [&states_out](int slot_A, int slot_B) {
+                for (FilterState* state_out : states_out) {
+                  RemoveFilteredPair(slot_A, slot_B, state_out);
+                }
+              });
+}
+
+void CollisionFilter::ForEachPair(
+    const GeometrySet& set_A, const GeometrySet& set_B,
+    const CollisionFilter::ExtractIds& extract_ids,
+    const std::function<void(int, int)>& pair_op) const {
+  /* The ids are resolved into slots once, rather than once per pair. */
+  auto to_slots = [this](const std::unordered_set<GeometryId>& ids) {
+    std::vector<int> result;
+    result.reserve(ids.size());
+    for (GeometryId id : ids) result.push_back(slot(id));
+    return result;
+  };
+  const std::vector<int> slots_A = to_slots(extract_ids(set_A));
+  if (&set_A == &set_B) {
+    /* A set paired with itself: visit each unordered pair of distinct ids
+     once, rather than both (a, b) and (b, a) and every (a, a). */
+    for (size_t i = 0; i < slots_A.size(); ++i) {
+      for (size_t j = i + 1; j < slots_A.size(); ++j) {
+        pair_op(slots_A[i], slots_A[j]);
+      }
+    }
+    return;
+  }
+  const std::vector<int> slots_B = to_slots(extract_ids(set_B));
+  for (int slot_A : slots_A) {
+    for (int slot_B : slots_B) {
+      if (slot_A != slot_B) pair_op(slot_A, slot_B);
     }
   }
 }
 
-void CollisionFilter::AddFilteredPair(GeometryId id_A, GeometryId id_B,
+void CollisionFilter::AddFilteredPair(int slot_A, int slot_B,
                                       bool is_invariant,
                                       FilterState* state_out) {
   FilterState& filter_state = *state_out;
-  DRAKE_DEMAND(filter_state.count(id_A) == 1 &&
-               filter_state.count(id_B) == 1);
-
-  if (id_A == id_B) return;
-  PairRelationship& pair_relation =
-      id_A < id_B ? filter_state[id_A][id_B] : filter_state[id_B][id_A];
-  if (pair_relation == kInvariantFilter) return;
-  pair_relation = is_invariant ? kInvariantFilter : kFiltered;
+  if (filter_state.get(slot_A, slot_B) == kInvariantFilter) return;
+  filter_state.set(slot_A, slot_B, is_invariant ? kInvariantFilter : kFiltered);
 }
 
-void CollisionFilter::RemoveFilteredPair(GeometryId id_A, GeometryId id_B,
+void CollisionFilter::RemoveFilteredPair(int slot_A, int slot_B,
                                          FilterState* state_out) {
   FilterState& filter_state = *state_out;
-  DRAKE_DEMAND(filter_state.count(id_A) == 1 &&
-               filter_state.count(id_B) == 1);
-  if (id_A == id_B) return;
-  PairRelationship& pair_relation =
-      id_A < id_B ? filter_state[id_A][id_B] : filter_state[id_B][id_A];
-  if (pair_relation == kInvariantFilter) return;
-  pair_relation = kUnfiltered;
+  if (filter_state.get(slot_A, slot_B) == kInvariantFilter) return;
+  filter_state.set(slot_A, slot_B, kUnfiltered);
 }
 
 bool CollisionFilter::operator==(const CollisionFilter& other) const {
   if (this == &other) return true;
-  if (filter_state_.size() != other.filter_state_.size()) return false;
-  for (const auto& [this_id, this_map] : filter_state_) {
-    if (!other.HasGeometry(this_id)) return false;
-    for (const auto& [this_pair_id, can_collide] : this_map) {
-      unused(can_collide);
-      if (!other.HasGeometry(this_pair_id)) return false;
-      if (CanCollideWith(this_id, this_pair_id) !=
-          other.CanCollideWith(this_id, this_pair_id)) {
+  if (slots_.size() != other.slots_.size()) return false;
+  for (const auto& [id, _] : slots_) {
+    unused(_);
+    if (!other.HasGeometry(id)) return false;
+  }
+  /* The two filters may have assigned different slots to the same geometry, so
+   we compare pair by pair. */
+  for (int i = 0; i < static_cast<int>(slot_ids_.size()); ++i) {
+    const GeometryId id_A = slot_ids_[i];
+    if (!id_A.is_valid()) continue;
+    for (int j = 0; j < i; ++j) {
+      const GeometryId id_B = slot_ids_[j];
+      if (!id_B.is_valid()) continue;
+      if (CanCollideWith(id_A, id_B) != other.CanCollideWith(id_A, id_B)) {
         return false;
       }
     }
@@ -221,9 +323,11 @@ bool CollisionFilter::operator==(const CollisionFilter& other) const {
 }
 
 CollisionFilter CollisionFilter::MakeClearCopy() const {
-  auto clear_state = CollisionFilter::InitializeTransientState(
-      filter_state_, CollisionFilter::kUnfiltered);
+  const FilterState clear_state(filter_state_.num_slots(), kUnfiltered);
   CollisionFilter new_filter;
+  new_filter.slots_ = slots_;
+  new_filter.slot_ids_ = slot_ids_;
+  new_filter.free_slots_ = free_slots_;
   new_filter.filter_state_ = clear_state;
   new_filter.filter_history_[0].filter_state = clear_state;
   return new_filter;
@@ -231,7 +335,9 @@ CollisionFilter CollisionFilter::MakeClearCopy() const {
 
 void CollisionFilter::Apply(const CollisionFilterDeclaration& declaration,
                             const CollisionFilter::ExtractIds& extract_ids,
-                            bool is_invariant, FilterState* filter_state) {
+                            bool is_invariant,
+                            const std::vector<FilterState*>& filter_states)
+    const {
   using Operation = CollisionFilterDeclaration::StatementOp;
   for (const auto& statement : declaration.statements()) {
     switch (statement.operation) {
@@ -240,72 +346,25 @@ void CollisionFilter::Apply(const CollisionFilterDeclaration& declaration,
         // while removing collision filters.
         DRAKE_DEMAND(!is_invariant);
         RemoveFiltersBetween(statement.set_A, statement.set_B, extract_ids,
-                             filter_state);
+                             filter_states);
         break;
       case Operation::kAllowWithin:
         DRAKE_DEMAND(!is_invariant);
         RemoveFiltersBetween(statement.set_A, statement.set_A, extract_ids,
-                             filter_state);
+                             filter_states);
         break;
       case Operation::kExcludeWithin:
         AddFiltersBetween(statement.set_A, statement.set_A, extract_ids,
-                          is_invariant, filter_state);
+                          is_invariant, filter_states);
         break;
       case Operation::kExcludeBetween:
         AddFiltersBetween(statement.set_A, statement.set_B, extract_ids,
-                          is_invariant, filter_state);
+                          is_invariant, filter_states);
         break;
     }
   }
 }
 
-void CollisionFilter::AddGeometry(GeometryId new_id,
-                                  FilterState* filter_state_out,
-                                  PairRelationship relationship) {
-  FilterState& filter_state = *filter_state_out;
-  DRAKE_DEMAND(filter_state.count(new_id) == 0);
-  GeometryMap& new_map = filter_state[new_id] = {};
-  for (auto& [other_id, other_map] : filter_state) {
-    /* Whichever id is *smaller* tracks the relationship with the other.
-     That relationship defaults to unfiltered (i.e., "can collide").
-
-     Note: we're iterating over filter_state_ and assigning to either new_map
-     or other_map. This doesn't invalidate the implicit iterator of the range
-     operator. We never change the *keys* of filter_state_ in this loop, only
-     its values. And we don't do any iteration in the new_map or other_map
-     so don't depend on their iterators. */
-    if (other_id < new_id) {
-      other_map[new_id] = relationship;
-    } else {
-      new_map[other_id] = relationship;
-    }
-  }
-}
-
-void CollisionFilter::RemoveGeometry(GeometryId remove_id,
-                                     FilterState* filter_state_out) {
-  FilterState& filter_state = *filter_state_out;
-  DRAKE_DEMAND(filter_state.count(remove_id) == 1);
-  filter_state.erase(remove_id);
-  for (auto& [other_id, other_map] : filter_state) {
-    /* remove_id will only be found in maps belonging to geometries with ids
-     that are smaller than remove_id. Those that are larger were deleted when we
-     removed remove_id's entry. */
-    if (other_id < remove_id) {
-      other_map.erase(remove_id);
-    }
-  }
-}
-
-CollisionFilter::FilterState CollisionFilter::InitializeTransientState(
-    const FilterState& reference, PairRelationship default_relationship) {
-  FilterState new_state;
-  for (const auto& [id, _] : reference) {
-    unused(_);
-    AddGeometry(id, &new_state, default_relationship);
-  }
-  return new_state;
-}
 }  // namespace internal
 }  // namespace geometry
 }  // namespace drake
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "drake/common/drake_assert.h"
 #include "drake/geometry/collision_filter_declaration.h"
 #include "drake/geometry/geometry_ids.h"
 
@@ -126,7 +128,11 @@ class CollisionFilter {
   }
 
   /* Reports if the given `id` has been added to this filter system. */
-  bool HasGeometry(GeometryId id) const { return filter_state_.count(id) > 0; }
+  bool HasGeometry(GeometryId id) const { return slots_.count(id) > 0; }
+
+  /* Reports the number of bytes used by the tables of pair relationships (the
+   current configuration and the history), for benchmarking. */
+  int64_t table_bytes() const;
 
  private:
   friend class CollisionFilterTest;
@@ -135,58 +141,104 @@ class CollisionFilter {
    of the registered geometry but no collision filters. */
   CollisionFilter MakeClearCopy() const;
 
-  /* The collision filter state between a pair of geometries. */
+  /* The collision filter state between a pair of geometries. The values are
+   chosen so that a table of unfiltered pairs is all zeros, and a table of
+   undefined pairs is all ones. */
   enum PairRelationship {
-    kUndefined,        // No relationship has been defined; used for transient
-                       // declarations.
-    kUnfiltered,       // No filter has been declared.
-    kFiltered,         // A user-declared filter exists, the user can remove it.
-    kInvariantFilter,  // The filter supports a SceneGraph filter invariant and
-                       // cannot be removed by the user.
+    kUnfiltered = 0,       // No filter has been declared.
+    kFiltered = 1,         // A user-declared filter exists, the user can remove
+                           // it.
+    kInvariantFilter = 2,  // The filter supports a SceneGraph filter invariant
+                           // and cannot be removed by the user.
+    kUndefined = 3,        // No relationship has been defined; used for
+                           // transient declarations.
   };
 
   /* The "filter state" is a 2d table. For N registered geometries, it is
    an NxN table where cell (i, j) reports the filter status of the ith and jth
-   geometries (although i and j are actually GeometryIds).
+   geometries. Each registered geometry is assigned a *slot* i (see slots_),
+   and the table is indexed by slots rather than GeometryIds, so that a lookup
+   is a bit of arithmetic instead of hashing.
 
    Because a pair's filter status is symmetric (e.g., (a, b) and (b, a) are
-   equivalent), we only encode a triangular portion of the table. We have two
-   types that work together to define the table: GeometryMap and FilterState.
-
-   FilterState maps a GeometryId to the filter relationship with all other
-   registered geometries with *greater* GeometryId values. That set of
-   geometries is contained in a GeometryMap, where each entry on that "row"
-   is the key-value pair (other_id, filter_pair_state).
-
-   So, given a FilterState instance (filter_state) and two GeometryIds, a and b,
-   we could set the filtered state as (assuming a < b):
-
-      filter_state[a][b] = kFiltered;
-
-   As a concrete example, if we've registered GeometryId values 10, 20, 30, 40,
-   the filter state would have keys {10, 20, 30, 40} which each maps to a
-   corresponding GeometryMap as illustrated below.
-     10 -> {(20, PairRelationship), (30, PairRelationship),
-            (40, PairRelationship)}
-     20 -> {(30, PairRelationship), (40, PairRelationship)}
-     30 -> {(40, PairRelationship)}
-     40 -> {} */
-  using GeometryMap = std::unordered_map<GeometryId, PairRelationship>;
-
-  using FilterState = std::unordered_map<GeometryId, GeometryMap>;
-
-  /* Applies the given declaration to an arbitrary `filter_state`. */
-  static void Apply(const CollisionFilterDeclaration& declaration,
-                    const ExtractIds& extract_ids, bool is_invariant,
-                    FilterState* filter_state);
-
-  /* Adds the geometry with the given `id` to the given filter state with the
-   given initial_state for all pairs including the new id. */
-  static void AddGeometry(GeometryId id, FilterState* filter_state_out,
-                          PairRelationship relationship);
+   equivalent), we only encode the strictly lower triangular portion of the
+   table, row by row, with two bits per cell:
+
+          0   1   2   3
+      0   -
+      1   0   -
+      2   1   2   -
+      3   3   4   5   -
+
+   Cell (i, j), j < i, is at position i * (i - 1) / 2 + j. Adding a geometry
+   in a new slot appends a row, so existing cells never move; the table
+   occupies N² bits (12.5 MB for 10k geometries) in a single contiguous
+   allocation, which also makes copying it cheap. */
+  class FilterState {
+   public:
+    FilterState() = default;
+
+    /* Constructs a table for `num_slots` slots in which every pair has the
+     given relationship. */
+    FilterState(int num_slots, PairRelationship relationship);
+
+    int num_slots() const { return num_slots_; }
+
+    /* Reports the relationship between the geometries in slots i and j.
+     @pre i != j and both are less than num_slots(). */
+    PairRelationship get(int i, int j) const {
+      const int64_t cell = Cell(i, j);
+      return static_cast<PairRelationship>(
+          (words_[cell / kCellsPerWord] >> (2 * (cell % kCellsPerWord))) & 3);
+    }
+
+    /* Sets the relationship between the geometries in slots i and j.
+     @pre i != j and both are less than num_slots(). */
+    void set(int i, int j, PairRelationship relationship) {
+      const int64_t cell = Cell(i, j);
+      const int shift = 2 * (cell % kCellsPerWord);
+      uint64_t& word = words_[cell / kCellsPerWord];
+      word = (word & ~(uint64_t{3} << shift)) |
+             (static_cast<uint64_t>(relationship) << shift);
+    }
+
+    /* Adds a new slot (numbered num_slots()) with the given relationship to
+     all other slots. */
+    void AddSlot(PairRelationship relationship);
+
+    /* Sets the relationship of the given slot with all other slots. */
+    void ResetSlot(int slot, PairRelationship relationship);
+
+    /* Invokes `visitor(i, j, relationship)` for each pair of slots j < i
+     whose relationship isn't `skip`. */
+    void ForEachPair(
+        PairRelationship skip,
+        const std::function<void(int, int, PairRelationship)>& visitor) const;
+
+    int64_t bytes() const {
+      return static_cast<int64_t>(words_.size() * sizeof(uint64_t));
+    }
+
+   private:
+    static constexpr int kCellsPerWord = 32;
+
+    static int64_t Cell(int i, int j) {
+      if (i < j) std::swap(i, j);
+      return static_cast<int64_t>(i) * (i - 1) / 2 + j;
+    }
+
+    /* Sets the cells in [begin, end) to the given relationship. */
+    void Fill(int64_t begin, int64_t end, PairRelationship relationship);
+
+    int num_slots_{0};
+    std::vector<uint64_t> words_;
+  };
 
-  /* Removes the geometry with the given `id` from the given filter state. */
-  static void RemoveGeometry(GeometryId id, FilterState* filter_state_out);
+  /* Applies the given declaration to each of the arbitrary `filter_states`.
+   Each statement's geometry sets are resolved into slots only once. */
+  void Apply(const CollisionFilterDeclaration& declaration,
+             const ExtractIds& extract_ids, bool is_invariant,
+             const std::vector<FilterState*>& filter_states) const;
 
   /* Declares pairs (`id_A`, `id_B`) `∀ id_A ∈ set_A, id_B ∈ set_B` to be
    filtered. For each pair, if they are already filtered, no discernible change
@@ -198,34 +250,59 @@ class CollisionFilter {
    or pairs of anchored geometries are likewise filtered. GeometryState is
    responsible for determining invariance when adding filters.
 
+   The filters are added to each of the `states_out`.
+
    @pre All ids in `id_A` and `id_B` are part of this filter system.  */
-  static void AddFiltersBetween(const GeometrySet& set_A,
-                                const GeometrySet& set_B,
-                                const ExtractIds& extract_ids,
-                                bool is_invariant, FilterState* state_out);
+  void AddFiltersBetween(const GeometrySet& set_A, const GeometrySet& set_B,
+                         const ExtractIds& extract_ids, bool is_invariant,
+                         const std::vector<FilterState*>& states_out) const;
 
   /* Declares pairs (`id_A`, `id_B`) `∀ id_A ∈ set_A, id_B ∈ set_B` to be
    unfiltered (if the filter isn't invariant). For each pair, if they are
    already unfiltered, no discernible change is made.
 
+   The filters are removed from each of the `states_out`.
+
+   @pre All ids `id_A` and `id_B` are part of the system.  */
+  void RemoveFiltersBetween(const GeometrySet& set_A, const GeometrySet& set_B,
+                            const ExtractIds& extract_ids,
+                            const std::vector<FilterState*>& states_out) const;
+
+  /* Calls `pair_op` with the slots of each pair (`id_A`, `id_B`)
+   `∀ id_A ∈ set_A, id_B ∈ set_B` with `id_A ≠ id_B`. When `set_A` and `set_B`
+   are the same object, each unordered pair is visited only once.
+
    @pre All ids `id_A` and `id_B` are part of the system.  */
-  static void RemoveFiltersBetween(const GeometrySet& set_A,
-                                   const GeometrySet& set_B,
-                                   const ExtractIds& extract_ids,
-                                   FilterState* state_out);
+  void ForEachPair(const GeometrySet& set_A, const GeometrySet& set_B,
+                   const ExtractIds& extract_ids,
+                   const std::function<void(int, int)>& pair_op) const;
 
   /* Atomic operation in support of AddFiltersBetween().  */
-  static void AddFilteredPair(GeometryId id_A, GeometryId id_B,
-                              bool is_invariant, FilterState* state_out);
+  static void AddFilteredPair(int slot_A, int slot_B, bool is_invariant,
+                              FilterState* state_out);
 
   /* Atomic operation in support of RemoveFilterBetween().  */
-  static void RemoveFilteredPair(GeometryId id_A, GeometryId id_B,
+  static void RemoveFilteredPair(int slot_A, int slot_B,
                                  FilterState* state_out);
 
-  /* Instantiates a FilterState such that all known pairs have given
-   default relationship. */
-  static FilterState InitializeTransientState(
-      const FilterState& reference, PairRelationship default_relationship);
+  /* Returns the slot of the given geometry.
+   @pre `id` is part of this filter system. */
+  int slot(GeometryId id) const {
+    const auto iter = slots_.find(id);
+    DRAKE_DEMAND(iter != slots_.end());
+    return iter->second;
+  }
+
+  /* The slot assigned to each registered geometry. */
+  std::unordered_map<GeometryId, int> slots_;
+
+  /* The geometry in each slot; the ids of unused slots are invalid. */
+  std::vector<GeometryId> slot_ids_;
+
+  /* The slots freed by RemoveGeometry(), to be reused by AddGeometry(). The
+   cells of unused slots have arbitrary values; they are reset when the slot
+   is reused. */
+  std::vector<int> free_slots_;
 
   /* The filter state of all pairs of geometry.
 
@@ -253,6 +330,7 @@ class CollisionFilter {
     FilterState filter_state;
     FilterId id{};
   };
+
   std::vector<StateDelta> filter_history_;
 };
 
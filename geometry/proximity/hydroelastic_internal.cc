@@ -1,11 +1,18 @@
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 
 #include <algorithm>
+#include <exception>
 #include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 
 #include <fmt/format.h>
 
+#include "drake/common/hash.h"
+#include "drake/common/text_logging.h"
 #include "drake/geometry/proximity/make_box_field.h"
 #include "drake/geometry/proximity/make_box_mesh.h"
 #include "drake/geometry/proximity/make_capsule_field.h"
@@ -20,9 +27,13 @@
 #include "drake/geometry/proximity/make_mesh_from_vtk.h"
 #include "drake/geometry/proximity/make_sphere_field.h"
 #include "drake/geometry/proximity/make_sphere_mesh.h"
+#include "drake/geometry/proximity/mesh_cache.h"
 #include "drake/geometry/proximity/obj_to_surface_mesh.h"
+#include "drake/geometry/proximity/parallel_mesh_parsers.h"
+#include "drake/geometry/proximity/precompiled_hydroelastic.h"
 #include "drake/geometry/proximity/tessellation_strategy.h"
 #include "drake/geometry/proximity/volume_to_surface_mesh.h"
+#include "drake/geometry/shape_to_string.h"
 
 namespace drake {
 namespace geometry {
@@ -102,6 +113,8 @@ void Geometries::ImplementGeometry(const Convex& convex, void* user_data) {
 
 template <typename ShapeType>
 void Geometries::MakeShape(const ShapeType& shape, const ReifyData& data) {
+  if (MaybeAddPrecompiledGeometry(shape, data)) return;
+
   switch (data.type) {
     case HydroelasticType::kRigid: {
       auto hydro_geometry = MakeRigidRepresentation(shape, data.properties);
@@ -117,6 +130,42 @@ void Geometries::MakeShape(const ShapeType& shape, const ReifyData& data) {
   }
 }
 
+bool Geometries::MaybeAddPrecompiledGeometry(const Shape& shape,
+                                             const ReifyData& data) {
+  const std::string directory = data.properties.GetPropertyOrDefault(
+      kHydroGroup, kPrecompiledDir, std::string());
+  if (directory.empty()) return false;
+  const std::optional<std::string> key =
+      MakePrecompiledKey(shape, data.type, data.properties);
+  if (!key.has_value()) return false;
+  const std::string filename = GetPrecompiledFilename(directory, *key);
+
+  // A damaged file must not prevent the geometry from being loaded; it merely
+  // loses the benefit of having been precompiled.
+  try {
+    if (data.type == HydroelasticType::kSoft) {
+      std::optional<PrecompiledSoftMesh> soft =
+          ReadPrecompiledSoftMesh(filename, *key);
+      if (!soft.has_value()) return false;
+      AddGeometry(data.id, SoftGeometry(SoftMesh(move(soft->mesh),
+                                                 move(soft->pressure),
+                                                 move(soft->bvh))));
+    } else {
+      std::optional<PrecompiledRigidMesh> rigid =
+          ReadPrecompiledRigidMesh(filename, *key);
+      if (!rigid.has_value()) return false;
+      AddGeometry(data.id, RigidGeometry(RigidMesh(move(rigid->mesh),
+                                                   move(rigid->bvh))));
+    }
+  } catch (const std::exception& e) {
+    log()->warn("Ignoring the precompiled hydroelastic representation of {}: "
+                "{}. It will be computed instead.", ShapeName(shape).name(),
+                e.what());
+    return false;
+  }
+  return true;
+}
+
 void Geometries::AddGeometry(GeometryId id, SoftGeometry geometry) {
   DRAKE_DEMAND(hydroelastic_type(id) == HydroelasticType::kUndefined);
   supported_geometries_[id] = HydroelasticType::kSoft;
@@ -192,6 +241,57 @@ class PositiveDouble : public Validator<double> {
   }
 };
 
+namespace {
+
+/* The rigid and soft representations of meshes read from files are computed
+ once per file content and scale (and hydroelastic modulus, for soft meshes) and
+ shared via the MeshCache. Each geometry gets its own copy of the cached
+ representation; copying the mesh, pressure field, and BVH is much cheaper than
+ reading the file and computing them anew. */
+
+RigidMesh MakeRigidMeshFromObj(const std::string& filename, double scale) {
+  return *MeshCache::GetInstance().GetOrCompute<RigidMesh>(
+      filename, scale, "rigid_obj", [&filename, scale]() {
+        // Files that the parallel parser can't parse are left to
+        // tinyobjloader.
+        std::optional<TriangleSurfaceMesh<double>> mesh =
+            MaybeParseObjToTriangleSurfaceMesh(filename, scale);
+        return RigidMesh(make_unique<TriangleSurfaceMesh<double>>(
+            mesh.has_value() ? std::move(*mesh)
+                             : ReadObjToTriangleSurfaceMesh(filename, scale)));
+      });
+}
+
+RigidMesh MakeRigidMeshFromVtk(const Mesh& mesh_spec) {
+  return *MeshCache::GetInstance().GetOrCompute<RigidMesh>(
+      mesh_spec.filename(), mesh_spec.scale(), "rigid_vtk", [&mesh_spec]() {
+        return RigidMesh(make_unique<TriangleSurfaceMesh<double>>(
+            ConvertVolumeToSurfaceMesh(
+                MakeVolumeMeshFromVtk<double>(mesh_spec))));
+      });
+}
+
+/* Returns the soft mesh for the volume mesh produced by `make_mesh` with the
+ pressure field produced by `make_pressure` for the given modulus. The `tag`
+ distinguishes the kinds of shapes that can be made from the same file. */
+SoftMesh MakeSoftMeshFromFile(
+    const std::string& filename, double scale, const std::string& tag,
+    double hydroelastic_modulus,
+    const std::function<VolumeMesh<double>()>& make_mesh,
+    const std::function<VolumeMeshFieldLinear<double, double>(
+        const VolumeMesh<double>*, double)>& make_pressure) {
+  return *MeshCache::GetInstance().GetOrCompute<SoftMesh>(
+      filename, scale, fmt::format("{}:{}", tag, hydroelastic_modulus),
+      [&]() {
+        auto mesh = make_unique<VolumeMesh<double>>(make_mesh());
+        auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+            make_pressure(mesh.get(), hydroelastic_modulus));
+        return SoftMesh(move(mesh), move(pressure));
+      });
+}
+
+}  // namespace
+
 std::optional<RigidGeometry> MakeRigidRepresentation(
     const HalfSpace& hs, const ProximityProperties&) {
   return RigidGeometry(hs);
@@ -252,36 +352,28 @@ std::optional<RigidGeometry> MakeRigidRepresentation(
 std::optional<RigidGeometry> MakeRigidRepresentation(
     const Mesh& mesh_spec, const ProximityProperties&) {
   // Mesh does not use any properties.
-  std::unique_ptr<TriangleSurfaceMesh<double>> mesh;
-
   std::string extension =
       std::filesystem::path(mesh_spec.filename()).extension();
   std::transform(extension.begin(), extension.end(), extension.begin(),
                  [](unsigned char c) { return std::tolower(c); });
 
   if (extension == ".obj") {
-    mesh = make_unique<TriangleSurfaceMesh<double>>(
-        ReadObjToTriangleSurfaceMesh(mesh_spec.filename(), mesh_spec.scale()));
+    return RigidGeometry(
+        MakeRigidMeshFromObj(mesh_spec.filename(), mesh_spec.scale()));
   } else if (extension == ".vtk") {
-    mesh = make_unique<TriangleSurfaceMesh<double>>(
-        ConvertVolumeToSurfaceMesh(MakeVolumeMeshFromVtk<double>(mesh_spec)));
+    return RigidGeometry(MakeRigidMeshFromVtk(mesh_spec));
   } else {
     throw(std::runtime_error(fmt::format(
         "hydroelastic::MakeRigidRepresentation(): unsupported mesh file: {}",
         mesh_spec.filename())));
   }
-
-  return RigidGeometry(RigidMesh(move(mesh)));
 }
 
 std::optional<RigidGeometry> MakeRigidRepresentation(
     const Convex& convex_spec, const ProximityProperties&) {
   // Convex does not use any properties.
-  auto mesh =
-      make_unique<TriangleSurfaceMesh<double>>(ReadObjToTriangleSurfaceMesh(
-          convex_spec.filename(), convex_spec.scale()));
-
-  return RigidGeometry(RigidMesh(move(mesh)));
+  return RigidGeometry(
+      MakeRigidMeshFromObj(convex_spec.filename(), convex_spec.scale()));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -393,34 +485,123 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
     const Convex& convex_spec, const ProximityProperties& props) {
   PositiveDouble validator("Convex", "soft");
 
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeConvexVolumeMesh<double>(convex_spec));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeConvexPressureField(mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(move(mesh), move(pressure)));
+  return SoftGeometry(MakeSoftMeshFromFile(
+      convex_spec.filename(), convex_spec.scale(), "soft_convex",
+      hydroelastic_modulus,
+      [&convex_spec]() { return MakeConvexVolumeMesh<double>(convex_spec); },
+      &MakeConvexPressureField<double>));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
     const Mesh& mesh_specification, const ProximityProperties& props) {
   PositiveDouble validator("Mesh", "soft");
 
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeVolumeMeshFromVtk<double>(mesh_specification));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeVolumeMeshPressureField(mesh.get(), hydroelastic_modulus));
+  return SoftGeometry(MakeSoftMeshFromFile(
+      mesh_specification.filename(), mesh_specification.scale(), "soft_vtk",
+      hydroelastic_modulus,
+      [&mesh_specification]() {
+        return MakeVolumeMeshFromVtk<double>(mesh_specification);
+      },
+      &MakeVolumeMeshPressureField<double>));
+}
 
-  return SoftGeometry(SoftMesh(move(mesh), move(pressure)));
+std::optional<std::string> MakePrecompiledKey(
+    const Shape& shape, HydroelasticType type,
+    const ProximityProperties& props) {
+  if (dynamic_cast<const HalfSpace*>(&shape) != nullptr) return std::nullopt;
+
+  // Files are identified by their contents, not their names.
+  std::string shape_string;
+  const Mesh* mesh = dynamic_cast<const Mesh*>(&shape);
+  const Convex* convex = dynamic_cast<const Convex*>(&shape);
+  if (mesh != nullptr || convex != nullptr) {
+    const std::string& filename =
+        mesh != nullptr ? mesh->filename() : convex->filename();
+    const double scale = mesh != nullptr ? mesh->scale() : convex->scale();
+    // The digest is remembered by the mesh cache, so loading a model again
+    // doesn't rehash its mesh files.
+    const std::optional<FileContentDigest> digest =
+        MeshCache::GetInstance().GetFileDigest(filename);
+    if (!digest.has_value()) return std::nullopt;
+    shape_string = fmt::format("{}(s: {}, content: {:016x}-{})",
+                               ShapeName(shape).name(), scale, digest->first,
+                               digest->second);
+  } else {
+    ShapeToString reifier;
+    shape.Reify(&reifier);
+    shape_string = reifier.string();
+  }
+
+  std::string key;
+  switch (type) {
+    case HydroelasticType::kRigid:
+      key = fmt::format("rigid {}", shape_string);
+      break;
+    case HydroelasticType::kSoft: {
+      if (!props.HasProperty(kHydroGroup, kElastic)) return std::nullopt;
+      key = fmt::format("soft {} {}: {}", shape_string, kElastic,
+                        props.GetProperty<double>(kHydroGroup, kElastic));
+      break;
+    }
+    case HydroelasticType::kUndefined:
+      return std::nullopt;
+  }
+  if (props.HasProperty(kHydroGroup, kRezHint)) {
+    key += fmt::format(" {}: {}", kRezHint,
+                       props.GetProperty<double>(kHydroGroup, kRezHint));
+  }
+  if (props.HasProperty(kHydroGroup, "tessellation_strategy")) {
+    key += fmt::format(" tessellation_strategy: {}",
+                       static_cast<int>(props.GetProperty<TessellationStrategy>(
+                           kHydroGroup, "tessellation_strategy")));
+  }
+  return key;
+}
+
+std::string GetPrecompiledFilename(const std::string& directory,
+                                   const std::string& key) {
+  drake::internal::FNV1aHasher hasher;
+  hasher(key.data(), key.size());
+  return fmt::format("{}/{:016x}.hydro", directory,
+                     static_cast<size_t>(hasher));
 }
 
+std::optional<std::string> WritePrecompiledRepresentation(
+    const Shape& shape, const ProximityProperties& props,
+    const std::string& directory) {
+  const HydroelasticType type = props.GetPropertyOrDefault(
+      kHydroGroup, kComplianceType, HydroelasticType::kUndefined);
+  const std::optional<std::string> key = MakePrecompiledKey(shape, type, props);
+  if (!key.has_value()) return std::nullopt;
+
+  Geometries geometries;
+  const GeometryId id = GeometryId::get_new_id();
+  geometries.MaybeAddGeometry(shape, id, props);
+  const std::string filename = GetPrecompiledFilename(directory, *key);
+  switch (geometries.hydroelastic_type(id)) {
+    case HydroelasticType::kSoft: {
+      const SoftGeometry& soft = geometries.soft_geometry(id);
+      WritePrecompiledSoftMesh(filename, *key, soft.mesh(),
+                               soft.pressure_field(), soft.bvh());
+      return filename;
+    }
+    case HydroelasticType::kRigid: {
+      const RigidGeometry& rigid = geometries.rigid_geometry(id);
+      WritePrecompiledRigidMesh(filename, *key, rigid.mesh(), rigid.bvh());
+      return filename;
+    }
+    case HydroelasticType::kUndefined:
+      // The shape is not supported.
+      break;
+  }
+  return std::nullopt;
+}
 
 }  // namespace hydroelastic
 }  // namespace internal
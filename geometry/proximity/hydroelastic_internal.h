@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <optional>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <variant>
@@ -40,6 +41,19 @@ class SoftMesh {
     DRAKE_ASSERT(mesh_.get() == &pressure_->mesh());
   }
 
+  /* Constructs a soft mesh with a previously built bounding volume hierarchy
+   (e.g., one read from a precompiled file).
+   @pre `pressure` and `bvh` were built for `mesh`. */
+  SoftMesh(std::unique_ptr<VolumeMesh<double>> mesh,
+           std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure,
+           std::unique_ptr<Bvh<Obb, VolumeMesh<double>>> bvh)
+      : mesh_(std::move(mesh)),
+        pressure_(std::move(pressure)),
+        bvh_(std::move(bvh)) {
+    DRAKE_DEMAND(bvh_ != nullptr);
+    DRAKE_ASSERT(mesh_.get() == &pressure_->mesh());
+  }
+
   SoftMesh(const SoftMesh& s) { *this = s; }
   SoftMesh& operator=(const SoftMesh& s);
   SoftMesh(SoftMesh&&) = default;
@@ -187,6 +201,15 @@ class RigidMesh {
         bvh_(std::make_unique<Bvh<Obb, TriangleSurfaceMesh<double>>>(
             *mesh_)) {}
 
+  /* Constructs a rigid mesh with a previously built bounding volume hierarchy
+   (e.g., one read from a precompiled file).
+   @pre `bvh` was built for `mesh`. */
+  RigidMesh(std::unique_ptr<TriangleSurfaceMesh<double>> mesh,
+            std::unique_ptr<Bvh<Obb, TriangleSurfaceMesh<double>>> bvh)
+      : mesh_(std::move(mesh)), bvh_(std::move(bvh)) {
+    DRAKE_DEMAND(mesh_ != nullptr && bvh_ != nullptr);
+  }
+
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RigidMesh)
 
   const TriangleSurfaceMesh<double>& mesh() const {
@@ -347,6 +370,12 @@ class Geometries final : public ShapeReifier {
   template <typename ShapeType>
   void MakeShape(const ShapeType& shape, const ReifyData& data);
 
+  // Adds the representation of the given shape from the directory of
+  // precompiled representations named by its properties, if there is one that
+  // holds it. Returns true if the representation was added; returns false
+  // (logging a warning) if the file exists but can't be read.
+  bool MaybeAddPrecompiledGeometry(const Shape& shape, const ReifyData& data);
+
   // Adds a representation of the soft geometry with the given `id`.
   // @pre there is no previous representation associated with `id`.
   void AddGeometry(GeometryId id, SoftGeometry field);
@@ -491,6 +520,47 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
 
 //@}
 
+/* @name Precompiled hydroelastic representations
+
+ Hydroelastic representations can be computed ahead of time (e.g., with the
+ //manipulation/util:precompile_hydroelastic tool) and stored in a directory.
+ If a geometry's ('hydroelastic', 'precompiled_dir') property names such a
+ directory, Geometries::MaybeAddGeometry() reads the geometry's representation
+ from that directory instead of computing it, whenever the directory holds a
+ file for the geometry's key. Otherwise, or if the file can't be read (e.g.,
+ it is truncated), the representation is computed as usual; unreadable files
+ are reported with a warning. See precompiled_hydroelastic.h for the file
+ format. The property can also be set from model files, with the
+ <drake:precompiled_dir> tag of <drake:proximity_properties>. */
+//@{
+
+/* Returns the key that identifies the hydroelastic representation of `shape`
+ of the given `type` with the given properties. The key is made up of the
+ shape's parameters, a digest of the contents of its file (for Mesh and Convex)
+ and the values of the properties that determine the representation (the
+ resolution hint, the hydroelastic modulus and the tessellation strategy).
+ Returns nullopt if the representation can't be precompiled: for half spaces,
+ for soft shapes without a hydroelastic modulus, and for files that can't be
+ read.  */
+std::optional<std::string> MakePrecompiledKey(
+    const Shape& shape, HydroelasticType type,
+    const ProximityProperties& props);
+
+/* Returns the name of the file in `directory` for the given `key`.  */
+std::string GetPrecompiledFilename(const std::string& directory,
+                                   const std::string& key);
+
+/* Computes the hydroelastic representation of `shape` requested by `props`
+ and writes it to `directory`. Returns the name of the written file, or nullopt
+ if the representation can't be precompiled (see MakePrecompiledKey()).
+ @throws std::exception if the properties are malformed or the file can't be
+         written.  */
+std::optional<std::string> WritePrecompiledRepresentation(
+    const Shape& shape, const ProximityProperties& props,
+    const std::string& directory);
+
+//@}
+
 }  // namespace hydroelastic
 }  // namespace internal
 }  // namespace geometry
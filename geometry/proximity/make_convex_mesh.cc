@@ -1,12 +1,16 @@
 #include "drake/geometry/proximity/make_convex_mesh.h"
 
 #include <cmath>
+#include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/eigen_types.h"
+#include "drake/geometry/proximity/mesh_cache.h"
 #include "drake/geometry/proximity/obj_to_surface_mesh.h"
+#include "drake/geometry/proximity/parallel_mesh_parsers.h"
 #include "drake/geometry/proximity/triangle_surface_mesh.h"
 
 namespace drake {
@@ -55,8 +59,22 @@ Vector3d CalcCentroidOfEnclosedVolume(
 
 template <typename T>
 VolumeMesh<T> MakeConvexVolumeMesh(const Convex& convex) {
-  const TriangleSurfaceMesh<double> surface_mesh =
-      ReadObjToTriangleSurfaceMesh(convex.filename(), convex.scale());
+  // The parsed surface mesh is shared with every other Convex (or rigid
+  // hydroelastic mesh) that refers to the same file content and scale.
+  const std::shared_ptr<const TriangleSurfaceMesh<double>> shared_surface_mesh =
+      MeshCache::GetInstance().GetOrCompute<TriangleSurfaceMesh<double>>(
+          convex.filename(), convex.scale(), "obj", [&convex]() {
+            // Files that the parallel parser can't parse are left to
+            // tinyobjloader.
+            std::optional<TriangleSurfaceMesh<double>> mesh =
+                MaybeParseObjToTriangleSurfaceMesh(convex.filename(),
+                                                   convex.scale());
+            return mesh.has_value()
+                       ? std::move(*mesh)
+                       : ReadObjToTriangleSurfaceMesh(convex.filename(),
+                                                      convex.scale());
+          });
+  const TriangleSurfaceMesh<double>& surface_mesh = *shared_surface_mesh;
 
   std::vector<Vector3<T>> volume_mesh_vertices(surface_mesh.vertices().begin(),
                                                surface_mesh.vertices().end());
@@ -1,22 +1,33 @@
 #include "drake/geometry/proximity/make_mesh_from_vtk.h"
 
+#include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/eigen_types.h"
+#include "drake/geometry/proximity/mesh_cache.h"
+#include "drake/geometry/proximity/parallel_mesh_parsers.h"
 #include "drake/geometry/proximity/vtk_to_volume_mesh.h"
 
 namespace drake {
 namespace geometry {
 namespace internal {
 
-template <typename T>
-VolumeMesh<T> MakeVolumeMeshFromVtk(const Mesh& mesh_spec) {
-  const std::string& vtk_file_name = mesh_spec.filename();
+namespace {
+
+/* Reads the volume mesh from the file and confirms that its tetrahedra have
+ positive volume. Files that the parallel parser can't parse (e.g., outside
+ the subset of the format that it supports) are read with the VTK library. */
+VolumeMesh<double> ReadAndValidateVtk(const std::string& vtk_file_name,
+                                      double scale) {
+  std::optional<VolumeMesh<double>> parsed_mesh =
+      MaybeParseVtkToVolumeMesh(vtk_file_name, scale);
   VolumeMesh<double> read_mesh =
-      ReadVtkToVolumeMesh(vtk_file_name, mesh_spec.scale());
+      parsed_mesh.has_value() ? std::move(*parsed_mesh)
+                              : ReadVtkToVolumeMesh(vtk_file_name, scale);
 
   for (int e = 0; e < read_mesh.num_elements(); ++e) {
     if (read_mesh.CalcTetrahedronVolume(e) <= 0.) {
@@ -29,6 +40,22 @@ VolumeMesh<T> MakeVolumeMeshFromVtk(const Mesh& mesh_spec) {
           read_mesh.element(e).vertex(2), read_mesh.element(e).vertex(3)));
     }
   }
+  return read_mesh;
+}
+
+}  // namespace
+
+template <typename T>
+VolumeMesh<T> MakeVolumeMeshFromVtk(const Mesh& mesh_spec) {
+  const std::string& vtk_file_name = mesh_spec.filename();
+  const double scale = mesh_spec.scale();
+  // Each file content and scale is read and validated once per process.
+  const std::shared_ptr<const VolumeMesh<double>> shared_mesh =
+      MeshCache::GetInstance().GetOrCompute<VolumeMesh<double>>(
+          vtk_file_name, scale, "vtk", [&vtk_file_name, scale]() {
+            return ReadAndValidateVtk(vtk_file_name, scale);
+          });
+  const VolumeMesh<double>& read_mesh = *shared_mesh;
 
   if constexpr (std::is_same_v<T, double>) {
     return read_mesh;
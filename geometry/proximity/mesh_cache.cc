@@ -0,0 +1,118 @@
+#include "drake/geometry/proximity/mesh_cache.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <system_error>
+#include <tuple>
+
+#include <fmt/format.h>
+
+#include "drake/common/never_destroyed.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+class MeshCache::Impl {
+ public:
+  /* The file digest, the scale, the type of the value and the tag. */
+  using Key =
+      std::tuple<FileContentDigest, double, std::type_index, std::string>;
+
+  /* The absolute path, size and modification time of a file. */
+  using FileStamp =
+      std::tuple<std::string, uintmax_t,
+                 std::filesystem::file_time_type::duration::rep>;
+
+  /* The number of file digests remembered before they are all forgotten. Each
+   is only a few dozen bytes, so this merely guards against unbounded growth
+   when processing an endless stream of distinct files. */
+  static constexpr int kMaxFileDigests = 4096;
+
+  explicit Impl(int64_t max_bytes) : values("MeshCache", max_bytes) {}
+
+  /* Returns the digest of the file named `filename`, reusing the digest
+   computed for the same path, size and modification time, if any. Returns
+   nullopt if the file can't be read. */
+  std::optional<FileContentDigest> Digest(const std::string& filename) {
+    namespace fs = std::filesystem;
+    std::error_code error;
+    const fs::path path = fs::absolute(filename, error);
+    const uintmax_t size = error ? 0 : fs::file_size(path, error);
+    const fs::file_time_type time =
+        error ? fs::file_time_type{} : fs::last_write_time(path, error);
+    if (error) return DigestFileContents(filename);
+    const FileStamp stamp(path.string(), size, time.time_since_epoch().count());
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto iter = file_digests.find(stamp);
+      if (iter != file_digests.end()) return iter->second;
+    }
+    /* Hashing happens outside of the lock so that distinct files can be
+     hashed concurrently. */
+    const std::optional<FileContentDigest> digest =
+        DigestFileContents(filename);
+    if (digest.has_value()) {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (static_cast<int>(file_digests.size()) >= kMaxFileDigests) {
+        file_digests.clear();
+      }
+      file_digests.emplace(stamp, *digest);
+    }
+    return digest;
+  }
+
+  drake::internal::ContentKeyedCache<Key, void> values;
+  /* Guards `file_digests`. */
+  std::mutex mutex;
+  std::map<FileStamp, FileContentDigest> file_digests;
+};
+
+MeshCache::MeshCache(int64_t max_bytes)
+    : impl_(std::make_unique<Impl>(max_bytes)) {}
+
+MeshCache::~MeshCache() = default;
+
+MeshCache& MeshCache::GetInstance() {
+  static never_destroyed<MeshCache> instance;
+  return instance.access();
+}
+
+MeshCache::Stats MeshCache::GetStats() const {
+  return impl_->values.GetStats();
+}
+
+int64_t MeshCache::max_bytes() const {
+  return impl_->values.max_bytes();
+}
+
+std::optional<FileContentDigest> MeshCache::GetFileDigest(
+    const std::string& filename) {
+  return impl_->Digest(filename);
+}
+
+void MeshCache::Clear() {
+  impl_->values.Clear();
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  impl_->file_digests.clear();
+}
+
+std::shared_ptr<const void> MeshCache::GetOrComputeErased(
+    const std::string& filename, double scale, std::type_index type,
+    const std::string& tag,
+    const std::function<std::shared_ptr<const void>()>& compute) {
+  const std::optional<FileContentDigest> digest = impl_->Digest(filename);
+  if (!digest.has_value()) return compute();
+  return impl_->values.GetOrCompute(
+      Impl::Key(*digest, scale, type, tag),
+      static_cast<int64_t>(digest->second), compute, [&]() {
+        return fmt::format("'{}' for '{}' (scale {})", tag, filename, scale);
+      });
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+
+#include "drake/common/content_keyed_cache.h"
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* The digest of a file's contents. */
+using FileContentDigest = drake::internal::ContentDigest;
+
+using drake::internal::DigestFileContents;
+
+/* A process-wide, thread-safe cache of the products of reading and processing
+ mesh files (e.g., parsed meshes, meshes with their bounding volume
+ hierarchies, pressure fields, etc.). It is a drake::internal::ContentKeyedCache
+ (see there for the byte budget, eviction, and concurrency semantics) whose
+ entries are charged the size of the file they were derived from.
+
+ The key is the digest of the file's contents, not its name; so the same asset
+ referenced through different paths is processed once, and an edited file is
+ never served a stale result. The key additionally includes the scale applied
+ to the mesh, the type of the cached value, and a caller-provided `tag` that
+ distinguishes different products of the same type derived from the same file
+ (e.g., a rigid surface mesh versus the surface of a compliant volume mesh, or a
+ pressure field for a particular hydroelastic modulus).
+
+ Cached values are immutable and shared. Callers that need to own a mutable
+ value should copy it; copying is still far cheaper than parsing and
+ processing the file again.
+
+ Hashing the whole file on every request would cost nearly as much as parsing
+ small files, so the digest of each file is itself remembered, keyed on its
+ absolute path, size and modification time. A file that is rewritten is
+ rehashed as soon as its size or modification time changes.
+
+ Usage:
+
+   std::shared_ptr<const TriangleSurfaceMesh<double>> mesh =
+       MeshCache::GetInstance().GetOrCompute<TriangleSurfaceMesh<double>>(
+           filename, scale, "obj", [&]() {
+             return ReadObjToTriangleSurfaceMesh(filename, scale);
+           }); */
+class MeshCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MeshCache)
+
+  using Stats = drake::internal::ContentKeyedCacheStats;
+
+  /* The default byte budget of a cache. */
+  static constexpr int64_t kDefaultMaxBytes = int64_t{512} << 20;
+
+  /* Constructs an empty cache whose entries are charged against a budget of
+   `max_bytes`. Most code should share the process-wide instance returned by
+   GetInstance(); separate instances are useful for testing.
+   @throws std::exception if max_bytes < 0. */
+  explicit MeshCache(int64_t max_bytes = kDefaultMaxBytes);
+
+  ~MeshCache();
+
+  /* Returns the process-wide instance. */
+  static MeshCache& GetInstance();
+
+  /* Returns the cached value for the file named `filename` with the given
+   `scale` and `tag`, invoking `compute` to produce it on a miss.
+
+   If `filename` cannot be read, the cache is bypassed and the result of
+   `compute` is returned (or its exception propagated) directly. This preserves
+   whatever error reporting `compute` does for missing files.
+
+   @tparam Value  The type of the cached value; it is part of the key. */
+  template <typename Value>
+  std::shared_ptr<const Value> GetOrCompute(
+      const std::string& filename, double scale, const std::string& tag,
+      const std::function<Value()>& compute) {
+    return std::static_pointer_cast<const Value>(GetOrComputeErased(
+        filename, scale, std::type_index(typeid(Value)), tag,
+        [&compute]() -> std::shared_ptr<const void> {
+          return std::make_shared<const Value>(compute());
+        }));
+  }
+
+  /* Returns the digest of the contents of the file named `filename`, or
+   nullopt if the file can't be read. Like the keys of the cached values, the
+   digest is remembered for the file's path, size and modification time, so
+   the file is only hashed again once one of those changes. */
+  std::optional<FileContentDigest> GetFileDigest(const std::string& filename);
+
+  /* Returns a snapshot of the cache's statistics. */
+  Stats GetStats() const;
+
+  /* Returns the byte budget of this cache. */
+  int64_t max_bytes() const;
+
+  /* Evicts all entries, forgets all file digests and resets the statistics.
+   Values previously returned remain valid for as long as their callers hold on
+   to them. */
+  void Clear();
+
+ private:
+  class Impl;
+
+  std::shared_ptr<const void> GetOrComputeErased(
+      const std::string& filename, double scale, std::type_index type,
+      const std::string& tag,
+      const std::function<std::shared_ptr<const void>()>& compute);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -27,6 +27,13 @@ Obb::Obb(const RigidTransformd& X_HB, const Vector3<double>& half_width)
   PadBoundary();
 }
 
+Obb Obb::MakeUnpadded(const RigidTransformd& X_HB,
+                      const Vector3<double>& half_width) {
+  Obb result(X_HB, half_width);
+  result.half_width_ = half_width;
+  return result;
+}
+
 bool Obb::HasOverlap(const Obb& a, const Obb& b,
                      const RigidTransformd& X_GH) {
   // The canonical frame A of box `a` is posed in the hierarchy frame G, and
@@ -52,6 +52,14 @@ class Obb {
   */
   Obb(const math::RigidTransformd& X_HB, const Vector3<double>& half_width);
 
+  /* (Advanced) Constructs a box with exactly the given pose and half widths,
+   without padding its boundary. This is for restoring a box that was
+   previously constructed (and thereby padded), e.g., when reading it back
+   from a file; `half_width` is the value reported by its half_width().
+   @pre half_width.x(), half_width.y(), half_width.z() are not negative.  */
+  static Obb MakeUnpadded(const math::RigidTransformd& X_HB,
+                          const Vector3<double>& half_width);
+
   /* Returns the center of the box -- equivalent to the position vector from
    the hierarchy frame's origin Ho to `this` box's origin Bo: `p_HoBo_H`. */
   const Vector3<double>& center() const { return pose_.translation(); }
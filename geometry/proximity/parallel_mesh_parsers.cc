@@ -0,0 +1,829 @@
+#include "drake/geometry/proximity/parallel_mesh_parsers.h"
+
+#include <stdlib.h>
+
+#if defined(__APPLE__)
+#include <xlocale.h>
+#else
+#include <locale.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/mapped_file.h"
+#include "drake/common/parallel_for.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using drake::internal::MappedFile;
+using drake::internal::ParallelFor;
+using Eigen::Vector3d;
+
+/* Files are split into chunks of roughly this many bytes, which are parsed
+ independently. The chunking doesn't depend on the number of threads, so the
+ result (including which error is reported for a malformed file) doesn't
+ either. */
+constexpr size_t kChunkSize = size_t{1} << 20;
+
+/* Thrown for file contents that these parsers can't read, whether malformed or
+ outside the subset of the format that they support, so that the Maybe*()
+ functions can tell it apart from a file that can't be opened. */
+class ParseError : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+/* Whitespace within a line. */
+bool IsBlank(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+bool IsSpace(char c) {
+  return IsBlank(c) || c == '\n';
+}
+
+bool IsDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+bool IsAlpha(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+/* Splits `text` into consecutive chunks of at least kChunkSize bytes (except
+ for the last one). Each chunk but the last ends just past a character for
+ which `is_boundary` is true, so that no line (or token) straddles two chunks.
+ Returns the offsets at which the chunks begin, followed by text.size(). */
+template <typename IsBoundary>
+std::vector<size_t> SplitIntoChunks(std::string_view text,
+                                    const IsBoundary& is_boundary) {
+  std::vector<size_t> offsets{0};
+  size_t offset = kChunkSize;
+  while (offset < text.size()) {
+    while (offset < text.size() && !is_boundary(text[offset])) ++offset;
+    if (offset < text.size()) ++offset;
+    offsets.push_back(offset);
+    offset += kChunkSize;
+  }
+  if (offsets.back() != text.size()) offsets.push_back(text.size());
+  return offsets;
+}
+
+/* Parses the number that starts at `begin` with strtod in the "C" locale. This
+ handles every form of number (and is what tinyobjloader uses in Drake), but
+ it requires a null-terminated copy of the token. */
+bool ParseDoubleSlow(const char* begin, const char* end, const char** next,
+                     double* value) {
+#if defined(__APPLE__)
+  static const locale_t c_locale = newlocale(LC_ALL_MASK, nullptr, nullptr);
+#else
+  static const locale_t c_locale =
+      newlocale(LC_ALL_MASK, "C", static_cast<locale_t>(0));
+#endif
+  const char* token_end = begin;
+  while (token_end != end && !IsSpace(*token_end)) ++token_end;
+  const std::string token(begin, token_end);
+  char* parse_end = nullptr;
+  const double result = strtod_l(token.c_str(), &parse_end, c_locale);
+  if (parse_end == token.c_str() || !std::isfinite(result)) return false;
+  *next = begin + (parse_end - token.c_str());
+  *value = result;
+  return true;
+}
+
+/* Parses the decimal number at `*cursor` (which must be before `end`) into
+ `value` and advances `*cursor` past it. Returns false if there is no number
+ there (or it is not finite).
+
+ Numbers whose significand has at most 15 digits and whose decimal exponent is
+ at most 22 in magnitude are computed directly: both the significand and the
+ power of ten are exactly representable, so a single multiplication or
+ division is correctly rounded (Clinger's fast path). That covers the numbers
+ written by virtually all mesh tools. Anything else goes to strtod. */
+bool ParseDouble(const char** cursor, const char* end, double* value) {
+  static constexpr double kPowersOfTen[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  const char* const begin = *cursor;
+  const char* p = begin;
+  bool negative = false;
+  if (*p == '-' || *p == '+') {
+    negative = (*p == '-');
+    ++p;
+  }
+  uint64_t significand = 0;
+  int num_significant_digits = 0;
+  int exponent = 0;
+  bool has_digits = false;
+  bool is_exact = true;
+  // Appends the digit to the significand. Returns false if there is no room
+  // for it.
+  auto append = [&](char c) {
+    if (num_significant_digits == 0 && c == '0') return true;
+    if (num_significant_digits == 19) return false;
+    significand = 10 * significand + (c - '0');
+    ++num_significant_digits;
+    return true;
+  };
+  for (; p != end && IsDigit(*p); ++p) {
+    has_digits = true;
+    if (!append(*p)) {
+      ++exponent;
+      is_exact = false;
+    }
+  }
+  if (p != end && *p == '.') {
+    for (++p; p != end && IsDigit(*p); ++p) {
+      has_digits = true;
+      if (append(*p)) {
+        --exponent;
+      } else {
+        is_exact = false;
+      }
+    }
+  }
+  if (!has_digits) {
+    // Possibly "inf" or "nan", which strtod recognizes (and we reject).
+    return ParseDoubleSlow(begin, end, cursor, value);
+  }
+  if (p != end && (*p == 'e' || *p == 'E')) {
+    const char* q = p + 1;
+    bool negative_exponent = false;
+    if (q != end && (*q == '-' || *q == '+')) {
+      negative_exponent = (*q == '-');
+      ++q;
+    }
+    if (q != end && IsDigit(*q)) {
+      int explicit_exponent = 0;
+      for (; q != end && IsDigit(*q); ++q) {
+        if (explicit_exponent < 100000) {
+          explicit_exponent = 10 * explicit_exponent + (*q - '0');
+        }
+      }
+      exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+      p = q;
+    }
+  }
+  if (!is_exact || num_significant_digits > 15 || exponent < -22 ||
+      exponent > 22) {
+    return ParseDoubleSlow(begin, end, cursor, value);
+  }
+  double result = static_cast<double>(significand);
+  if (exponent < 0) {
+    result /= kPowersOfTen[-exponent];
+  } else {
+    result *= kPowersOfTen[exponent];
+  }
+  *value = negative ? -result : result;
+  *cursor = p;
+  return true;
+}
+
+/* Parses the decimal integer at `*cursor` (which must be before `end`) into
+ `value` and advances `*cursor` past it. Returns false if there is no integer
+ there or it doesn't fit in an int. */
+bool ParseInt(const char** cursor, const char* end, int* value) {
+  const char* p = *cursor;
+  bool negative = false;
+  if (*p == '-' || *p == '+') {
+    negative = (*p == '-');
+    ++p;
+  }
+  if (p == end || !IsDigit(*p)) return false;
+  int64_t result = 0;
+  for (; p != end && IsDigit(*p); ++p) {
+    result = 10 * result + (*p - '0');
+    if (result > std::numeric_limits<int>::max()) return false;
+  }
+  *value = static_cast<int>(negative ? -result : result);
+  *cursor = p;
+  return true;
+}
+
+/* Parses a whitespace-delimited number. */
+bool ParseNumber(const char** cursor, const char* end, double* value) {
+  return ParseDouble(cursor, end, value) &&
+         (*cursor == end || IsSpace(**cursor));
+}
+
+bool ParseNumber(const char** cursor, const char* end, int* value) {
+  return ParseInt(cursor, end, value) && (*cursor == end || IsSpace(**cursor));
+}
+
+/* The part of an .obj file parsed by one thread. Vertex indices in `faces`
+ are zero-based and refer to the whole file, except for those listed in
+ `relative_indices`. */
+struct ObjChunk {
+  std::vector<Vector3d> vertices;
+  /* The faces, encoded as in ObjPolygons::faces. */
+  std::vector<int> faces;
+  int num_faces{0};
+  /* The positions in `faces` of vertex indices that were given relative to
+   the last vertex (i.e., negative indices in the file). They are relative to
+   the first vertex of this chunk until the number of vertices in the
+   preceding chunks is added to them. */
+  std::vector<int> relative_indices;
+  /* The values of `num_faces` at which objects (`o` or `g`) were declared. */
+  std::vector<int> object_starts;
+  int num_lines{0};
+  /* The first error in the chunk, if any, and its line within the chunk. */
+  std::string error;
+  int error_line{0};
+};
+
+/* Parses one line of an .obj file (without its newline) into `chunk`. Returns
+ an error message if the line is malformed. */
+std::string ParseObjLine(const char* p, const char* end, double scale,
+                         ObjChunk* chunk) {
+  while (p != end && IsBlank(*p)) ++p;
+  if (end - p < 2 || !IsBlank(p[1])) {
+    if (p != end && (*p == 'o' || *p == 'g') && end - p == 1) {
+      chunk->object_starts.push_back(chunk->num_faces);
+    }
+    return {};
+  }
+  const char statement = *p;
+  p += 2;
+  if (statement == 'v') {
+    Vector3d vertex;
+    for (int i = 0; i < 3; ++i) {
+      while (p != end && IsBlank(*p)) ++p;
+      if (p == end || !ParseNumber(&p, end, &vertex[i])) {
+        return "couldn't parse the vertex position";
+      }
+    }
+    chunk->vertices.push_back(scale * vertex);
+  } else if (statement == 'f') {
+    const int num_vertices_position = chunk->faces.size();
+    chunk->faces.push_back(0);
+    int num_vertices = 0;
+    while (true) {
+      while (p != end && IsBlank(*p)) ++p;
+      if (p == end) break;
+      int index{};
+      if (!ParseInt(&p, end, &index) || index == 0 ||
+          (p != end && !IsBlank(*p) && *p != '/')) {
+        return "couldn't parse the face's vertex index";
+      }
+      // Skip the texture coordinate and normal indices, if any.
+      while (p != end && !IsBlank(*p)) ++p;
+      if (index < 0) {
+        chunk->relative_indices.push_back(chunk->faces.size());
+        index += static_cast<int>(chunk->vertices.size());
+      } else {
+        index -= 1;
+      }
+      chunk->faces.push_back(index);
+      ++num_vertices;
+    }
+    if (num_vertices < 3) {
+      chunk->faces.resize(num_vertices_position);
+    } else {
+      chunk->faces[num_vertices_position] = num_vertices;
+      ++chunk->num_faces;
+    }
+  } else if (statement == 'o' || statement == 'g') {
+    chunk->object_starts.push_back(chunk->num_faces);
+  }
+  return {};
+}
+
+void ParseObjChunk(std::string_view text, double scale, ObjChunk* chunk) {
+  const char* p = text.data();
+  const char* const end = p + text.size();
+  while (p != end) {
+    const char* line_end =
+        static_cast<const char*>(std::memchr(p, '\n', end - p));
+    if (line_end == nullptr) line_end = end;
+    ++chunk->num_lines;
+    std::string error = ParseObjLine(p, line_end, scale, chunk);
+    if (!error.empty()) {
+      chunk->error = std::move(error);
+      chunk->error_line = chunk->num_lines;
+      return;
+    }
+    p = (line_end == end) ? end : line_end + 1;
+  }
+}
+
+/* Invokes `function(indices, n)` for each face encoded in `faces`. */
+template <typename Function>
+void ForEachFace(const std::vector<int>& faces, const Function& function) {
+  for (size_t i = 0; i < faces.size(); i += faces[i] + 1) {
+    function(&faces[i + 1], faces[i]);
+  }
+}
+
+/* Returns the number of triangles of the faces encoded in `faces`, each of
+ which must be a triangle or a quadrilateral.
+ @throws ParseError if a face has more than four vertices, since
+         its triangulation depends on its shape (it may be concave). */
+int CountTriangles(const std::vector<int>& faces, const std::string& filename) {
+  int count = 0;
+  ForEachFace(faces, [&count, &filename](const int*, int n) {
+    if (n > 4) {
+      throw ParseError(fmt::format(
+          "Error parsing Wavefront obj file '{}': triangulating a face with {} "
+          "vertices is not supported", filename, n));
+    }
+    count += n - 2;
+  });
+  return count;
+}
+
+/* Invokes `emit(a, b, c)` for each triangle of the triangle or quadrilateral
+ with the given vertex indices. Quadrilaterals are split along their shorter
+ diagonal (preferring the one from v₁ to v₃ for ties, as tinyobjloader
+ does). */
+template <typename Emit>
+void TriangulateFace(const int* v, int n, const std::vector<Vector3d>& vertices,
+                     const Emit& emit) {
+  if (n == 4) {
+    const double d02 = (vertices[v[2]] - vertices[v[0]]).squaredNorm();
+    const double d13 = (vertices[v[3]] - vertices[v[1]]).squaredNorm();
+    if (d02 < d13) {
+      emit(v[0], v[1], v[2]);
+      emit(v[0], v[2], v[3]);
+    } else {
+      emit(v[0], v[1], v[3]);
+      emit(v[1], v[2], v[3]);
+    }
+    return;
+  }
+  DRAKE_DEMAND(n == 3);
+  emit(v[0], v[1], v[2]);
+}
+
+/* Parses the .obj file in parallel and resolves and validates all vertex
+ indices. Returns the parsed chunks, whose faces refer to `vertices`, which
+ holds all of the file's vertices on return (the chunks' own vertices are
+ released). `num_objects` is set as described in ObjPolygons. */
+std::vector<ObjChunk> ParseObjChunks(const std::string& filename,
+                                     double scale,
+                                     std::vector<Vector3d>* vertices,
+                                     int* num_objects) {
+  const MappedFile file(filename);
+  if (!file.is_open()) {
+    throw std::runtime_error(fmt::format("Cannot open file '{}'", filename));
+  }
+  const std::string_view text = file.contents();
+  const std::vector<size_t> offsets =
+      SplitIntoChunks(text, [](char c) { return c == '\n'; });
+  const int num_chunks = static_cast<int>(offsets.size()) - 1;
+  std::vector<ObjChunk> chunks(std::max(num_chunks, 0));
+  ParallelFor(num_chunks, [&](int c) {
+    ParseObjChunk(text.substr(offsets[c], offsets[c + 1] - offsets[c]), scale,
+                  &chunks[c]);
+  });
+
+  int num_lines = 0;
+  for (const ObjChunk& chunk : chunks) {
+    if (!chunk.error.empty()) {
+      throw ParseError(
+          fmt::format("Error parsing Wavefront obj file '{}' at line {}: {}",
+                      filename, num_lines + chunk.error_line, chunk.error));
+    }
+    num_lines += chunk.num_lines;
+  }
+
+  // Count the objects with faces: each object declaration (and the start of
+  // the file) starts an object that extends to the next declaration.
+  *num_objects = 0;
+  int previous_start = 0;
+  int num_faces = 0;
+  for (const ObjChunk& chunk : chunks) {
+    for (int start : chunk.object_starts) {
+      if (num_faces + start > previous_start) ++*num_objects;
+      previous_start = num_faces + start;
+    }
+    num_faces += chunk.num_faces;
+  }
+  if (num_faces > previous_start) ++*num_objects;
+
+  std::vector<int> vertex_offsets(num_chunks + 1, 0);
+  for (int c = 0; c < num_chunks; ++c) {
+    vertex_offsets[c + 1] = vertex_offsets[c] + chunks[c].vertices.size();
+  }
+  const int num_vertices = vertex_offsets.back();
+  vertices->resize(num_vertices);
+  ParallelFor(num_chunks, [&](int c) {
+    ObjChunk& chunk = chunks[c];
+    std::copy(chunk.vertices.begin(), chunk.vertices.end(),
+              vertices->begin() + vertex_offsets[c]);
+    chunk.vertices = {};
+    for (int i : chunk.relative_indices) {
+      chunk.faces[i] += vertex_offsets[c];
+    }
+    ForEachFace(chunk.faces, [&](const int* indices, int n) {
+      for (int i = 0; i < n; ++i) {
+        if (indices[i] < 0 || indices[i] >= num_vertices) {
+          throw ParseError(fmt::format(
+              "Error parsing Wavefront obj file '{}': a face refers to the "
+              "vertex with index {}, but the file has {} vertices",
+              filename, indices[i] + 1, num_vertices));
+        }
+      }
+    });
+  });
+  return chunks;
+}
+
+}  // namespace
+
+ObjPolygons ParseObjPolygons(const std::string& filename, double scale,
+                             bool triangulate) {
+  ObjPolygons result;
+  std::vector<ObjChunk> chunks =
+      ParseObjChunks(filename, scale, &result.vertices, &result.num_objects);
+  const int num_chunks = chunks.size();
+
+  // The size of each chunk's encoded faces (and its number of faces).
+  std::vector<int> face_offsets(num_chunks + 1, 0);
+  std::vector<int> face_counts(num_chunks + 1, 0);
+  for (int c = 0; c < num_chunks; ++c) {
+    int size = chunks[c].faces.size();
+    int count = chunks[c].num_faces;
+    if (triangulate) {
+      // Each triangle is encoded with 4 ints.
+      count = CountTriangles(chunks[c].faces, filename);
+      size = 4 * count;
+    }
+    face_offsets[c + 1] = face_offsets[c] + size;
+    face_counts[c + 1] = face_counts[c] + count;
+  }
+  result.num_faces = face_counts.back();
+  result.faces.resize(face_offsets.back());
+  ParallelFor(num_chunks, [&](int c) {
+    const std::vector<int>& faces = chunks[c].faces;
+    auto out = result.faces.begin() + face_offsets[c];
+    if (!triangulate) {
+      std::copy(faces.begin(), faces.end(), out);
+      return;
+    }
+    ForEachFace(faces, [&](const int* indices, int n) {
+      TriangulateFace(indices, n, result.vertices,
+                      [&out](int v0, int v1, int v2) {
+                        *out++ = 3;
+                        *out++ = v0;
+                        *out++ = v1;
+                        *out++ = v2;
+                      });
+    });
+  });
+  return result;
+}
+
+TriangleSurfaceMesh<double> ParseObjToTriangleSurfaceMesh(
+    const std::string& filename, double scale) {
+  std::vector<Vector3d> vertices;
+  int num_objects{};
+  std::vector<ObjChunk> chunks =
+      ParseObjChunks(filename, scale, &vertices, &num_objects);
+  const int num_chunks = chunks.size();
+
+  std::vector<int> triangle_offsets(num_chunks + 1, 0);
+  for (int c = 0; c < num_chunks; ++c) {
+    triangle_offsets[c + 1] =
+        triangle_offsets[c] + CountTriangles(chunks[c].faces, filename);
+  }
+  if (triangle_offsets.back() == 0) {
+    throw ParseError(
+        fmt::format("The Wavefront obj file '{}' has no faces.", filename));
+  }
+  std::vector<SurfaceTriangle> triangles(triangle_offsets.back(),
+                                         SurfaceTriangle(0, 0, 0));
+  ParallelFor(num_chunks, [&](int c) {
+    auto out = triangles.begin() + triangle_offsets[c];
+    ForEachFace(chunks[c].faces, [&](const int* indices, int n) {
+      TriangulateFace(indices, n, vertices, [&out](int v0, int v1, int v2) {
+        *out++ = SurfaceTriangle(v0, v1, v2);
+      });
+    });
+  });
+  return TriangleSurfaceMesh<double>(std::move(triangles), std::move(vertices));
+}
+
+std::optional<ObjPolygons> MaybeParseObjPolygons(const std::string& filename,
+                                                 double scale,
+                                                 bool triangulate) {
+  try {
+    return ParseObjPolygons(filename, scale, triangulate);
+  } catch (const ParseError&) {
+    return std::nullopt;
+  }
+}
+
+std::optional<TriangleSurfaceMesh<double>> MaybeParseObjToTriangleSurfaceMesh(
+    const std::string& filename, double scale) {
+  try {
+    return ParseObjToTriangleSurfaceMesh(filename, scale);
+  } catch (const ParseError&) {
+    return std::nullopt;
+  }
+}
+
+namespace {
+
+/* Sequential access to the structure of a legacy VTK file. The (potentially
+ large) data arrays are parsed in parallel by ParseArray(). */
+class VtkCursor {
+ public:
+  VtkCursor(std::string_view text, const std::string& filename)
+      : p_(text.data()), end_(text.data() + text.size()), filename_(filename) {}
+
+  /* Returns the rest of the current line (without its newline) and advances
+   to the next line. */
+  std::string_view NextLine() {
+    const char* line_end =
+        static_cast<const char*>(std::memchr(p_, '\n', end_ - p_));
+    if (line_end == nullptr) line_end = end_;
+    std::string_view line(p_, line_end - p_);
+    p_ = (line_end == end_) ? end_ : line_end + 1;
+    while (!line.empty() && IsSpace(line.back())) line.remove_suffix(1);
+    return line;
+  }
+
+  /* Returns the next whitespace-delimited token, or an empty token at the end
+   of the file. */
+  std::string_view NextToken() {
+    while (p_ != end_ && IsSpace(*p_)) ++p_;
+    const char* begin = p_;
+    while (p_ != end_ && !IsSpace(*p_)) ++p_;
+    return {begin, static_cast<size_t>(p_ - begin)};
+  }
+
+  /* Returns the next token, which must be a non-negative integer. */
+  int NextCount(std::string_view section) {
+    const std::string_view token = NextToken();
+    const char* p = token.data();
+    int count{};
+    if (token.empty() || !ParseInt(&p, token.data() + token.size(), &count) ||
+        p != token.data() + token.size() || count < 0) {
+      Fail(fmt::format("invalid size '{}' for the {} section", token, section));
+    }
+    return count;
+  }
+
+  /* Returns the numbers that follow the current line: they extend to the
+   first line that starts with a letter (i.e., the next section keyword) or to
+   the end of the file. Throws unless there are exactly `count` of them, or
+   if `count` is nullopt, returns however many there are. */
+  template <typename T>
+  std::vector<T> NextArray(std::optional<int> count, std::string_view section) {
+    NextLine();
+    const char* begin = p_;
+    while (p_ != end_) {
+      const char* q = p_;
+      while (q != end_ && IsBlank(*q)) ++q;
+      if (q != end_ && IsAlpha(*q)) break;
+      q = static_cast<const char*>(std::memchr(q, '\n', end_ - q));
+      p_ = (q == nullptr) ? end_ : q + 1;
+    }
+    std::vector<T> values = ParseArray<T>({begin, size_t(p_ - begin)}, section);
+    if (count.has_value() && static_cast<int>(values.size()) != *count) {
+      Fail(fmt::format("the {} section has {} values; expected {}", section,
+                       values.size(), *count));
+    }
+    return values;
+  }
+
+  /* Skips the current line and the lines that follow it, up to and including
+   the next blank line. */
+  void SkipBlock() {
+    NextLine();
+    while (p_ != end_ && !NextLine().empty()) {
+    }
+  }
+
+  /* Throws unless the next token is `keyword`. */
+  void Expect(std::string_view keyword) {
+    const std::string_view token = NextToken();
+    if (token != keyword) {
+      Fail(fmt::format("expected {} but found '{}'", keyword, token));
+    }
+  }
+
+  [[noreturn]] void Fail(std::string_view message) const {
+    throw ParseError(
+        fmt::format("Error parsing VTK file '{}': {}", filename_, message));
+  }
+
+ private:
+  template <typename T>
+  std::vector<T> ParseArray(std::string_view text,
+                            std::string_view section) const {
+    const std::vector<size_t> offsets = SplitIntoChunks(text, IsSpace);
+    const int num_chunks = static_cast<int>(offsets.size()) - 1;
+    std::vector<std::vector<T>> chunks(std::max(num_chunks, 0));
+    ParallelFor(num_chunks, [&](int c) {
+      const char* p = text.data() + offsets[c];
+      const char* const end = text.data() + offsets[c + 1];
+      std::vector<T>& values = chunks[c];
+      values.reserve((end - p) / 4);
+      while (true) {
+        while (p != end && IsSpace(*p)) ++p;
+        if (p == end) break;
+        T value{};
+        if (!ParseNumber(&p, end, &value)) {
+          const char* token_end = p;
+          while (token_end != end && !IsSpace(*token_end)) ++token_end;
+          Fail(fmt::format("invalid value '{}' in the {} section",
+                           std::string_view(p, token_end - p), section));
+        }
+        values.push_back(value);
+      }
+    });
+    std::vector<size_t> value_offsets(num_chunks + 1, 0);
+    for (int c = 0; c < num_chunks; ++c) {
+      value_offsets[c + 1] = value_offsets[c] + chunks[c].size();
+    }
+    std::vector<T> values(value_offsets.back());
+    ParallelFor(num_chunks, [&](int c) {
+      std::copy(chunks[c].begin(), chunks[c].end(),
+                values.begin() + value_offsets[c]);
+    });
+    return values;
+  }
+
+  const char* p_{};
+  const char* end_{};
+  const std::string& filename_;
+};
+
+}  // namespace
+
+VolumeMesh<double> ParseVtkToVolumeMesh(const std::string& filename,
+                                        double scale) {
+  if (scale <= 0.0) {
+    throw std::runtime_error(fmt::format(
+        "ParseVtkToVolumeMesh: scale={} is not a positive number", scale));
+  }
+  const MappedFile file(filename);
+  if (!file.is_open()) {
+    throw std::runtime_error(fmt::format("Cannot open file '{}'", filename));
+  }
+  VtkCursor cursor(file.contents(), filename);
+  if (cursor.NextLine().substr(0, 22) != "# vtk DataFile Version") {
+    cursor.Fail("not a legacy VTK file");
+  }
+  cursor.NextLine();  // The title.
+  const std::string_view format = cursor.NextLine();
+  if (format != "ASCII") {
+    cursor.Fail(
+        fmt::format("only ASCII files are supported, not '{}'", format));
+  }
+  if (cursor.NextToken() != "DATASET") cursor.Fail("missing DATASET");
+  const std::string_view dataset = cursor.NextToken();
+  if (dataset != "UNSTRUCTURED_GRID") {
+    cursor.Fail(fmt::format(
+        "only UNSTRUCTURED_GRID datasets are supported, not '{}'", dataset));
+  }
+
+  std::vector<double> coordinates;
+  int num_vertices = -1;
+  // The vertex indices of the tetrahedra: those of the i-th tetrahedron are
+  // at cells[stride * i + offset] and the three values after it.
+  std::vector<int> cells;
+  int num_cells = -1;
+  int stride = 4;
+  int offset = 0;
+  while (true) {
+    const std::string_view keyword = cursor.NextToken();
+    if (keyword.empty()) break;
+    if (keyword == "POINT_DATA" || keyword == "CELL_DATA" ||
+        keyword == "FIELD") {
+      // Attribute data follows the grid and is ignored, but field data may
+      // also precede it, which isn't supported.
+      if (num_vertices < 0 || num_cells < 0) {
+        cursor.Fail(fmt::format(
+            "the {} section must follow the POINTS and CELLS sections",
+            keyword));
+      }
+      break;
+    }
+    if (keyword == "POINTS") {
+      num_vertices = cursor.NextCount(keyword);
+      cursor.NextToken();  // The data type; every type is read as double.
+      coordinates = cursor.NextArray<double>(3 * num_vertices, keyword);
+    } else if (keyword == "CELLS") {
+      const int first = cursor.NextCount(keyword);
+      const int second = cursor.NextCount(keyword);
+      cells = cursor.NextArray<int>(std::nullopt, keyword);
+      if (cells.empty() && second > 0) {
+        // The 5.1 format: CELLS gives the sizes of the OFFSETS and
+        // CONNECTIVITY arrays that follow it.
+        cursor.Expect("OFFSETS");
+        cursor.NextToken();  // The data type.
+        const std::vector<int> offsets =
+            cursor.NextArray<int>(first, "OFFSETS");
+        num_cells = first - 1;
+        for (int i = 0; i <= num_cells; ++i) {
+          if (offsets[i] != 4 * i) {
+            cursor.Fail("only tetrahedral cells are supported");
+          }
+        }
+        cursor.Expect("CONNECTIVITY");
+        cursor.NextToken();  // The data type.
+        cells = cursor.NextArray<int>(second, "CONNECTIVITY");
+        if (second != 4 * num_cells) {
+          cursor.Fail("the OFFSETS and CONNECTIVITY sections don't agree");
+        }
+      } else {
+        // Each cell is given by its number of vertices followed by the
+        // vertices' indices.
+        if (static_cast<int>(cells.size()) != second) {
+          cursor.Fail(fmt::format("the CELLS section has {} values; "
+                                  "expected {}", cells.size(), second));
+        }
+        num_cells = first;
+        stride = 5;
+        offset = 1;
+        if (second != 5 * num_cells) {
+          cursor.Fail("only tetrahedral cells are supported");
+        }
+        for (int i = 0; i < num_cells; ++i) {
+          if (cells[5 * i] != 4) {
+            cursor.Fail("only tetrahedral cells are supported");
+          }
+        }
+      }
+    } else if (keyword == "CELL_TYPES") {
+      const int num_types = cursor.NextCount(keyword);
+      const std::vector<int> types = cursor.NextArray<int>(num_types, keyword);
+      if (num_types != num_cells) {
+        cursor.Fail("the CELL_TYPES section must follow the CELLS section and "
+                    "have one type per cell");
+      }
+      constexpr int kTetrahedronCellType = 10;  // VTK_TETRA.
+      for (int i = 0; i < num_types; ++i) {
+        if (types[i] != kTetrahedronCellType) {
+          cursor.Fail(fmt::format(
+              "only tetrahedral cells (type {}) are supported; cell {} has "
+              "type {}", kTetrahedronCellType, i, types[i]));
+        }
+      }
+    } else if (keyword == "METADATA") {
+      cursor.SkipBlock();
+    } else {
+      cursor.Fail(fmt::format("unsupported section '{}'", keyword));
+    }
+  }
+  if (num_vertices < 0) cursor.Fail("missing the POINTS section");
+  if (num_cells < 0) cursor.Fail("missing the CELLS section");
+
+  // Large meshes are converted in parallel, in blocks of this many vertices
+  // or tetrahedra.
+  constexpr int kBlockSize = 1 << 16;
+  std::vector<Vector3d> vertices(num_vertices);
+  ParallelFor((num_vertices + kBlockSize - 1) / kBlockSize, [&](int block) {
+    const int end = std::min(num_vertices, (block + 1) * kBlockSize);
+    for (int v = block * kBlockSize; v < end; ++v) {
+      vertices[v] = scale * Vector3d(coordinates[3 * v],
+                                     coordinates[3 * v + 1],
+                                     coordinates[3 * v + 2]);
+    }
+  });
+  std::vector<VolumeElement> elements(num_cells, VolumeElement(0, 0, 0, 0));
+  ParallelFor((num_cells + kBlockSize - 1) / kBlockSize, [&](int block) {
+    const int end = std::min(num_cells, (block + 1) * kBlockSize);
+    for (int e = block * kBlockSize; e < end; ++e) {
+      const int* v = &cells[stride * e + offset];
+      for (int i = 0; i < 4; ++i) {
+        if (v[i] < 0 || v[i] >= num_vertices) {
+          cursor.Fail(fmt::format(
+              "cell {} refers to the vertex with index {}, but there are {} "
+              "vertices", e, v[i], num_vertices));
+        }
+      }
+      elements[e] = VolumeElement(v);
+    }
+  });
+  return {std::move(elements), std::move(vertices)};
+}
+
+std::optional<VolumeMesh<double>> MaybeParseVtkToVolumeMesh(
+    const std::string& filename, double scale) {
+  try {
+    return ParseVtkToVolumeMesh(filename, scale);
+  } catch (const ParseError&) {
+    return std::nullopt;
+  }
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "drake/common/eigen_types.h"
+#include "drake/geometry/proximity/triangle_surface_mesh.h"
+#include "drake/geometry/proximity/volume_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* @name Parallel parsers for mesh files
+
+ These functions read the meshes in Wavefront .obj files and legacy ASCII VTK
+ files without going through tinyobjloader or the VTK library. They map the
+ file into memory, split it into chunks at line (or token) boundaries, and
+ parse the chunks in parallel (when Drake is built with OpenMP), writing the
+ vertices and elements directly into the resulting mesh. Numbers are parsed
+ with a locale-independent fast path that is exact for the decimal values
+ written by mesh tools; any other number is handed to strtod, so the parsed
+ values are identical to those of the existing readers.
+
+ They are intended for large meshes (e.g., millions of triangles from scanned
+ environments), for which ReadObjToTriangleSurfaceMesh() and
+ ReadVtkToVolumeMesh() are dominated by per-token overhead. See
+ //geometry/benchmarking:mesh_parsing_benchmark for a comparison.
+
+ Each parser only supports a subset of its format (described below), and is
+ stricter than the existing readers about malformed input (e.g., tinyobjloader
+ ignores characters that trail a number, as in `v 1.0abc 2 3`). The Maybe*()
+ variants return nullopt, rather than throwing, for any file that can be opened
+ but not parsed, so that callers can fall back to the existing readers. Those
+ then either read the file or report the error as they always have. The
+ Maybe*() variants still throw for files that can't be opened. */
+//@{
+
+/* The vertices and polygonal faces of an .obj file. */
+struct ObjPolygons {
+  /* The vertex positions, in the order they appear in the file. */
+  std::vector<Eigen::Vector3d> vertices;
+  /* The faces, encoded as { n₀, v0₀, ..., v0ₙ₀₋₁, n₁, v1₀, ..., v1ₙ₁₋₁, ... }
+   where nᵢ is the number of vertices of the i-th face and vᵢⱼ are (zero-based)
+   indices into `vertices`. This is the encoding that fcl::Convex expects. */
+  std::vector<int> faces;
+  /* The number of faces encoded in `faces`. */
+  int num_faces{0};
+  /* The number of objects (declared with `o` or `g`) that have at least one
+   face. Faces that precede any object declaration form an object of their
+   own. */
+  int num_objects{0};
+};
+
+/* Reads the vertices and faces of the .obj file `filename`, scaling the
+ vertices by `scale`.
+
+ Only vertex positions (`v`) and faces (`f`) are read; texture coordinates,
+ normals, materials, and every other statement are ignored. Face vertices may
+ be given in any of the forms `v`, `v/vt`, `v//vn`, or `v/vt/vn`, with
+ positive (one-based) or negative (relative) indices. Faces with fewer than
+ three vertices are ignored.
+
+ When `triangulate` is true, each quadrilateral is split into two triangles
+ along its shorter diagonal (as tinyobjloader does). Triangulating larger
+ polygons, which may be concave, is not supported.
+
+ @throws std::exception if the file can't be opened, a vertex can't be parsed,
+                        a face refers to a vertex that doesn't exist, or
+                        `triangulate` is true and a face has more than four
+                        vertices. */
+ObjPolygons ParseObjPolygons(const std::string& filename, double scale,
+                             bool triangulate);
+
+/* Like ParseObjPolygons(), but returns nullopt when the file's contents can't
+ be parsed (including when `triangulate` is true and a face has more than four
+ vertices). */
+std::optional<ObjPolygons> MaybeParseObjPolygons(const std::string& filename,
+                                                 double scale,
+                                                 bool triangulate);
+
+/* Reads the .obj file `filename` into a triangle surface mesh, scaling the
+ vertices by `scale`. All of the file's objects are merged into the one mesh
+ and polygons are triangulated as described in ParseObjPolygons().
+
+ This is a faster alternative to ReadObjToTriangleSurfaceMesh().
+ @throws std::exception under the conditions of ParseObjPolygons() or if the
+                        file has no faces. */
+TriangleSurfaceMesh<double> ParseObjToTriangleSurfaceMesh(
+    const std::string& filename, double scale = 1.0);
+
+/* Like ParseObjToTriangleSurfaceMesh(), but returns nullopt when the file's
+ contents can't be parsed (including when a face has more than four vertices)
+ or it has no faces. */
+std::optional<TriangleSurfaceMesh<double>> MaybeParseObjToTriangleSurfaceMesh(
+    const std::string& filename, double scale = 1.0);
+
+/* Reads the tetrahedral mesh in the legacy ASCII VTK file `filename`, scaling
+ the vertices by `scale`. The file must hold an UNSTRUCTURED_GRID whose cells
+ are all tetrahedra (VTK_TETRA), with the cells given either as a single CELLS
+ section (file format versions up to 4.2) or as OFFSETS and CONNECTIVITY
+ arrays (version 5.1). Attribute and field data that follow the grid (the
+ POINT_DATA, CELL_DATA, and FIELD sections) are ignored; binary files and field
+ data that precede the grid are not supported.
+
+ This is a faster alternative to ReadVtkToVolumeMesh().
+ @throws std::exception if the file can't be opened, is not in the supported
+                        subset of the format, or is malformed, or if
+                        `scale` is not positive. */
+VolumeMesh<double> ParseVtkToVolumeMesh(const std::string& filename,
+                                        double scale = 1.0);
+
+/* Like ParseVtkToVolumeMesh(), but returns nullopt when the file's contents
+ can't be parsed, whether they're malformed or not in the supported subset of
+ the format. */
+std::optional<VolumeMesh<double>> MaybeParseVtkToVolumeMesh(
+    const std::string& filename, double scale = 1.0);
+
+//@}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,394 @@
+#include "drake/geometry/proximity/precompiled_hydroelastic.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/mapped_file.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using drake::internal::MappedFile;
+
+/* File layout. Every section starts at a multiple of 8 bytes.
+
+   Header
+   key                  (key_size chars)
+   vertices             (3 * num_vertices doubles)
+   elements             (kVertexPerElement * num_elements int32s)
+   pressure values      (num_vertices doubles; compliant meshes only)
+   pressure gradients   (3 * num_elements doubles; compliant meshes only)
+   BVH nodes            (num_nodes NodeRecords, in depth-first pre-order)  */
+
+constexpr char kMagic[8] = {'D', 'R', 'K', 'H', 'Y', 'D', 'R', 'O'};
+constexpr uint32_t kEndianMarker = 0x01020304;
+constexpr uint32_t kVersion = 1;
+
+enum class Kind : uint32_t { kSoft = 1, kRigid = 2 };
+
+struct Header {
+  char magic[8];
+  uint32_t endian_marker;
+  uint32_t version;
+  Kind kind;
+  uint32_t reserved;
+  uint64_t key_size;
+  uint64_t num_vertices;
+  uint64_t num_elements;
+  uint64_t num_nodes;
+};
+static_assert(sizeof(Header) == 56);
+
+/* A node of the BVH. The children of a branch node immediately follow it: the
+ left child and its descendants, then the right child and its descendants. */
+template <class MeshType>
+struct NodeRecord {
+  static constexpr int kMaxElementPerLeaf =
+      MeshTraits<MeshType>::kMaxElementPerBvhLeaf;
+
+  /* The rotation (column major) and translation of the Obb's pose. */
+  double R_HB[9];
+  double p_HoBo[3];
+  double half_width[3];
+  /* The number of element indices for a leaf, or -1 for a branch. */
+  int32_t num_indices;
+  int32_t indices[kMaxElementPerLeaf];
+};
+
+static_assert(sizeof(Eigen::Vector3d) == 3 * sizeof(double));
+
+size_t PaddedSize(size_t num_bytes) {
+  return (num_bytes + 7) & ~static_cast<size_t>(7);
+}
+
+/* Accumulates the contents of a file in memory. */
+class Writer {
+ public:
+  void Append(const void* data, size_t num_bytes) {
+    const char* bytes = static_cast<const char*>(data);
+    buffer_.insert(buffer_.end(), bytes, bytes + num_bytes);
+    buffer_.resize(PaddedSize(buffer_.size()), 0);
+  }
+
+  template <class MeshType>
+  void AppendMesh(const MeshType& mesh) {
+    Append(mesh.vertices().data(), mesh.num_vertices() * sizeof(double) * 3);
+    std::vector<int32_t> indices;
+    indices.reserve(mesh.num_elements() * MeshType::kVertexPerElement);
+    for (int e = 0; e < mesh.num_elements(); ++e) {
+      for (int i = 0; i < MeshType::kVertexPerElement; ++i) {
+        indices.push_back(mesh.element(e).vertex(i));
+      }
+    }
+    Append(indices.data(), indices.size() * sizeof(int32_t));
+  }
+
+  template <class MeshType>
+  void AppendBvh(const Bvh<Obb, MeshType>& bvh) {
+    std::vector<NodeRecord<MeshType>> records;
+    AppendNode(bvh.root_node(), &records);
+    Append(records.data(), records.size() * sizeof(NodeRecord<MeshType>));
+  }
+
+  /* Writes the accumulated contents to `filename`. The contents are written to
+   a temporary file first, which is then renamed, so that concurrent readers
+   never see a partially written file. */
+  void WriteFile(const std::string& filename) const {
+    const std::string temp_filename = fmt::format("{}.{}.tmp", filename,
+                                                  getpid());
+    {
+      std::ofstream file(temp_filename, std::ios::binary);
+      file.write(buffer_.data(), buffer_.size());
+      if (!file) {
+        throw std::runtime_error(fmt::format(
+            "Failed to write precompiled hydroelastic geometry file '{}'",
+            temp_filename));
+      }
+    }
+    std::filesystem::rename(temp_filename, filename);
+  }
+
+ private:
+  template <class MeshType>
+  static void AppendNode(const BvNode<Obb, MeshType>& node,
+                         std::vector<NodeRecord<MeshType>>* records) {
+    NodeRecord<MeshType>& record = records->emplace_back();
+    const math::RigidTransformd& X_HB = node.bv().pose();
+    Eigen::Map<Eigen::Matrix3d>(record.R_HB) = X_HB.rotation().matrix();
+    Eigen::Map<Eigen::Vector3d>(record.p_HoBo) = X_HB.translation();
+    Eigen::Map<Eigen::Vector3d>(record.half_width) = node.bv().half_width();
+    std::fill(std::begin(record.indices), std::end(record.indices), -1);
+    if (node.is_leaf()) {
+      record.num_indices = node.num_element_indices();
+      for (int i = 0; i < node.num_element_indices(); ++i) {
+        record.indices[i] = node.element_index(i);
+      }
+    } else {
+      record.num_indices = -1;
+      // N.B. `record` may be invalidated by appending the children.
+      AppendNode(node.left(), records);
+      AppendNode(node.right(), records);
+    }
+  }
+
+  std::vector<char> buffer_;
+};
+
+void WriteHeader(Kind kind, const std::string& key, int num_vertices,
+                 int num_elements, int num_nodes, Writer* writer) {
+  Header header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.endian_marker = kEndianMarker;
+  header.version = kVersion;
+  header.kind = kind;
+  header.key_size = key.size();
+  header.num_vertices = num_vertices;
+  header.num_elements = num_elements;
+  header.num_nodes = num_nodes;
+  writer->Append(&header, sizeof(header));
+  writer->Append(key.data(), key.size());
+}
+
+template <class MeshType>
+int CountNodes(const BvNode<Obb, MeshType>& node) {
+  if (node.is_leaf()) return 1;
+  return 1 + CountNodes(node.left()) + CountNodes(node.right());
+}
+
+/* Reads consecutive sections of a mapped file. */
+class Reader {
+ public:
+  Reader(const MappedFile* file, const std::string& filename)
+      : file_(file), filename_(filename) {}
+
+  /* Returns a pointer to the next `count` objects of type T. */
+  template <typename T>
+  const T* Take(size_t count) {
+    if (count > (file_->size() - offset_) / sizeof(T)) {
+      throw std::runtime_error(fmt::format(
+          "The precompiled hydroelastic geometry file '{}' is truncated",
+          filename_));
+    }
+    const T* result = reinterpret_cast<const T*>(file_->data() + offset_);
+    offset_ += PaddedSize(count * sizeof(T));
+    offset_ = std::min(offset_, file_->size());
+    return result;
+  }
+
+  /* Returns the header if the file was written for `kind` and `key` with the
+   current version of the format, or nullptr otherwise. */
+  const Header* TakeHeader(Kind kind, const std::string& key) {
+    if (file_->size() < sizeof(Header)) return nullptr;
+    const Header* header = Take<Header>(1);
+    if (std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0 ||
+        header->endian_marker != kEndianMarker ||
+        header->version != kVersion || header->kind != kind ||
+        header->key_size != key.size()) {
+      return nullptr;
+    }
+    const char* file_key = Take<char>(header->key_size);
+    if (std::memcmp(file_key, key.data(), key.size()) != 0) return nullptr;
+    // The counts are multiplied by small constants to size the sections that
+    // follow, so bound them first to keep a corrupt header from overflowing
+    // those products. Meshes index their vertices and elements with int.
+    constexpr uint64_t kMaxCount = std::numeric_limits<int>::max();
+    if (header->num_vertices > kMaxCount || header->num_elements > kMaxCount ||
+        header->num_nodes > kMaxCount) {
+      ThrowCorrupt();
+    }
+    return header;
+  }
+
+  template <class MeshType>
+  std::unique_ptr<MeshType> TakeMesh(const Header& header) {
+    constexpr int kVertexPerElement = MeshType::kVertexPerElement;
+    using ElementType = std::conditional_t<kVertexPerElement == 4,
+                                           VolumeElement, SurfaceTriangle>;
+    std::vector<Eigen::Vector3d> vertices = TakeVectors(header.num_vertices);
+    const int32_t* indices =
+        Take<int32_t>(kVertexPerElement * header.num_elements);
+    std::vector<ElementType> elements;
+    elements.reserve(header.num_elements);
+    for (uint64_t e = 0; e < header.num_elements; ++e) {
+      const int32_t* v = indices + kVertexPerElement * e;
+      for (int i = 0; i < kVertexPerElement; ++i) {
+        ThrowIfOutOfRange(v[i], header.num_vertices);
+      }
+      if constexpr (kVertexPerElement == 4) {
+        elements.emplace_back(v[0], v[1], v[2], v[3]);
+      } else {
+        elements.emplace_back(v[0], v[1], v[2]);
+      }
+    }
+    return std::make_unique<MeshType>(std::move(elements), std::move(vertices));
+  }
+
+  template <class MeshType>
+  std::unique_ptr<Bvh<Obb, MeshType>> TakeBvh(const Header& header) {
+    const NodeRecord<MeshType>* records =
+        Take<NodeRecord<MeshType>>(header.num_nodes);
+    // The writer's BVHs are balanced (each branch splits its elements in
+    // half), so no node of a valid file is deeper than twice the depth of a
+    // complete binary tree with the recorded number of nodes. Bounding the
+    // depth keeps a corrupt file from exhausting the stack.
+    int max_depth = 1;
+    for (uint64_t n = header.num_nodes; n > 1; n >>= 1) ++max_depth;
+    max_depth *= 2;
+    uint64_t next = 0;
+    auto root = MakeNode(records, header.num_nodes, header.num_elements,
+                         1, max_depth, &next);
+    if (next != header.num_nodes) ThrowCorrupt();
+    return std::make_unique<Bvh<Obb, MeshType>>(std::move(root));
+  }
+
+  /* Returns the next `count` 3-vectors. */
+  std::vector<Eigen::Vector3d> TakeVectors(size_t count) {
+    const Eigen::Vector3d* data =
+        reinterpret_cast<const Eigen::Vector3d*>(Take<double>(3 * count));
+    return std::vector<Eigen::Vector3d>(data, data + count);
+  }
+
+  void ThrowIfOutOfRange(int64_t index, uint64_t size) const {
+    if (index < 0 || static_cast<uint64_t>(index) >= size) ThrowCorrupt();
+  }
+
+  [[noreturn]] void ThrowCorrupt() const {
+    throw std::runtime_error(fmt::format(
+        "The precompiled hydroelastic geometry file '{}' is corrupt",
+        filename_));
+  }
+
+ private:
+  template <class MeshType>
+  std::unique_ptr<BvNode<Obb, MeshType>> MakeNode(
+      const NodeRecord<MeshType>* records, uint64_t num_nodes,
+      uint64_t num_elements, int depth, int max_depth, uint64_t* next) const {
+    using NodeType = BvNode<Obb, MeshType>;
+    if (*next >= num_nodes || depth > max_depth) ThrowCorrupt();
+    const NodeRecord<MeshType>& record = records[(*next)++];
+    // RotationMatrix only validates its matrix in debug builds, and a box that
+    // isn't the one written would silently miss contacts.
+    const Eigen::Map<const Eigen::Matrix3d> R_HB(record.R_HB);
+    const Eigen::Map<const Eigen::Vector3d> p_HoBo(record.p_HoBo);
+    const Eigen::Map<const Eigen::Vector3d> half_width(record.half_width);
+    if (!math::RotationMatrixd::IsValid(R_HB) || !p_HoBo.allFinite() ||
+        !half_width.allFinite() || (half_width.array() < 0).any()) {
+      ThrowCorrupt();
+    }
+    const math::RigidTransformd X_HB(math::RotationMatrixd(R_HB), p_HoBo);
+    // The recorded half widths are already padded.
+    Obb bv = Obb::MakeUnpadded(X_HB, half_width);
+    if (record.num_indices < 0) {
+      auto left = MakeNode(records, num_nodes, num_elements, depth + 1,
+                           max_depth, next);
+      auto right = MakeNode(records, num_nodes, num_elements, depth + 1,
+                            max_depth, next);
+      return std::make_unique<NodeType>(std::move(bv), std::move(left),
+                                        std::move(right));
+    }
+    if (record.num_indices == 0 ||
+        record.num_indices > NodeRecord<MeshType>::kMaxElementPerLeaf) {
+      ThrowCorrupt();
+    }
+    typename NodeType::LeafData data{record.num_indices, {}};
+    for (int i = 0; i < record.num_indices; ++i) {
+      ThrowIfOutOfRange(record.indices[i], num_elements);
+      data.indices[i] = record.indices[i];
+    }
+    return std::make_unique<NodeType>(std::move(bv), data);
+  }
+
+  const MappedFile* file_{};
+  std::string filename_;
+  size_t offset_{0};
+};
+
+}  // namespace
+
+void WritePrecompiledSoftMesh(
+    const std::string& filename, const std::string& key,
+    const VolumeMesh<double>& mesh,
+    const VolumeMeshFieldLinear<double, double>& pressure,
+    const Bvh<Obb, VolumeMesh<double>>& bvh) {
+  DRAKE_DEMAND(&pressure.mesh() == &mesh);
+  Writer writer;
+  WriteHeader(Kind::kSoft, key, mesh.num_vertices(), mesh.num_elements(),
+              CountNodes(bvh.root_node()), &writer);
+  writer.AppendMesh(mesh);
+  writer.Append(pressure.values().data(),
+                pressure.values().size() * sizeof(double));
+  std::vector<Eigen::Vector3d> gradients;
+  gradients.reserve(mesh.num_elements());
+  for (int e = 0; e < mesh.num_elements(); ++e) {
+    gradients.push_back(pressure.EvaluateGradient(e));
+  }
+  writer.Append(gradients.data(), gradients.size() * sizeof(Eigen::Vector3d));
+  writer.AppendBvh(bvh);
+  writer.WriteFile(filename);
+}
+
+void WritePrecompiledRigidMesh(
+    const std::string& filename, const std::string& key,
+    const TriangleSurfaceMesh<double>& mesh,
+    const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh) {
+  Writer writer;
+  WriteHeader(Kind::kRigid, key, mesh.num_vertices(), mesh.num_elements(),
+              CountNodes(bvh.root_node()), &writer);
+  writer.AppendMesh(mesh);
+  writer.AppendBvh(bvh);
+  writer.WriteFile(filename);
+}
+
+std::optional<PrecompiledSoftMesh> ReadPrecompiledSoftMesh(
+    const std::string& filename, const std::string& key) {
+  const MappedFile file(filename);
+  if (file.data() == nullptr) return std::nullopt;
+  Reader reader(&file, filename);
+  const Header* header = reader.TakeHeader(Kind::kSoft, key);
+  if (header == nullptr) return std::nullopt;
+
+  PrecompiledSoftMesh result;
+  result.mesh = reader.TakeMesh<VolumeMesh<double>>(*header);
+  const double* values_data = reader.Take<double>(header->num_vertices);
+  std::vector<double> values(values_data, values_data + header->num_vertices);
+  std::vector<Eigen::Vector3d> gradients =
+      reader.TakeVectors(header->num_elements);
+  result.pressure = std::make_unique<VolumeMeshFieldLinear<double, double>>(
+      std::move(values), result.mesh.get(), std::move(gradients));
+  result.bvh = reader.TakeBvh<VolumeMesh<double>>(*header);
+  return result;
+}
+
+std::optional<PrecompiledRigidMesh> ReadPrecompiledRigidMesh(
+    const std::string& filename, const std::string& key) {
+  const MappedFile file(filename);
+  if (file.data() == nullptr) return std::nullopt;
+  Reader reader(&file, filename);
+  const Header* header = reader.TakeHeader(Kind::kRigid, key);
+  if (header == nullptr) return std::nullopt;
+
+  PrecompiledRigidMesh result;
+  result.mesh = reader.TakeMesh<TriangleSurfaceMesh<double>>(*header);
+  result.bvh = reader.TakeBvh<TriangleSurfaceMesh<double>>(*header);
+  return result;
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
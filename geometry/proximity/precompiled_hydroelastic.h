@@ -0,0 +1,94 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "drake/geometry/proximity/bvh.h"
+#include "drake/geometry/proximity/obb.h"
+#include "drake/geometry/proximity/triangle_surface_mesh.h"
+#include "drake/geometry/proximity/volume_mesh.h"
+#include "drake/geometry/proximity/volume_mesh_field.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* @name Precompiled hydroelastic representations
+
+ Computing the hydroelastic representation of a geometry (its mesh, its
+ bounding volume hierarchy and, for compliant geometries, its pressure field)
+ can dominate the time it takes to load a scene. These functions write and read
+ a binary file format that stores the representation in its in-memory layout,
+ so that loading it is a matter of mapping the file into memory and copying
+ arrays. The vertices, elements, pressure values and gradients, and the
+ bounding volume hierarchy are loaded as stored, so none of the expensive steps
+ (meshing, computing the pressure field, fitting the bounding volumes) are
+ repeated. The cheap per-element quantities that the mesh and field
+ constructors derive from those arrays are still recomputed: the face areas,
+ normals and centroid of a TriangleSurfaceMesh and the pressure field's value at
+ the mesh origin for each element.
+
+ Each file records the `key` it was written with. The key is an arbitrary
+ string that uniquely identifies the inputs of the computation (e.g., the shape
+ parameters, a digest of the source file, the resolution hint and the elastic
+ modulus); readers pass the key they expect and files written for any other
+ key are ignored. The files are specific to the machine's endianness and to
+ the version of the format; files that don't match are likewise ignored.
+
+ See hydroelastic::MakePrecompiledKey() for the keys used by SceneGraph. */
+//@{
+
+/* The components of a precompiled compliant mesh. The `pressure` field and the
+ `bvh` refer to `mesh`. */
+struct PrecompiledSoftMesh {
+  std::unique_ptr<VolumeMesh<double>> mesh;
+  std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure;
+  std::unique_ptr<Bvh<Obb, VolumeMesh<double>>> bvh;
+};
+
+/* The components of a precompiled rigid mesh. The `bvh` refers to `mesh`. */
+struct PrecompiledRigidMesh {
+  std::unique_ptr<TriangleSurfaceMesh<double>> mesh;
+  std::unique_ptr<Bvh<Obb, TriangleSurfaceMesh<double>>> bvh;
+};
+
+/* Writes the compliant mesh representation to the file `filename`, tagged
+ with `key`.
+ @pre `pressure` has gradients (i.e., it was constructed with
+      calculate_gradient = true).
+ @throws std::exception if the file can't be written. */
+void WritePrecompiledSoftMesh(
+    const std::string& filename, const std::string& key,
+    const VolumeMesh<double>& mesh,
+    const VolumeMeshFieldLinear<double, double>& pressure,
+    const Bvh<Obb, VolumeMesh<double>>& bvh);
+
+/* Writes the rigid mesh representation to the file `filename`, tagged with
+ `key`.
+ @throws std::exception if the file can't be written. */
+void WritePrecompiledRigidMesh(
+    const std::string& filename, const std::string& key,
+    const TriangleSurfaceMesh<double>& mesh,
+    const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh);
+
+/* Reads the compliant mesh representation from the file `filename`. Returns
+ nullopt if the file doesn't exist, or if it wasn't written for the given
+ `key`, for a compliant mesh, or with the current version of the format.
+ @throws std::exception if the file is truncated or otherwise corrupt (which
+         includes a bounding volume hierarchy much deeper than any the writer
+         produces). */
+std::optional<PrecompiledSoftMesh> ReadPrecompiledSoftMesh(
+    const std::string& filename, const std::string& key);
+
+/* Reads the rigid mesh representation from the file `filename`. Returns
+ nullopt under the same conditions as ReadPrecompiledSoftMesh().
+ @throws std::exception if the file is truncated or otherwise corrupt. */
+std::optional<PrecompiledRigidMesh> ReadPrecompiledRigidMesh(
+    const std::string& filename, const std::string& key);
+
+//@}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -489,6 +489,91 @@ TEST_F(CollisionFilterTest, Equality) {
   EXPECT_TRUE(filters1 != filters2);
 }
 
+/* Geometry ids map to slots in a packed table; a removed geometry's slot is
+ reused by the next added geometry. Confirm that the reused slot doesn't
+ inherit the removed geometry's filters, in either the persistent state or the
+ transient history. */
+TEST_F(CollisionFilterTest, RemoveAndReuse) {
+  CollisionFilter filter;
+  const auto [id_A, id_B, id_C] = InitIds(&filter);
+  FilterAllPairs(&filter, {id_A, id_B, id_C}, false /* is_invariant */);
+  const FilterId transient_id = filter.ApplyTransient(
+      CollisionFilterDeclaration().AllowBetween(GeometrySet(id_A),
+                                                GeometrySet(id_C)),
+      get_extract_ids_functor());
+  EXPECT_TRUE(ExpectCanCollide(filter, id_A, id_C, kCanCollide));
+
+  filter.RemoveGeometry(id_C);
+  EXPECT_FALSE(filter.HasGeometry(id_C));
+  const GeometryId id_D = GeometryId::get_new_id();
+  filter.AddGeometry(id_D);
+  EXPECT_TRUE(ExpectCanCollide(filter, id_A, id_D, kCanCollide));
+  EXPECT_TRUE(ExpectCanCollide(filter, id_B, id_D, kCanCollide));
+  EXPECT_TRUE(ExpectCanCollide(filter, id_A, id_B, !kCanCollide));
+
+  /* Filter (B, D) in the persistent state; removing the transient declaration
+   must neither restore C's filters onto D nor lose the new filter. */
+  ASSERT_TRUE(filter.RemoveDeclaration(transient_id));
+  filter.Apply(CollisionFilterDeclaration().ExcludeBetween(GeometrySet(id_B),
+                                                           GeometrySet(id_D)),
+               get_extract_ids_functor());
+  EXPECT_TRUE(ExpectCanCollide(filter, id_A, id_D, kCanCollide));
+  EXPECT_TRUE(ExpectCanCollide(filter, id_B, id_D, !kCanCollide));
+
+  /* The result is equivalent to a filter that never had C. */
+  CollisionFilter expected;
+  expected.AddGeometry(id_A);
+  expected.AddGeometry(id_D);
+  expected.AddGeometry(id_B);
+  expected.Apply(CollisionFilterDeclaration()
+                     .ExcludeBetween(GeometrySet(id_A), GeometrySet(id_B))
+                     .ExcludeBetween(GeometrySet(id_B), GeometrySet(id_D)),
+                 get_extract_ids_functor());
+  EXPECT_TRUE(filter == expected);
+}
+
+/* Exercises tables large enough that rows span many words of the packed
+ representation, including transient declarations whose tables are mostly
+ undefined. */
+TEST_F(CollisionFilterTest, LargeTable) {
+  CollisionFilter filter;
+  vector<GeometryId> ids;
+  for (int i = 0; i < 200; ++i) {
+    ids.push_back(GeometryId::get_new_id());
+    filter.AddGeometry(ids.back());
+  }
+  /* Filter the pairs among the even-indexed geometries. */
+  vector<GeometryId> evens;
+  for (int i = 0; i < 200; i += 2) evens.push_back(ids[i]);
+  filter.Apply(CollisionFilterDeclaration().ExcludeWithin(GeometrySet(evens)),
+               get_extract_ids_functor());
+  const CollisionFilter persistent = filter;
+
+  /* Two transient declarations; removing the first must replay the second. */
+  const FilterId first = filter.ApplyTransient(
+      CollisionFilterDeclaration().ExcludeBetween(GeometrySet(ids[1]),
+                                                  GeometrySet(ids[199])),
+      get_extract_ids_functor());
+  filter.ApplyTransient(
+      CollisionFilterDeclaration().AllowBetween(GeometrySet(ids[0]),
+                                                GeometrySet(ids[198])),
+      get_extract_ids_functor());
+  ASSERT_TRUE(filter.RemoveDeclaration(first));
+  for (int i = 0; i < 200; ++i) {
+    for (int j = 0; j < i; ++j) {
+      const bool filtered =
+          (i % 2 == 0 && j % 2 == 0) && !(i == 198 && j == 0);
+      ASSERT_TRUE(ExpectCanCollide(filter, ids[i], ids[j], !filtered));
+    }
+  }
+
+  /* The history's tables are accounted for, and flattening releases them. */
+  EXPECT_GT(filter.table_bytes(), persistent.table_bytes());
+  filter.Flatten();
+  EXPECT_EQ(filter.table_bytes(), persistent.table_bytes());
+  EXPECT_FALSE(filter == persistent);
+}
+
 }  // namespace internal
 }  // namespace geometry
 }  // namespace drake
@@ -4,6 +4,7 @@
 #include <filesystem>
 #include <functional>
 #include <limits>
+#include <string>
 
 #include <fmt/format.h>
 #include <gtest/gtest.h>
@@ -14,6 +15,7 @@
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/geometry/proximity/make_sphere_field.h"
 #include "drake/geometry/proximity/make_sphere_mesh.h"
+#include "drake/geometry/proximity/precompiled_hydroelastic.h"
 #include "drake/geometry/proximity/proximity_utilities.h"
 #include "drake/geometry/proximity/tessellation_strategy.h"
 #include "drake/geometry/proximity_properties.h"
@@ -1265,6 +1267,115 @@ typedef ::testing::Types<Sphere, Box, Capsule, Cylinder, Ellipsoid, HalfSpace,
 INSTANTIATE_TYPED_TEST_SUITE_P(My, HydroelasticSoftGeometryErrorTests,
                                SoftErrorShapeTypes);
 
+GTEST_TEST(PrecompiledHydroelasticTest, Keys) {
+  ProximityProperties rigid;
+  AddRigidHydroelasticProperties(0.5, &rigid);
+  ProximityProperties soft;
+  AddCompliantHydroelasticProperties(0.5, 1e7, &soft);
+  ProximityProperties soft_stiffer;
+  AddCompliantHydroelasticProperties(0.5, 1e8, &soft_stiffer);
+  ProximityProperties soft_finer;
+  AddCompliantHydroelasticProperties(0.25, 1e7, &soft_finer);
+
+  const Sphere sphere(1.0);
+  const std::optional<std::string> rigid_key =
+      MakePrecompiledKey(sphere, HydroelasticType::kRigid, rigid);
+  const std::optional<std::string> soft_key =
+      MakePrecompiledKey(sphere, HydroelasticType::kSoft, soft);
+  ASSERT_TRUE(rigid_key.has_value());
+  ASSERT_TRUE(soft_key.has_value());
+  EXPECT_NE(*rigid_key, *soft_key);
+  EXPECT_NE(*soft_key,
+            MakePrecompiledKey(sphere, HydroelasticType::kSoft, soft_stiffer));
+  EXPECT_NE(*soft_key,
+            MakePrecompiledKey(sphere, HydroelasticType::kSoft, soft_finer));
+  EXPECT_NE(*soft_key,
+            MakePrecompiledKey(Sphere(2.0), HydroelasticType::kSoft, soft));
+  EXPECT_EQ(*soft_key,
+            MakePrecompiledKey(Sphere(1.0), HydroelasticType::kSoft, soft));
+
+  // Meshes are identified by the contents of their files.
+  const std::string obj =
+      FindResourceOrThrow("drake/geometry/test/quad_cube.obj");
+  const std::string copy = temp_directory() + "/copy.obj";
+  std::filesystem::copy_file(obj, copy);
+  EXPECT_EQ(MakePrecompiledKey(Convex(obj), HydroelasticType::kRigid, rigid),
+            MakePrecompiledKey(Convex(copy), HydroelasticType::kRigid, rigid));
+  EXPECT_NE(
+      MakePrecompiledKey(Convex(obj), HydroelasticType::kRigid, rigid),
+      MakePrecompiledKey(Convex(obj, 2.0), HydroelasticType::kRigid, rigid));
+
+  // Representations that can't be precompiled.
+  EXPECT_FALSE(MakePrecompiledKey(HalfSpace(), HydroelasticType::kSoft, soft)
+                   .has_value());
+  EXPECT_FALSE(
+      MakePrecompiledKey(Convex(temp_directory() + "/missing.obj"),
+                         HydroelasticType::kRigid, rigid)
+          .has_value());
+  EXPECT_FALSE(MakePrecompiledKey(sphere, HydroelasticType::kSoft, rigid)
+                   .has_value());
+}
+
+/* Geometries loads representations from the directory named by the
+ ('hydroelastic', 'precompiled_dir') property, if it holds them. */
+GTEST_TEST(PrecompiledHydroelasticTest, LoadFromDirectory) {
+  const std::string directory = temp_directory();
+  const Sphere sphere(1.0);
+  ProximityProperties coarse;
+  AddCompliantHydroelasticProperties(1.0, 1e7, &coarse);
+  ProximityProperties fine;
+  AddCompliantHydroelasticProperties(0.25, 1e7, &fine);
+  ProximityProperties fine_precompiled(fine);
+  fine_precompiled.AddProperty(kHydroGroup, kPrecompiledDir, directory);
+
+  // Write the coarse representation under the key of the fine one, so we can
+  // tell whether the representation was loaded or computed.
+  const std::optional<std::string> coarse_file =
+      WritePrecompiledRepresentation(sphere, coarse, directory);
+  ASSERT_TRUE(coarse_file.has_value());
+  const std::string fine_key =
+      *MakePrecompiledKey(sphere, HydroelasticType::kSoft, fine);
+  const std::optional<SoftGeometry> coarse_geometry =
+      MakeSoftRepresentation(sphere, coarse);
+  WritePrecompiledSoftMesh(GetPrecompiledFilename(directory, fine_key),
+                           fine_key, coarse_geometry->mesh(),
+                           coarse_geometry->pressure_field(),
+                           coarse_geometry->bvh());
+
+  const GeometryId computed_id = GeometryId::get_new_id();
+  const GeometryId loaded_id = GeometryId::get_new_id();
+  Geometries geometries;
+  geometries.MaybeAddGeometry(sphere, computed_id, fine);
+  geometries.MaybeAddGeometry(sphere, loaded_id, fine_precompiled);
+
+  const SoftGeometry& computed = geometries.soft_geometry(computed_id);
+  const SoftGeometry& loaded = geometries.soft_geometry(loaded_id);
+  EXPECT_GT(computed.mesh().num_vertices(),
+            coarse_geometry->mesh().num_vertices());
+  EXPECT_TRUE(loaded.mesh().Equal(coarse_geometry->mesh()));
+  EXPECT_TRUE(loaded.pressure_field().Equal(coarse_geometry->pressure_field()));
+  EXPECT_TRUE(loaded.bvh().Equal(coarse_geometry->bvh()));
+
+  // Representations that aren't in the directory are computed.
+  const GeometryId rigid_id = GeometryId::get_new_id();
+  ProximityProperties rigid;
+  AddRigidHydroelasticProperties(0.5, &rigid);
+  rigid.AddProperty(kHydroGroup, kPrecompiledDir, directory);
+  geometries.MaybeAddGeometry(sphere, rigid_id, rigid);
+  EXPECT_EQ(geometries.hydroelastic_type(rigid_id), HydroelasticType::kRigid);
+
+  // A damaged file is ignored (with a warning) and the representation is
+  // computed instead.
+  const std::string fine_file = GetPrecompiledFilename(directory, fine_key);
+  std::filesystem::resize_file(fine_file,
+                               std::filesystem::file_size(fine_file) / 2);
+  const GeometryId recomputed_id = GeometryId::get_new_id();
+  geometries.MaybeAddGeometry(sphere, recomputed_id, fine_precompiled);
+  EXPECT_TRUE(geometries.soft_geometry(recomputed_id)
+                  .mesh()
+                  .Equal(computed.mesh()));
+}
+
 }  // namespace
 }  // namespace hydroelastic
 }  // namespace internal
@@ -1,8 +1,14 @@
 #include "drake/geometry/proximity/make_mesh_from_vtk.h"
 
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 
 namespace drake {
@@ -75,6 +81,76 @@ GTEST_TEST(MakeVolumeMeshFromVtkTest, NegativeVolumeThrow) {
       "so you might want to switch two consecutive vertices.");
 }
 
+// Appends the big-endian bytes of `value`, as legacy binary VTK files store
+// them.
+template <typename T>
+void AppendBigEndian(T value, std::string* bytes) {
+  static_assert(sizeof(T) == sizeof(uint32_t));
+  uint32_t bits{};
+  std::memcpy(&bits, &value, sizeof(bits));
+  for (int shift = 24; shift >= 0; shift -= 8) {
+    bytes->push_back(static_cast<char>((bits >> shift) & 0xff));
+  }
+}
+
+// Files that the parallel parser doesn't support are read with the VTK
+// library instead.
+GTEST_TEST(MakeVolumeMeshFromVtkTest, BinaryFile) {
+  std::string contents =
+      "# vtk DataFile Version 3.0\none tetrahedron\nBINARY\n"
+      "DATASET UNSTRUCTURED_GRID\nPOINTS 4 float\n";
+  for (float coordinate : {0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1}) {
+    AppendBigEndian(coordinate, &contents);
+  }
+  contents += "\nCELLS 1 5\n";
+  for (int32_t index : {4, 0, 1, 2, 3}) {
+    AppendBigEndian(index, &contents);
+  }
+  contents += "\nCELL_TYPES 1\n";
+  AppendBigEndian(int32_t{10}, &contents);
+  contents += "\n";
+  const std::string filename = temp_directory() + "/binary.vtk";
+  std::ofstream(filename, std::ios::binary) << contents;
+
+  const VolumeMesh<double> volume_mesh =
+      MakeVolumeMeshFromVtk<double>(Mesh(filename, 0.5));
+
+  const VolumeMesh<double> expected_mesh{
+      {{0, 1, 2, 3}},
+      {0.5 * Vector3d::Zero(), 0.5 * Vector3d::UnitX(),
+       0.5 * Vector3d::UnitY(), 0.5 * Vector3d::UnitZ()}};
+  EXPECT_TRUE(volume_mesh.Equal(expected_mesh));
+}
+
+GTEST_TEST(MakeVolumeMeshFromVtkTest, FieldDataBeforeGrid) {
+  const std::string filename = temp_directory() + "/field.vtk";
+  std::ofstream(filename) << R"""(# vtk DataFile Version 3.0
+one tetrahedron
+ASCII
+DATASET UNSTRUCTURED_GRID
+FIELD FieldData 1
+TIME 1 1 double
+2.5
+POINTS 4 double
+0 0 0
+1 0 0
+0 1 0
+0 0 1
+CELLS 1 5
+4 0 1 2 3
+CELL_TYPES 1
+10
+)""";
+
+  const VolumeMesh<double> volume_mesh =
+      MakeVolumeMeshFromVtk<double>(Mesh(filename));
+
+  const VolumeMesh<double> expected_mesh{
+      {{0, 1, 2, 3}},
+      {Vector3d::Zero(), Vector3d::UnitX(), Vector3d::UnitY(),
+       Vector3d::UnitZ()}};
+  EXPECT_TRUE(volume_mesh.Equal(expected_mesh));
+}
 
 }  // namespace
 }  // namespace internal
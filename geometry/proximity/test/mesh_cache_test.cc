@@ -0,0 +1,230 @@
+#include "drake/geometry/proximity/mesh_cache.h"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+class MeshCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    file_a_ = WriteFile("a.obj", "v 0 0 0\n");
+    file_b_ = WriteFile("b.obj", "v 1 1 1\n");
+  }
+
+  std::string WriteFile(const std::string& name, const std::string& contents) {
+    const std::string path = dir_ + "/" + name;
+    std::ofstream(path) << contents;
+    return path;
+  }
+
+  /* Requests an int for `filename`, counting the invocations of compute. */
+  int Get(const std::string& filename, double scale = 1.0,
+          const std::string& tag = "tag") {
+    return *cache_.GetOrCompute<int>(filename, scale, tag, [this]() {
+      return ++num_computes_;
+    });
+  }
+
+  const std::string dir_{temp_directory()};
+  MeshCache cache_;
+  std::string file_a_;
+  std::string file_b_;
+  int num_computes_{0};
+};
+
+TEST_F(MeshCacheTest, HitsAndMisses) {
+  EXPECT_EQ(Get(file_a_), 1);
+  EXPECT_EQ(Get(file_a_), 1);
+  EXPECT_EQ(Get(file_b_), 2);
+  EXPECT_EQ(Get(file_b_), 2);
+  EXPECT_EQ(num_computes_, 2);
+
+  const MeshCache::Stats stats = cache_.GetStats();
+  EXPECT_EQ(stats.hits, 2);
+  EXPECT_EQ(stats.misses, 2);
+  EXPECT_GE(stats.load_time, 0.0);
+  EXPECT_EQ(stats.evictions, 0);
+  EXPECT_EQ(stats.bytes, 16);
+
+  cache_.Clear();
+  EXPECT_EQ(cache_.GetStats().hits, 0);
+  EXPECT_EQ(cache_.GetStats().misses, 0);
+  EXPECT_EQ(Get(file_a_), 3);
+}
+
+TEST_F(MeshCacheTest, KeyIncludesScaleTagAndType) {
+  EXPECT_EQ(Get(file_a_, 1.0, "tag"), 1);
+  EXPECT_EQ(Get(file_a_, 2.0, "tag"), 2);
+  EXPECT_EQ(Get(file_a_, 1.0, "other"), 3);
+  const std::shared_ptr<const double> value = cache_.GetOrCompute<double>(
+      file_a_, 1.0, "tag", []() { return 0.5; });
+  EXPECT_EQ(*value, 0.5);
+  EXPECT_EQ(Get(file_a_, 2.0, "tag"), 2);
+  EXPECT_EQ(cache_.GetStats().misses, 4);
+}
+
+/* Files are identified by their contents, not their names. */
+TEST_F(MeshCacheTest, ContentAddressed) {
+  const std::string copy_of_a = WriteFile("copy_of_a.obj", "v 0 0 0\n");
+  ASSERT_NE(copy_of_a, file_a_);
+  EXPECT_EQ(Get(file_a_), 1);
+  EXPECT_EQ(Get(copy_of_a), 1);
+
+  // Editing a file invalidates its entry. The edit keeps the size, so it's
+  // detected through the modification time, which we push forward explicitly
+  // lest the file system's timestamp resolution hide the edit.
+  const auto time = std::filesystem::last_write_time(copy_of_a);
+  WriteFile("copy_of_a.obj", "v 0 0 1\n");
+  std::filesystem::last_write_time(copy_of_a, time + std::chrono::seconds(1));
+  EXPECT_EQ(Get(copy_of_a), 2);
+}
+
+/* The digest of a file is remembered for as long as its path, size and
+ modification time don't change; the file is not hashed again on each
+ request. */
+TEST_F(MeshCacheTest, DigestsAreKeyedOnFileStamp) {
+  EXPECT_EQ(Get(file_a_), 1);
+  // Rewriting the file but restoring its size and modification time goes
+  // unnoticed, which proves that the contents weren't hashed again.
+  const auto time = std::filesystem::last_write_time(file_a_);
+  WriteFile("a.obj", "v 1 1 1\n");
+  std::filesystem::last_write_time(file_a_, time);
+  EXPECT_EQ(Get(file_a_), 1);
+
+  // Forgetting the digests exposes the new contents, which match b.obj.
+  cache_.Clear();
+  EXPECT_EQ(Get(file_b_), 2);
+  EXPECT_EQ(Get(file_a_), 2);
+}
+
+/* The digests handed out directly are the remembered ones, too. */
+TEST_F(MeshCacheTest, GetFileDigest) {
+  const std::optional<FileContentDigest> digest =
+      cache_.GetFileDigest(file_a_);
+  EXPECT_EQ(digest, DigestFileContents(file_a_));
+  EXPECT_NE(digest, cache_.GetFileDigest(file_b_));
+  EXPECT_FALSE(cache_.GetFileDigest(dir_ + "/missing.obj").has_value());
+
+  // As above, an edit that preserves the file stamp goes unnoticed until the
+  // digests are forgotten.
+  const auto time = std::filesystem::last_write_time(file_a_);
+  WriteFile("a.obj", "v 1 1 1\n");
+  std::filesystem::last_write_time(file_a_, time);
+  EXPECT_EQ(cache_.GetFileDigest(file_a_), digest);
+  cache_.Clear();
+  EXPECT_EQ(cache_.GetFileDigest(file_a_), cache_.GetFileDigest(file_b_));
+}
+
+/* Each entry is charged the size of its file (8 bytes here); the least
+ recently used entries are evicted once the budget is exceeded. */
+TEST_F(MeshCacheTest, EvictionHonorsBudget) {
+  MeshCache cache(16);
+  EXPECT_EQ(cache.max_bytes(), 16);
+  const std::string file_c = WriteFile("c.obj", "v 2 2 2\n");
+  auto get = [&cache, this](const std::string& filename) {
+    return *cache.GetOrCompute<int>(filename, 1.0, "tag", [this]() {
+      return ++num_computes_;
+    });
+  };
+  EXPECT_EQ(get(file_a_), 1);
+  EXPECT_EQ(get(file_b_), 2);
+  EXPECT_EQ(cache.GetStats().bytes, 16);
+  // Touch a, so that b becomes the least recently used.
+  EXPECT_EQ(get(file_a_), 1);
+  EXPECT_EQ(get(file_c), 3);
+  EXPECT_EQ(cache.GetStats().evictions, 1);
+  EXPECT_EQ(cache.GetStats().bytes, 16);
+  EXPECT_EQ(get(file_a_), 1);
+  EXPECT_EQ(get(file_b_), 4);
+  EXPECT_EQ(cache.GetStats().evictions, 2);
+
+  // A single entry larger than the whole budget is still cached.
+  MeshCache tiny(4);
+  EXPECT_EQ(*tiny.GetOrCompute<int>(file_a_, 1.0, "tag", []() { return 1; }),
+            1);
+  EXPECT_EQ(*tiny.GetOrCompute<int>(file_a_, 1.0, "tag", []() { return 2; }),
+            1);
+  EXPECT_EQ(tiny.GetStats().evictions, 0);
+}
+
+TEST_F(MeshCacheTest, ValuesAreShared) {
+  const std::shared_ptr<const std::vector<int>> first =
+      cache_.GetOrCompute<std::vector<int>>(file_a_, 1.0, "tag", []() {
+        return std::vector<int>{1, 2, 3};
+      });
+  const std::shared_ptr<const std::vector<int>> second =
+      cache_.GetOrCompute<std::vector<int>>(file_a_, 1.0, "tag", []() {
+        return std::vector<int>{};
+      });
+  EXPECT_EQ(first.get(), second.get());
+
+  // Values outlive their eviction.
+  cache_.Clear();
+  EXPECT_EQ(first->size(), 3);
+}
+
+TEST_F(MeshCacheTest, ExceptionsAreNotCached) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      cache_.GetOrCompute<int>(file_a_, 1.0, "tag",
+                               []() -> int {
+                                 throw std::runtime_error("bad mesh");
+                               }),
+      "bad mesh");
+  EXPECT_EQ(Get(file_a_), 1);
+  EXPECT_EQ(Get(file_a_), 1);
+}
+
+/* Unreadable files bypass the cache, so that compute() reports the error. */
+TEST_F(MeshCacheTest, UnreadableFile) {
+  const std::string missing = dir_ + "/missing.obj";
+  EXPECT_EQ(Get(missing), 1);
+  EXPECT_EQ(Get(missing), 2);
+  EXPECT_EQ(cache_.GetStats().hits, 0);
+  EXPECT_EQ(cache_.GetStats().misses, 0);
+}
+
+TEST_F(MeshCacheTest, ConcurrentRequests) {
+  constexpr int kNumThreads = 8;
+  std::vector<std::shared_ptr<const int>> results(kNumThreads);
+  std::atomic<int> num_computes{0};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&, i]() {
+      results[i] = cache_.GetOrCompute<int>(file_a_, 1.0, "tag", [&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return ++num_computes;
+      });
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(num_computes, 1);
+  for (const auto& result : results) {
+    EXPECT_EQ(result.get(), results[0].get());
+  }
+  EXPECT_EQ(cache_.GetStats().misses, 1);
+  EXPECT_EQ(cache_.GetStats().hits, kNumThreads - 1);
+}
+
+TEST_F(MeshCacheTest, GetInstance) {
+  EXPECT_EQ(&MeshCache::GetInstance(), &MeshCache::GetInstance());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
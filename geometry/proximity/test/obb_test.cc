@@ -1296,6 +1296,15 @@ GTEST_TEST(ObbTest, TestEqual) {
   EXPECT_TRUE(a.Equal(d));
 }
 
+GTEST_TEST(ObbTest, MakeUnpadded) {
+  const Obb a{RigidTransformd(Vector3d{0.5, 0.25, -0.75}), Vector3d{1, 2, 3}};
+  // The constructor pads the half widths.
+  EXPECT_NE(a.half_width(), Vector3d(1, 2, 3));
+  // Restoring the box from its (padded) half widths doesn't pad them again.
+  const Obb b = Obb::MakeUnpadded(a.pose(), a.half_width());
+  EXPECT_TRUE(a.Equal(b));
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace geometry
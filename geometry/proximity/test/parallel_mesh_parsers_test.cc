@@ -0,0 +1,452 @@
+#include "drake/geometry/proximity/parallel_mesh_parsers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+#include "drake/geometry/proximity/vtk_to_volume_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+
+class ParallelMeshParsersTest : public ::testing::Test {
+ protected:
+  std::string WriteFile(const std::string& name, const std::string& contents) {
+    const std::string filename = dir_ + "/" + name;
+    std::ofstream(filename) << contents;
+    return filename;
+  }
+
+  const std::string dir_{temp_directory()};
+};
+
+/* The parsers produce the same meshes as the readers they replace. */
+TEST_F(ParallelMeshParsersTest, MatchesExistingReaders) {
+  for (const char* name : {"convex.obj", "extruded_u.obj",
+                           "non_convex_mesh.obj", "octahedron.obj",
+                           "quad_cube.obj"}) {
+    SCOPED_TRACE(name);
+    const std::string filename =
+        FindResourceOrThrow(fmt::format("drake/geometry/test/{}", name));
+    EXPECT_TRUE(ParseObjToTriangleSurfaceMesh(filename, 1.5).Equal(
+        ReadObjToTriangleSurfaceMesh(filename, 1.5)));
+  }
+  for (const char* name :
+       {"non_convex_mesh.vtk", "one_negative_tetrahedron.vtk",
+        "one_tetrahedron.vtk", "two_tetrahedra_with_field_variable.vtk"}) {
+    SCOPED_TRACE(name);
+    const std::string filename =
+        FindResourceOrThrow(fmt::format("drake/geometry/test/{}", name));
+    EXPECT_TRUE(ParseVtkToVolumeMesh(filename, 0.5).Equal(
+        ReadVtkToVolumeMesh(filename, 0.5)));
+  }
+}
+
+TEST_F(ParallelMeshParsersTest, ObjStatements) {
+  const std::string filename = WriteFile("statements.obj", R"""(
+# A comment.
+mtllib material.mtl
+o first
+v 0 0 0
+v 1 0 0
+v 0 1 0 1.0
+vt 0 0
+vn 0 0 1
+f 1/1/1 2/1/1 3/1/1
+g second
+  v 0 0 1
+usemtl material
+s off
+f -4//1   -3//1 -1//1
+f 1 2
+l 1 2
+o empty
+)""");
+  const ObjPolygons polygons = ParseObjPolygons(filename, 2.0, false);
+  EXPECT_EQ(polygons.vertices,
+            (std::vector<Vector3d>{Vector3d(0, 0, 0), Vector3d(2, 0, 0),
+                                   Vector3d(0, 2, 0), Vector3d(0, 0, 2)}));
+  EXPECT_EQ(polygons.faces, (std::vector<int>{3, 0, 1, 2, 3, 0, 1, 3}));
+  EXPECT_EQ(polygons.num_faces, 2);
+  EXPECT_EQ(polygons.num_objects, 2);
+
+  const std::string one_object =
+      WriteFile("one_object.obj", "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n");
+  EXPECT_EQ(ParseObjPolygons(one_object, 1.0, false).num_objects, 1);
+  EXPECT_EQ(ParseObjPolygons(WriteFile("empty.obj", ""), 1.0, false)
+                .num_objects, 0);
+}
+
+/* Numbers are parsed exactly as strtod parses them. */
+TEST_F(ParallelMeshParsersTest, ObjNumbers) {
+  const std::vector<std::string> numbers{
+      "0", "-0.0", "1", "+2.5", ".5", "5.", "0.1", "-1e-3", "2.5E+2",
+      "1.00000000000000000000001", "123456789012345678901234567890",
+      "0.000000000000000000000000123", "1.7976931348623157e308",
+      "4.9406564584124654e-324", "0.30000000000000004", "3.14159265358979",
+      "9007199254740993"};
+  std::string contents;
+  for (const std::string& number : numbers) {
+    contents += fmt::format("v {0} {0} {0}\n", number);
+  }
+  const ObjPolygons polygons =
+      ParseObjPolygons(WriteFile("numbers.obj", contents), 1.0, false);
+  ASSERT_EQ(polygons.vertices.size(), numbers.size());
+  for (size_t i = 0; i < numbers.size(); ++i) {
+    SCOPED_TRACE(numbers[i]);
+    const double expected = std::strtod(numbers[i].c_str(), nullptr);
+    EXPECT_EQ(polygons.vertices[i], Vector3d::Constant(expected));
+    EXPECT_EQ(std::signbit(polygons.vertices[i].x()), std::signbit(expected));
+  }
+}
+
+TEST_F(ParallelMeshParsersTest, ObjTriangulation) {
+  // The quadrilaterals are split along their shorter diagonal.
+  const std::string filename = WriteFile("polygons.obj", R"""(
+v 0 0 0
+v 2 0 0
+v 2 1 0
+v 0 1 0
+f 1 2 3 4
+f 2 3 4 1
+f 1 2 3
+)""");
+  const ObjPolygons polygons = ParseObjPolygons(filename, 1.0, true);
+  EXPECT_EQ(polygons.num_faces, 5);
+  EXPECT_EQ(polygons.faces,
+            (std::vector<int>{3, 0, 1, 3, 3, 1, 2, 3,  // Equal diagonals.
+                              3, 1, 2, 0, 3, 2, 3, 0,  // Rotated.
+                              3, 0, 1, 2}));
+  const std::optional<ObjPolygons> maybe_polygons =
+      MaybeParseObjPolygons(filename, 1.0, true);
+  ASSERT_TRUE(maybe_polygons.has_value());
+  EXPECT_EQ(maybe_polygons->faces, polygons.faces);
+
+  const TriangleSurfaceMesh<double> mesh =
+      ParseObjToTriangleSurfaceMesh(filename);
+  ASSERT_EQ(mesh.num_triangles(), 5);
+  EXPECT_EQ(mesh.element(3).vertex(0), 2);
+  EXPECT_EQ(mesh.element(3).vertex(1), 3);
+  EXPECT_EQ(mesh.element(3).vertex(2), 0);
+  const std::optional<TriangleSurfaceMesh<double>> maybe_mesh =
+      MaybeParseObjToTriangleSurfaceMesh(filename);
+  ASSERT_TRUE(maybe_mesh.has_value());
+  EXPECT_TRUE(maybe_mesh->Equal(mesh));
+
+  // Larger polygons, which may be concave, are only read untriangulated.
+  const std::string concave = WriteFile("concave.obj", R"""(
+v 0 0 0
+v 4 0 0
+v 4 4 0
+v 2 1 0
+v 0 4 0
+f 1 2 3 4 5
+)""");
+  EXPECT_EQ(ParseObjPolygons(concave, 1.0, false).faces,
+            (std::vector<int>{5, 0, 1, 2, 3, 4}));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ParseObjPolygons(concave, 1.0, true),
+      ".*triangulating a face with 5 vertices is not supported");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ParseObjToTriangleSurfaceMesh(concave),
+      ".*triangulating a face with 5 vertices is not supported");
+  EXPECT_FALSE(MaybeParseObjPolygons(concave, 1.0, true).has_value());
+  EXPECT_FALSE(MaybeParseObjToTriangleSurfaceMesh(concave).has_value());
+
+  const std::string skewed = WriteFile("skewed.obj", R"""(
+v 0 0 0
+v 1 0 0
+v 5 1 0
+v 0 1 0
+f 1 2 3 4
+)""");
+  EXPECT_EQ(ParseObjPolygons(skewed, 1.0, true).faces,
+            (std::vector<int>{3, 0, 1, 3, 3, 1, 2, 3}));
+  const std::string narrow = WriteFile("narrow.obj", R"""(
+v 0 0 0
+v 1 0 0
+v 1 1 0
+v -5 1 0
+f 1 2 3 4
+)""");
+  EXPECT_EQ(ParseObjPolygons(narrow, 1.0, true).faces,
+            (std::vector<int>{3, 0, 1, 2, 3, 0, 2, 3}));
+}
+
+/* Files larger than a chunk are split into several, which must be stitched
+ together; relative indices and error line numbers span chunks. */
+TEST_F(ParallelMeshParsersTest, ObjLargeFile) {
+  constexpr int kNumStrips = 60000;
+  std::string contents;
+  for (int i = 0; i < kNumStrips; ++i) {
+    contents += fmt::format("v {} 0 0.125\nv {} 1 -0.125\n", i, i);
+    if (i > 0) {
+      contents += "f -4 -3 -1 -2\n";
+      contents += fmt::format("f {} {} {}\n", 2 * i - 1, 2 * i + 1, 2 * i + 2);
+    }
+  }
+  ASSERT_GT(contents.size(), 3 << 20);
+  const std::string filename = WriteFile("large.obj", contents);
+  const ObjPolygons polygons = ParseObjPolygons(filename, 1.0, false);
+  ASSERT_EQ(polygons.vertices.size(), 2 * kNumStrips);
+  ASSERT_EQ(polygons.num_faces, 2 * (kNumStrips - 1));
+  EXPECT_EQ(polygons.num_objects, 1);
+  for (int i = 0; i < kNumStrips; ++i) {
+    ASSERT_EQ(polygons.vertices[2 * i], Vector3d(i, 0, 0.125));
+    ASSERT_EQ(polygons.vertices[2 * i + 1], Vector3d(i, 1, -0.125));
+  }
+  for (int i = 1; i < kNumStrips; ++i) {
+    const int* face = &polygons.faces[9 * (i - 1)];
+    ASSERT_EQ(std::vector<int>(face, face + 9),
+              (std::vector<int>{4, 2 * i - 2, 2 * i - 1, 2 * i + 1, 2 * i, 3,
+                                2 * i - 2, 2 * i, 2 * i + 1}));
+  }
+
+  const TriangleSurfaceMesh<double> mesh =
+      ParseObjToTriangleSurfaceMesh(filename);
+  EXPECT_EQ(mesh.num_triangles(), 3 * (kNumStrips - 1));
+
+  const int num_lines = std::count(contents.begin(), contents.end(), '\n');
+  const std::string bad_filename =
+      WriteFile("bad.obj", contents + "v 1 2 three\n");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ParseObjPolygons(bad_filename, 1.0, false),
+      fmt::format(".*bad.obj' at line {}: couldn't parse the vertex position",
+                  num_lines + 1));
+}
+
+TEST_F(ParallelMeshParsersTest, ObjErrors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ParseObjPolygons(dir_ + "/missing.obj", 1.0, false),
+      "Cannot open file '.*missing.obj'");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ParseObjPolygons(WriteFile("bad_vertex.obj", "v 1 2\n"), 1.0, false),
+      ".*line 1: couldn't parse the vertex position");
+  // Numbers must be followed by whitespace (or a '/', for face indices), so
+  // that trailing garbage is rejected rather than ignored.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ParseObjPolygons(WriteFile("garbage.obj", "v 1.0abc 2 3\n"), 1.0, false),
+      ".*line 1: couldn't parse the vertex position");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ParseObjPolygons(WriteFile("zero.obj", "v 1 2 3\n\nf 0 1 1\n"), 1.0,
+                       false),
+      ".*line 3: couldn't parse the face's vertex index");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ParseObjPolygons(WriteFile("garbage_index.obj", "v 1 2 3\nf 1x 1 1\n"),
+                       1.0, false),
+      ".*line 2: couldn't parse the face's vertex index");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ParseObjPolygons(WriteFile("out_of_range.obj", "v 1 2 3\nf 1 2 -2\n"),
+                       1.0, false),
+      ".*a face refers to the vertex with index 2, but the file has 1 "
+      "vertices");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ParseObjToTriangleSurfaceMesh(WriteFile("no_faces.obj", "v 1 2 3\n")),
+      "The Wavefront obj file '.*no_faces.obj' has no faces.");
+}
+
+/* The Maybe*() variants return nullopt for any file that they can open but not
+ parse, so that the callers fall back to tinyobjloader, which is more lenient
+ (e.g., it ignores trailing characters) and reports errors in its own terms. */
+TEST_F(ParallelMeshParsersTest, ObjMaybeFallsBack) {
+  for (const char* contents :
+       {"v 1.0abc 2 3\nv 0 1 0\nv 0 0 1\nf 1 2 3\n",
+        "v 1 0 0\nv 0 1 0\nv 0 0 1\nf 1 2 3 # comment\n",
+        "v 1 0 0\nv 0 1 0\nv 0 0 1\nf 1 2 4\n"}) {
+    const std::string filename = WriteFile("fallback.obj", contents);
+    EXPECT_FALSE(MaybeParseObjPolygons(filename, 1.0, false).has_value())
+        << contents;
+    EXPECT_FALSE(MaybeParseObjToTriangleSurfaceMesh(filename).has_value())
+        << contents;
+  }
+  EXPECT_FALSE(
+      MaybeParseObjToTriangleSurfaceMesh(WriteFile("no_faces.obj", "v 1 2 3\n"))
+          .has_value());
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MaybeParseObjPolygons(dir_ + "/missing.obj", 1.0, false),
+      "Cannot open file '.*missing.obj'");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MaybeParseObjToTriangleSurfaceMesh(dir_ + "/missing.obj"),
+      "Cannot open file '.*missing.obj'");
+}
+
+TEST_F(ParallelMeshParsersTest, VtkScale) {
+  const std::string filename =
+      FindResourceOrThrow("drake/geometry/test/one_tetrahedron.vtk");
+  const double kScale = 0.01;
+  const VolumeMesh<double> expected_mesh{
+      {{0, 1, 2, 3}},
+      {kScale * Vector3d::Zero(), kScale * Vector3d::UnitX(),
+       kScale * Vector3d::UnitY(), kScale * Vector3d::UnitZ()}};
+  EXPECT_TRUE(ParseVtkToVolumeMesh(filename, kScale).Equal(expected_mesh));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ParseVtkToVolumeMesh(filename, 0.0),
+      "ParseVtkToVolumeMesh: scale=0 is not a positive number");
+}
+
+/* The 5.1 format splits the cells into offsets and connectivity, and may
+ include metadata. */
+TEST_F(ParallelMeshParsersTest, VtkVersion51) {
+  const std::string filename = WriteFile("version_5_1.vtk",
+                                         "# vtk DataFile Version 5.1\n"
+                                         R"""(vtk output
+ASCII
+DATASET UNSTRUCTURED_GRID
+POINTS 5 float
+0 0 0 1 0 0 0 1 0
+0 0 1 0 0 -1
+METADATA
+INFORMATION 2
+NAME L2_NORM_RANGE LOCATION vtkDataArray
+DATA 2 0 1
+
+CELLS 3 8
+OFFSETS vtktypeint64
+0 4 8
+CONNECTIVITY vtktypeint64
+0 1 2 3 0 2 1 4
+CELL_TYPES 2
+10
+10
+
+CELL_DATA 2
+)""");
+  const VolumeMesh<double> expected_mesh{
+      {{0, 1, 2, 3}, {0, 2, 1, 4}},
+      {Vector3d::Zero(), Vector3d::UnitX(), Vector3d::UnitY(),
+       Vector3d::UnitZ(), -Vector3d::UnitZ()}};
+  EXPECT_TRUE(ParseVtkToVolumeMesh(filename).Equal(expected_mesh));
+}
+
+TEST_F(ParallelMeshParsersTest, VtkLargeFile) {
+  constexpr int kNumTetrahedra = 60000;
+  std::string contents =
+      "# vtk DataFile Version 2.0\nlarge\nASCII\nDATASET UNSTRUCTURED_GRID\n";
+  contents += fmt::format("POINTS {} double\n", kNumTetrahedra + 3);
+  for (int i = 0; i < kNumTetrahedra + 3; ++i) {
+    contents += fmt::format("{} {} {}\n", i, 0.5 * i, -0.25 * i);
+  }
+  contents += fmt::format("CELLS {} {}\n", kNumTetrahedra, 5 * kNumTetrahedra);
+  for (int i = 0; i < kNumTetrahedra; ++i) {
+    contents += fmt::format("4 {} {} {} {}\n", i, i + 1, i + 2, i + 3);
+  }
+  contents += fmt::format("CELL_TYPES {}\n", kNumTetrahedra);
+  for (int i = 0; i < kNumTetrahedra; ++i) contents += "10\n";
+  ASSERT_GT(contents.size(), 2 << 20);
+
+  const VolumeMesh<double> mesh =
+      ParseVtkToVolumeMesh(WriteFile("large.vtk", contents), 2.0);
+  ASSERT_EQ(mesh.num_vertices(), kNumTetrahedra + 3);
+  ASSERT_EQ(mesh.num_elements(), kNumTetrahedra);
+  for (int i = 0; i < kNumTetrahedra + 3; ++i) {
+    ASSERT_EQ(mesh.vertex(i), Vector3d(2.0 * i, i, -0.5 * i));
+  }
+  for (int i = 0; i < kNumTetrahedra; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      ASSERT_EQ(mesh.element(i).vertex(j), i + j);
+    }
+  }
+}
+
+TEST_F(ParallelMeshParsersTest, VtkErrors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(ParseVtkToVolumeMesh(dir_ + "/missing.vtk"),
+                              "Cannot open file '.*missing.vtk'");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ParseVtkToVolumeMesh(
+          FindResourceOrThrow("drake/geometry/test/non_convex_mesh.obj")),
+      ".*not a legacy VTK file");
+
+  const std::string header = "# vtk DataFile Version 2.0\ntitle\nASCII\n";
+  const std::string grid = header + "DATASET UNSTRUCTURED_GRID\n";
+  const std::string points = grid + "POINTS 4 float\n0 0 0 1 0 0 0 1 0 0 0 1\n";
+  auto parse = [this](const std::string& contents) {
+    return ParseVtkToVolumeMesh(WriteFile("bad.vtk", contents));
+  };
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      parse("# vtk DataFile Version 2.0\ntitle\nBINARY\n"),
+      ".*only ASCII files are supported, not 'BINARY'");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      parse(header + "DATASET POLYDATA\n"),
+      ".*only UNSTRUCTURED_GRID datasets are supported, not 'POLYDATA'");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      parse(grid + "POINTS 2 float\n0 0 0 1 0\n"),
+      ".*the POINTS section has 5 values; expected 6");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      parse(grid + "POINTS 1 float\n0 zero 0\n"),
+      ".*invalid value 'zero' in the POINTS section");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      parse(points), ".*missing the CELLS section");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      parse(points + "CELLS 1 4\n3 0 1 2\n"),
+      ".*only tetrahedral cells are supported");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      parse(points + "CELLS 1 5\n4 0 1 2 4\n"),
+      ".*cell 0 refers to the vertex with index 4, but there are 4 vertices");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      parse(points + "CELLS 1 5\n4 0 1 2 3\nCELL_TYPES 1\n12\n"),
+      ".*only tetrahedral cells \\(type 10\\) are supported; cell 0 has type "
+      "12");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      parse(points + "LINES 1 3\n2 0 1\n"), ".*unsupported section 'LINES'");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      parse(grid + "FIELD FieldData 1\nTIME 1 1 double\n0\n" +
+            points.substr(grid.size()) + "CELLS 1 5\n4 0 1 2 3\n"),
+      ".*the FIELD section must follow the POINTS and CELLS sections");
+}
+
+/* The Maybe*() variant returns nullopt for the files outside the supported
+ subset of the format (which ReadVtkToVolumeMesh() may be able to read) and for
+ malformed files (for which ReadVtkToVolumeMesh() reports the error), but still
+ throws for files that can't be opened. */
+TEST_F(ParallelMeshParsersTest, VtkUnsupported) {
+  const std::string header = "# vtk DataFile Version 2.0\ntitle\nASCII\n";
+  const std::string grid = header + "DATASET UNSTRUCTURED_GRID\n";
+  const std::string points = grid + "POINTS 4 float\n0 0 0 1 0 0 0 1 0 0 0 1\n";
+  const std::string tetrahedron = points + "CELLS 1 5\n4 0 1 2 3\n";
+  auto maybe_parse = [this](const std::string& contents) {
+    return MaybeParseVtkToVolumeMesh(WriteFile("unsupported.vtk", contents));
+  };
+  EXPECT_TRUE(maybe_parse(tetrahedron + "CELL_TYPES 1\n10\n").has_value());
+  EXPECT_TRUE(maybe_parse(tetrahedron + "FIELD FieldData 0\n").has_value());
+
+  EXPECT_FALSE(
+      maybe_parse("# vtk DataFile Version 2.0\ntitle\nBINARY\n").has_value());
+  EXPECT_FALSE(maybe_parse(header + "DATASET POLYDATA\n").has_value());
+  EXPECT_FALSE(maybe_parse(points + "CELLS 1 4\n3 0 1 2\n").has_value());
+  EXPECT_FALSE(
+      maybe_parse(tetrahedron + "CELL_TYPES 1\n12\n").has_value());
+  EXPECT_FALSE(maybe_parse(points + "LINES 1 3\n2 0 1\n").has_value());
+  EXPECT_FALSE(maybe_parse(grid + "FIELD FieldData 0\n" +
+                           tetrahedron.substr(grid.size()))
+                   .has_value());
+
+  EXPECT_FALSE(maybe_parse(grid + "POINTS 2 float\n0 0 0 1 0\n").has_value());
+  EXPECT_FALSE(
+      maybe_parse(tetrahedron.substr(0, tetrahedron.size() - 2) + "4\n")
+          .has_value());
+
+  DRAKE_EXPECT_THROWS_MESSAGE(MaybeParseVtkToVolumeMesh(dir_ + "/missing.vtk"),
+                              "Cannot open file '.*missing.vtk'");
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
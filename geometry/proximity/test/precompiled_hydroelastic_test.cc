@@ -0,0 +1,169 @@
+#include "drake/geometry/proximity/precompiled_hydroelastic.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/proximity/make_sphere_field.h"
+#include "drake/geometry/proximity/make_sphere_mesh.h"
+#include "drake/geometry/proximity/tessellation_strategy.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+class PrecompiledHydroelasticTest : public ::testing::Test {
+ protected:
+  PrecompiledHydroelasticTest()
+      : sphere_(0.5),
+        volume_mesh_(MakeSphereVolumeMesh<double>(
+            sphere_, 0.125, TessellationStrategy::kDenseInteriorVertices)),
+        pressure_(MakeSpherePressureField(sphere_, &volume_mesh_, 1e7)),
+        volume_bvh_(volume_mesh_),
+        surface_mesh_(MakeSphereSurfaceMesh<double>(sphere_, 0.125)),
+        surface_bvh_(surface_mesh_) {}
+
+  const std::string dir_{temp_directory()};
+  const Sphere sphere_;
+  const VolumeMesh<double> volume_mesh_;
+  const VolumeMeshFieldLinear<double, double> pressure_;
+  const Bvh<Obb, VolumeMesh<double>> volume_bvh_;
+  const TriangleSurfaceMesh<double> surface_mesh_;
+  const Bvh<Obb, TriangleSurfaceMesh<double>> surface_bvh_;
+};
+
+TEST_F(PrecompiledHydroelasticTest, SoftRoundTrip) {
+  const std::string filename = dir_ + "/soft.hydro";
+  WritePrecompiledSoftMesh(filename, "soft key", volume_mesh_, pressure_,
+                           volume_bvh_);
+
+  const std::optional<PrecompiledSoftMesh> read =
+      ReadPrecompiledSoftMesh(filename, "soft key");
+  ASSERT_TRUE(read.has_value());
+  EXPECT_TRUE(read->mesh->Equal(volume_mesh_));
+  EXPECT_EQ(&read->pressure->mesh(), read->mesh.get());
+  EXPECT_TRUE(read->pressure->Equal(pressure_));
+  EXPECT_TRUE(read->bvh->Equal(volume_bvh_));
+}
+
+TEST_F(PrecompiledHydroelasticTest, RigidRoundTrip) {
+  const std::string filename = dir_ + "/rigid.hydro";
+  WritePrecompiledRigidMesh(filename, "rigid key", surface_mesh_,
+                            surface_bvh_);
+
+  const std::optional<PrecompiledRigidMesh> read =
+      ReadPrecompiledRigidMesh(filename, "rigid key");
+  ASSERT_TRUE(read.has_value());
+  EXPECT_TRUE(read->mesh->Equal(surface_mesh_));
+  EXPECT_TRUE(read->bvh->Equal(surface_bvh_));
+}
+
+/* Files that don't match the request are ignored. */
+TEST_F(PrecompiledHydroelasticTest, Mismatches) {
+  const std::string filename = dir_ + "/soft.hydro";
+  WritePrecompiledSoftMesh(filename, "soft key", volume_mesh_, pressure_,
+                           volume_bvh_);
+  EXPECT_FALSE(ReadPrecompiledSoftMesh(filename, "other key").has_value());
+  EXPECT_FALSE(ReadPrecompiledSoftMesh(filename, "soft").has_value());
+  EXPECT_FALSE(ReadPrecompiledRigidMesh(filename, "soft key").has_value());
+  EXPECT_FALSE(
+      ReadPrecompiledSoftMesh(dir_ + "/missing.hydro", "soft key").has_value());
+
+  // A file in some other format.
+  const std::string text_file = dir_ + "/text.hydro";
+  std::ofstream(text_file) << "not a precompiled file\n";
+  EXPECT_FALSE(ReadPrecompiledSoftMesh(text_file, "soft key").has_value());
+}
+
+TEST_F(PrecompiledHydroelasticTest, Truncated) {
+  const std::string filename = dir_ + "/rigid.hydro";
+  WritePrecompiledRigidMesh(filename, "rigid key", surface_mesh_,
+                            surface_bvh_);
+  std::filesystem::resize_file(filename,
+                               std::filesystem::file_size(filename) / 2);
+  DRAKE_EXPECT_THROWS_MESSAGE(ReadPrecompiledRigidMesh(filename, "rigid key"),
+                              ".*rigid.hydro' is truncated");
+}
+
+/* Element counts whose section sizes would overflow are rejected before they
+ are used. */
+TEST_F(PrecompiledHydroelasticTest, HugeCount) {
+  const std::string filename = dir_ + "/rigid.hydro";
+  WritePrecompiledRigidMesh(filename, "rigid key", surface_mesh_,
+                            surface_bvh_);
+  // Overwrite the header's element count (at byte 40) with a count for which
+  // the number of vertex indices, 3 * count, wraps around to 2.
+  const uint64_t num_elements = UINT64_MAX / 3 + 1;
+  std::fstream file(filename, std::ios::in | std::ios::out | std::ios::binary);
+  file.seekp(40);
+  file.write(reinterpret_cast<const char*>(&num_elements),
+             sizeof(num_elements));
+  file.close();
+  DRAKE_EXPECT_THROWS_MESSAGE(ReadPrecompiledRigidMesh(filename, "rigid key"),
+                              ".*rigid.hydro' is corrupt");
+}
+
+/* A bounding box whose recorded rotation isn't a rotation is rejected, even
+ in release builds where RotationMatrix doesn't validate its input. */
+TEST_F(PrecompiledHydroelasticTest, InvalidRotation) {
+  const std::string filename = dir_ + "/rigid.hydro";
+  WritePrecompiledRigidMesh(filename, "rigid key", surface_mesh_,
+                            surface_bvh_);
+  // Find the root box's rotation matrix (column major) in the file and change
+  // its first entry.
+  std::string contents;
+  {
+    std::ifstream in(filename, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(in),
+                    std::istreambuf_iterator<char>());
+  }
+  const Eigen::Matrix3d R =
+      surface_bvh_.root_node().bv().pose().rotation().matrix();
+  const std::string R_bytes(reinterpret_cast<const char*>(R.data()),
+                            sizeof(double) * 9);
+  const size_t offset = contents.find(R_bytes);
+  ASSERT_NE(offset, std::string::npos);
+  const double entry = R(0, 0) + 2;
+  std::fstream file(filename, std::ios::in | std::ios::out | std::ios::binary);
+  file.seekp(offset);
+  file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+  file.close();
+  DRAKE_EXPECT_THROWS_MESSAGE(ReadPrecompiledRigidMesh(filename, "rigid key"),
+                              ".*rigid.hydro' is corrupt");
+}
+
+/* A BVH far deeper than any the writer produces (e.g., a corrupt file whose
+ records form a long chain) is rejected rather than recursed into. */
+TEST_F(PrecompiledHydroelasticTest, TooDeep) {
+  using NodeType = BvNode<Obb, TriangleSurfaceMesh<double>>;
+  const Obb bv(math::RigidTransformd(), Eigen::Vector3d::Ones());
+  auto leaf = [&bv]() {
+    return std::make_unique<NodeType>(bv, NodeType::LeafData{1, {0}});
+  };
+  // A chain of 20 branches has 41 nodes; a balanced tree of that size is 6
+  // levels deep.
+  std::unique_ptr<NodeType> root = leaf();
+  for (int i = 0; i < 20; ++i) {
+    root = std::make_unique<NodeType>(bv, leaf(), std::move(root));
+  }
+  const Bvh<Obb, TriangleSurfaceMesh<double>> chain(std::move(root));
+
+  const std::string filename = dir_ + "/chain.hydro";
+  WritePrecompiledRigidMesh(filename, "rigid key", surface_mesh_, chain);
+  DRAKE_EXPECT_THROWS_MESSAGE(ReadPrecompiledRigidMesh(filename, "rigid key"),
+                              ".*chain.hydro' is corrupt");
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
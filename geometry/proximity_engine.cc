@@ -25,6 +25,7 @@
 #include "drake/geometry/proximity/hydroelastic_callback.h"
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 #include "drake/geometry/proximity/make_mesh_from_vtk.h"
+#include "drake/geometry/proximity/mesh_cache.h"
 #include "drake/geometry/proximity/obj_to_surface_mesh.h"
 #include "drake/geometry/proximity/penetration_as_point_pair_callback.h"
 #include "drake/geometry/proximity/volume_to_surface_mesh.h"
@@ -200,6 +201,22 @@ bool OrderContactSurface(const ContactSurface<T>& s1,
   return s1.id_N() < s2.id_N();
 }
 
+// The vertices and faces of an Obj file, as returned by ReadObjFile().
+using ObjVerticesAndFaces = std::tuple<shared_ptr<std::vector<Vector3d>>,
+                                       shared_ptr<std::vector<int>>, int>;
+
+// Reads the given Obj file (without triangulating its faces) at most once per
+// process for each file content and scale. The vertices and faces are shared
+// by all fcl::Convex shapes created from the same file; FCL doesn't modify
+// them.
+ObjVerticesAndFaces ReadObjFileCached(const std::string& filename,
+                                      double scale) {
+  return *MeshCache::GetInstance().GetOrCompute<ObjVerticesAndFaces>(
+      filename, scale, "fcl_obj", [&filename, scale]() {
+        return ReadObjFile(filename, scale, false /* triangulate */);
+      });
+}
+
 }  // namespace
 
 // The implementation class for the fcl engine. Each of these functions
@@ -406,6 +423,12 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       geometries_for_deformable_contact_.UpdateRigidWorldPose(id, X_WG_d);
     }
     dynamic_tree_.update();
+    // The anchored geometries never move, so their tree only needs updating
+    // after new geometries have been registered (see AddGeometry()).
+    if (anchored_tree_needs_update_) {
+      anchored_tree_.update();
+      anchored_tree_needs_update_ = false;
+    }
   }
 
   void UpdateDeformableVertexPositions(
@@ -521,9 +544,9 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       // TODO(SeanCurtis-TRI) Add a troubleshooting entry to give more helpful
       //  advice.
 
-      // Don't bother triangulating; we're ignoring the faces.
+      // The faces are ignored.
       std::tie(shared_verts, std::ignore, std::ignore) =
-          ReadObjFile(mesh.filename(), mesh.scale(), false /* triangulate */);
+          ReadObjFileCached(mesh.filename(), mesh.scale());
     }
 
     // Note: the strategy here is to use an *invalid* fcl::Convex shape for the
@@ -548,9 +571,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   }
 
   void ImplementGeometry(const Convex& convex, void* user_data) override {
-    // Don't bother triangulating; Convex supports polygons.
     const auto [vertices, faces, num_faces] =
-        ReadObjFile(convex.filename(), convex.scale(), false /* triangulate */);
+        ReadObjFileCached(convex.filename(), convex.scale());
 
     // Create fcl::Convex.
     auto fcl_convex = make_shared<fcl::Convexd>(vertices, num_faces, faces);
@@ -558,11 +580,6 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     TakeShapeOwnership(fcl_convex, user_data);
     ProcessHydroelastic(convex, user_data);
     ProcessGeometriesForDeformableContact(convex, user_data);
-
-    // TODO(DamrongGuoy): Per f2f with SeanCurtis-TRI, we want ProximityEngine
-    // to own vertices and face by a map from filename.  This way we won't have
-    // to read the same file again and again when we create multiple Convex
-    // objects from the same file.
   }
 
   std::vector<SignedDistancePair<T>> ComputeSignedDistancePairwiseClosestPoints(
@@ -867,8 +884,13 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     EncodedData encoding(id, is_dynamic);
     encoding.write_to(data.fcl_object.get());
 
+    // Registration inserts the object into the tree, leaving it valid for
+    // queries. Rebalancing it with update() costs time linear in the tree's
+    // size, so doing it per geometry would make registering N geometries
+    // O(N²); instead, it's deferred to the next UpdateWorldPoses(), which
+    // precedes the queries made through SceneGraph.
     tree->registerObject(data.fcl_object.get());
-    tree->update();
+    if (!is_dynamic) anchored_tree_needs_update_ = true;
     (*objects)[id] = std::move(data.fcl_object);
 
     collision_filter_.AddGeometry(id);
@@ -918,6 +940,10 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // All of the *anchored* collision elements (spanning *all* sources).
   unordered_map<GeometryId, unique_ptr<CollisionObjectd>> anchored_objects_;
 
+  // True if geometries have been registered in `anchored_tree_` since it was
+  // last updated. The dynamic tree is updated with every UpdateWorldPoses().
+  bool anchored_tree_needs_update_{false};
+
   // The mechanism for dictating collision filtering.
   CollisionFilter collision_filter_;
 
@@ -1,10 +1,15 @@
 #include "drake/geometry/read_obj.h"
 
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
 #include <fmt/format.h>
 #include <tiny_obj_loader.h>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/text_logging.h"
+#include "drake/geometry/proximity/parallel_mesh_parsers.h"
 
 static_assert(std::is_same_v<tinyobj::real_t, double>,
               "tinyobjloader must be compiled in double-precision mode");
@@ -92,11 +97,42 @@ std::vector<int> TinyObjToFclFaces(const tinyobj::mesh_t& mesh) {
 
   return faces;
 }
+
+// Throws unless the file has exactly one object.
+void ThrowUnlessSingleObject(int num_objects, const std::string& filename) {
+  if (num_objects == 0) {
+    throw std::runtime_error(
+        fmt::format("The file parsed contains no objects; only OBJs with "
+                    "a single object are supported. The file could be "
+                    "corrupt, empty, or not an OBJ file. File name: '{}'",
+                    filename));
+  } else if (num_objects > 1) {
+    throw std::runtime_error(
+        fmt::format("The OBJ file contains multiple objects; only OBJs with "
+                    "a single object are supported: File name: '{}'",
+                    filename));
+  }
+}
 }  // namespace
 
 std::tuple<std::shared_ptr<std::vector<Eigen::Vector3d>>,
            std::shared_ptr<std::vector<int>>, int>
 ReadObjFile(const std::string& filename, double scale, bool triangulate) {
+  // The parallel parser reads most files; those that it can't parse (e.g.,
+  // with polygons of more than four vertices to triangulate, or with syntax
+  // that only tinyobj tolerates) are left to tinyobj.
+  std::optional<ObjPolygons> polygons =
+      MaybeParseObjPolygons(filename, scale, triangulate);
+  if (polygons.has_value()) {
+    ThrowUnlessSingleObject(polygons->num_objects, filename);
+    // The faces are encoded as fcl::Convex expects them; see ObjPolygons.
+    auto vertices = std::make_shared<std::vector<Eigen::Vector3d>>(
+        std::move(polygons->vertices));
+    auto faces =
+        std::make_shared<std::vector<int>>(std::move(polygons->faces));
+    return {vertices, faces, polygons->num_faces};
+  }
+
   tinyobj::attrib_t attrib;
   std::vector<tinyobj::shape_t> shapes;
   std::vector<tinyobj::material_t> materials;
@@ -119,18 +155,7 @@ ReadObjFile(const std::string& filename, double scale, bool triangulate) {
     drake::log()->warn("Warning parsing file '{}' : {}", filename, warn);
   }
 
-  if (shapes.size() == 0) {
-    throw std::runtime_error(
-        fmt::format("The file parsed contains no objects; only OBJs with "
-                    "a single object are supported. The file could be "
-                    "corrupt, empty, or not an OBJ file. File name: '{}'",
-                    filename));
-  } else if (shapes.size() > 1) {
-    throw std::runtime_error(
-        fmt::format("The OBJ file contains multiple objects; only OBJs with "
-                    "a single object are supported: File name: '{}'",
-                    filename));
-  }
+  ThrowUnlessSingleObject(static_cast<int>(shapes.size()), filename);
 
   auto vertices = std::make_shared<std::vector<Eigen::Vector3d>>(
       TinyObjToFclVertices(attrib, scale));
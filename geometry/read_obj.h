@@ -11,14 +11,12 @@ namespace drake {
 namespace geometry {
 namespace internal {
 /** Reads the OBJ file with the given `filename` into a collection of data. It
- * includes the vertex positions, face encodings (see TinyObjToFclFaces), and
- * number of faces.
+ * includes the vertex positions, face encodings (as fcl::Convex expects them),
+ * and number of faces. The file is parsed with ParseObjPolygons(), or with
+ * tinyobjloader if it has polygons that ParseObjPolygons() can't triangulate.
  * @param filename The name of the obj file.
  * @param scale Scale to coordinates.
- * @param triangulate Whether triangulate polygon face in .obj or not. Refer to
- * LoadObj function in
- * https://github.com/tinyobjloader/tinyobjloader/blob/master/tiny_obj_loader.h
- * for more details.
+ * @param triangulate Whether triangulate polygon face in .obj or not.
  * @return (vertices, faces, num_faces) vertices[i] is the i'th vertex in the
  * mesh. faces is interpreted as
  *
@@ -31,6 +29,8 @@ namespace internal {
  * `vertices` for a vertex on face i. Note that the size of faces is larger than
  * num_faces.
  *
+ * @throws std::exception if the file can't be parsed or if it doesn't contain
+ * exactly one object with faces.
  */
 std::tuple<std::shared_ptr<std::vector<Eigen::Vector3d>>,
            std::shared_ptr<std::vector<int>>, int>
@@ -1,10 +1,12 @@
 #include "drake/geometry/read_obj.h"
 
+#include <fstream>
 #include <unordered_set>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
 
 namespace drake {
 namespace geometry {
@@ -135,6 +137,37 @@ GTEST_TEST(ReadObjFile, NonconvexMesh) {
     }
   }
 }
+
+// The pentagon is concave at its fourth vertex, so a fan of triangles around
+// its first vertex would fold over itself. Its triangles must instead cover
+// it exactly, with its orientation.
+GTEST_TEST(ReadObjFile, ConcavePolygon) {
+  const std::string filename = temp_directory() + "/concave.obj";
+  std::ofstream(filename) << R"""(
+v 0 0 0
+v 4 0 0
+v 4 4 0
+v 2 1 0
+v 0 4 0
+f 1 2 3 4 5
+)""";
+  const auto [vertices, faces, num_faces] =
+      ReadObjFile(filename, 1.0, true /* triangulate */);
+  ASSERT_EQ(vertices->size(), 5);
+  ASSERT_EQ(num_faces, 3);
+  ASSERT_EQ(faces->size(), num_faces * 4);
+  double area = 0;
+  for (int i = 0; i < num_faces; ++i) {
+    ASSERT_EQ((*faces)[4 * i], 3);
+    const Eigen::Vector3d& a = (*vertices)[(*faces)[4 * i + 1]];
+    const Eigen::Vector3d& b = (*vertices)[(*faces)[4 * i + 2]];
+    const Eigen::Vector3d& c = (*vertices)[(*faces)[4 * i + 3]];
+    const double twice_signed_area = (b - a).cross(c - a).z();
+    EXPECT_GT(twice_signed_area, 0);
+    area += 0.5 * twice_signed_area;
+  }
+  EXPECT_NEAR(area, 10, 1e-12);
+}
 }  // namespace
 }  // namespace internal
 }  // namespace geometry
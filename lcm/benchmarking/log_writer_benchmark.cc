@@ -0,0 +1,78 @@
+// @file
+// Benchmarks for saving LCM logs with DrakeLcmLog, comparing the synchronous
+// writer (the LCM library's, which writes each message as it's published) with
+// the buffered, background LcmLogWriter, as a function of the message size.
+// Each benchmark reports the messages (items) and bytes published per second.
+// For LcmLogWriter, the time is the publishers' time: the publishers only wait
+// for the writing thread when the buffer is full.
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/lcm/drake_lcm_log.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace lcm {
+namespace {
+
+/* Fixture whose messages have as many bytes as the first benchmark argument.
+ */
+class LogWriterFixture : public benchmark::Fixture {
+ public:
+  LogWriterFixture() { tools::performance::AddMinMaxStatistics(this); }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    message_.assign(state.range(0), 'x');
+  }
+
+ protected:
+  /* Publishes messages to `log`, round robin on a few channels, for as long
+   as the benchmark runs. */
+  void PublishAll(benchmark::State& state, DrakeLcmLog* log) {
+    const std::vector<std::string> channels{"STATE", "COMMAND", "CAMERA",
+                                            "CONTACT"};
+    int i = 0;
+    for (auto _ : state) {
+      log->Publish(channels[i % channels.size()], message_.data(),
+                   message_.size(), 1e-3 * i);
+      ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * message_.size());
+  }
+
+  std::string filename_{temp_directory() + "/benchmark.lcmlog"};
+  std::vector<char> message_;
+};
+
+void Args(benchmark::internal::Benchmark* b) {
+  b->Arg(100)->Arg(10000)->Arg(1000000)->ArgName("bytes");
+}
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(LogWriterFixture, Synchronous)(benchmark::State& state) {
+  DrakeLcmLog log(filename_, true);
+  PublishAll(state, &log);
+  log.Flush();
+}
+BENCHMARK_REGISTER_F(LogWriterFixture, Synchronous)->Apply(Args);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(LogWriterFixture, Buffered)(benchmark::State& state) {
+  DrakeLcmLog log(filename_, LcmLogWriterParams{});
+  PublishAll(state, &log);
+  log.Flush();
+  state.counters["publisher_waits"] = log.GetWriteStatistics().publisher_waits;
+}
+BENCHMARK_REGISTER_F(LogWriterFixture, Buffered)->Apply(Args);
+
+}  // namespace
+}  // namespace lcm
+}  // namespace drake
+
+BENCHMARK_MAIN();
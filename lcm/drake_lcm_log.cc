@@ -1,8 +1,12 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstdio>
 #include <limits>
 #include <map>
+#include <optional>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -10,6 +14,9 @@
 #include "lcm/lcm-cpp.hpp"
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/filesystem.h"
+#include "drake/lcm/lcm_log_reader.h"
+#include "drake/lcm/lcm_log_writer.h"
 
 namespace drake {
 namespace lcm {
@@ -22,8 +29,40 @@ class DrakeLcmLog::Impl {
  public:
   std::multimap<std::string, HandlerFunction> subscriptions_;
   std::vector<MultichannelHandlerFunction> multichannel_subscriptions_;
+  // In write mode, exactly one of log_ and writer_ is set. In read mode,
+  // reader_ is set for a regular file, and log_ otherwise.
   std::unique_ptr<::lcm::LogFile> log_;
-  const ::lcm::LogEvent* next_event_{nullptr};
+  std::unique_ptr<LcmLogWriter> writer_;
+  std::unique_ptr<LcmLogReader> reader_;
+  // The next event of reader_, by index.
+  int next_event_{0};
+  // The next event of log_, in read mode, or nullptr at its end.
+  const ::lcm::LogEvent* next_stream_event_{nullptr};
+
+  // Returns the next event in read mode, or nullopt at the end of the log.
+  std::optional<LcmLogEventView> PeekNextEvent() const {
+    if (reader_ == nullptr) {
+      if (next_stream_event_ == nullptr) return std::nullopt;
+      LcmLogEventView result;
+      result.event_number = next_stream_event_->eventnum;
+      result.timestamp = next_stream_event_->timestamp;
+      result.channel = next_stream_event_->channel;
+      result.data = next_stream_event_->data;
+      result.data_size = next_stream_event_->datalen;
+      return result;
+    }
+    if (next_event_ == reader_->num_events()) return std::nullopt;
+    return reader_->event(next_event_);
+  }
+
+  // Advances past the event returned by PeekNextEvent().
+  void AdvanceEvent() {
+    if (reader_ == nullptr) {
+      next_stream_event_ = log_->readNextEvent();
+    } else {
+      ++next_event_;
+    }
+  }
 };
 
 DrakeLcmLog::DrakeLcmLog(const std::string& file_name, bool is_write,
@@ -35,15 +74,32 @@ DrakeLcmLog::DrakeLcmLog(const std::string& file_name, bool is_write,
       impl_(new Impl) {
   if (is_write_) {
     impl_->log_ = std::make_unique<::lcm::LogFile>(file_name, "w");
+    if (!impl_->log_->good()) {
+      throw std::runtime_error("Failed to open log file: " + file_name);
+    }
+  } else if (filesystem::is_regular_file(file_name)) {
+    impl_->reader_ = std::make_unique<LcmLogReader>(file_name);
   } else {
+    // Pipes and devices can't be memory-mapped, so they're read as a stream.
     impl_->log_ = std::make_unique<::lcm::LogFile>(file_name, "r");
-    impl_->next_event_ = impl_->log_->readNextEvent();
-  }
-  if (!impl_->log_->good()) {
-    throw std::runtime_error("Failed to open log file: " + file_name);
+    if (!impl_->log_->good()) {
+      throw std::runtime_error("Failed to open log file: " + file_name);
+    }
+    impl_->next_stream_event_ = impl_->log_->readNextEvent();
   }
 }
 
+DrakeLcmLog::DrakeLcmLog(const std::string& file_name,
+                         const LcmLogWriterParams& params,
+                         bool overwrite_publish_time_with_system_clock)
+    : is_write_(true),
+      overwrite_publish_time_with_system_clock_(
+          overwrite_publish_time_with_system_clock),
+      url_("lcmlog://" + file_name),
+      impl_(new Impl) {
+  impl_->writer_ = std::make_unique<LcmLogWriter>(file_name, params);
+}
+
 DrakeLcmLog::~DrakeLcmLog() = default;
 
 std::string DrakeLcmLog::get_lcm_url() const {
@@ -63,6 +119,13 @@ void DrakeLcmLog::Publish(const std::string& channel, const void* data,
     log_event.timestamp = std::chrono::steady_clock::now().time_since_epoch() /
                           std::chrono::microseconds(1);
   }
+
+  // The writer is thread-safe, and never blocks on the file system.
+  if (impl_->writer_ != nullptr) {
+    impl_->writer_->Write(channel, data, data_size, log_event.timestamp);
+    return;
+  }
+
   log_event.channel = channel;
   log_event.datalen = data_size;
   log_event.data = const_cast<void*>(data);
@@ -74,6 +137,29 @@ void DrakeLcmLog::Publish(const std::string& channel, const void* data,
   }
 }
 
+void DrakeLcmLog::Flush() {
+  if (!is_write_) {
+    throw std::logic_error("Flush is only available for log saving.");
+  }
+  if (impl_->writer_ != nullptr) {
+    impl_->writer_->Flush();
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (std::fflush(impl_->log_->getFilePtr()) != 0) {
+    throw std::runtime_error("Flush failed to write to log file.");
+  }
+}
+
+LcmLogWriterStatistics DrakeLcmLog::GetWriteStatistics() const {
+  if (impl_->writer_ == nullptr) {
+    throw std::logic_error(
+        "GetWriteStatistics is only available for logs saved with "
+        "LcmLogWriterParams.");
+  }
+  return impl_->writer_->GetStatistics();
+}
+
 std::shared_ptr<DrakeSubscriptionInterface> DrakeLcmLog::Subscribe(
     const std::string& channel, HandlerFunction handler) {
   if (is_write_) {
@@ -109,10 +195,44 @@ double DrakeLcmLog::GetNextMessageTime() const {
   }
 
   std::lock_guard<std::mutex> lock(mutex_);
-  if (impl_->next_event_ == nullptr) {
+  const std::optional<LcmLogEventView> next_event = impl_->PeekNextEvent();
+  if (!next_event.has_value()) {
     return std::numeric_limits<double>::infinity();
   }
-  return timestamp_to_second(impl_->next_event_->timestamp);
+  return timestamp_to_second(next_event->timestamp);
+}
+
+void DrakeLcmLog::Seek(double time_sec) {
+  if (is_write_) {
+    throw std::logic_error("Seek is only available for log playback.");
+  }
+  if (impl_->reader_ == nullptr) {
+    throw std::logic_error("Seek is only available for regular log files.");
+  }
+
+  // Seek to a timestamp (in microseconds) just before time_sec, clamped so
+  // that seeking to +/- infinity is well-defined, and then step over the
+  // messages that are still before time_sec after rounding.
+  const double timestamp =
+      std::clamp(std::floor(time_sec * 1e6) - 1, -9e18, 9e18);
+  std::lock_guard<std::mutex> lock(mutex_);
+  const LcmLogReader& reader = *impl_->reader_;
+  int next = reader.Seek(static_cast<int64_t>(timestamp));
+  while (next < reader.num_events() &&
+         timestamp_to_second(reader.event(next).timestamp) < time_sec) {
+    ++next;
+  }
+  impl_->next_event_ = next;
+}
+
+const LcmLogReader& DrakeLcmLog::reader() const {
+  if (is_write_) {
+    throw std::logic_error("reader is only available for log playback.");
+  }
+  if (impl_->reader_ == nullptr) {
+    throw std::logic_error("reader is only available for regular log files.");
+  }
+  return *impl_->reader_;
 }
 
 void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
@@ -123,10 +243,12 @@ void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
 
   std::lock_guard<std::mutex> lock(mutex_);
   // End of log, do nothing.
-  if (impl_->next_event_ == nullptr) {
+  const std::optional<LcmLogEventView> maybe_next_event =
+      impl_->PeekNextEvent();
+  if (!maybe_next_event.has_value()) {
     return;
   }
-  const ::lcm::LogEvent& next_event = *impl_->next_event_;
+  const LcmLogEventView& next_event = *maybe_next_event;
 
   // Do nothing if the call time does not match the event's time.
   if (current_time != timestamp_to_second(next_event.timestamp)) {
@@ -134,18 +256,19 @@ void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
   }
 
   // Dispatch message if necessary.
-  const auto& range = impl_->subscriptions_.equal_range(next_event.channel);
+  const auto& range =
+      impl_->subscriptions_.equal_range(std::string(next_event.channel));
   for (auto iter = range.first; iter != range.second; ++iter) {
     const HandlerFunction& handler = iter->second;
-    handler(next_event.data, next_event.datalen);
+    handler(next_event.data, next_event.data_size);
   }
   for (const MultichannelHandlerFunction& handler :
            impl_->multichannel_subscriptions_) {
-    handler(next_event.channel, next_event.data, next_event.datalen);
+    handler(next_event.channel, next_event.data, next_event.data_size);
   }
 
   // Advance log.
-  impl_->next_event_ = impl_->log_->readNextEvent();
+  impl_->AdvanceEvent();
 }
 
 void DrakeLcmLog::OnHandleSubscriptionsError(const std::string& error_message) {
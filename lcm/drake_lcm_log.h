@@ -7,6 +7,8 @@
 
 #include "drake/common/drake_copyable.h"
 #include "drake/lcm/drake_lcm_interface.h"
+#include "drake/lcm/lcm_log_reader.h"
+#include "drake/lcm/lcm_log_writer.h"
 
 namespace drake {
 namespace lcm {
@@ -18,6 +20,13 @@ namespace lcm {
  * is generated by some external logger (the lcm-logger binary), which uses the
  * unix epoch time clock to record message arrival time, the user needs to
  * offset those timestamps properly to match and the clock used for playback.
+ *
+ * In read-only mode, a log that is a regular file is memory-mapped and indexed
+ * by an LcmLogReader (see reader()), so playback can start anywhere in the log
+ * (see Seek()) without reading the messages that precede it. Only the messages
+ * in the file when it is opened are played back; a log that is still being
+ * written isn't followed. A log that isn't a regular file (e.g., a named pipe)
+ * is instead read as a stream, one message at a time, and can't be seeked.
  */
 class DrakeLcmLog : public DrakeLcmInterface {
  public:
@@ -41,11 +50,25 @@ class DrakeLcmLog : public DrakeLcmInterface {
   DrakeLcmLog(const std::string& file_name, bool is_write,
               bool overwrite_publish_time_with_system_clock = false);
 
+  /**
+   * Constructs a DrakeLcmLog that writes to the log named @p file_name from a
+   * background thread (see LcmLogWriter), so that Publish() only copies the
+   * message into a buffer and never waits for the file system. This is meant
+   * for logging many high-rate channels from within a simulation.
+   * @param params Configures the buffering.
+   * @param overwrite_publish_time_with_system_clock As above.
+   *
+   * @throws std::exception if unable to open file.
+   */
+  DrakeLcmLog(const std::string& file_name, const LcmLogWriterParams& params,
+              bool overwrite_publish_time_with_system_clock = false);
+
   ~DrakeLcmLog() override;
 
   /**
    * Writes an entry occurred at @p timestamp with content @p data to the log
-   * file. The current implementation blocks until writing is done.
+   * file. Unless this instance was constructed with LcmLogWriterParams, this
+   * blocks until writing is done.
    * @param channel Channel name.
    * @param data Pointer to raw bytes.
    * @param data_size Number of bytes in @p data.
@@ -61,6 +84,23 @@ class DrakeLcmLog : public DrakeLcmInterface {
   void Publish(const std::string& channel, const void* data, int data_size,
                std::optional<double> time_sec) override;
 
+  /**
+   * Waits until all of the messages published so far are written to the log
+   * file.
+   *
+   * @throws std::exception if this instance is not constructed in write-only
+   * mode.
+   */
+  void Flush();
+
+  /**
+   * Returns the statistics of the background writer.
+   *
+   * @throws std::exception if this instance is not constructed with
+   * LcmLogWriterParams.
+   */
+  LcmLogWriterStatistics GetWriteStatistics() const;
+
   /**
    * Subscribes @p handler to @p channel. Multiple handlers can subscribe to the
    * same channel.
@@ -112,6 +152,26 @@ class DrakeLcmLog : public DrakeLcmInterface {
    */
   void DispatchMessageAndAdvanceLog(double current_time);
 
+  /**
+   * Moves the log's cursor to the first message whose time is at least
+   * @p time_sec, so that it is the next message returned by
+   * GetNextMessageTime() and dispatched by DispatchMessageAndAdvanceLog().
+   * The cursor may move backward as well as forward.
+   *
+   * @throws std::exception if this instance is not constructed in read-only
+   * mode, or if the log isn't a regular file.
+   */
+  void Seek(double time_sec);
+
+  /**
+   * Returns the index of the log being played back, for random access to its
+   * messages.
+   *
+   * @throws std::exception if this instance is not constructed in read-only
+   * mode, or if the log isn't a regular file.
+   */
+  const LcmLogReader& reader() const;
+
   /**
    * Returns true if this instance is constructed in write-only mode.
    */
@@ -0,0 +1,288 @@
+#include "drake/lcm/lcm_log_reader.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/filesystem.h"
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace lcm {
+
+namespace {
+
+/* Each event in an LCM log starts with this (big-endian) word, followed by the
+ (big-endian) event number, timestamp, channel length, and data length, then
+ the channel name (without a terminating nul) and the data. */
+constexpr uint32_t kSyncWord = 0xEDA1DA01;
+constexpr size_t kEventHeaderSize = 4 + 8 + 8 + 4 + 4;
+
+/* The LCM log reader rejects channel names at least this long as corrupt. */
+constexpr int32_t kMaxChannelLength = 1000;
+
+/* The first bytes of an index file; bump the version when changing the
+ format. */
+constexpr char kIndexMagic[] = "drake-lcm-log-index 1\n";
+
+uint64_t ReadBigEndian(const unsigned char* bytes, int num_bytes) {
+  uint64_t result = 0;
+  for (int i = 0; i < num_bytes; ++i) {
+    result = (result << 8) | bytes[i];
+  }
+  return result;
+}
+
+/* Identifies the contents of a log file, so that a stale index is detected. */
+struct LogStamp {
+  uint64_t size{};
+  int64_t modification_time{};
+};
+
+template <typename T>
+void WriteValue(std::ofstream* file, const T& value) {
+  file->write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool ReadValue(std::ifstream* file, T* value) {
+  return static_cast<bool>(
+      file->read(reinterpret_cast<char*>(value), sizeof(*value)));
+}
+
+}  // namespace
+
+LcmLogReader::LcmLogReader(const std::string& file_name,
+                           const std::optional<std::string>& index_file_name)
+    : log_(file_name) {
+  if (!log_.is_open()) {
+    throw std::runtime_error("Failed to open log file: " + file_name);
+  }
+  std::error_code ec;
+  const auto time = filesystem::last_write_time(file_name, ec);
+  log_modification_time_ = ec ? 0 : time.time_since_epoch().count();
+  if (index_file_name.has_value() && LoadIndex(*index_file_name)) {
+    index_was_loaded_ = true;
+  } else {
+    ScanLog();
+    if (index_file_name.has_value()) SaveIndex(*index_file_name);
+  }
+  FinishIndex();
+}
+
+LcmLogReader::~LcmLogReader() = default;
+
+LcmLogEventView LcmLogReader::event(int index) const {
+  DRAKE_ASSERT(index >= 0 && index < num_events());
+  const IndexEntry& entry = events_[index];
+  LcmLogEventView result;
+  result.event_number = entry.event_number;
+  result.timestamp = entry.timestamp;
+  result.channel = channels_[entry.channel];
+  result.data = log_.data() + entry.data_offset;
+  result.data_size = entry.data_size;
+  return result;
+}
+
+const std::vector<int>& LcmLogReader::events_on_channel(
+    std::string_view channel) const {
+  static const std::vector<int> kNoEvents;
+  const auto iter = channel_numbers_.find(std::string(channel));
+  if (iter == channel_numbers_.end()) return kNoEvents;
+  return channel_events_[iter->second];
+}
+
+int LcmLogReader::Seek(int64_t timestamp) const {
+  const auto is_before = [timestamp](const IndexEntry& entry) {
+    return entry.timestamp < timestamp;
+  };
+  const auto iter =
+      timestamps_sorted_
+          ? std::partition_point(events_.begin(), events_.end(), is_before)
+          : std::find_if_not(events_.begin(), events_.end(), is_before);
+  return static_cast<int>(iter - events_.begin());
+}
+
+std::vector<int> LcmLogReader::FindEvents(std::string_view channel,
+                                          int64_t begin_timestamp,
+                                          int64_t end_timestamp) const {
+  const std::vector<int>& candidates = events_on_channel(channel);
+  std::vector<int> result;
+  if (timestamps_sorted_) {
+    const auto timestamp_less = [this](int index, int64_t timestamp) {
+      return events_[index].timestamp < timestamp;
+    };
+    const auto begin = std::lower_bound(candidates.begin(), candidates.end(),
+                                        begin_timestamp, timestamp_less);
+    const auto end = std::lower_bound(begin, candidates.end(), end_timestamp,
+                                      timestamp_less);
+    result.assign(begin, end);
+  } else {
+    for (int index : candidates) {
+      const int64_t timestamp = events_[index].timestamp;
+      if (timestamp >= begin_timestamp && timestamp < end_timestamp) {
+        result.push_back(index);
+      }
+    }
+  }
+  return result;
+}
+
+void LcmLogReader::ScanLog() {
+  const unsigned char* const data =
+      reinterpret_cast<const unsigned char*>(log_.data());
+  const size_t size = log_.size();
+  size_t offset = 0;
+  while (offset + kEventHeaderSize <= size) {
+    const unsigned char* header = data + offset;
+    if (ReadBigEndian(header, 4) != kSyncWord) {
+      // Skip corrupt bytes until the next sync word.
+      ++offset;
+      continue;
+    }
+    const int64_t event_number = ReadBigEndian(header + 4, 8);
+    const int64_t timestamp = ReadBigEndian(header + 12, 8);
+    const int32_t channel_size = ReadBigEndian(header + 20, 4);
+    const int32_t data_size = ReadBigEndian(header + 24, 4);
+    if (channel_size <= 0 || channel_size >= kMaxChannelLength ||
+        data_size < 0) {
+      // A sync word that isn't the start of an event.
+      ++offset;
+      continue;
+    }
+    const size_t channel_offset = offset + kEventHeaderSize;
+    const size_t data_offset = channel_offset + channel_size;
+    if (data_offset + data_size > size) {
+      // The last event was truncated.
+      break;
+    }
+    IndexEntry entry;
+    entry.event_number = event_number;
+    entry.timestamp = timestamp;
+    entry.data_offset = data_offset;
+    entry.data_size = data_size;
+    entry.channel = InternChannel(std::string_view(
+        reinterpret_cast<const char*>(data + channel_offset), channel_size));
+    events_.push_back(entry);
+    offset = data_offset + data_size;
+  }
+}
+
+bool LcmLogReader::LoadIndex(const std::string& index_file_name) {
+  std::ifstream file(index_file_name, std::ios::binary);
+  if (!file) return false;
+  const auto fail = [this]() {
+    events_.clear();
+    channels_.clear();
+    channel_numbers_.clear();
+    return false;
+  };
+
+  char magic[sizeof(kIndexMagic) - 1];
+  if (!file.read(magic, sizeof(magic)) ||
+      std::memcmp(magic, kIndexMagic, sizeof(magic)) != 0) {
+    return fail();
+  }
+  LogStamp stamp;
+  if (!ReadValue(&file, &stamp.size) ||
+      !ReadValue(&file, &stamp.modification_time) ||
+      stamp.size != log_.size() ||
+      stamp.modification_time != log_modification_time_) {
+    return fail();
+  }
+
+  uint32_t num_channels{};
+  if (!ReadValue(&file, &num_channels)) return fail();
+  for (uint32_t i = 0; i < num_channels; ++i) {
+    uint32_t channel_size{};
+    if (!ReadValue(&file, &channel_size) ||
+        channel_size >= static_cast<uint32_t>(kMaxChannelLength)) {
+      return fail();
+    }
+    std::string channel(channel_size, '\0');
+    if (!file.read(channel.data(), channel_size)) return fail();
+    InternChannel(channel);
+  }
+  if (channels_.size() != num_channels) return fail();
+
+  uint64_t num_events{};
+  if (!ReadValue(&file, &num_events) ||
+      num_events > log_.size() / kEventHeaderSize) {
+    return fail();
+  }
+  events_.resize(num_events);
+  if (!file.read(reinterpret_cast<char*>(events_.data()),
+                 num_events * sizeof(IndexEntry))) {
+    return fail();
+  }
+  // Never trust an index to stay within the mapping.
+  for (const IndexEntry& entry : events_) {
+    if (entry.channel < 0 || entry.channel >= static_cast<int>(num_channels) ||
+        entry.data_size < 0 ||
+        entry.data_offset + entry.data_size > log_.size()) {
+      return fail();
+    }
+  }
+  return true;
+}
+
+void LcmLogReader::SaveIndex(const std::string& index_file_name) const {
+  // Write to a temporary file first, which is then renamed, so that concurrent
+  // readers never see a partial index.
+  const std::string temp_file_name =
+      fmt::format("{}.{}.tmp", index_file_name, getpid());
+  {
+    std::ofstream file(temp_file_name, std::ios::binary);
+    file.write(kIndexMagic, sizeof(kIndexMagic) - 1);
+    WriteValue(&file, static_cast<uint64_t>(log_.size()));
+    WriteValue(&file, log_modification_time_);
+    WriteValue(&file, static_cast<uint32_t>(channels_.size()));
+    for (const std::string& channel : channels_) {
+      WriteValue(&file, static_cast<uint32_t>(channel.size()));
+      file.write(channel.data(), channel.size());
+    }
+    WriteValue(&file, static_cast<uint64_t>(events_.size()));
+    file.write(reinterpret_cast<const char*>(events_.data()),
+               events_.size() * sizeof(IndexEntry));
+    if (!file) {
+      log()->debug("LcmLogReader: could not write index file {}",
+                   index_file_name);
+      std::error_code ec;
+      filesystem::remove(temp_file_name, ec);
+      return;
+    }
+  }
+  std::error_code ec;
+  filesystem::rename(temp_file_name, index_file_name, ec);
+  if (ec) {
+    log()->debug("LcmLogReader: could not write index file {}",
+                 index_file_name);
+    filesystem::remove(temp_file_name, ec);
+  }
+}
+
+int32_t LcmLogReader::InternChannel(std::string_view channel) {
+  const auto [iter, inserted] = channel_numbers_.emplace(
+      std::string(channel), static_cast<int32_t>(channels_.size()));
+  if (inserted) channels_.emplace_back(channel);
+  return iter->second;
+}
+
+void LcmLogReader::FinishIndex() {
+  channel_events_.assign(channels_.size(), {});
+  for (int i = 0; i < num_events(); ++i) {
+    channel_events_[events_[i].channel].push_back(i);
+    if (i > 0 && events_[i].timestamp < events_[i - 1].timestamp) {
+      timestamps_sorted_ = false;
+    }
+  }
+}
+
+}  // namespace lcm
+}  // namespace drake
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/mapped_file.h"
+#include "drake/common/nice_type_name.h"
+#include "drake/common/parallel_for.h"
+
+namespace drake {
+namespace lcm {
+
+/**
+ * A view of one event in an LCM log, as read by LcmLogReader. The channel
+ * and data refer to storage owned by the reader (the data refers directly to
+ * the memory-mapped log file), so the view is only valid for the lifetime of
+ * the reader.
+ */
+struct LcmLogEventView {
+  /** The event number recorded by the writer of the log. */
+  int64_t event_number{};
+
+  /** The time of the event in microseconds, as recorded in the log. */
+  int64_t timestamp{};
+
+  /** The channel the message was published on. */
+  std::string_view channel;
+
+  /** The encoded message. */
+  const void* data{};
+
+  /** The number of bytes in `data`. */
+  int data_size{};
+};
+
+/**
+ * A read-only, random-access reader of LCM log files, for offline analysis of
+ * large logs.
+ *
+ * The log file is memory-mapped rather than read, and is scanned once at
+ * construction to build an index of its events (their timestamps, channels,
+ * and locations in the file). After that, accessing any event is O(1),
+ * finding the first event at or after a given time is O(log n), and the
+ * events' data can be used in place, without copying. Optionally, the index
+ * can be saved next to the log so that reopening the log doesn't need to scan
+ * it again.
+ *
+ * Only the events in the file when it is opened are indexed; events that are
+ * appended later (e.g., by a logger that is still running) are not seen. The
+ * log must be a regular file, not a pipe or a device.
+ *
+ * The reader is immutable once constructed, so any number of threads may use
+ * it concurrently. DecodeEvents() decodes many messages in parallel (when
+ * compiled with OpenMP).
+ *
+ * Like the LCM log reader, corrupt bytes between events are skipped, and a
+ * final event that was truncated (e.g., because the logger was killed) is
+ * ignored.
+ *
+ * DrakeLcmLog uses this class to play back logs.
+ */
+class LcmLogReader {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(LcmLogReader)
+
+  /**
+   * Opens and indexes the log file named @p file_name.
+   *
+   * @param index_file_name If given, names a file in which the index of the
+   * log is saved. If that file already holds the index of this log (as
+   * identified by the size and the modification time of the log), the index
+   * is loaded from it instead of scanning the log; otherwise the log is
+   * scanned, and the index is saved there for next time. Failing to save the
+   * index is not an error.
+   *
+   * @throws std::exception if unable to open the log file, or if it isn't a
+   * regular file.
+   */
+  explicit LcmLogReader(
+      const std::string& file_name,
+      const std::optional<std::string>& index_file_name = std::nullopt);
+
+  ~LcmLogReader();
+
+  /** Returns the number of events in the log. */
+  int num_events() const { return static_cast<int>(events_.size()); }
+
+  /**
+   * Returns the event at @p index, in the order the events appear in the log.
+   * @pre 0 <= index < num_events().
+   */
+  LcmLogEventView event(int index) const;
+
+  /** Returns the distinct channels in the log, in order of first appearance. */
+  const std::vector<std::string>& channels() const { return channels_; }
+
+  /**
+   * Returns the indices of the events on @p channel, in increasing order. The
+   * result is empty if there are no such events.
+   */
+  const std::vector<int>& events_on_channel(std::string_view channel) const;
+
+  /**
+   * Returns the index of the first event whose timestamp (in microseconds) is
+   * at least @p timestamp, or num_events() if there is none. This is O(log n)
+   * when the timestamps in the log never decrease, as is the case for logs
+   * written by lcm-logger or DrakeLcmLog; otherwise, it's O(n).
+   */
+  int Seek(int64_t timestamp) const;
+
+  /**
+   * Returns the indices of the events on @p channel whose timestamps are in
+   * [@p begin_timestamp, @p end_timestamp), in increasing order.
+   */
+  std::vector<int> FindEvents(
+      std::string_view channel,
+      int64_t begin_timestamp = std::numeric_limits<int64_t>::min(),
+      int64_t end_timestamp = std::numeric_limits<int64_t>::max()) const;
+
+  /**
+   * Decodes the messages of the events at @p indices, which are all expected
+   * to be of type `Message`. The messages are decoded in parallel.
+   *
+   * @throws std::exception if any of the messages can't be decoded.
+   * @pre Each index is in [0, num_events()).
+   */
+  template <typename Message>
+  std::vector<Message> DecodeEvents(const std::vector<int>& indices) const {
+    std::vector<Message> result(indices.size());
+    drake::internal::ParallelForOptions options;
+    options.chunk_size = 64;
+    drake::internal::ParallelFor(static_cast<int>(indices.size()), [&](int i) {
+      const LcmLogEventView view = event(indices[i]);
+      const int size_decoded = result[i].decode(view.data, 0, view.data_size);
+      if (size_decoded != view.data_size) {
+        throw std::runtime_error(
+            "Error decoding message of type '" + NiceTypeName::Get<Message>() +
+            "' from the event at index " + std::to_string(indices[i]) +
+            " on channel '" + std::string(view.channel) + "'");
+      }
+    }, options);
+    return result;
+  }
+
+  /**
+   * Reports whether the index was loaded from the index file given to the
+   * constructor, rather than built by scanning the log.
+   */
+  bool index_was_loaded() const { return index_was_loaded_; }
+
+ private:
+  /* The indexed location of one event. */
+  struct IndexEntry {
+    int64_t event_number{};
+    int64_t timestamp{};
+    uint64_t data_offset{};
+    int32_t data_size{};
+    int32_t channel{};
+  };
+
+  /* Builds the index by scanning the whole log. */
+  void ScanLog();
+
+  /* Loads the index from the given file, returning false (and leaving the
+   index empty) if the file doesn't hold a valid index of this log. */
+  bool LoadIndex(const std::string& index_file_name);
+
+  /* Saves the index to the given file. */
+  void SaveIndex(const std::string& index_file_name) const;
+
+  /* Returns the number of the given channel, adding it if it's new. */
+  int32_t InternChannel(std::string_view channel);
+
+  /* Computes timestamps_sorted_ and channel_events_ from events_. */
+  void FinishIndex();
+
+  const drake::internal::MappedFile log_;
+  int64_t log_modification_time_{};
+  std::vector<IndexEntry> events_;
+  std::vector<std::string> channels_;
+  std::unordered_map<std::string, int32_t> channel_numbers_;
+  std::vector<std::vector<int>> channel_events_;
+  bool timestamps_sorted_{true};
+  bool index_was_loaded_{false};
+};
+
+}  // namespace lcm
+}  // namespace drake
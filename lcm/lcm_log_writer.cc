@@ -0,0 +1,263 @@
+#include "drake/lcm/lcm_log_writer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace lcm {
+
+namespace {
+
+/* The header of each event in an LCM log; see LcmLogReader. */
+constexpr uint32_t kSyncWord = 0xEDA1DA01;
+constexpr size_t kEventHeaderSize = 4 + 8 + 8 + 4 + 4;
+
+/* How long the writing thread sleeps when there's nothing to write. Publishers
+ never wake it (that would take a lock), so this bounds how long messages sit
+ in the buffer. */
+constexpr std::chrono::milliseconds kIdlePeriod(1);
+
+constexpr uint64_t RoundUpTo8(uint64_t size) {
+  return (size + 7) & ~uint64_t{7};
+}
+
+void AppendBigEndian(uint64_t value, int num_bytes, std::string* out) {
+  for (int i = num_bytes - 1; i >= 0; --i) {
+    out->push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+}
+
+}  // namespace
+
+LcmLogWriter::LcmLogWriter(const std::string& file_name,
+                           const LcmLogWriterParams& params)
+    : file_name_(file_name),
+      params_(params),
+      capacity_(RoundUpTo8(std::max(params.buffer_size, 0))) {
+  DRAKE_THROW_UNLESS(params.buffer_size >= 1024);
+  DRAKE_THROW_UNLESS(params.batch_size > 0);
+  static_assert(sizeof(RecordHeader) == 24);
+  static_assert(std::atomic<uint64_t>::is_always_lock_free);
+  // The buffer starts (and, between records, is always kept) zeroed, so that
+  // a record's `committed` word is zero until its publisher completes it.
+  // Unlike new[], calloc() leaves a large buffer's pages untouched until used.
+  buffer_.reset(static_cast<char*>(std::calloc(capacity_, 1)));
+  if (buffer_ == nullptr) throw std::bad_alloc();
+  file_ = std::fopen(file_name.c_str(), "wb");
+  if (file_ == nullptr) {
+    throw std::runtime_error("Failed to open log file: " + file_name);
+  }
+  // We do our own batching.
+  std::setvbuf(file_, nullptr, _IONBF, 0);
+  batch_.reserve(params.batch_size + kEventHeaderSize);
+  thread_ = std::thread([this]() {
+    WriteLoop();
+  });
+}
+
+LcmLogWriter::~LcmLogWriter() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wake_writer_.notify_one();
+  thread_.join();
+  std::fclose(file_);
+}
+
+void LcmLogWriter::Write(std::string_view channel, const void* data,
+                         int data_size, int64_t timestamp) {
+  ThrowIfFailed();
+  DRAKE_THROW_UNLESS(data_size >= 0);
+  const uint64_t size =
+      RoundUpTo8(sizeof(RecordHeader) + channel.size() + data_size);
+  if (size > capacity_ / 2) {
+    throw std::runtime_error(fmt::format(
+        "LcmLogWriter: a {} byte message on channel '{}' is too large for the "
+        "{} byte buffer of {}; increase LcmLogWriterParams::buffer_size.",
+        data_size, channel, capacity_, file_name_));
+  }
+
+  // Claim space for the record. If the record doesn't fit before the end of
+  // the buffer, it also claims the remainder of the buffer as padding, and
+  // goes at the start of the buffer.
+  uint64_t head = head_.load(std::memory_order_relaxed);
+  uint64_t padding{};
+  bool waited = false;
+  while (true) {
+    const uint64_t remainder = capacity_ - head % capacity_;
+    padding = remainder < size ? remainder : 0;
+    const uint64_t new_head = head + padding + size;
+    const uint64_t tail = tail_.load(std::memory_order_acquire);
+    if (new_head - tail > capacity_) {
+      if (params_.drop_when_full) {
+        ++messages_dropped_;
+        return;
+      }
+      if (!waited) {
+        ++publisher_waits_;
+        waited = true;
+      }
+      ThrowIfFailed();
+      std::this_thread::yield();
+      head = head_.load(std::memory_order_relaxed);
+      continue;
+    }
+    if (head_.compare_exchange_weak(head, new_head,
+                                    std::memory_order_relaxed)) {
+      const int64_t buffered = new_head - tail;
+      int64_t max_buffered =
+          max_buffered_bytes_.load(std::memory_order_relaxed);
+      while (buffered > max_buffered &&
+             !max_buffered_bytes_.compare_exchange_weak(
+                 max_buffered, buffered, std::memory_order_relaxed)) {
+      }
+      break;
+    }
+  }
+
+  // Padding shorter than a header is implied; the writing thread skips it.
+  if (padding >= sizeof(RecordHeader)) {
+    RecordHeader* header = header_at(head);
+    header->channel_size = -1;
+    header->committed.store(head + 1, std::memory_order_release);
+  }
+  const uint64_t position = head + padding;
+  RecordHeader* header = header_at(position);
+  header->timestamp = timestamp;
+  header->channel_size = static_cast<int32_t>(channel.size());
+  header->data_size = data_size;
+  char* payload = reinterpret_cast<char*>(header + 1);
+  std::memcpy(payload, channel.data(), channel.size());
+  if (data_size > 0) {
+    std::memcpy(payload + channel.size(), data, data_size);
+  }
+  header->committed.store(position + 1, std::memory_order_release);
+}
+
+void LcmLogWriter::Flush() {
+  const uint64_t target = head_.load(std::memory_order_acquire);
+  std::unique_lock<std::mutex> lock(mutex_);
+  flush_requested_ = std::max(flush_requested_, target);
+  wake_writer_.notify_one();
+  flushed_.wait(lock, [this, target]() {
+    return flushed_position_ >= target || failed_.load();
+  });
+  lock.unlock();
+  ThrowIfFailed();
+}
+
+LcmLogWriterStatistics LcmLogWriter::GetStatistics() const {
+  LcmLogWriterStatistics result;
+  result.messages_written = messages_written_.load();
+  result.bytes_written = bytes_written_.load();
+  result.messages_dropped = messages_dropped_.load();
+  result.publisher_waits = publisher_waits_.load();
+  result.max_buffered_bytes = max_buffered_bytes_.load();
+  return result;
+}
+
+void LcmLogWriter::WriteLoop() {
+  uint64_t tail = 0;
+  while (true) {
+    // Drain whatever is in the buffer, in batches.
+    while (CollectRecords(&tail)) {
+      if (batch_.size() >= static_cast<size_t>(params_.batch_size)) {
+        WriteBatch();
+      }
+    }
+    WriteBatch();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (flush_requested_ > flushed_position_) {
+      // Records claimed before the flush may still be being filled in.
+      if (tail >= flush_requested_ || failed_.load()) {
+        std::fflush(file_);
+        flushed_position_ = tail;
+        flushed_.notify_all();
+      }
+      continue;
+    }
+    if (stop_) {
+      // Publishers are gone; anything claimed is complete.
+      if (CollectRecords(&tail)) continue;
+      flushed_position_ = tail;
+      flushed_.notify_all();
+      return;
+    }
+    wake_writer_.wait_for(lock, kIdlePeriod);
+  }
+}
+
+bool LcmLogWriter::CollectRecords(uint64_t* tail) {
+  const uint64_t head = head_.load(std::memory_order_acquire);
+  uint64_t position = *tail;
+  while (position < head &&
+         batch_.size() < static_cast<size_t>(params_.batch_size)) {
+    const uint64_t remainder = capacity_ - position % capacity_;
+    if (remainder < sizeof(RecordHeader)) {
+      position += remainder;
+      continue;
+    }
+    RecordHeader* header = header_at(position);
+    if (header->committed.load(std::memory_order_acquire) != position + 1) {
+      // The publisher is still filling in this record.
+      break;
+    }
+    if (header->channel_size < 0) {
+      std::memset(static_cast<void*>(header), 0, sizeof(RecordHeader));
+      position += remainder;
+      continue;
+    }
+    const int channel_size = header->channel_size;
+    const int data_size = header->data_size;
+    const char* payload = reinterpret_cast<const char*>(header + 1);
+    AppendBigEndian(kSyncWord, 4, &batch_);
+    AppendBigEndian(next_event_number_++, 8, &batch_);
+    AppendBigEndian(header->timestamp, 8, &batch_);
+    AppendBigEndian(channel_size, 4, &batch_);
+    AppendBigEndian(data_size, 4, &batch_);
+    batch_.append(payload, channel_size + data_size);
+    ++messages_written_;
+    const size_t record_size =
+        sizeof(RecordHeader) + channel_size + data_size;
+    std::memset(static_cast<void*>(header), 0, record_size);
+    position += RoundUpTo8(record_size);
+  }
+  const bool found = position != *tail;
+  if (found) {
+    *tail = position;
+    tail_.store(position, std::memory_order_release);
+  }
+  return found;
+}
+
+void LcmLogWriter::WriteBatch() {
+  if (batch_.empty()) return;
+  if (!failed_.load() &&
+      std::fwrite(batch_.data(), 1, batch_.size(), file_) == batch_.size()) {
+    bytes_written_ += batch_.size();
+  } else {
+    // Keep draining the buffer so that publishers don't wait forever, but
+    // report the failure to them.
+    failed_ = true;
+  }
+  batch_.clear();
+}
+
+void LcmLogWriter::ThrowIfFailed() const {
+  if (failed_.load()) {
+    throw std::runtime_error("Failed to write to log file: " + file_name_);
+  }
+}
+
+}  // namespace lcm
+}  // namespace drake
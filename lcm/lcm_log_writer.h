@@ -0,0 +1,185 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/name_value.h"
+
+namespace drake {
+namespace lcm {
+
+/** The set of parameters for configuring LcmLogWriter. */
+struct LcmLogWriterParams {
+  /** Passes this object to an Archive.
+  Refer to @ref yaml_serialization "YAML Serialization" for background. */
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(buffer_size));
+    a->Visit(DRAKE_NVP(batch_size));
+    a->Visit(DRAKE_NVP(drop_when_full));
+  }
+
+  /** The size in bytes of the buffer that holds the messages that haven't
+  been written yet. Each message uses 24 bytes more than the size of its
+  channel name and data, rounded up to a multiple of 8. A message that needs
+  more than half of the buffer can't be written. */
+  int buffer_size{64 * 1024 * 1024};
+
+  /** The writing thread collects messages into batches of about this many
+  bytes, and writes each batch with a single system call. */
+  int batch_size{1024 * 1024};
+
+  /** What to do when a message is published while the buffer is full: when
+  false, the publisher waits for the writing thread to make room; when true,
+  the message is dropped (and counted in LcmLogWriterStatistics). */
+  bool drop_when_full{false};
+};
+
+/** Counts of what an LcmLogWriter has done so far. */
+struct LcmLogWriterStatistics {
+  /** The number of messages written to the log file. */
+  int64_t messages_written{};
+
+  /** The number of bytes written to the log file. */
+  int64_t bytes_written{};
+
+  /** The number of messages dropped because the buffer was full. */
+  int64_t messages_dropped{};
+
+  /** The number of times a publisher had to wait for room in the buffer. */
+  int64_t publisher_waits{};
+
+  /** The largest number of bytes that were buffered at once. */
+  int64_t max_buffered_bytes{};
+};
+
+/**
+ * Writes an LCM log file from a background thread, so that publishers don't
+ * wait for the file system.
+ *
+ * Write() copies the message into a ring buffer and returns. Any number of
+ * threads may call Write() concurrently; they claim space in the buffer with
+ * an atomic compare-and-swap rather than a lock, and never make a system call
+ * (unless they have to wait for room, see LcmLogWriterParams). A background
+ * thread collects the buffered messages into large batches in the LCM log
+ * format and writes them to the file. Messages appear in the log in the order
+ * in which they claimed space in the buffer.
+ *
+ * Messages are only guaranteed to be in the file once Flush() returns, or
+ * once the writer is destroyed.
+ *
+ * DrakeLcmLog uses this class when it's constructed with LcmLogWriterParams.
+ */
+class LcmLogWriter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(LcmLogWriter)
+
+  /**
+   * Creates (or truncates) the log file named @p file_name, and starts the
+   * writing thread.
+   *
+   * @throws std::exception if unable to open the file, or if the @p params
+   * are invalid.
+   */
+  LcmLogWriter(const std::string& file_name, const LcmLogWriterParams& params);
+
+  /** Writes all buffered messages, and closes the file. */
+  ~LcmLogWriter();
+
+  /**
+   * Buffers the message @p data (with @p data_size bytes) published on
+   * @p channel at @p timestamp (in microseconds), for writing to the log.
+   *
+   * @throws std::exception if the message is too large for the buffer, or if
+   * an earlier write to the file failed.
+   */
+  void Write(std::string_view channel, const void* data, int data_size,
+             int64_t timestamp);
+
+  /**
+   * Waits until all of the messages buffered before this call have been
+   * written to the file (and handed over to the operating system).
+   *
+   * @throws std::exception if writing to the file failed.
+   */
+  void Flush();
+
+  /** Returns the statistics so far. This is safe to call at any time. */
+  LcmLogWriterStatistics GetStatistics() const;
+
+ private:
+  /* The header of each record in the ring buffer. */
+  struct RecordHeader {
+    /* The position of the record in the stream of buffered bytes, plus one,
+     once the record is complete; zero until then. */
+    std::atomic<uint64_t> committed;
+    int64_t timestamp;
+    /* A negative channel size marks padding up to the end of the buffer. */
+    int32_t channel_size;
+    int32_t data_size;
+  };
+
+  /* The body of the writing thread. */
+  void WriteLoop();
+
+  /* Moves the complete records between `*tail` and head_ into batch_, and
+   zeroes their space in the buffer. Returns false if there were none. */
+  bool CollectRecords(uint64_t* tail);
+
+  /* Writes batch_ to the file, then empties it. */
+  void WriteBatch();
+
+  /* Throws if the writing thread failed to write to the file. */
+  void ThrowIfFailed() const;
+
+  RecordHeader* header_at(uint64_t position) {
+    return reinterpret_cast<RecordHeader*>(buffer_.get() +
+                                           position % capacity_);
+  }
+
+  const std::string file_name_;
+  const LcmLogWriterParams params_;
+  const uint64_t capacity_;
+  std::unique_ptr<char[], void (*)(void*)> buffer_{nullptr, &std::free};
+  std::FILE* file_{};
+
+  /* The positions (in the stream of buffered bytes, which wraps around the
+   buffer) of the end of the space claimed by publishers, and of the start of
+   the space not yet freed by the writing thread. */
+  std::atomic<uint64_t> head_{0};
+  std::atomic<uint64_t> tail_{0};
+
+  /* Only used by the writing thread. */
+  std::string batch_;
+  int64_t next_event_number_{0};
+
+  std::atomic<int64_t> messages_written_{0};
+  std::atomic<int64_t> bytes_written_{0};
+  std::atomic<int64_t> messages_dropped_{0};
+  std::atomic<int64_t> publisher_waits_{0};
+  std::atomic<int64_t> max_buffered_bytes_{0};
+  std::atomic<bool> failed_{false};
+
+  /* Guards the handshake between Flush() (or the destructor) and the writing
+   thread. Publishers never take it. */
+  std::mutex mutex_;
+  std::condition_variable wake_writer_;
+  std::condition_variable flushed_;
+  uint64_t flush_requested_{0};
+  uint64_t flushed_position_{0};
+  bool stop_{false};
+
+  std::thread thread_;
+};
+
+}  // namespace lcm
+}  // namespace drake
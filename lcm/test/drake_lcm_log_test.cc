@@ -1,10 +1,18 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <sys/stat.h>
+
+#include <cmath>
+#include <limits>
 #include <memory>
+#include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include "drake/common/temp_directory.h"
 #include "drake/lcmt_drake_signal.hpp"
 
 namespace drake {
@@ -66,6 +74,101 @@ GTEST_TEST(LcmLogTest, LcmLogTestSaveAndRead) {
   EXPECT_TRUE(multichannel_received);
 }
 
+// Saves a log from a background thread, then plays it back.
+GTEST_TEST(LcmLogTest, BufferedSave) {
+  const std::string channel_name("test_channel");
+  DrakeLcmLog w_log("buffered.log", LcmLogWriterParams{});
+  EXPECT_TRUE(w_log.is_write());
+  for (int i = 0; i < 10; ++i) {
+    drake::lcmt_drake_signal msg{};
+    msg.timestamp = i;
+    Publish(&w_log, channel_name, msg, 0.1 * i);
+  }
+  w_log.Flush();
+  const LcmLogWriterStatistics statistics = w_log.GetWriteStatistics();
+  EXPECT_EQ(statistics.messages_written, 10);
+  EXPECT_EQ(statistics.messages_dropped, 0);
+
+  // The flushed messages can be played back while the log is still open.
+  DrakeLcmLog r_log("buffered.log", false);
+  std::vector<int64_t> received;
+  Subscribe<drake::lcmt_drake_signal>(
+      &r_log, channel_name, [&received](const auto& message) {
+        received.push_back(message.timestamp);
+      });
+  while (!std::isinf(r_log.GetNextMessageTime())) {
+    r_log.DispatchMessageAndAdvanceLog(r_log.GetNextMessageTime());
+  }
+  EXPECT_EQ(received, std::vector<int64_t>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+  EXPECT_THROW(r_log.GetWriteStatistics(), std::exception);
+}
+
+// Plays back a log from the middle, and then rewinds it.
+GTEST_TEST(LcmLogTest, Seek) {
+  const std::string channel_name("test_channel");
+  {
+    DrakeLcmLog w_log("seek.log", true);
+    for (int i = 0; i < 10; ++i) {
+      drake::lcmt_drake_signal msg{};
+      msg.timestamp = i;
+      Publish(&w_log, channel_name, msg, 0.1 * i);
+    }
+  }
+
+  DrakeLcmLog r_log("seek.log", false);
+  EXPECT_EQ(r_log.reader().num_events(), 10);
+  std::vector<int64_t> received;
+  Subscribe<drake::lcmt_drake_signal>(
+      &r_log, channel_name, [&received](const auto& message) {
+        received.push_back(message.timestamp);
+      });
+
+  r_log.Seek(0.65);
+  EXPECT_EQ(r_log.GetNextMessageTime(), r_log.timestamp_to_second(700000));
+  while (!std::isinf(r_log.GetNextMessageTime())) {
+    r_log.DispatchMessageAndAdvanceLog(r_log.GetNextMessageTime());
+  }
+  EXPECT_EQ(received, std::vector<int64_t>({7, 8, 9}));
+
+  // Seeking to a message's own time lands on it.
+  r_log.Seek(0.3);
+  EXPECT_EQ(r_log.GetNextMessageTime(), r_log.timestamp_to_second(300000));
+  r_log.Seek(-std::numeric_limits<double>::infinity());
+  EXPECT_EQ(r_log.GetNextMessageTime(), 0.0);
+  r_log.Seek(std::numeric_limits<double>::infinity());
+  EXPECT_TRUE(std::isinf(r_log.GetNextMessageTime()));
+}
+
+// A log that isn't a regular file is played back as a stream.
+GTEST_TEST(LcmLogTest, PlayBackPipe) {
+  const std::string channel_name("test_channel");
+  const std::string pipe_name = temp_directory() + "/pipe.log";
+  ASSERT_EQ(mkfifo(pipe_name.c_str(), 0600), 0);
+
+  // Opening either end of the pipe blocks until the other end is opened.
+  std::thread writer([&]() {
+    DrakeLcmLog w_log(pipe_name, true);
+    for (int i = 0; i < 3; ++i) {
+      drake::lcmt_drake_signal msg{};
+      msg.timestamp = i;
+      Publish(&w_log, channel_name, msg, 0.1 * i);
+    }
+  });
+  DrakeLcmLog r_log(pipe_name, false);
+  std::vector<int64_t> received;
+  Subscribe<drake::lcmt_drake_signal>(
+      &r_log, channel_name, [&received](const auto& message) {
+        received.push_back(message.timestamp);
+      });
+  while (!std::isinf(r_log.GetNextMessageTime())) {
+    r_log.DispatchMessageAndAdvanceLog(r_log.GetNextMessageTime());
+  }
+  writer.join();
+  EXPECT_EQ(received, std::vector<int64_t>({0, 1, 2}));
+  EXPECT_THROW(r_log.Seek(0.0), std::logic_error);
+  EXPECT_THROW(r_log.reader(), std::logic_error);
+}
+
 }  // namespace
 }  // namespace lcm
 }  // namespace drake
@@ -0,0 +1,147 @@
+#include "drake/lcm/lcm_log_reader.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/lcm/drake_lcm_log.h"
+#include "drake/lcmt_drake_signal.hpp"
+
+namespace drake {
+namespace lcm {
+namespace {
+
+drake::lcmt_drake_signal MakeMessage(int i) {
+  drake::lcmt_drake_signal message{};
+  message.dim = 1;
+  message.val.push_back(0.5 * i);
+  message.coord.push_back("x");
+  message.timestamp = i;
+  return message;
+}
+
+class LcmLogReaderTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    filename_ = temp_directory() + "/test.lcmlog";
+    // Messages alternate between channels A and B, 0.25 seconds apart.
+    DrakeLcmLog log(filename_, true);
+    for (int i = 0; i < kNumMessages; ++i) {
+      Publish(&log, i % 2 == 0 ? "A" : "B", MakeMessage(i), 0.25 * i);
+    }
+  }
+
+  static constexpr int kNumMessages = 100;
+  std::string filename_;
+};
+
+TEST_F(LcmLogReaderTest, RandomAccess) {
+  const LcmLogReader dut(filename_);
+  ASSERT_EQ(dut.num_events(), kNumMessages);
+  EXPECT_EQ(dut.channels(), std::vector<std::string>({"A", "B"}));
+  EXPECT_FALSE(dut.index_was_loaded());
+
+  const LcmLogEventView view = dut.event(37);
+  EXPECT_EQ(view.channel, "B");
+  EXPECT_EQ(view.timestamp, 9250000);
+  drake::lcmt_drake_signal message{};
+  ASSERT_EQ(message.decode(view.data, 0, view.data_size), view.data_size);
+  EXPECT_EQ(message.timestamp, 37);
+
+  EXPECT_EQ(dut.events_on_channel("A").size(), kNumMessages / 2);
+  EXPECT_EQ(dut.events_on_channel("A")[3], 6);
+  EXPECT_TRUE(dut.events_on_channel("C").empty());
+}
+
+TEST_F(LcmLogReaderTest, Seek) {
+  const LcmLogReader dut(filename_);
+  EXPECT_EQ(dut.Seek(0), 0);
+  EXPECT_EQ(dut.Seek(10000000), 40);
+  EXPECT_EQ(dut.Seek(10000001), 41);
+  EXPECT_EQ(dut.Seek(1000000000), kNumMessages);
+
+  // Channel B's events in [2, 3) seconds.
+  EXPECT_EQ(dut.FindEvents("B", 2000000, 3000000),
+            std::vector<int>({9, 11}));
+  EXPECT_TRUE(dut.FindEvents("C").empty());
+}
+
+TEST_F(LcmLogReaderTest, DecodeEvents) {
+  const LcmLogReader dut(filename_);
+  const std::vector<int>& indices = dut.events_on_channel("B");
+  const std::vector<drake::lcmt_drake_signal> messages =
+      dut.DecodeEvents<drake::lcmt_drake_signal>(indices);
+  ASSERT_EQ(messages.size(), indices.size());
+  for (int i = 0; i < static_cast<int>(indices.size()); ++i) {
+    EXPECT_EQ(messages[i].timestamp, indices[i]);
+    EXPECT_EQ(messages[i].val.at(0), 0.5 * indices[i]);
+  }
+}
+
+TEST_F(LcmLogReaderTest, DecodeError) {
+  const std::string junk_filename = temp_directory() + "/junk.lcmlog";
+  {
+    DrakeLcmLog log(junk_filename, true);
+    log.Publish("junk", "junk", 4, 0.0);
+  }
+  const LcmLogReader dut(junk_filename);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.DecodeEvents<drake::lcmt_drake_signal>({0}),
+      "Error decoding message of type 'drake::lcmt_drake_signal' from the "
+      "event at index 0 on channel 'junk'");
+}
+
+TEST_F(LcmLogReaderTest, IndexFile) {
+  const std::string index = temp_directory() + "/test.lcmlog.index";
+  const LcmLogReader first(filename_, index);
+  EXPECT_FALSE(first.index_was_loaded());
+
+  const LcmLogReader second(filename_, index);
+  EXPECT_TRUE(second.index_was_loaded());
+  ASSERT_EQ(second.num_events(), first.num_events());
+  EXPECT_EQ(second.channels(), first.channels());
+  for (int i = 0; i < first.num_events(); ++i) {
+    EXPECT_EQ(second.event(i).timestamp, first.event(i).timestamp);
+    EXPECT_EQ(second.event(i).data, first.event(i).data);
+  }
+
+  // A corrupt index is ignored.
+  { std::ofstream(index) << "garbage"; }
+  const LcmLogReader third(filename_, index);
+  EXPECT_FALSE(third.index_was_loaded());
+  EXPECT_EQ(third.num_events(), kNumMessages);
+}
+
+TEST_F(LcmLogReaderTest, Corruption) {
+  // Garbage between events is skipped, and a truncated final event is ignored.
+  std::string contents;
+  {
+    std::ifstream input(filename_, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(input), {});
+  }
+  // The first event starts the file with a 28 byte header and its one byte
+  // channel name, and the second event follows its data.
+  const LcmLogReader original(filename_);
+  const size_t second_event = 28 + 1 + original.event(0).data_size;
+  std::string corrupt = contents.substr(0, second_event) + "garbage" +
+                        contents.substr(second_event);
+  corrupt.resize(corrupt.size() - 3);
+  const std::string corrupt_filename = temp_directory() + "/corrupt.lcmlog";
+  { std::ofstream(corrupt_filename, std::ios::binary) << corrupt; }
+
+  const LcmLogReader dut(corrupt_filename);
+  EXPECT_EQ(dut.num_events(), kNumMessages - 1);
+}
+
+GTEST_TEST(LcmLogReaderErrorTest, MissingFile) {
+  DRAKE_EXPECT_THROWS_MESSAGE(LcmLogReader("/no/such/file.lcmlog"),
+                              "Failed to open log file.*");
+}
+
+}  // namespace
+}  // namespace lcm
+}  // namespace drake
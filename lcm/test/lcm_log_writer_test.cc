@@ -0,0 +1,136 @@
+#include "drake/lcm/lcm_log_writer.h"
+
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/lcm/lcm_log_reader.h"
+
+namespace drake {
+namespace lcm {
+namespace {
+
+class LcmLogWriterTest : public ::testing::Test {
+ protected:
+  std::string filename_{temp_directory() + "/test.lcmlog"};
+};
+
+TEST_F(LcmLogWriterTest, RoundTrip) {
+  {
+    LcmLogWriter dut(filename_, LcmLogWriterParams{});
+    dut.Write("A", "one", 3, 10);
+    dut.Write("BB", "", 0, 20);
+    dut.Write("A", "three", 5, 30);
+    dut.Flush();
+    const LcmLogWriterStatistics statistics = dut.GetStatistics();
+    EXPECT_EQ(statistics.messages_written, 3);
+    EXPECT_EQ(statistics.bytes_written, 3 * 28 + 1 + 3 + 2 + 1 + 5);
+    EXPECT_EQ(statistics.messages_dropped, 0);
+  }
+
+  const LcmLogReader reader(filename_);
+  ASSERT_EQ(reader.num_events(), 3);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(reader.event(i).event_number, i);
+    EXPECT_EQ(reader.event(i).timestamp, 10 * (i + 1));
+  }
+  EXPECT_EQ(reader.event(1).channel, "BB");
+  EXPECT_EQ(reader.event(1).data_size, 0);
+  const LcmLogEventView third = reader.event(2);
+  EXPECT_EQ(third.channel, "A");
+  EXPECT_EQ(std::string(static_cast<const char*>(third.data), third.data_size),
+            "three");
+}
+
+// Many publishers share a buffer that's much smaller than the messages they
+// publish, so the buffer wraps around many times and publishers must wait.
+TEST_F(LcmLogWriterTest, ConcurrentPublishers) {
+  constexpr int kNumThreads = 4;
+  constexpr int kNumMessages = 2000;
+  LcmLogWriterParams params;
+  params.buffer_size = 4096;
+  params.batch_size = 1000;
+  {
+    LcmLogWriter dut(filename_, params);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kNumThreads; ++t) {
+      threads.emplace_back([&dut, t]() {
+        // Messages of different sizes, so that records don't line up with
+        // the end of the buffer.
+        std::vector<char> data(37 + 13 * t, static_cast<char>('a' + t));
+        for (int i = 0; i < kNumMessages; ++i) {
+          std::memcpy(data.data(), &i, sizeof(i));
+          dut.Write("CHANNEL_" + std::to_string(t), data.data(), data.size(),
+                    i);
+        }
+      });
+    }
+    for (std::thread& thread : threads) thread.join();
+    dut.Flush();
+    const LcmLogWriterStatistics statistics = dut.GetStatistics();
+    EXPECT_EQ(statistics.messages_written, kNumThreads * kNumMessages);
+    EXPECT_LE(statistics.max_buffered_bytes, 4096);
+  }
+
+  // Each publisher's messages are in the log in order, and intact.
+  const LcmLogReader reader(filename_);
+  ASSERT_EQ(reader.num_events(), kNumThreads * kNumMessages);
+  for (int t = 0; t < kNumThreads; ++t) {
+    const std::vector<int>& indices =
+        reader.events_on_channel("CHANNEL_" + std::to_string(t));
+    ASSERT_EQ(indices.size(), kNumMessages);
+    for (int i = 0; i < kNumMessages; ++i) {
+      const LcmLogEventView event = reader.event(indices[i]);
+      ASSERT_EQ(event.data_size, 37 + 13 * t);
+      int value{};
+      std::memcpy(&value, event.data, sizeof(value));
+      ASSERT_EQ(value, i);
+      ASSERT_EQ(static_cast<const char*>(event.data)[event.data_size - 1],
+                'a' + t);
+    }
+  }
+}
+
+TEST_F(LcmLogWriterTest, DropWhenFull) {
+  LcmLogWriterParams params;
+  params.buffer_size = 1024;
+  params.drop_when_full = true;
+  const std::vector<char> data(400);
+  int64_t messages_dropped{};
+  {
+    LcmLogWriter dut(filename_, params);
+    for (int i = 0; i < 100; ++i) {
+      dut.Write("A", data.data(), data.size(), i);
+    }
+    dut.Flush();
+    const LcmLogWriterStatistics statistics = dut.GetStatistics();
+    messages_dropped = statistics.messages_dropped;
+    EXPECT_EQ(statistics.messages_written + statistics.messages_dropped, 100);
+    EXPECT_EQ(statistics.publisher_waits, 0);
+  }
+  const LcmLogReader reader(filename_);
+  EXPECT_EQ(reader.num_events(), 100 - messages_dropped);
+}
+
+TEST_F(LcmLogWriterTest, Errors) {
+  LcmLogWriterParams params;
+  params.buffer_size = 1024;
+  LcmLogWriter dut(filename_, params);
+  const std::vector<char> data(1000);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.Write("A", data.data(), data.size(), 0),
+      ".*1000 byte message on channel 'A' is too large.*");
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LcmLogWriter("/no/such/directory/test.lcmlog", params),
+      "Failed to open log file.*");
+}
+
+}  // namespace
+}  // namespace lcm
+}  // namespace drake
@@ -0,0 +1,85 @@
+#include <filesystem>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/text_logging.h"
+#include "drake/geometry/proximity/hydroelastic_internal.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/multibody_plant.h"
+
+DEFINE_string(output_dir, "",
+              "Directory in which to write the precompiled representations");
+
+namespace drake {
+namespace {
+
+using geometry::GeometryId;
+using geometry::ProximityProperties;
+using geometry::SceneGraph;
+using geometry::SceneGraphInspector;
+using geometry::internal::hydroelastic::WritePrecompiledRepresentation;
+using multibody::MultibodyPlant;
+using multibody::Parser;
+
+void main(const std::vector<std::string>& model_files) {
+  DRAKE_THROW_UNLESS(!FLAGS_output_dir.empty());
+  DRAKE_THROW_UNLESS(!model_files.empty());
+  std::filesystem::create_directories(FLAGS_output_dir);
+
+  MultibodyPlant<double> plant(0.0);
+  SceneGraph<double> scene_graph;
+  plant.RegisterAsSourceForSceneGraph(&scene_graph);
+  Parser parser(&plant);
+  for (const std::string& model_file : model_files) {
+    parser.AddAllModelsFromFile(model_file);
+  }
+
+  // Geometries that share a representation (e.g., many instances of the same
+  // mesh) produce a single file.
+  std::set<std::string> written;
+  const SceneGraphInspector<double>& inspector = scene_graph.model_inspector();
+  for (const GeometryId id : inspector.GetAllGeometryIds()) {
+    const ProximityProperties* props = inspector.GetProximityProperties(id);
+    if (props == nullptr) continue;
+    const std::optional<std::string> filename = WritePrecompiledRepresentation(
+        inspector.GetShape(id), *props, FLAGS_output_dir);
+    if (filename.has_value() && written.insert(*filename).second) {
+      log()->info("Wrote {} for {}", *filename, inspector.GetName(id));
+    }
+  }
+  log()->info("Wrote {} precompiled hydroelastic representations to {}",
+              written.size(), FLAGS_output_dir);
+}
+
+}  // namespace
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      R"""([--output_dir=DIR] MODEL_FILE...
+
+Loads the given model files (SDFormat, URDF, etc.) and writes the hydroelastic
+representation (meshes, pressure fields and bounding volume hierarchies) of
+each of their hydroelastic geometries to the output directory, in a binary
+format that is loaded without parsing or recomputation.
+
+To use the precompiled representations, add the ('hydroelastic',
+'precompiled_dir') proximity property, naming the output directory, to the
+properties of the geometries that should use them. In model files, this is the
+<drake:precompiled_dir> tag of <drake:proximity_properties>, whose value (a
+package:// URI or a path relative to the model file) names the directory.
+Representations are keyed on
+the shape parameters, the contents of mesh files, and the hydroelastic
+properties; geometries whose inputs have changed since they were precompiled,
+or whose files are damaged, are computed as usual.
+)""");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  drake::main(std::vector<std::string>(argv + 1, argv + argc));
+  return 0;
+}
@@ -0,0 +1,149 @@
+// @file
+// Benchmarks for the computation of contact Jacobians as a function of the
+// number of contact points, computing the Jacobian of each contact point with
+// MultibodyTree::CalcJacobianTranslationalVelocity() versus computing per-tree
+// blocks from the spatial Jacobian of each body in contact.
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include "drake/multibody/plant/contact_jacobian_blocks.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using geometry::GeometryId;
+
+/* The model has kNumChains chains of kChainLength links connected by revolute
+ joints, one tree each, and kNumFreeBodies free bodies. */
+constexpr int kNumChains = 4;
+constexpr int kChainLength = 7;
+constexpr int kNumFreeBodies = 8;
+
+/* Fixture with a plant and a set of synthetic contact pairs, with the number of
+ contact points given by the first benchmark argument. As with hydroelastic
+ contact, contact points are grouped into patches of kPointsPerPatch points
+ between the same two bodies. */
+class ContactJacobiansFixture : public benchmark::Fixture {
+ public:
+  ContactJacobiansFixture() { tools::performance::AddMinMaxStatistics(this); }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    plant_ = std::make_unique<MultibodyPlant<double>>(0.0);
+    const SpatialInertia<double> M = SpatialInertia<double>::MakeUnitary();
+    std::vector<BodyIndex> bodies;
+    for (int c = 0; c < kNumChains; ++c) {
+      const Body<double>* parent = &plant_->world_body();
+      for (int l = 0; l < kChainLength; ++l) {
+        const std::string suffix = fmt::format("_{}_{}", c, l);
+        const RigidBody<double>& link =
+            plant_->AddRigidBody("link" + suffix, M);
+        plant_->AddJoint<RevoluteJoint>(
+            "joint" + suffix, *parent,
+            math::RigidTransformd(Vector3d(c, 0, l == 0 ? 1.0 : -0.2)), link,
+            std::nullopt, l % 2 == 0 ? Vector3d::UnitY() : Vector3d::UnitX());
+        bodies.push_back(link.index());
+        parent = &link;
+      }
+    }
+    for (int b = 0; b < kNumFreeBodies; ++b) {
+      bodies.push_back(
+          plant_->AddRigidBody(fmt::format("free_{}", b), M).index());
+    }
+    bodies.push_back(plant_->world_body().index());
+    plant_->Finalize();
+    context_ = plant_->CreateDefaultContext();
+    plant_->SetPositions(
+        context_.get(),
+        VectorX<double>::LinSpaced(plant_->num_positions(), 0.1, 0.9));
+
+    std::vector<GeometryId> geometries;
+    for (const BodyIndex& body : bodies) {
+      geometries.push_back(GeometryId::get_new_id());
+      geometry_id_to_body_index_[geometries.back()] = body;
+    }
+
+    const int num_contacts = state.range(0);
+    const int num_bodies = bodies.size();
+    constexpr int kPointsPerPatch = 20;
+    contact_pairs_.clear();
+    for (int i = 0; i < num_contacts; ++i) {
+      const int patch = i / kPointsPerPatch;
+      DiscreteContactPair<double> pair;
+      pair.id_A = geometries[patch % num_bodies];
+      pair.id_B = geometries[(3 * patch + 1) % num_bodies];
+      if (pair.id_A == pair.id_B) pair.id_B = geometries.back();
+      pair.p_WC = Vector3d(0.01 * i, 0.02 * (i % 7), 0.03 * (i % 11));
+      pair.nhat_BA_W = Vector3d::UnitZ();
+      contact_pairs_.push_back(pair);
+    }
+    state.counters["contacts"] = num_contacts;
+  }
+
+ protected:
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  std::unique_ptr<systems::Context<double>> context_;
+  std::unordered_map<GeometryId, BodyIndex> geometry_id_to_body_index_;
+  std::vector<DiscreteContactPair<double>> contact_pairs_;
+};
+
+void ContactsArgs(benchmark::internal::Benchmark* b) {
+  b->Arg(10)->Arg(100)->Arg(1000)->ArgName("contacts")->Unit(
+      benchmark::kMicrosecond);
+}
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(ContactJacobiansFixture, PerPoint)(benchmark::State& state) {
+  const MultibodyTree<double>& tree = GetInternalTree(*plant_);
+  const Frame<double>& frame_W = plant_->world_frame();
+  Matrix3X<double> Jv_WAc_W(3, plant_->num_velocities());
+  Matrix3X<double> Jv_WBc_W(3, plant_->num_velocities());
+  std::vector<Matrix3X<double>> J_AcBc_W(contact_pairs_.size());
+  for (auto _ : state) {
+    for (int i = 0; i < static_cast<int>(contact_pairs_.size()); ++i) {
+      const DiscreteContactPair<double>& pair = contact_pairs_[i];
+      const Body<double>& body_A =
+          tree.get_body(geometry_id_to_body_index_.at(pair.id_A));
+      const Body<double>& body_B =
+          tree.get_body(geometry_id_to_body_index_.at(pair.id_B));
+      tree.CalcJacobianTranslationalVelocity(
+          *context_, JacobianWrtVariable::kV, body_A.body_frame(), frame_W,
+          pair.p_WC, frame_W, frame_W, &Jv_WAc_W);
+      tree.CalcJacobianTranslationalVelocity(
+          *context_, JacobianWrtVariable::kV, body_B.body_frame(), frame_W,
+          pair.p_WC, frame_W, frame_W, &Jv_WBc_W);
+      J_AcBc_W[i] = Jv_WBc_W - Jv_WAc_W;
+    }
+  }
+}
+BENCHMARK_REGISTER_F(ContactJacobiansFixture, PerPoint)->Apply(ContactsArgs);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(ContactJacobiansFixture, TreeBlocks)
+(benchmark::State& state) {
+  const MultibodyTree<double>& tree = GetInternalTree(*plant_);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CalcContactJacobianTreeBlocks(
+        tree, *context_, geometry_id_to_body_index_, contact_pairs_));
+  }
+}
+BENCHMARK_REGISTER_F(ContactJacobiansFixture, TreeBlocks)->Apply(ContactsArgs);
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -0,0 +1,150 @@
+// @file
+// Benchmarks for the assembly of the FEM residual, tangent matrix, and
+// per-element data of deformable bodies, as a function of the number of
+// threads. Threads are only used when Drake is built with OpenMP, e.g.,
+//
+//   bazel run --config=omp //multibody/benchmarking:fem_assembly
+
+#include <memory>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#include <benchmark/benchmark.h>
+
+#include "drake/geometry/proximity/make_box_mesh.h"
+#include "drake/multibody/fem/corotated_model.h"
+#include "drake/multibody/fem/fem_state.h"
+#include "drake/multibody/fem/linear_simplex_element.h"
+#include "drake/multibody/fem/petsc_symmetric_block_sparse_matrix.h"
+#include "drake/multibody/fem/simplex_gaussian_quadrature.h"
+#include "drake/multibody/fem/volumetric_model.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+namespace {
+
+constexpr int kNaturalDimension = 3;
+constexpr int kSpatialDimension = 3;
+constexpr int kQuadratureOrder = 1;
+using QuadratureType =
+    SimplexGaussianQuadrature<kNaturalDimension, kQuadratureOrder>;
+constexpr int kNumQuads = QuadratureType::num_quadrature_points;
+using IsoparametricElementType =
+    LinearSimplexElement<double, kNaturalDimension, kSpatialDimension,
+                         kNumQuads>;
+using ConstitutiveModelType = CorotatedModel<double, kNumQuads>;
+using ElementType = VolumetricElement<IsoparametricElementType, QuadratureType,
+                                      ConstitutiveModelType>;
+using ModelType = VolumetricModel<ElementType>;
+
+/* Mesh resolutions (in meters) for a unit cube, indexed by the first benchmark
+ argument. They produce roughly 6k, 48k, and 165k tetrahedra respectively. */
+constexpr double kResolutions[] = {0.1, 0.05, 0.033};
+
+/* Fixture that builds a corotated FEM model of a unit cube. The benchmark
+ arguments are {resolution index, number of threads}. */
+class FemAssemblyFixture : public benchmark::Fixture {
+ public:
+  FemAssemblyFixture() { tools::performance::AddMinMaxStatistics(this); }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    const geometry::VolumeMesh<double> mesh =
+        geometry::internal::MakeBoxVolumeMesh<double>(
+            geometry::Box(1.0, 1.0, 1.0), kResolutions[state.range(0)]);
+    model_ = std::make_unique<ModelType>();
+    ModelType::VolumetricBuilder builder(model_.get());
+    const ConstitutiveModelType constitutive_model(1e5, 0.4);
+    const DampingModel<double> damping_model(0.01, 0.01);
+    builder.AddLinearTetrahedralElements(mesh, constitutive_model, 1000.0,
+                                         damping_model);
+    builder.Build();
+    fem_state_ = model_->MakeFemState();
+    /* Perturb the state away from the reference configuration so that the
+     corotated model does nontrivial work. */
+    VectorX<double> q = fem_state_->GetPositions();
+    for (int i = 0; i < q.size(); ++i) {
+      q(i) *= 1.0 + 0.01 * ((i % 7) - 3);
+    }
+    fem_state_->SetPositions(q);
+    residual_ = VectorX<double>::Zero(model_->num_dofs());
+    tangent_matrix_ = model_->MakePetscSymmetricBlockSparseTangentMatrix();
+#if defined(_OPENMP)
+    omp_set_num_threads(state.range(1));
+#else
+    if (state.range(1) > 1) {
+      state.SkipWithError("Multiple threads requires building with OpenMP.");
+    }
+#endif
+    state.counters["elements"] = model_->num_elements();
+  }
+
+  void InvalidateState() {
+    /* Setting the positions invalidates the per-element data cache entry. */
+    const VectorX<double> q = fem_state_->GetPositions();
+    fem_state_->SetPositions(q);
+  }
+
+ protected:
+  std::unique_ptr<ModelType> model_;
+  std::unique_ptr<FemState<double>> fem_state_;
+  VectorX<double> residual_;
+  std::unique_ptr<PetscSymmetricBlockSparseMatrix> tangent_matrix_;
+};
+
+/* Registers the {resolution, threads} combinations. */
+void AssemblyArgs(benchmark::internal::Benchmark* b) {
+  for (int resolution : {0, 1, 2}) {
+    for (int threads : {1, 2, 4, 8, 16}) {
+      b->Args({resolution, threads});
+    }
+  }
+  b->ArgNames({"resolution", "threads"})
+      ->Unit(benchmark::kMillisecond)
+      ->UseRealTime();
+}
+
+BENCHMARK_DEFINE_F(FemAssemblyFixture, ResidualWithElementData)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  for (auto _ : state) {
+    InvalidateState();
+    model_->CalcResidual(*fem_state_, &residual_);
+  }
+}
+BENCHMARK_REGISTER_F(FemAssemblyFixture, ResidualWithElementData)
+    ->Apply(AssemblyArgs);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(FemAssemblyFixture, Residual)(benchmark::State& state) {
+  /* Evaluate the element data once outside of the timing loop so that only
+   the residual assembly is measured. */
+  model_->CalcResidual(*fem_state_, &residual_);
+  for (auto _ : state) {
+    model_->CalcResidual(*fem_state_, &residual_);
+  }
+}
+BENCHMARK_REGISTER_F(FemAssemblyFixture, Residual)->Apply(AssemblyArgs);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(FemAssemblyFixture, TangentMatrix)(benchmark::State& state) {
+  const Vector3<double> weights(1.0, 0.01, 1e-4);
+  model_->CalcResidual(*fem_state_, &residual_);
+  for (auto _ : state) {
+    model_->CalcTangentMatrix(*fem_state_, weights, tangent_matrix_.get());
+  }
+}
+BENCHMARK_REGISTER_F(FemAssemblyFixture, TangentMatrix)->Apply(AssemblyArgs);
+
+}  // namespace
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
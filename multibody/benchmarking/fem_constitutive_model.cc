@@ -0,0 +1,153 @@
+// @file
+// Benchmarks for the evaluation of the corotated constitutive model (the
+// polar decomposition, energy density, stress, and stress derivative) at many
+// quadrature points, one location at a time versus in batches with the
+// (possibly SIMD) kernels in corotated_batch_kernels.h.
+
+#include <array>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/math/rotation_matrix.h"
+#include "drake/multibody/fem/corotated_batch_kernels.h"
+#include "drake/multibody/fem/corotated_model.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+namespace {
+
+using ModelType = CorotatedModel<double, 1>;
+using Data = ModelType::Data;
+
+/* Fixture holding the inputs and outputs at the number of locations given by
+ the first benchmark argument, both in the per-location layout used by
+ CorotatedModel and in the structure-of-arrays layout used by the kernels. */
+class CorotatedModelFixture : public benchmark::Fixture {
+ public:
+  CorotatedModelFixture() { tools::performance::AddMinMaxStatistics(this); }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    const int size = state.range(0);
+    const int stride = (size + 3) / 4 * 4;
+    F_.resize(size);
+    data_.resize(size);
+    Psi_.resize(size);
+    P_.resize(size);
+    dPdF_.resize(size);
+    entries_.resize(size);
+    storage_.assign(130 * stride, 0.0);
+    arrays_.size = size;
+    arrays_.stride = stride;
+    double* next = storage_.data();
+    auto take = [&next, stride](int num_arrays) {
+      double* result = next;
+      next += num_arrays * stride;
+      return result;
+    };
+    double* F = take(9);
+    double* mu = take(1);
+    double* lambda = take(1);
+    arrays_.F = F;
+    arrays_.mu = mu;
+    arrays_.lambda = lambda;
+    arrays_.R = take(9);
+    arrays_.S = take(9);
+    arrays_.Jm1 = take(1);
+    arrays_.JFinvT = take(9);
+    arrays_.Psi = take(1);
+    arrays_.P = take(9);
+    arrays_.dPdF = take(81);
+    /* Moderately large, rotated deformations. */
+    for (int i = 0; i < stride; ++i) {
+      const Matrix3<double> R =
+          math::RotationMatrix<double>(
+              math::RollPitchYaw<double>(0.1 * i, 0.2 * i, 0.3 * i))
+              .matrix();
+      const Vector3<double> stretch(1.0 + 0.01 * (i % 11),
+                                    1.0 - 0.02 * (i % 5), 1.0 + 0.03 * (i % 3));
+      const Matrix3<double> F_i = R * stretch.asDiagonal();
+      for (int k = 0; k < 9; ++k) {
+        F[k * stride + i] = F_i(k);
+      }
+      mu[i] = model_.shear_modulus();
+      lambda[i] = model_.lame_first_parameter();
+      if (i < size) {
+        F_[i][0] = F_i;
+        entries_[i] = {&model_, &F_[i], &data_[i], &Psi_[i], &P_[i], &dPdF_[i]};
+      }
+    }
+    state.counters["locations"] = size;
+  }
+
+ protected:
+  const ModelType model_{1e5, 0.4};
+  std::vector<std::array<Matrix3<double>, 1>> F_;
+  std::vector<Data> data_;
+  std::vector<std::array<double, 1>> Psi_;
+  std::vector<std::array<Matrix3<double>, 1>> P_;
+  std::vector<std::array<Eigen::Matrix<double, 9, 9>, 1>> dPdF_;
+  std::vector<ModelType::BatchEntry> entries_;
+  std::vector<double> storage_;
+  CorotatedBatchArrays arrays_;
+};
+
+void BatchArgs(benchmark::internal::Benchmark* b) {
+  b->Arg(64)->Arg(4096)->ArgName("locations")->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK_DEFINE_F(CorotatedModelFixture, PerLocation)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  for (auto _ : state) {
+    for (int i = 0; i < static_cast<int>(F_.size()); ++i) {
+      data_[i].UpdateData(F_[i]);
+      model_.CalcElasticEnergyDensity(data_[i], &Psi_[i]);
+      model_.CalcFirstPiolaStress(data_[i], &P_[i]);
+      model_.CalcFirstPiolaStressDerivative(data_[i], &dPdF_[i]);
+    }
+  }
+}
+BENCHMARK_REGISTER_F(CorotatedModelFixture, PerLocation)->Apply(BatchArgs);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(CorotatedModelFixture, CalcBatch)(benchmark::State& state) {
+  for (auto _ : state) {
+    ModelType::CalcBatch(entries_);
+  }
+}
+BENCHMARK_REGISTER_F(CorotatedModelFixture, CalcBatch)->Apply(BatchArgs);
+
+BENCHMARK_DEFINE_F(CorotatedModelFixture, PortableKernel)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CalcCorotatedBatchPortable(arrays_));
+  }
+}
+BENCHMARK_REGISTER_F(CorotatedModelFixture, PortableKernel)->Apply(BatchArgs);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(CorotatedModelFixture, AvxKernel)(benchmark::State& state) {
+  if (!CorotatedBatchAvxSupported()) {
+    state.SkipWithError("AVX2 is not supported on this build or processor.");
+    return;
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CalcCorotatedBatchAvx(arrays_));
+  }
+}
+BENCHMARK_REGISTER_F(CorotatedModelFixture, AvxKernel)->Apply(BatchArgs);
+
+}  // namespace
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -0,0 +1,221 @@
+// @file
+// Benchmarks comparing the PETSc and the native (in-tree) linear solvers used
+// by the FEM solver of deformable bodies.
+
+#include <iterator>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/geometry/proximity/make_box_mesh.h"
+#include "drake/multibody/fem/acceleration_newmark_scheme.h"
+#include "drake/multibody/fem/block_sparse_cholesky_solver.h"
+#include "drake/multibody/fem/block_sparse_conjugate_gradient.h"
+#include "drake/multibody/fem/corotated_model.h"
+#include "drake/multibody/fem/fem_solver.h"
+#include "drake/multibody/fem/fem_state.h"
+#include "drake/multibody/fem/linear_simplex_element.h"
+#include "drake/multibody/fem/petsc_symmetric_block_sparse_matrix.h"
+#include "drake/multibody/fem/simplex_gaussian_quadrature.h"
+#include "drake/multibody/fem/volumetric_model.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+namespace {
+
+constexpr int kNaturalDimension = 3;
+constexpr int kSpatialDimension = 3;
+constexpr int kQuadratureOrder = 1;
+using QuadratureType =
+    SimplexGaussianQuadrature<kNaturalDimension, kQuadratureOrder>;
+constexpr int kNumQuads = QuadratureType::num_quadrature_points;
+using IsoparametricElementType =
+    LinearSimplexElement<double, kNaturalDimension, kSpatialDimension,
+                         kNumQuads>;
+using ConstitutiveModelType = CorotatedModel<double, kNumQuads>;
+using ElementType = VolumetricElement<IsoparametricElementType, QuadratureType,
+                                      ConstitutiveModelType>;
+using ModelType = VolumetricModel<ElementType>;
+using LinearSolverType = FemSolver<double>::LinearSolverType;
+
+/* Mesh resolutions (in meters) for a unit cube, indexed by the first benchmark
+ argument. They produce roughly 750, 6k, 48k, and 197k tetrahedra
+ respectively. */
+constexpr double kResolutions[] = {0.2, 0.1, 0.05, 1.0 / 32};
+
+/* The linear solvers under comparison, indexed by the second benchmark
+ argument. */
+constexpr LinearSolverType kLinearSolverTypes[] = {
+    LinearSolverType::kPetscConjugateGradient,
+    LinearSolverType::kBlockSparseConjugateGradient,
+    LinearSolverType::kBlockSparseConjugateGradientBlockJacobi,
+    LinearSolverType::kBlockSparseCholesky,
+};
+constexpr int kNumLinearSolverTypes = std::size(kLinearSolverTypes);
+
+constexpr double kDt = 0.01;
+
+/* Fixture that builds a corotated FEM model of a unit cube that is clamped at
+ the bottom face. The benchmark arguments are {resolution index, linear solver
+ index}. */
+class FemSolverFixture : public benchmark::Fixture {
+ public:
+  FemSolverFixture() { tools::performance::AddMinMaxStatistics(this); }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    const geometry::VolumeMesh<double> mesh =
+        geometry::internal::MakeBoxVolumeMesh<double>(
+            geometry::Box(1.0, 1.0, 1.0), kResolutions[state.range(0)]);
+    model_ = std::make_unique<ModelType>();
+    ModelType::VolumetricBuilder builder(model_.get());
+    const ConstitutiveModelType constitutive_model(1e5, 0.4);
+    const DampingModel<double> damping_model(0.01, 0.01);
+    builder.AddLinearTetrahedralElements(mesh, constitutive_model, 1000.0,
+                                         damping_model);
+    builder.Build();
+    /* Clamp the vertices on the bottom face so that the cube sags under
+     gravity. */
+    DirichletBoundaryCondition<double> bc;
+    for (int v = 0; v < mesh.num_vertices(); ++v) {
+      const Vector3<double>& p = mesh.vertex(v);
+      if (p.z() < -0.5 + 1e-6) {
+        for (int d = 0; d < 3; ++d) {
+          bc.AddBoundaryCondition(3 * v + d, Vector3<double>(p(d), 0.0, 0.0));
+        }
+      }
+    }
+    model_->SetDirichletBoundaryCondition(std::move(bc));
+    prev_state_ = model_->MakeFemState();
+    next_state_ = model_->MakeFemState();
+    solver_ = std::make_unique<FemSolver<double>>(model_.get(), &integrator_);
+    solver_->set_linear_solver_type(kLinearSolverTypes[state.range(1)]);
+    scratch_ = std::make_unique<FemSolverScratchData<double>>(*model_);
+    state.counters["dofs"] = model_->num_dofs();
+    state.counters["elements"] = model_->num_elements();
+  }
+
+ protected:
+  AccelerationNewmarkScheme<double> integrator_{kDt, 0.5, 0.25};
+  std::unique_ptr<ModelType> model_;
+  std::unique_ptr<FemSolver<double>> solver_;
+  std::unique_ptr<FemSolverScratchData<double>> scratch_;
+  std::unique_ptr<FemState<double>> prev_state_;
+  std::unique_ptr<FemState<double>> next_state_;
+};
+
+/* Registers the {resolution, linear solver} combinations. */
+void SolverArgs(benchmark::internal::Benchmark* b) {
+  for (int resolution : {0, 1, 2, 3}) {
+    for (int solver = 0; solver < kNumLinearSolverTypes; ++solver) {
+      b->Args({resolution, solver});
+    }
+  }
+  b->ArgNames({"resolution", "solver"})->Unit(benchmark::kMillisecond);
+}
+
+/* A full time step, including all Newton iterations. The scratch data persists
+ across time steps, so the native solvers reuse their symbolic analysis. */
+BENCHMARK_DEFINE_F(FemSolverFixture, AdvanceOneTimeStep)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  int newton_iterations = 0;
+  for (auto _ : state) {
+    newton_iterations =
+        solver_->AdvanceOneTimeStep(*prev_state_, next_state_.get(),
+                                    scratch_.get());
+  }
+  state.counters["newton_iterations"] = newton_iterations;
+}
+BENCHMARK_REGISTER_F(FemSolverFixture, AdvanceOneTimeStep)->Apply(SolverArgs);
+
+/* A single linear solve with the tangent matrix at the rest configuration,
+ including the tangent matrix assembly and (for the native solvers) the
+ refactorization, but excluding the symbolic analysis. The `operator_bytes`
+ counter reports the memory used to store the tangent matrix and its
+ preconditioner (not reported for PETSc). The per-element data that all
+ solvers share (e.g. the stress derivatives at the quadrature points) isn't
+ included. */
+BENCHMARK_DEFINE_F(FemSolverFixture, LinearSolve)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  const Vector3<double> weights = integrator_.GetWeights();
+  VectorX<double> b(model_->num_dofs());
+  model_->CalcResidual(*prev_state_, &b);
+  b = -b;
+  VectorX<double> x(model_->num_dofs());
+  const LinearSolverType type = kLinearSolverTypes[state.range(1)];
+  if (type == LinearSolverType::kPetscConjugateGradient) {
+    PetscSymmetricBlockSparseMatrix& A = scratch_->mutable_tangent_matrix();
+    A.set_relative_tolerance(1e-5);
+    for (auto _ : state) {
+      model_->CalcTangentMatrix(*prev_state_, weights, &A);
+      A.AssembleIfNecessary();
+      const PetscSolverStatus status =
+          A.Solve(PetscSymmetricBlockSparseMatrix::SolverType::
+                      kConjugateGradient,
+                  PetscSymmetricBlockSparseMatrix::PreconditionerType::
+                      kIncompleteCholesky,
+                  b, &x);
+      if (status == PetscSolverStatus::kFailure) {
+        state.SkipWithError("Linear solve failed.");
+        break;
+      }
+    }
+    return;
+  }
+  constexpr double kBlockBytes = sizeof(Matrix3<double>);
+  Block3x3SparseSymmetricMatrix& A = scratch_->mutable_block_tangent_matrix();
+  if (type == LinearSolverType::kBlockSparseCholesky) {
+    BlockSparseCholeskySolver& cholesky = scratch_->mutable_cholesky_solver();
+    cholesky.AnalyzePattern(A);
+    state.counters["factor_blocks"] = cholesky.num_factor_blocks();
+    state.counters["operator_bytes"] =
+        (A.num_blocks() + cholesky.num_factor_blocks()) * kBlockBytes;
+    for (auto _ : state) {
+      model_->CalcTangentMatrix(*prev_state_, weights, &A);
+      if (!cholesky.Factor(A)) {
+        state.SkipWithError("Linear solve failed.");
+        break;
+      }
+      x = b;
+      cholesky.SolveInPlace(&x);
+    }
+    return;
+  }
+  BlockSparseConjugateGradient cg(
+      type == LinearSolverType::kBlockSparseConjugateGradient
+          ? BlockSparseConjugateGradient::PreconditionerType::
+                kBlockIncompleteCholesky
+          : BlockSparseConjugateGradient::PreconditionerType::kBlockJacobi);
+  cg.set_relative_tolerance(1e-5);
+  for (auto _ : state) {
+    model_->CalcTangentMatrix(*prev_state_, weights, &A);
+    x.setZero();
+    if (!cg.Compute(A) || !cg.Solve(A, b, &x)) {
+      state.SkipWithError("Linear solve failed.");
+      break;
+    }
+  }
+  state.counters["cg_iterations"] = cg.num_iterations();
+  /* The matrix plus either the block IC(0) factor (with the same sparsity) or
+   the inverse diagonal blocks. */
+  state.counters["operator_bytes"] =
+      (A.num_blocks() +
+       (type == LinearSolverType::kBlockSparseConjugateGradient
+            ? A.num_blocks()
+            : model_->num_nodes())) *
+      kBlockBytes;
+}
+BENCHMARK_REGISTER_F(FemSolverFixture, LinearSolve)->Apply(SolverArgs);
+
+}  // namespace
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
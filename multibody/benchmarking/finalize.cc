@@ -0,0 +1,149 @@
+// @file
+// Benchmarks for the cost of building and finalizing a MultibodyPlant for very
+// large scenes, as a function of the number of bodies. In the "free bodies"
+// scene (e.g., a warehouse full of objects) every body is a free body with
+// one collision and one visual geometry, resting on anchored shelves; in the
+// "chains" scene the bodies form chains of revolute joints, so that the
+// default collision filters between adjacent bodies are exercised as well.
+
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include "drake/geometry/scene_graph.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::Vector3d;
+using geometry::Box;
+using geometry::SceneGraph;
+using math::RigidTransformd;
+
+/* The number of links in each chain of the "chains" scene. */
+constexpr int kChainLength = 10;
+
+/* Fixture whose scene has as many bodies as the first benchmark argument. */
+class FinalizeFixture : public benchmark::Fixture {
+ public:
+  FinalizeFixture() { tools::performance::AddMinMaxStatistics(this); }
+
+ protected:
+  /* Creates an empty plant registered with a new scene graph. */
+  void MakePlant() {
+    scene_graph_ = std::make_unique<SceneGraph<double>>();
+    plant_ = std::make_unique<MultibodyPlant<double>>(0.001);
+    plant_->RegisterAsSourceForSceneGraph(scene_graph_.get());
+  }
+
+  /* Adds one collision and one visual box to the given body. */
+  void AddGeometry(const RigidBody<double>& body) {
+    const Box box(0.1, 0.1, 0.1);
+    plant_->RegisterCollisionGeometry(body, RigidTransformd(), box, "collision",
+                                      CoulombFriction<double>(1.0, 1.0));
+    plant_->RegisterVisualGeometry(body, RigidTransformd(), box, "visual",
+                                   Vector4<double>(0.5, 0.5, 0.5, 1.0));
+  }
+
+  /* Populates the plant with `num_bodies` free bodies, each in its own model
+   instance, and one anchored shelf for every hundred bodies. */
+  void AddFreeBodies(int num_bodies) {
+    const SpatialInertia<double> M = SpatialInertia<double>::MakeUnitary();
+    for (int i = 0; i < num_bodies; ++i) {
+      const ModelInstanceIndex instance =
+          plant_->AddModelInstance(fmt::format("object_{}", i));
+      AddGeometry(plant_->AddRigidBody("body", instance, M));
+    }
+    for (int i = 0; i < (num_bodies + 99) / 100; ++i) {
+      plant_->RegisterCollisionGeometry(
+          plant_->world_body(), RigidTransformd(Vector3d(i, 0, 0)),
+          Box(0.9, 2.0, 0.05), fmt::format("shelf_{}", i),
+          CoulombFriction<double>(1.0, 1.0));
+    }
+  }
+
+  /* Populates the plant with `num_bodies` bodies in chains of kChainLength
+   links connected by revolute joints, each chain in its own model instance. */
+  void AddChains(int num_bodies) {
+    const SpatialInertia<double> M = SpatialInertia<double>::MakeUnitary();
+    for (int c = 0; c * kChainLength < num_bodies; ++c) {
+      const ModelInstanceIndex instance =
+          plant_->AddModelInstance(fmt::format("chain_{}", c));
+      const Body<double>* parent = &plant_->world_body();
+      for (int l = 0; l < kChainLength; ++l) {
+        const RigidBody<double>& link =
+            plant_->AddRigidBody(fmt::format("link_{}", l), instance, M);
+        plant_->AddJoint<RevoluteJoint>(
+            fmt::format("joint_{}", l), *parent,
+            RigidTransformd(Vector3d(c, 0, l == 0 ? 1.0 : -0.2)), link,
+            std::nullopt, Vector3d::UnitY());
+        AddGeometry(link);
+        parent = &link;
+      }
+    }
+  }
+
+  std::unique_ptr<SceneGraph<double>> scene_graph_;
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+};
+
+void Args(benchmark::internal::Benchmark* b) {
+  b->Arg(100)->Arg(1000)->Arg(5000)->Arg(10000)->ArgName("bodies")->Unit(
+      benchmark::kMillisecond);
+}
+
+// Only Finalize() is timed.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(FinalizeFixture, FreeBodies)(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    MakePlant();
+    AddFreeBodies(state.range(0));
+    state.ResumeTiming();
+    plant_->Finalize();
+  }
+}
+BENCHMARK_REGISTER_F(FinalizeFixture, FreeBodies)->Apply(Args);
+
+// Adding the bodies and registering their geometry is timed, too.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(FinalizeFixture, FreeBodiesWithRegistration)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    // Don't time tearing down the previous scene.
+    state.PauseTiming();
+    plant_.reset();
+    scene_graph_.reset();
+    state.ResumeTiming();
+    MakePlant();
+    AddFreeBodies(state.range(0));
+    plant_->Finalize();
+  }
+}
+BENCHMARK_REGISTER_F(FinalizeFixture, FreeBodiesWithRegistration)
+    ->Apply(Args);
+
+// Only Finalize() is timed.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(FinalizeFixture, Chains)(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    MakePlant();
+    AddChains(state.range(0));
+    state.ResumeTiming();
+    plant_->Finalize();
+  }
+}
+BENCHMARK_REGISTER_F(FinalizeFixture, Chains)->Apply(Args);
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -0,0 +1,213 @@
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/find_resource.h"
+#include "drake/examples/acrobot/acrobot_plant.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/solvers/ipopt_solver.h"
+#include "drake/solvers/snopt_solver.h"
+#include "drake/systems/trajectory_optimization/direct_collocation.h"
+#include "drake/systems/trajectory_optimization/iterative_linear_quadratic_regulator.h"
+#include "drake/tools/performance/fixture_common.h"
+
+/* Latency of IterativeLinearQuadraticRegulator on the acrobot swing-up, cold
+and warm-started as a receding-horizon controller would be, against
+DirectCollocation solved by IPOPT and SNOPT on the same horizon and cost; and
+the latency of one iLQR iteration for the Cassie model, which is dominated by
+linearizing its 45-state dynamics at every knot. None of the cases request the
+feedback gains, which would cost the Cassie cases a second linearization. The
+first benchmark argument of the iLQR cases is the number of threads. */
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using examples::acrobot::AcrobotPlant;
+using symbolic::Expression;
+using systems::Context;
+using systems::trajectory_optimization::DirectCollocation;
+using systems::trajectory_optimization::IterativeLinearQuadraticRegulator;
+using systems::trajectory_optimization::
+    IterativeLinearQuadraticRegulatorOptions;
+using systems::trajectory_optimization::TimeStep;
+
+// We use this alias to silence cpplint barking at mutable references.
+using BenchmarkStateRef = benchmark::State&;
+
+class AcrobotSwingUp : public benchmark::Fixture {
+ public:
+  AcrobotSwingUp() {
+    tools::performance::AddMinMaxStatistics(this);
+  }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(BenchmarkStateRef) override {
+    context_ = plant_.CreateDefaultContext();
+    ilqr_ = std::make_unique<IterativeLinearQuadraticRegulator>(
+        &plant_, *context_, kNumTimeSamples, TimeStep(kTimeStep));
+    ilqr_->SetQuadraticCost(Q_, R_, Qf_, xd_, Vector1d::Zero());
+  }
+
+ protected:
+  static constexpr int kNumTimeSamples = 81;
+  static constexpr double kTimeStep = 0.05;
+
+  IterativeLinearQuadraticRegulatorOptions MakeOptions(
+      const benchmark::State& state) const {
+    IterativeLinearQuadraticRegulatorOptions options;
+    options.num_threads = state.range(0);
+    return options;
+  }
+
+  void SolveDirectCollocation(BenchmarkStateRef state,
+                              const solvers::SolverInterface& solver) {
+    if (!solver.available()) {
+      state.SkipWithError("The solver isn't available.");
+      return;
+    }
+    for (auto _ : state) {
+      DirectCollocation dircol(&plant_, *context_, kNumTimeSamples, kTimeStep,
+                               kTimeStep);
+      const VectorX<Expression> x_error =
+          dircol.state().cast<Expression>() - xd_.cast<Expression>();
+      const VectorX<Expression> u = dircol.input().cast<Expression>();
+      const VectorX<Expression> final_error =
+          dircol.final_state().cast<Expression>() - xd_.cast<Expression>();
+      dircol.AddRunningCost(x_error.dot(Q_ * x_error) + u.dot(R_ * u));
+      dircol.AddFinalCost(final_error.dot(Qf_ * final_error));
+      dircol.prog().AddLinearEqualityConstraint(dircol.initial_state() ==
+                                                Eigen::Vector4d::Zero());
+      solvers::MathematicalProgramResult result;
+      solver.Solve(dircol.prog(), {}, {}, &result);
+      if (!result.is_success()) state.SkipWithError("No solution found.");
+    }
+  }
+
+  const AcrobotPlant<double> plant_;
+  std::unique_ptr<Context<double>> context_;
+  std::unique_ptr<IterativeLinearQuadraticRegulator> ilqr_;
+  const Eigen::Matrix4d Q_{Eigen::Vector4d(10, 10, 1, 1).asDiagonal()};
+  const Vector1d R_{Vector1d(0.1)};
+  const Eigen::Matrix4d Qf_{100 * Eigen::Matrix4d::Identity()};
+  const Eigen::Vector4d xd_{M_PI, 0, 0, 0};
+  const Eigen::Vector4d x0_{Eigen::Vector4d::Zero()};
+  const std::vector<Eigen::VectorXd> u_zero_{
+      std::vector<Eigen::VectorXd>(kNumTimeSamples - 1, Vector1d::Zero())};
+};
+
+BENCHMARK_DEFINE_F(AcrobotSwingUp, Ilqr)(BenchmarkStateRef state) {
+  const IterativeLinearQuadraticRegulatorOptions options = MakeOptions(state);
+  for (auto _ : state) {
+    ilqr_->Solve(x0_, u_zero_, options);
+  }
+}
+
+// Re-plans from a slightly disturbed initial state, starting from the
+// previous solution, as a receding-horizon controller does at each update.
+BENCHMARK_DEFINE_F(AcrobotSwingUp, IlqrWarmStart)(BenchmarkStateRef state) {
+  const IterativeLinearQuadraticRegulatorOptions options = MakeOptions(state);
+  const std::vector<Eigen::VectorXd> u_previous =
+      ilqr_->Solve(x0_, u_zero_, options).u;
+  const Eigen::Vector4d x0_disturbed(0.05, -0.05, 0.1, 0.0);
+  for (auto _ : state) {
+    ilqr_->Solve(x0_disturbed, u_previous, options);
+  }
+}
+
+BENCHMARK_DEFINE_F(AcrobotSwingUp, DirectCollocationIpopt)(
+    BenchmarkStateRef state) {
+  SolveDirectCollocation(state, solvers::IpoptSolver());
+}
+
+BENCHMARK_DEFINE_F(AcrobotSwingUp, DirectCollocationSnopt)(
+    BenchmarkStateRef state) {
+  SolveDirectCollocation(state, solvers::SnoptSolver());
+}
+
+BENCHMARK_REGISTER_F(AcrobotSwingUp, Ilqr)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgName("threads")->Arg(1)->Arg(2)->Arg(4);
+BENCHMARK_REGISTER_F(AcrobotSwingUp, IlqrWarmStart)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgName("threads")->Arg(1)->Arg(2)->Arg(4);
+BENCHMARK_REGISTER_F(AcrobotSwingUp, DirectCollocationIpopt)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(AcrobotSwingUp, DirectCollocationSnopt)
+    ->Unit(benchmark::kMillisecond);
+
+// Cassie regulated toward its default state over a short horizon. Its floating
+// base can't be held up by its actuators, but that doesn't affect the cost of
+// an iteration.
+class CassieIlqr : public benchmark::Fixture {
+ public:
+  CassieIlqr() {
+    tools::performance::AddMinMaxStatistics(this);
+    Parser parser(&plant_);
+    parser.AddModelFromFile(
+        FindResourceOrThrow("drake/multibody/benchmarking/cassie_v2.urdf"));
+    plant_.Finalize();
+  }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(BenchmarkStateRef) override {
+    context_ = plant_.CreateDefaultContext();
+    ilqr_ = std::make_unique<IterativeLinearQuadraticRegulator>(
+        &plant_, *context_, kNumTimeSamples, TimeStep(kTimeStep),
+        plant_.get_actuation_input_port().get_index());
+    const int nx = ilqr_->num_states();
+    const int nu = ilqr_->num_inputs();
+    x0_ = plant_.GetPositionsAndVelocities(*context_);
+    ilqr_->SetQuadraticCost(Eigen::MatrixXd::Identity(nx, nx),
+                            0.01 * Eigen::MatrixXd::Identity(nu, nu),
+                            10 * Eigen::MatrixXd::Identity(nx, nx), x0_,
+                            Eigen::VectorXd::Zero(nu));
+    u_zero_.assign(kNumTimeSamples - 1, Eigen::VectorXd::Zero(nu));
+  }
+
+ protected:
+  static constexpr int kNumTimeSamples = 21;
+  static constexpr double kTimeStep = 0.01;
+
+  MultibodyPlant<double> plant_{0.0};
+  std::unique_ptr<Context<double>> context_;
+  std::unique_ptr<IterativeLinearQuadraticRegulator> ilqr_;
+  Eigen::VectorXd x0_;
+  std::vector<Eigen::VectorXd> u_zero_;
+};
+
+BENCHMARK_DEFINE_F(CassieIlqr, OneIteration)(BenchmarkStateRef state) {
+  IterativeLinearQuadraticRegulatorOptions options;
+  options.max_iterations = 1;
+  options.num_threads = state.range(0);
+  for (auto _ : state) {
+    ilqr_->Solve(x0_, u_zero_, options);
+  }
+}
+
+BENCHMARK_DEFINE_F(CassieIlqr, OneIterationFiniteDifferences)(
+    BenchmarkStateRef state) {
+  IterativeLinearQuadraticRegulatorOptions options;
+  options.max_iterations = 1;
+  options.use_autodiff = false;
+  options.num_threads = state.range(0);
+  for (auto _ : state) {
+    ilqr_->Solve(x0_, u_zero_, options);
+  }
+}
+
+BENCHMARK_REGISTER_F(CassieIlqr, OneIteration)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgName("threads")->Arg(1)->Arg(2)->Arg(4);
+BENCHMARK_REGISTER_F(CassieIlqr, OneIterationFiniteDifferences)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgName("threads")->Arg(1)->Arg(2)->Arg(4);
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -0,0 +1,159 @@
+// @file
+// Benchmarks for the start-up cost of building a plant from model directives
+// that add many robots, as in fleet scenes. Each robot is a copy of the Cassie
+// URDF; the copies are either the very same file (so its parse is reused from
+// the document cache) or distinct files (so each is parsed, in parallel when
+// built with OpenMP).
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
+#include "drake/multibody/parsing/detail_xml_document_cache.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/parsing/process_model_directives.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using internal::XmlDocumentCache;
+using parsing::LoadModelDirectivesFromString;
+using parsing::ModelDirectives;
+using parsing::ProcessModelDirectives;
+
+// Fixture whose scene has as many robots as the first benchmark argument.
+class ModelParsingFixture : public benchmark::Fixture {
+ public:
+  ModelParsingFixture() { tools::performance::AddMinMaxStatistics(this); }
+
+ protected:
+  // Returns the names of `num_copies` files that all hold the Cassie model
+  // but whose contents differ (by a trailing comment), so that each one must
+  // be parsed.
+  static std::vector<std::string> DistinctFiles(int num_copies) {
+    static const std::string dir = temp_directory();
+    static const std::string model = ReadModel();
+    std::vector<std::string> result;
+    for (int i = 0; i < num_copies; ++i) {
+      const std::string filename = fmt::format("{}/cassie_{}.urdf", dir, i);
+      std::ofstream(filename) << model << fmt::format("<!-- {} -->\n", i);
+      result.push_back(filename);
+    }
+    return result;
+  }
+
+  // Returns the name of the Cassie model file, `num_copies` times.
+  static std::vector<std::string> RepeatedFile(int num_copies) {
+    return std::vector<std::string>(
+        num_copies,
+        FindResourceOrThrow("drake/multibody/benchmarking/cassie_v2.urdf"));
+  }
+
+  // Returns directives that add each of the given files as its own model.
+  static ModelDirectives MakeDirectives(
+      const std::vector<std::string>& filenames) {
+    std::string yaml = "directives:\n";
+    for (int i = 0; i < static_cast<int>(filenames.size()); ++i) {
+      yaml += fmt::format(
+          "- add_model:\n"
+          "    name: cassie_{}\n"
+          "    file: file://{}\n",
+          i, filenames[i]);
+    }
+    return LoadModelDirectivesFromString(yaml);
+  }
+
+  // Builds a plant from the directives, optionally starting from an empty
+  // document cache (as a new process would).
+  static void Process(const ModelDirectives& directives, bool clear_cache,
+                      benchmark::State* state) {
+    if (clear_cache) {
+      state->PauseTiming();
+      XmlDocumentCache::GetInstance().Clear();
+      state->ResumeTiming();
+    }
+    MultibodyPlant<double> plant(0.0);
+    Parser parser(&plant);
+    ProcessModelDirectives(directives, &parser);
+  }
+
+ private:
+  static std::string ReadModel() {
+    std::ifstream file(
+        FindResourceOrThrow("drake/multibody/benchmarking/cassie_v2.urdf"));
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+  }
+};
+
+void Args(benchmark::internal::Benchmark* b) {
+  b->Arg(1)->Arg(20)->ArgName("robots")->Unit(benchmark::kMillisecond);
+}
+
+// The baseline: each model is parsed, one after the other, as it is added.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(ModelParsingFixture, Sequential)(benchmark::State& state) {
+  const std::vector<std::string> filenames = DistinctFiles(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    XmlDocumentCache::GetInstance().Clear();
+    state.ResumeTiming();
+    MultibodyPlant<double> plant(0.0);
+    Parser parser(&plant);
+    for (int i = 0; i < static_cast<int>(filenames.size()); ++i) {
+      parser.AddModelFromFile(filenames[i], fmt::format("cassie_{}", i));
+    }
+  }
+}
+BENCHMARK_REGISTER_F(ModelParsingFixture, Sequential)->Apply(Args);
+
+// Distinct models are parsed in parallel before being added.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(ModelParsingFixture, DistinctModels)
+(benchmark::State& state) {
+  const ModelDirectives directives =
+      MakeDirectives(DistinctFiles(state.range(0)));
+  for (auto _ : state) {
+    Process(directives, true /* clear_cache */, &state);
+  }
+}
+BENCHMARK_REGISTER_F(ModelParsingFixture, DistinctModels)->Apply(Args);
+
+// The same model is parsed once and added many times.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(ModelParsingFixture, RepeatedModel)
+(benchmark::State& state) {
+  const ModelDirectives directives =
+      MakeDirectives(RepeatedFile(state.range(0)));
+  for (auto _ : state) {
+    Process(directives, true /* clear_cache */, &state);
+  }
+}
+BENCHMARK_REGISTER_F(ModelParsingFixture, RepeatedModel)->Apply(Args);
+
+// A later scene in the same process finds the model already parsed.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(ModelParsingFixture, RepeatedModelWarm)
+(benchmark::State& state) {
+  const ModelDirectives directives =
+      MakeDirectives(RepeatedFile(state.range(0)));
+  for (auto _ : state) {
+    Process(directives, false /* clear_cache */, &state);
+  }
+}
+BENCHMARK_REGISTER_F(ModelParsingFixture, RepeatedModelWarm)->Apply(Args);
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
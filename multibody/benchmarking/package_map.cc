@@ -0,0 +1,110 @@
+// @file
+// Benchmarks for the start-up cost of a PackageMap that is populated from a
+// large directory tree, as with a ROS workspace. The tree holds as many
+// packages as the first benchmark argument, each with a few subdirectories.
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include "drake/common/filesystem.h"
+#include "drake/common/temp_directory.h"
+#include "drake/multibody/parsing/package_map.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+// Fixture whose tree has as many packages as the first benchmark argument.
+class PackageMapFixture : public benchmark::Fixture {
+ public:
+  PackageMapFixture() { tools::performance::AddMinMaxStatistics(this); }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    ::unsetenv("DRAKE_PACKAGE_MAP_INDEX_DIR");
+    root_ = MakeTree(state.range(0));
+  }
+
+  using benchmark::Fixture::TearDown;
+  void TearDown(benchmark::State&) override {
+    ::unsetenv("DRAKE_PACKAGE_MAP_INDEX_DIR");
+  }
+
+ protected:
+  // Returns the root of a tree of `num_packages` packages, ten to a group.
+  static std::string MakeTree(int num_packages) {
+    const std::string root = temp_directory();
+    for (int i = 0; i < num_packages; ++i) {
+      const std::string package =
+          fmt::format("{}/group_{}/package_{}", root, i / 10, i);
+      for (const char* subdir : {"meshes", "models", "urdf"}) {
+        filesystem::create_directories(package + "/" + subdir);
+      }
+      std::ofstream(package + "/package.xml") << fmt::format(
+          "<package format=\"2\">\n"
+          "  <name>package_{}</name>\n"
+          "  <version>0.0.0</version>\n"
+          "</package>\n",
+          i);
+    }
+    return root;
+  }
+
+  std::string root_;
+};
+
+void Args(benchmark::internal::Benchmark* b) {
+  b->Arg(10)->Arg(1000)->ArgName("packages")->Unit(benchmark::kMillisecond);
+}
+
+// The baseline: the whole tree is crawled, as any use of a populated map did
+// before crawling was deferred.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(PackageMapFixture, Crawl)(benchmark::State& state) {
+  for (auto _ : state) {
+    PackageMap package_map;
+    package_map.PopulateFromFolder(root_);
+    benchmark::DoNotOptimize(package_map.size());
+  }
+}
+BENCHMARK_REGISTER_F(PackageMapFixture, Crawl)->Apply(Args);
+
+// Only packages that are already known are used, so the tree isn't crawled.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(PackageMapFixture, Deferred)(benchmark::State& state) {
+  for (auto _ : state) {
+    PackageMap package_map;
+    package_map.PopulateFromFolder(root_);
+    benchmark::DoNotOptimize(package_map.GetPath("drake"));
+  }
+}
+BENCHMARK_REGISTER_F(PackageMapFixture, Deferred)->Apply(Args);
+
+// The whole tree is needed, but an earlier process left an index of it.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(PackageMapFixture, Indexed)(benchmark::State& state) {
+  const std::string index_dir = temp_directory();
+  ::setenv("DRAKE_PACKAGE_MAP_INDEX_DIR", index_dir.c_str(), 1);
+  {
+    PackageMap package_map;
+    package_map.PopulateFromFolder(root_);
+    package_map.size();
+  }
+  for (auto _ : state) {
+    PackageMap package_map;
+    package_map.PopulateFromFolder(root_);
+    benchmark::DoNotOptimize(package_map.size());
+  }
+}
+BENCHMARK_REGISTER_F(PackageMapFixture, Indexed)->Apply(Args);
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
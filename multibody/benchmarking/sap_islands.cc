@@ -0,0 +1,158 @@
+// @file
+// Benchmarks for the SAP solver on scenes with many disjoint stacks of boxes,
+// solving a single global contact problem versus solving each island (stack)
+// independently, in parallel when built with OpenMP.
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/math/cross_product.h"
+#include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
+#include "drake/multibody/contact_solvers/sap/sap_friction_cone_constraint.h"
+#include "drake/multibody/contact_solvers/sap/sap_island_solver.h"
+#include "drake/multibody/contact_solvers/sap/sap_solver.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+constexpr double kTimeStep = 1.0e-3;
+constexpr double kGravity = 9.81;
+/* Boxes are cubes of side 2 * kHalfSize. */
+constexpr double kHalfSize = 0.05;
+constexpr double kMass = 0.5;
+/* Stacks have heights between 1 and kMaxHeight, so that some islands (a box
+ resting on the ground) are much easier to solve than others. */
+constexpr int kMaxHeight = 8;
+
+/* Returns the 3x6 Jacobian of the velocity of a point P fixed to a box, with
+ the box's velocities ordered as [ω, v] and p_BoP the position of P in the
+ box's frame, aligned with the world frame. */
+MatrixX<double> MakePointJacobian(const Vector3<double>& p_BoP) {
+  MatrixX<double> J(3, 6);
+  J << -math::VectorToSkewSymmetric(p_BoP), Matrix3<double>::Identity();
+  return J;
+}
+
+/* Fixture with a scene of disjoint stacks of boxes resting on the ground, with
+ the number of stacks given by the first benchmark argument. Each box touches
+ the box below (or the ground) at its four bottom corners. */
+class SapIslandsFixture : public benchmark::Fixture {
+ public:
+  SapIslandsFixture() { tools::performance::AddMinMaxStatistics(this); }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    const int num_stacks = state.range(0);
+    std::vector<MatrixX<double>> A;
+    std::vector<int> heights;
+    int num_boxes = 0;
+    for (int s = 0; s < num_stacks; ++s) {
+      heights.push_back(1 + (3 * s) % kMaxHeight);
+      num_boxes += heights.back();
+    }
+    const double inertia = kMass * (2 * kHalfSize) * (2 * kHalfSize) / 6.0;
+    MatrixX<double> M = MatrixX<double>::Zero(6, 6);
+    M.diagonal() << inertia, inertia, inertia, kMass, kMass, kMass;
+    A.assign(num_boxes, M);
+    /* Free motion velocities, from rest with a small horizontal push. */
+    VectorX<double> v_star = VectorX<double>::Zero(6 * num_boxes);
+    for (int b = 0; b < num_boxes; ++b) {
+      v_star.segment<3>(6 * b + 3) =
+          Vector3<double>(0.01 * (b % 3), 0.0, -kGravity * kTimeStep);
+    }
+    problem_ = std::make_unique<SapContactProblem<double>>(
+        kTimeStep, std::move(A), std::move(v_star));
+
+    SapFrictionConeConstraint<double>::Parameters parameters;
+    parameters.mu = 0.5;
+    parameters.stiffness = 1.0e5;
+    parameters.dissipation_time_scale = 0.01;
+    /* Penetration consistent with the weight supported by each contact. */
+    int box = 0;
+    for (int s = 0; s < num_stacks; ++s) {
+      for (int level = 0; level < heights[s]; ++level, ++box) {
+        const double weight = (heights[s] - level) * kMass * kGravity;
+        const double phi0 = -weight / 4.0 / parameters.stiffness;
+        for (const double x : {-kHalfSize, kHalfSize}) {
+          for (const double y : {-kHalfSize, kHalfSize}) {
+            const MatrixX<double> J_bottom =
+                MakePointJacobian(Vector3<double>(x, y, -kHalfSize));
+            if (level == 0) {
+              problem_->AddConstraint(
+                  std::make_unique<SapFrictionConeConstraint<double>>(
+                      box, J_bottom, phi0, parameters));
+            } else {
+              const MatrixX<double> J_top =
+                  MakePointJacobian(Vector3<double>(x, y, kHalfSize));
+              problem_->AddConstraint(
+                  std::make_unique<SapFrictionConeConstraint<double>>(
+                      box, box - 1, J_bottom, -J_top, phi0, parameters));
+            }
+          }
+        }
+      }
+    }
+    v_guess_ = VectorX<double>::Zero(problem_->num_velocities());
+    state.counters["boxes"] = num_boxes;
+    state.counters["contacts"] = problem_->num_constraints();
+  }
+
+ protected:
+  std::unique_ptr<SapContactProblem<double>> problem_;
+  VectorX<double> v_guess_;
+};
+
+void StacksArgs(benchmark::internal::Benchmark* b) {
+  b->Arg(4)->Arg(32)->Arg(256)->ArgName("stacks")->Unit(
+      benchmark::kMicrosecond);
+}
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(SapIslandsFixture, Global)(benchmark::State& state) {
+  SapSolver<double> sap;
+  SapSolverResults<double> results;
+  for (auto _ : state) {
+    if (sap.SolveWithGuess(*problem_, v_guess_, &results) !=
+        SapSolverStatus::kSuccess) {
+      state.SkipWithError("SapSolver failed to converge.");
+      return;
+    }
+  }
+  state.counters["iterations"] = sap.get_statistics().num_iters;
+}
+BENCHMARK_REGISTER_F(SapIslandsFixture, Global)->Apply(StacksArgs);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(SapIslandsFixture, Islands)(benchmark::State& state) {
+  SapIslandSolver<double> sap;
+  SapSolverResults<double> results;
+  for (auto _ : state) {
+    if (sap.SolveWithGuess(*problem_, v_guess_, &results) !=
+        SapSolverStatus::kSuccess) {
+      state.SkipWithError("SapIslandSolver failed to converge.");
+      return;
+    }
+  }
+  /* The total number of Newton iterations, over all islands. */
+  int num_iterations = 0;
+  for (int i = 0; i < sap.num_islands(); ++i) {
+    num_iterations += sap.get_island_statistics(i).num_iters;
+  }
+  state.counters["islands"] = sap.num_islands();
+  state.counters["iterations"] = num_iterations;
+}
+BENCHMARK_REGISTER_F(SapIslandsFixture, Islands)->Apply(StacksArgs);
+
+}  // namespace
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -0,0 +1,186 @@
+// @file
+// Benchmarks for TamsiSolver as a function of the number of contact points,
+// with dense versus block-sparse contact Jacobians.
+
+#include <cmath>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/multibody/plant/tamsi_solver.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using internal::TamsiBlockSparseJacobians;
+using Attorney = internal::TamsiSolverBlockSparseAttorney<double>;
+
+/* The system has kNumTrees free bodies with six degrees of freedom each, for
+ 102 generalized velocities. */
+constexpr int kNumTrees = 17;
+constexpr int kTreeSize = 6;
+constexpr int kNumVelocities = kNumTrees * kTreeSize;
+constexpr double kDt = 1.0e-3;
+
+/* Returns a rows x cols matrix with arbitrary entries in [-1, 1]. */
+MatrixX<double> MakeMatrix(int rows, int cols, int seed) {
+  MatrixX<double> A(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      A(i, j) = std::sin(1.0 + seed + 1.3 * i + 2.1 * j * (seed + 1));
+    }
+  }
+  return A;
+}
+
+/* Fixture with a synthetic problem for the number of contact points given by
+ the first benchmark argument. Half of the contact points are between a body
+ and the (fixed) ground and the other half between two bodies, so that each
+ row of the contact Jacobians has one or two non-zero 1 x 6 blocks. */
+class TamsiSolverFixture : public benchmark::Fixture {
+ public:
+  TamsiSolverFixture() { tools::performance::AddMinMaxStatistics(this); }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    nc_ = state.range(0);
+    M_ = MatrixX<double>::Zero(kNumVelocities, kNumVelocities);
+    M_blocks_.clear();
+    for (int t = 0; t < kNumTrees; ++t) {
+      const MatrixX<double> A = MakeMatrix(kTreeSize, kTreeSize, t);
+      M_blocks_.push_back(A.transpose() * A +
+                          MatrixX<double>::Identity(kTreeSize, kTreeSize));
+      M_.block(t * kTreeSize, t * kTreeSize, kTreeSize, kTreeSize) =
+          M_blocks_.back();
+    }
+
+    Jn_ = MatrixX<double>::Zero(nc_, kNumVelocities);
+    Jt_ = MatrixX<double>::Zero(2 * nc_, kNumVelocities);
+    std::vector<std::vector<TamsiBlockSparseJacobians<double>::Block>>
+        contact_blocks(nc_);
+    for (int ic = 0; ic < nc_; ++ic) {
+      std::vector<int> trees = {ic % kNumTrees};
+      if (ic % 2 == 1) trees.push_back((7 * ic + 3) % kNumTrees);
+      if (trees.size() == 2 && trees[0] == trees[1]) trees.pop_back();
+      for (int k = 0; k < static_cast<int>(trees.size()); ++k) {
+        const int t = trees[k];
+        /* The Jacobian of the second body has the opposite sign. */
+        const MatrixX<double> Jc =
+            (k == 0 ? 1.0 : -1.0) * MakeMatrix(3, kTreeSize, ic % 32);
+        Jn_.block(ic, t * kTreeSize, 1, kTreeSize) = Jc.row(0);
+        Jt_.block(2 * ic, t * kTreeSize, 2, kTreeSize) = Jc.bottomRows(2);
+        contact_blocks[ic].push_back({t, Jc});
+      }
+    }
+    jacobians_ = std::make_unique<TamsiBlockSparseJacobians<double>>(
+        std::vector<int>(kNumTrees, kTreeSize), std::move(contact_blocks));
+
+    v0_ = MakeMatrix(kNumVelocities, 1, 3);
+    p_star_ = M_ * v0_ + kDt * 10.0 * MakeMatrix(kNumVelocities, 1, 5);
+    mu_ = VectorX<double>::Constant(nc_, 0.5);
+    fn_ = VectorX<double>::LinSpaced(nc_, 1.0, 10.0);
+    stiffness_ = VectorX<double>::Constant(nc_, 1.0e4);
+    dissipation_ = VectorX<double>::Constant(nc_, 1.0);
+    fn0_ = stiffness_.cwiseProduct(VectorX<double>::LinSpaced(nc_, 0.0, 1e-4));
+    state.counters["contacts"] = nc_;
+  }
+
+  /* Sets the problem data on `solver`, one-way or two-way coupled and with
+   dense or block-sparse Jacobians. */
+  void SetProblemData(bool two_way_coupled, bool block_sparse,
+                      TamsiSolver<double>* solver) const {
+    if (two_way_coupled && block_sparse) {
+      Attorney::SetTwoWayCoupledProblemData(solver, &M_blocks_,
+                                            jacobians_.get(), &p_star_, &fn0_,
+                                            &stiffness_, &dissipation_, &mu_);
+    } else if (two_way_coupled) {
+      solver->SetTwoWayCoupledProblemData(&M_, &Jn_, &Jt_, &p_star_, &fn0_,
+                                          &stiffness_, &dissipation_, &mu_);
+    } else if (block_sparse) {
+      Attorney::SetOneWayCoupledProblemData(solver, &M_blocks_,
+                                            jacobians_.get(), &p_star_, &fn_,
+                                            &mu_);
+    } else {
+      solver->SetOneWayCoupledProblemData(&M_, &Jn_, &Jt_, &p_star_, &fn_,
+                                          &mu_);
+    }
+  }
+
+  /* Times setting the problem data and solving it, as done once per time
+   step. With block-sparse Jacobians, the symbolic analysis of the sparse
+   Newton-Raphson Jacobian is only performed in the first step since the
+   contact pattern is the same for all steps. */
+  // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+  void Solve(benchmark::State& state, bool two_way_coupled,
+             bool block_sparse) {
+    TamsiSolver<double> solver(kNumVelocities);
+    int num_iterations = 0;
+    for (auto _ : state) {
+      SetProblemData(two_way_coupled, block_sparse, &solver);
+      if (solver.SolveWithGuess(kDt, v0_) != TamsiSolverResult::kSuccess) {
+        state.SkipWithError("TamsiSolver failed to converge.");
+        return;
+      }
+      num_iterations = solver.get_iteration_statistics().num_iterations;
+    }
+    state.counters["iterations"] = num_iterations;
+  }
+
+ protected:
+  int nc_{};
+  MatrixX<double> M_;
+  MatrixX<double> Jn_;
+  MatrixX<double> Jt_;
+  std::vector<MatrixX<double>> M_blocks_;
+  std::unique_ptr<TamsiBlockSparseJacobians<double>> jacobians_;
+  VectorX<double> v0_;
+  VectorX<double> p_star_;
+  VectorX<double> mu_;
+  VectorX<double> fn_;
+  VectorX<double> fn0_;
+  VectorX<double> stiffness_;
+  VectorX<double> dissipation_;
+};
+
+void ContactArgs(benchmark::internal::Benchmark* b) {
+  b->Arg(64)->Arg(256)->Arg(1024)->ArgName("contacts")->Unit(
+      benchmark::kMicrosecond);
+}
+
+BENCHMARK_DEFINE_F(TamsiSolverFixture, OneWayDense)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  Solve(state, false, false);
+}
+BENCHMARK_REGISTER_F(TamsiSolverFixture, OneWayDense)->Apply(ContactArgs);
+
+BENCHMARK_DEFINE_F(TamsiSolverFixture, OneWayBlockSparse)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  Solve(state, false, true);
+}
+BENCHMARK_REGISTER_F(TamsiSolverFixture, OneWayBlockSparse)->Apply(ContactArgs);
+
+BENCHMARK_DEFINE_F(TamsiSolverFixture, TwoWayDense)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  Solve(state, true, false);
+}
+BENCHMARK_REGISTER_F(TamsiSolverFixture, TwoWayDense)->Apply(ContactArgs);
+
+BENCHMARK_DEFINE_F(TamsiSolverFixture, TwoWayBlockSparse)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  Solve(state, true, true);
+}
+BENCHMARK_REGISTER_F(TamsiSolverFixture, TwoWayBlockSparse)->Apply(ContactArgs);
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -1,5 +1,7 @@
 #include "drake/multibody/contact_solvers/sap/contact_problem_graph.h"
 
+#include <algorithm>
+#include <numeric>
 #include <utility>
 
 namespace drake {
@@ -70,6 +72,37 @@ int ContactProblemGraph::AddConstraint(int first_clique, int second_clique,
                        num_constraint_equations);
 }
 
+std::vector<std::vector<int>> ContactProblemGraph::CalcIslands() const {
+  // Union-find over cliques. The root of each set is its smallest clique.
+  std::vector<int> parent(num_cliques());
+  std::iota(parent.begin(), parent.end(), 0);
+  auto find_root = [&parent](int c) {
+    while (parent[c] != c) {
+      parent[c] = parent[parent[c]];  // Path halving.
+      c = parent[c];
+    }
+    return c;
+  };
+  for (const ConstraintCluster& cluster : clusters_) {
+    const int first_root = find_root(cluster.cliques().first());
+    const int second_root = find_root(cluster.cliques().second());
+    parent[std::max(first_root, second_root)] =
+        std::min(first_root, second_root);
+  }
+
+  std::vector<int> root_to_island(num_cliques(), -1);
+  std::vector<std::vector<int>> islands;
+  for (int k = 0; k < num_clusters(); ++k) {
+    int& island = root_to_island[find_root(clusters_[k].cliques().first())];
+    if (island < 0) {
+      island = islands.size();
+      islands.emplace_back();
+    }
+    islands[island].push_back(k);
+  }
+  return islands;
+}
+
 }  // namespace internal
 }  // namespace contact_solvers
 }  // namespace multibody
@@ -152,6 +152,15 @@ class ContactProblemGraph {
     return participating_cliques_;
   }
 
+  /* Partitions the clusters of this graph into "islands", the connected
+   components of the graph. Cliques in different islands are not coupled by any
+   constraint and therefore a SapContactProblem with this graph can be solved
+   one island at a time, see SapContactProblem::MakeIslandProblems(). Cliques
+   that do not participate (see participating_cliques()) belong to no island.
+   @returns For the i-th island, the indexes of its clusters in increasing
+   order. Islands are sorted by the index of their first cluster. */
+  std::vector<std::vector<int>> CalcIslands() const;
+
  private:
   /* Helper to add a constraint between a pair of cliques. */
   int AddConstraint(SortedPair<int> cliques, int num_constrained_dofs);
@@ -40,6 +40,23 @@ SapConstraint<T>::SapConstraint(int first_clique, int second_clique,
                      first_clique_jacobian().rows());
 }
 
+template <typename T>
+std::unique_ptr<SapConstraint<T>> SapConstraint<T>::CloneWithRemappedCliques(
+    const std::vector<int>& clique_map) const {
+  const int num_mapped_cliques = clique_map.size();
+  DRAKE_THROW_UNLESS(first_clique_ < num_mapped_cliques);
+  DRAKE_THROW_UNLESS(second_clique_ < num_mapped_cliques);
+  std::unique_ptr<SapConstraint<T>> clone = Clone();
+  clone->first_clique_ = clique_map[first_clique_];
+  DRAKE_THROW_UNLESS(clone->first_clique_ >= 0);
+  if (num_cliques() == 2) {
+    clone->second_clique_ = clique_map[second_clique_];
+    DRAKE_THROW_UNLESS(clone->second_clique_ >= 0);
+    DRAKE_THROW_UNLESS(clone->first_clique_ != clone->second_clique_);
+  }
+  return clone;
+}
+
 }  // namespace internal
 }  // namespace contact_solvers
 }  // namespace multibody
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
@@ -196,6 +197,16 @@ class SapConstraint {
    instance. */
   virtual std::unique_ptr<SapConstraint<T>> Clone() const = 0;
 
+  /* Returns a deep-copy of `this` constraint that references clique
+   clique_map[c] in place of each clique c referenced by `this` constraint. All
+   other data, including the Jacobian blocks, is preserved. This is used to move
+   constraints into a problem with a different numbering of the cliques, see
+   SapContactProblem::MakeIslandProblems().
+   @throws exception if clique_map[c] is negative or not defined for a clique c
+   of `this` constraint. */
+  std::unique_ptr<SapConstraint<T>> CloneWithRemappedCliques(
+      const std::vector<int>& clique_map) const;
+
  protected:
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SapConstraint);
 
@@ -1,7 +1,9 @@
 #include "drake/multibody/contact_solvers/sap/sap_constraint_bundle.h"
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/parallel_for.h"
 #include "drake/multibody/contact_solvers/sap/contact_problem_graph.h"
+#include "drake/multibody/contact_solvers/sap/sap_parallelism.h"
 
 namespace drake {
 namespace multibody {
@@ -19,6 +21,7 @@ SapConstraintBundle<T>::SapConstraintBundle(
   // the ContactProblemGraph, where constraints between the same
   // pair of cliques are "clustered" together.
   constraints_.reserve(problem->num_constraints());
+  constraint_start_.reserve(problem->num_constraints());
 
   // Vector of bias velocities and diagonal matrix R.
   vhat_.resize(problem->num_constraint_equations());
@@ -29,6 +32,7 @@ SapConstraintBundle<T>::SapConstraintBundle(
     for (int i : e.constraint_index()) {
       const SapConstraint<T>& c = problem->get_constraint(i);
       constraints_.push_back(&c);
+      constraint_start_.push_back(impulse_index_start);
 
       const int ni = c.num_constraint_equations();
       const T& wi = delassus_diagonal[i];
@@ -141,10 +145,13 @@ void SapConstraintBundle<T>::ProjectImpulses(
   if (dPdy != nullptr) {
     DRAKE_DEMAND(static_cast<int>(dPdy->size()) == num_constraints());
   }
-  int constraint_start = 0;
-  for (int i = 0; i < num_constraints(); ++i) {
+  // Projections are independent and each writes to its own segment of gamma
+  // and its own entry in dPdy.
+  const int nc = num_constraints();
+  drake::internal::ParallelFor(nc, [&](int i) {
     const SapConstraint<T>& c = *constraints_[i];
     const int ni = c.num_constraint_equations();
+    const int constraint_start = constraint_start_[i];
     const auto y_i = y.segment(constraint_start, ni);
     const auto R_i = R().segment(constraint_start, ni);
     auto gamma_i = gamma->segment(constraint_start, ni);
@@ -154,8 +161,7 @@ void SapConstraintBundle<T>::ProjectImpulses(
     } else {
       c.Project(y_i, R_i, &gamma_i);
     }
-    constraint_start += ni;
-  }
+  }, SapConstraintLoopOptions<T>(nc));
 }
 
 template <typename T>
@@ -165,19 +171,73 @@ void SapConstraintBundle<T>::ProjectImpulsesAndCalcConstraintsHessian(
   DRAKE_DEMAND(gamma != nullptr);
   DRAKE_DEMAND(gamma->size() == num_constraint_equations());
   DRAKE_DEMAND(static_cast<int>(G->size()) == num_constraints());
-  // G = dPdy after call to ProjectImpulses. We add in the R⁻¹ next.
-  ProjectImpulses(y, gamma, G);
+  // Each Gᵢ only depends on the i-th constraint. Therefore we compute the
+  // projection and the Hessian block of each constraint in a single pass.
+  const int nc = num_constraints();
+  drake::internal::ParallelFor(nc, [&](int i) {
+    const SapConstraint<T>& c = *constraints_[i];
+    const int ni = c.num_constraint_equations();
+    const int constraint_start = constraint_start_[i];
+    const auto y_i = y.segment(constraint_start, ni);
+    const auto R_i = R().segment(constraint_start, ni);
+    const auto Rinv_i = Rinv().segment(constraint_start, ni);
+    auto gamma_i = gamma->segment(constraint_start, ni);
+    // G = dPdy after the projection. We add in the R⁻¹ next.
+    MatrixX<T>& G_i = (*G)[i];
+    c.Project(y_i, R_i, &gamma_i, &G_i);
+    // The regularizer Hessian is G = d²ℓ/dvc² = dP/dy⋅R⁻¹.
+    G_i = G_i * Rinv_i.asDiagonal();
+  }, SapConstraintLoopOptions<T>(nc));
+}
 
-  // The regularizer Hessian is G = d²ℓ/dvc² = dP/dy⋅R⁻¹.
-  int constraint_start = 0;
-  for (int i = 0; i < num_constraints(); ++i) {
+template <typename T>
+T SapConstraintBundle<T>::CalcRegularizerCostAlongLine(
+    const VectorX<T>& vc, const VectorX<T>& dvc, const T& alpha,
+    LineSearchWorkspace* workspace, T* dell_dalpha, T* d2ell_dalpha2) const {
+  DRAKE_DEMAND(vc.size() == num_constraint_equations());
+  DRAKE_DEMAND(dvc.size() == num_constraint_equations());
+  DRAKE_DEMAND(workspace != nullptr);
+  const int nc = num_constraints();
+  const int nk = num_constraint_equations();
+  workspace->y.resize(nk);
+  workspace->gamma.resize(nk);
+  workspace->ell.resize(nc);
+  workspace->dell_dalpha.resize(nc);
+  workspace->d2ell_dalpha2.resize(nc);
+  const bool calc_second_derivative = d2ell_dalpha2 != nullptr;
+  if (calc_second_derivative) workspace->dPdy.resize(nc);
+
+  drake::internal::ParallelFor(nc, [&](int i) {
     const SapConstraint<T>& c = *constraints_[i];
     const int ni = c.num_constraint_equations();
+    const int constraint_start = constraint_start_[i];
+    const auto R_i = R().segment(constraint_start, ni);
     const auto Rinv_i = Rinv().segment(constraint_start, ni);
-    const MatrixX<T>& dPdy_i = (*G)[i];
-    (*G)[i] = dPdy_i * Rinv_i.asDiagonal();
-    constraint_start += ni;
-  }
+    const auto dvc_i = dvc.segment(constraint_start, ni);
+    auto y_i = workspace->y.segment(constraint_start, ni);
+    auto gamma_i = workspace->gamma.segment(constraint_start, ni);
+    // y(α) = −R⁻¹⋅(vc + α⋅Δvc − v̂).
+    y_i = Rinv_i.asDiagonal() * (vhat().segment(constraint_start, ni) -
+                                 vc.segment(constraint_start, ni) -
+                                 alpha * dvc_i);
+    if (calc_second_derivative) {
+      MatrixX<T>& dPdy_i = workspace->dPdy[i];
+      c.Project(y_i, R_i, &gamma_i, &dPdy_i);
+      // Δvcᵢᵀ⋅Gᵢ⋅Δvcᵢ, with Gᵢ = dPᵢ/dyᵢ⋅Rᵢ⁻¹.
+      workspace->d2ell_dalpha2[i] =
+          dvc_i.dot(dPdy_i * (Rinv_i.asDiagonal() * dvc_i));
+    } else {
+      c.Project(y_i, R_i, &gamma_i);
+    }
+    workspace->ell[i] = 0.5 * gamma_i.dot(R_i.asDiagonal() * gamma_i);
+    workspace->dell_dalpha[i] = -dvc_i.dot(gamma_i);
+  }, SapConstraintLoopOptions<T>(nc));
+
+  // N.B. Reductions are performed serially so that results are bitwise
+  // reproducible regardless of the number of threads.
+  if (dell_dalpha != nullptr) *dell_dalpha = workspace->dell_dalpha.sum();
+  if (calc_second_derivative) *d2ell_dalpha2 = workspace->d2ell_dalpha2.sum();
+  return workspace->ell.sum();
 }
 
 }  // namespace internal
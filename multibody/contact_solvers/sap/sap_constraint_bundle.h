@@ -123,6 +123,40 @@ class SapConstraintBundle {
   void ProjectImpulsesAndCalcConstraintsHessian(
       const VectorX<T>& y, VectorX<T>* gamma, std::vector<MatrixX<T>>* G) const;
 
+  /* Scratch space used by CalcRegularizerCostAlongLine() so that repeated
+   evaluations along the same line do not allocate. Default constructed
+   workspaces are resized on first use. */
+  struct LineSearchWorkspace {
+    VectorX<T> y;                  // Unprojected impulses y(α).
+    VectorX<T> gamma;              // Impulses γ(α) = P(y(α)).
+    std::vector<MatrixX<T>> dPdy;  // Per-constraint dPᵢ/dyᵢ.
+    VectorX<T> ell;                // Per-constraint ℓᵢ(α).
+    VectorX<T> dell_dalpha;        // Per-constraint dℓᵢ/dα.
+    VectorX<T> d2ell_dalpha2;      // Per-constraint d²ℓᵢ/dα².
+  };
+
+  /* Computes the regularizer cost ℓᵣ(α) = 1/2⋅γ(α)ᵀ⋅R⋅γ(α) along the line
+   vc(α) = vc + α⋅Δvc, with γ(α) = P(−R⁻¹⋅(vc(α)−v̂)). Since y(α) is affine in
+   α, this only performs the per-constraint projections; it does not multiply
+   by the Jacobian J. Per-constraint contributions are computed concurrently
+   and then added in a fixed order, so that the result does not depend on the
+   number of threads.
+   @param[in] vc Constraint velocities at α = 0.
+   @param[in] dvc Change in constraint velocities Δvc = J⋅Δv along the line.
+   @param[in] alpha The step size α.
+   @param[in,out] workspace Scratch space. It must not be nullptr.
+   @param[out] dell_dalpha If not nullptr, on output the first derivative
+   dℓᵣ/dα = −Δvcᵀ⋅γ(α).
+   @param[out] d2ell_dalpha2 If not nullptr, on output the second derivative
+   d²ℓᵣ/dα² = Δvcᵀ⋅G(α)⋅Δvc, with G(α) the constraints' Hessian, see
+   ProjectImpulsesAndCalcConstraintsHessian().
+   @returns The regularizer cost ℓᵣ(α).
+   @pre vc.size() and dvc.size() equal num_constraint_equations(). */
+  T CalcRegularizerCostAlongLine(const VectorX<T>& vc, const VectorX<T>& dvc,
+                                 const T& alpha, LineSearchWorkspace* workspace,
+                                 T* dell_dalpha = nullptr,
+                                 T* d2ell_dalpha2 = nullptr) const;
+
  private:
   /* This method builds the BlockSparseMatrix representation of the Jacobian
    matrix for the given contact problem. For further details on its structure,
@@ -135,6 +169,10 @@ class SapConstraintBundle {
   VectorX<T> Rinv_;
   // Constraint references in the order dictated by the ContactProblemGraph.
   std::vector<const SapConstraint<T>*> constraints_;
+  // constraint_start_[i] is the index of the first equation of the i-th
+  // constraint in constraints_, so that constraints can be processed
+  // concurrently.
+  std::vector<int> constraint_start_;
 };
 
 }  // namespace internal
@@ -1,5 +1,6 @@
 #include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "drake/common/default_scalars.h"
@@ -61,6 +62,72 @@ std::unique_ptr<SapContactProblem<T>> SapContactProblem<T>::Clone() const {
   return clone;
 }
 
+template <typename T>
+std::vector<std::unique_ptr<SapContactProblem<T>>>
+SapContactProblem<T>::MakeIslandProblems(
+    const std::vector<std::vector<int>>& islands,
+    std::vector<std::vector<int>>* island_cliques,
+    std::vector<std::vector<int>>* island_constraints) const {
+  DRAKE_THROW_UNLESS(island_cliques != nullptr);
+  DRAKE_THROW_UNLESS(island_constraints != nullptr);
+  const int num_islands = islands.size();
+  island_cliques->assign(num_islands, {});
+  island_constraints->assign(num_islands, {});
+
+  std::vector<int> clique_velocity_start(num_cliques());
+  for (int c = 1; c < num_cliques(); ++c) {
+    clique_velocity_start[c] = clique_velocity_start[c - 1] + A_[c - 1].rows();
+  }
+
+  // Since a clique belongs to at most one island, a single map from cliques in
+  // `this` problem to cliques in their island problem suffices.
+  std::vector<int> clique_map(num_cliques(), -1);
+  std::vector<std::unique_ptr<SapContactProblem<T>>> problems;
+  problems.reserve(num_islands);
+  for (int i = 0; i < num_islands; ++i) {
+    std::vector<int>& cliques = (*island_cliques)[i];
+    std::vector<int>& constraints = (*island_constraints)[i];
+    for (int k : islands[i]) {
+      const ContactProblemGraph::ConstraintCluster& cluster =
+          graph_.get_cluster(k);
+      for (int c : {cluster.cliques().first(), cluster.cliques().second()}) {
+        if (clique_map[c] < 0) {
+          clique_map[c] = cliques.size();
+          cliques.push_back(c);
+        }
+      }
+      constraints.insert(constraints.end(), cluster.constraint_index().begin(),
+                         cluster.constraint_index().end());
+    }
+    std::sort(constraints.begin(), constraints.end());
+
+    std::vector<MatrixX<T>> A;
+    A.reserve(cliques.size());
+    int nv = 0;
+    for (int c : cliques) {
+      A.push_back(A_[c]);
+      nv += A_[c].rows();
+    }
+    VectorX<T> v_star(nv);
+    int offset = 0;
+    for (int c : cliques) {
+      const int nv_c = A_[c].rows();
+      v_star.segment(offset, nv_c) =
+          v_star_.segment(clique_velocity_start[c], nv_c);
+      offset += nv_c;
+    }
+
+    auto problem = std::make_unique<SapContactProblem<T>>(
+        time_step_, std::move(A), std::move(v_star));
+    for (int j : constraints) {
+      problem->AddConstraint(constraints_[j]->CloneWithRemappedCliques(
+          clique_map));
+    }
+    problems.push_back(std::move(problem));
+  }
+  return problems;
+}
+
 template <typename T>
 int SapContactProblem<T>::AddConstraint(std::unique_ptr<SapConstraint<T>> c) {
   if (c->first_clique() >= num_cliques()) {
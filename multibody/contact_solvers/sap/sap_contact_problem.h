@@ -117,6 +117,28 @@ class SapContactProblem {
   /* Returns a deep-copy of `this` instance. */
   std::unique_ptr<SapContactProblem<T>> Clone() const;
 
+  /* Splits `this` problem into independent problems, one for each of the given
+   `islands` of graph(), as returned by graph().CalcIslands(). The problem for
+   an island contains only the cliques and constraints of that island and can
+   be solved independently of the other islands. Cliques that belong to no
+   island are not constrained and their solution is simply v = v*.
+   @param[in] islands
+     The partition of the clusters of graph() into islands, see
+     ContactProblemGraph::CalcIslands().
+   @param[out] island_cliques
+     On output, (*island_cliques)[i][k] is the index in `this` problem of the
+     k-th clique in the problem for the i-th island.
+   @param[out] island_constraints
+     On output, (*island_constraints)[i][k] is the index in `this` problem of
+     the k-th constraint in the problem for the i-th island. Constraints keep
+     their relative order in `this` problem.
+   @returns the problem for each island, with the time step of `this`
+   problem. */
+  std::vector<std::unique_ptr<SapContactProblem<T>>> MakeIslandProblems(
+      const std::vector<std::vector<int>>& islands,
+      std::vector<std::vector<int>>* island_cliques,
+      std::vector<std::vector<int>>* island_constraints) const;
+
   /* TODO(amcastro-tri): consider constructor API taking std::vector<VectorX<T>>
    for v_star. It could be useful for deformables. */
 
@@ -0,0 +1,146 @@
+#include "drake/multibody/contact_solvers/sap/sap_island_solver.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/parallel_for.h"
+#include "drake/multibody/contact_solvers/sap/sap_parallelism.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+template <typename T>
+std::unique_ptr<SapIslandSolver<T>> SapIslandSolver<T>::Clone() const {
+  auto clone = std::make_unique<SapIslandSolver<T>>();
+  clone->set_parameters(parameters_);
+  return clone;
+}
+
+template <typename T>
+void SapIslandSolver<T>::set_parameters(
+    const SapSolverParameters& parameters) {
+  parameters_ = parameters;
+}
+
+template <typename T>
+const typename SapSolver<T>::SolverStats&
+SapIslandSolver<T>::get_island_statistics(int island) const {
+  DRAKE_THROW_UNLESS(0 <= island && island < num_islands());
+  return solvers_[island]->get_statistics();
+}
+
+template <typename T>
+SapSolverStatus SapIslandSolver<T>::SolveWithGuess(
+    const SapContactProblem<T>& problem, const VectorX<T>& v_guess,
+    SapSolverResults<T>* results) {
+  DRAKE_DEMAND(results != nullptr);
+  DRAKE_THROW_UNLESS(v_guess.size() == problem.num_velocities());
+
+  const std::vector<std::vector<int>> islands = problem.graph().CalcIslands();
+  num_islands_ = islands.size();
+  while (static_cast<int>(solvers_.size()) < std::max(num_islands_, 1)) {
+    solvers_.push_back(std::make_unique<SapSolver<T>>());
+  }
+  for (const std::unique_ptr<SapSolver<T>>& solver : solvers_) {
+    solver->set_parameters(parameters_);
+  }
+
+  // Splitting the problem would only add overhead.
+  if (num_islands_ <= 1) {
+    num_islands_ = 1;
+    return solvers_[0]->SolveWithGuess(problem, v_guess, results);
+  }
+
+  // The constraints of the island problems are clones of those of `problem`.
+  // They can't be reused across calls since each call gets a new problem, with
+  // new constraints (and their Jacobians).
+  std::vector<std::vector<int>> island_cliques;
+  std::vector<std::vector<int>> island_constraints;
+  const std::vector<std::unique_ptr<SapContactProblem<T>>> island_problems =
+      problem.MakeIslandProblems(islands, &island_cliques,
+                                 &island_constraints);
+
+  // Offsets into the generalized velocities and constraint equations of
+  // `problem` for each of its cliques and constraints.
+  std::vector<int> clique_velocity_start(problem.num_cliques());
+  for (int c = 1; c < problem.num_cliques(); ++c) {
+    clique_velocity_start[c] =
+        clique_velocity_start[c - 1] + problem.num_velocities(c - 1);
+  }
+  std::vector<int> constraint_equation_start(problem.num_constraints());
+  for (int i = 1; i < problem.num_constraints(); ++i) {
+    constraint_equation_start[i] =
+        constraint_equation_start[i - 1] +
+        problem.get_constraint(i - 1).num_constraint_equations();
+  }
+
+  // Cliques in no island are not constrained and their solution is v = v*,
+  // with zero generalized impulses. The remaining entries are overwritten by
+  // the solution of their island.
+  results->Resize(problem.num_velocities(),
+                  problem.num_constraint_equations());
+  results->v = problem.v_star();
+  results->j.setZero();
+
+  // Islands write to disjoint entries of `results` and can be solved
+  // concurrently, in which case the parallel loops of each island's solver
+  // run serially (see ParallelizeSapLoops()).
+  std::vector<SapSolverStatus> status(num_islands_, SapSolverStatus::kFailure);
+  drake::internal::ParallelForOptions parallel_options;
+  parallel_options.parallelize =
+      ParallelizeSapLoops<T>(problem.num_constraints());
+  drake::internal::ParallelFor(num_islands_, [&](int i) {
+    const SapContactProblem<T>& island_problem = *island_problems[i];
+    const std::vector<int>& cliques = island_cliques[i];
+    const std::vector<int>& constraints = island_constraints[i];
+
+    VectorX<T> island_v_guess(island_problem.num_velocities());
+    int offset = 0;
+    for (int c : cliques) {
+      const int nv = problem.num_velocities(c);
+      island_v_guess.segment(offset, nv) =
+          v_guess.segment(clique_velocity_start[c], nv);
+      offset += nv;
+    }
+
+    SapSolverResults<T> island_results;
+    status[i] = solvers_[i]->SolveWithGuess(island_problem, island_v_guess,
+                                            &island_results);
+    if (status[i] != SapSolverStatus::kSuccess) return;
+
+    offset = 0;
+    for (int c : cliques) {
+      const int nv = problem.num_velocities(c);
+      const int start = clique_velocity_start[c];
+      results->v.segment(start, nv) = island_results.v.segment(offset, nv);
+      results->j.segment(start, nv) = island_results.j.segment(offset, nv);
+      offset += nv;
+    }
+    offset = 0;
+    for (int k : constraints) {
+      const int ne = problem.get_constraint(k).num_constraint_equations();
+      const int start = constraint_equation_start[k];
+      results->gamma.segment(start, ne) =
+          island_results.gamma.segment(offset, ne);
+      results->vc.segment(start, ne) = island_results.vc.segment(offset, ne);
+      offset += ne;
+    }
+  }, parallel_options);
+
+  for (SapSolverStatus island_status : status) {
+    if (island_status != SapSolverStatus::kSuccess) return island_status;
+  }
+  return SapSolverStatus::kSuccess;
+}
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::contact_solvers::internal::SapIslandSolver)
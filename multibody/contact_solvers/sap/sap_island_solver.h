@@ -0,0 +1,83 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
+#include "drake/multibody/contact_solvers/sap/sap_solver.h"
+#include "drake/multibody/contact_solvers/sap/sap_solver_results.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+// This class solves a SapContactProblem by splitting it into "islands", the
+// connected components of the problem's graph (see
+// ContactProblemGraph::CalcIslands()), and solving the problem for each island
+// with its own SapSolver. Since islands are not coupled by any constraint, the
+// solution is the same as that of the full problem, though each island
+// converges on its own: islands that are easy to solve (e.g. objects resting on
+// the ground) can converge in a single Newton iteration, while harder islands
+// keep iterating. Islands are solved in parallel when OpenMP is available, for
+// T = double and problems with enough constraints (see ParallelizeSapLoops()),
+// in which case the parallel loops within the solver of each island run
+// serially.
+//
+// When the problem has a single island, it is solved directly with SapSolver.
+//
+// @tparam_nonsymbolic_scalar
+template <typename T>
+class SapIslandSolver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SapIslandSolver);
+
+  SapIslandSolver() = default;
+
+  // Returns a new solver with the same parameters as this one. The solvers of
+  // the islands, which only serve as scratch, are not copied.
+  std::unique_ptr<SapIslandSolver<T>> Clone() const;
+
+  // Solves `problem` one island at a time. Velocities of cliques that belong
+  // to no island are v = v*. The results are the same as those of
+  // SapSolver::SolveWithGuess() for the full problem, within the convergence
+  // tolerances specified with set_parameters(), which apply to each island.
+  // @returns SapSolverStatus::kSuccess if all islands converged.
+  // @throws std::exception if the solver throws for any of the islands.
+  SapSolverStatus SolveWithGuess(const SapContactProblem<T>& problem,
+                                 const VectorX<T>& v_guess,
+                                 SapSolverResults<T>* results);
+
+  // New parameters will affect the next call to SolveWithGuess().
+  void set_parameters(const SapSolverParameters& parameters);
+
+  // Returns the number of islands solved in the last call to SolveWithGuess().
+  // A problem with a single island, or none, is solved as a whole and counts as
+  // a single island.
+  int num_islands() const { return num_islands_; }
+
+  // Returns the statistics of the solver for the i-th island in the last call
+  // to SolveWithGuess(), with islands ordered as in
+  // ContactProblemGraph::CalcIslands().
+  // @throws std::exception if island is not in [0, num_islands()).
+  const typename SapSolver<T>::SolverStats& get_island_statistics(
+      int island) const;
+
+ private:
+  SapSolverParameters parameters_;
+  int num_islands_{0};
+  // Solvers are reused across calls to SolveWithGuess(). Only the first
+  // num_islands_ are used by the last call.
+  std::vector<std::unique_ptr<SapSolver<T>>> solvers_;
+};
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::contact_solvers::internal::SapIslandSolver);
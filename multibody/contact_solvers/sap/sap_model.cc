@@ -4,9 +4,11 @@
 #include <utility>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/parallel_for.h"
 #include "drake/math/linear_solve.h"
 #include "drake/multibody/contact_solvers/block_sparse_matrix.h"
 #include "drake/multibody/contact_solvers/sap/contact_problem_graph.h"
+#include "drake/multibody/contact_solvers/sap/sap_parallelism.h"
 
 namespace drake {
 namespace multibody {
@@ -383,61 +385,55 @@ void SapModel<T>::CalcDelassusDiagonalApproximation(
   DRAKE_DEMAND(static_cast<int>(A.size()) == num_cliques());
 
   // We compute a factorization of A once so we can re-use it multiple times
-  // below.
+  // below. Cliques are independent and are factorized concurrently.
   const int num_cliques = A.size();  // N.B. Participating cliques.
   std::vector<math::LinearSolver<Eigen::LDLT, MatrixX<T>>> A_ldlt(num_cliques);
-  for (int c = 0; c < num_cliques; ++c) {
+  const int num_constraints = problem().num_constraints();
+  drake::internal::ParallelForOptions clique_options;
+  clique_options.parallelize = ParallelizeSapLoops<T>(num_constraints);
+  drake::internal::ParallelFor(num_cliques, [&](int c) {
     A_ldlt[c] = math::LinearSolver<Eigen::LDLT, MatrixX<T>>(A[c]);
     DRAKE_DEMAND(A_ldlt[c].eigen_linear_solver().isPositive());
-  }
-
-  // Scan constraints in the order specified by the graph.
-  const int num_constraints = problem().num_constraints();
-  std::vector<MatrixX<T>> W(num_constraints);
-
-  const ContactProblemGraph& graph = problem().graph();
-  const PartialPermutation& cliques_permutation = graph.participating_cliques();
+  }, clique_options);
 
+  // Constraint indexes in the order specified by the graph, i.e. the i-th
+  // constraint in this model is constraint_index[i] in the original problem.
+  std::vector<int> constraint_index;
+  constraint_index.reserve(num_constraints);
   for (const ContactProblemGraph::ConstraintCluster& e :
        problem().graph().clusters()) {
     for (int i : e.constraint_index()) {
-      const SapConstraint<T>& constraint = problem().get_constraint(i);
-      const int ni = constraint.num_constraint_equations();
-      if (W[i].size() == 0) {
-        // Resize and initialize to zero on the first time it gets accessed.
-        W[i].resize(ni, ni);
-        W[i].setZero();
-      }
-
-      // Clique 0 is always present. Add its contribution.
-      {
-        const int c =
-            cliques_permutation.permuted_index(constraint.first_clique());
-        const MatrixX<T>& Jic = constraint.first_clique_jacobian();
-        W[i] += Jic * A_ldlt[c].Solve(Jic.transpose());
-      }
-
-      // Adds clique 1 contribution, if present.
-      if (constraint.num_cliques() == 2) {
-        const int c =
-            cliques_permutation.permuted_index(constraint.second_clique());
-        const MatrixX<T>& Jic = constraint.second_clique_jacobian();
-        W[i] += Jic * A_ldlt[c].Solve(Jic.transpose());
-      }
+      constraint_index.push_back(i);
     }
   }
 
-  // Compute Delassus_diagonal as the rms norm of the diagonal block for the
-  // i-th constraint.
+  const ContactProblemGraph& graph = problem().graph();
+  const PartialPermutation& cliques_permutation = graph.participating_cliques();
+
+  // Compute Delassus_diagonal as the rms norm of the diagonal block Wᵢᵢ for the
+  // i-th constraint. Each block only depends on its own constraint and
+  // therefore they are computed concurrently.
   delassus_diagonal->resize(num_constraints);
-  int permuted_constraint_index = 0;
-  for (const ContactProblemGraph::ConstraintCluster& e :
-       problem().graph().clusters()) {
-    for (int i : e.constraint_index()) {
-      (*delassus_diagonal)[permuted_constraint_index++] =
-          W[i].norm() / W[i].rows();
+  drake::internal::ParallelFor(num_constraints, [&](int k) {
+    const SapConstraint<T>& constraint =
+        problem().get_constraint(constraint_index[k]);
+
+    // Clique 0 is always present. Add its contribution.
+    const int c0 =
+        cliques_permutation.permuted_index(constraint.first_clique());
+    const MatrixX<T>& J0 = constraint.first_clique_jacobian();
+    MatrixX<T> W = J0 * A_ldlt[c0].Solve(J0.transpose());
+
+    // Adds clique 1 contribution, if present.
+    if (constraint.num_cliques() == 2) {
+      const int c1 =
+          cliques_permutation.permuted_index(constraint.second_clique());
+      const MatrixX<T>& J1 = constraint.second_clique_jacobian();
+      W += J1 * A_ldlt[c1].Solve(J1.transpose());
     }
-  }
+
+    (*delassus_diagonal)[k] = W.norm() / W.rows();
+  }, SapConstraintLoopOptions<T>(num_constraints));
 }
 
 }  // namespace internal
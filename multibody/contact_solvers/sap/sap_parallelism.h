@@ -0,0 +1,46 @@
+#pragma once
+
+#include "drake/common/parallel_for.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+/* Below this number of constraints, the loops over the constraints and cliques
+ of a SAP problem run serially since the overhead of a parallel region
+ outweighs the work. */
+constexpr int kMinConstraintsForParallelism = 64;
+
+/* Loops over the constraints of a SAP problem hand them to threads this many
+ at a time, since a single constraint is too little work to be scheduled on
+ its own. */
+constexpr int kConstraintsPerChunk = 16;
+
+/* Returns true if the loops over the constraints or cliques of a SAP problem
+ with `num_constraints` constraints (or over the islands of such a problem, see
+ SapIslandSolver) should run in parallel. See drake::internal::
+ ShouldParallelize(). In particular, loops reached from within an active
+ parallel region, e.g. those of the SapSolver of an island while
+ SapIslandSolver solves islands in parallel, run serially. */
+template <typename T>
+bool ParallelizeSapLoops(int num_constraints) {
+  return drake::internal::ShouldParallelize<T>(num_constraints,
+                                               kMinConstraintsForParallelism);
+}
+
+/* Returns the ParallelFor() options for a loop over the constraints of a SAP
+ problem with `num_constraints` constraints. */
+template <typename T>
+drake::internal::ParallelForOptions SapConstraintLoopOptions(
+    int num_constraints) {
+  drake::internal::ParallelForOptions options;
+  options.parallelize = ParallelizeSapLoops<T>(num_constraints);
+  options.chunk_size = kConstraintsPerChunk;
+  return options;
+}
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
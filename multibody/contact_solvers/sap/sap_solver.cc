@@ -8,6 +8,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/extract_double.h"
+#include "drake/common/timer.h"
 #include "drake/math/linear_solve.h"
 #include "drake/multibody/contact_solvers/newton_with_bisection.h"
 #include "drake/multibody/contact_solvers/supernodal_solver.h"
@@ -106,25 +107,31 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
   using std::abs;
   using std::max;
 
+  stats_ = SolverStats();
+  SteadyTimer total_timer;
+  SteadyTimer timer;
+
   if (problem.num_constraints() == 0) {
     // In the absence of constraints the solution is trivially v = v*.
     results->Resize(problem.num_velocities(),
                     problem.num_constraint_equations());
     results->v = problem.v_star();
     results->j.setZero();
+    stats_.total_time = total_timer.Tick();
     return SapSolverStatus::kSuccess;
   }
 
   // Make model for the given contact problem.
+  timer.Start();
   model_ = std::make_unique<SapModel<double>>(&problem);
   const int nv = model_->num_velocities();
   const int nk = model_->num_constraint_equations();
 
   // Allocate the necessary memory to work with.
   auto context = model_->MakeContext();
-  auto scratch = model_->MakeContext();
   SearchDirectionData search_direction_data(nv, nk);
-  stats_ = SolverStats();
+  LineSearchWorkspace line_search_workspace;
+  stats_.model_time = timer.Tick();
   // The supernodal solver is expensive to instantiate and therefore we only
   // instantiate when needed.
   std::unique_ptr<SuperNodalSolver> supernodal_solver;
@@ -139,7 +146,9 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
 
   // Start Newton iterations.
   int k = 0;
+  timer.Start();
   double ell = model_->EvalCost(*context);
+  stats_.gradient_time += timer.Tick();
   double ell_previous = ell;
   bool converged = false;
   double alpha = 1.0;
@@ -148,7 +157,9 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
     // We first verify the stopping criteria. If satisfied, we skip expensive
     // factorizations.
     double momentum_residual, momentum_scale;
+    timer.Start();
     CalcStoppingCriteriaResidual(*context, &momentum_residual, &momentum_scale);
+    stats_.gradient_time += timer.Tick();
     stats_.optimality_criterion_reached =
         momentum_residual <=
         parameters_.abs_tolerance + parameters_.rel_tolerance * momentum_scale;
@@ -184,7 +195,9 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
         // Instantiate supernodal solver on the first iteration when needed. If
         // the stopping criteria is satisfied at k = 0 (good guess), then we
         // skip the expensive instantiation of the solver.
+        timer.Start();
         supernodal_solver = MakeSuperNodalSolver();
+        stats_.factorization_time += timer.Tick();
       }
     }
 
@@ -200,23 +213,27 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
     const VectorX<double>& dv = search_direction_data.dv;
 
     // Perform line search.
+    timer.Start();
     switch (parameters_.line_search_type) {
       case SapSolverParameters::LineSearchType::kBackTracking:
         std::tie(alpha, num_line_search_iters) = PerformBackTrackingLineSearch(
-            *context, search_direction_data, scratch.get());
+            *context, search_direction_data, &line_search_workspace);
         break;
       case SapSolverParameters::LineSearchType::kExact:
         std::tie(alpha, num_line_search_iters) = PerformExactLineSearch(
-            *context, search_direction_data, scratch.get());
+            *context, search_direction_data, &line_search_workspace);
         break;
     }
     stats_.num_line_search_iters += num_line_search_iters;
+    stats_.line_search_time += timer.Tick();
 
     // Update state.
     model_->GetMutableVelocities(context.get()) += alpha * dv;
 
     ell_previous = ell;
+    timer.Start();
     ell = model_->EvalCost(*context);
+    stats_.gradient_time += timer.Tick();
 
     const double ell_scale = (ell + ell_previous) / 2.0;
     // N.B. Even though theoretically we expect ell < ell_previous, round-off
@@ -234,7 +251,10 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
         alpha > 0.5;
   }
 
-  if (!converged) return SapSolverStatus::kFailure;
+  if (!converged) {
+    stats_.total_time = total_timer.Tick();
+    return SapSolverStatus::kFailure;
+  }
 
   PackSapSolverResults(*context, results);
 
@@ -242,6 +262,7 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
   // even instantiated and no factorizations are performed (the expensive part
   // of the computation). We report zero number of iterations.
   stats_.num_iters = k;
+  stats_.total_time = total_timer.Tick();
 
   return SapSolverStatus::kSuccess;
 }
@@ -250,89 +271,47 @@ template <typename T>
 T SapSolver<T>::CalcCostAlongLine(
     const systems::Context<T>& context,
     const SearchDirectionData& search_direction_data, const T& alpha,
-    systems::Context<T>* scratch, T* dell_dalpha, T* d2ell_dalpha2,
-    VectorX<T>* d2ell_dalpha2_scratch) const {
-  DRAKE_DEMAND(scratch != nullptr);
-  DRAKE_DEMAND(scratch != &context);
-  if (d2ell_dalpha2 != nullptr) DRAKE_DEMAND(d2ell_dalpha2_scratch != nullptr);
-
-  // Data.
-  const VectorX<T>& R = model_->constraints_bundle().R();
-  const VectorX<T>& v_star = model_->v_star();
+    LineSearchWorkspace* workspace, T* dell_dalpha, T* d2ell_dalpha2) const {
+  DRAKE_DEMAND(workspace != nullptr);
 
   // Search direction quantities at state v.
-  const VectorX<T>& dv = search_direction_data.dv;
-  const VectorX<T>& dp = search_direction_data.dp;
   const VectorX<T>& dvc = search_direction_data.dvc;
+  const T& dellA_dalpha0 = search_direction_data.dellA_dalpha;
   const T& d2ellA_dalpha2 = search_direction_data.d2ellA_dalpha2;
 
-  // State at v(alpha).
-  Context<T>& context_alpha = *scratch;
-  const VectorX<T>& v = model_->GetVelocities(context);
-  model_->GetMutableVelocities(&context_alpha) = v + alpha * dv;
-
-  if (d2ell_dalpha2 != nullptr) {
-    // Since it is more efficient to calculate impulses (gamma) and their
-    // derivatives (G) together, this evaluation avoids calculating the impulses
-    // twice.
-    model_->EvalConstraintsHessian(context_alpha);
-  }
-
-  // Update velocities and impulses at v(alpha).
-  // N.B. This evaluation should be cheap given we called
-  // EvalConstraintsHessian() at the very start of the scope of this function.
-  const VectorX<T>& gamma = model_->EvalImpulses(context_alpha);
-
-  // Regularizer cost.
-  const T ellR = 0.5 * gamma.dot(R.asDiagonal() * gamma);
+  // Regularizer cost. Constraint velocities are affine in α, vc(α) = vc + αΔvc,
+  // and therefore we only need vc at α = 0, already cached in `context`.
+  const VectorX<T>& vc = model_->EvalConstraintVelocities(context);
+  T dellR_dalpha{NAN};
+  T d2ellR_dalpha2{NAN};
+  const T ellR = model_->constraints_bundle().CalcRegularizerCostAlongLine(
+      vc, dvc, alpha, workspace,
+      dell_dalpha != nullptr ? &dellR_dalpha : nullptr,
+      d2ell_dalpha2 != nullptr ? &d2ellR_dalpha2 : nullptr);
 
   // Momentum cost. We use the O(n) strategy described in [Castro et al., 2021].
   // The momentum cost is: ellA(α) = 0.5‖v(α)−v*‖², where ‖⋅‖ is the norm
   // defined by A. v(α) corresponds to the value of v along the search
   // direction: v(α) = v + αΔv. Using v(α) in the expression of the cost and
   // expanding the squared norm leads to: ellA(α) = 0.5‖v−v*‖² + αΔvᵀ⋅A⋅(v−v*) +
-  // 0.5‖Δv‖²α². We now notice some of those terms are already cached:
-  //  - dpᵀ = Δvᵀ⋅A
+  // 0.5‖Δv‖²α². We now notice all of those terms are already cached:
   //  - ellA(v) = 0.5‖v−v*‖²
-  //  - d2ellA_dalpha2 = 0.5‖Δv‖²α², see [Castro et al., 2021; §VIII.C].
+  //  - dellA_dalpha0 = Δvᵀ⋅A⋅(v−v*)
+  //  - d2ellA_dalpha2 = ‖Δv‖², see [Castro et al., 2021; §VIII.C].
   T ellA = model_->EvalMomentumCost(context);
-  ellA += alpha * dp.dot(v - v_star);
+  ellA += alpha * dellA_dalpha0;
   ellA += 0.5 * alpha * alpha * d2ellA_dalpha2;
   const T ell = ellA + ellR;
 
   // Compute first derivative.
   if (dell_dalpha != nullptr) {
-    const VectorX<T>& v_alpha = model_->GetVelocities(context_alpha);
-
-    // First derivative.
-    const T dellA_dalpha = dp.dot(v_alpha - v_star);  // Momentum term.
-    const T dellR_dalpha = -dvc.dot(gamma);           // Regularizer term.
+    // dellA/dα = Δvᵀ⋅A⋅(v(α)−v*) and dellR/dα = −Δvcᵀ⋅γ(α).
+    const T dellA_dalpha = dellA_dalpha0 + alpha * d2ellA_dalpha2;
     *dell_dalpha = dellA_dalpha + dellR_dalpha;
   }
 
-  // Compute second derivative.
+  // Compute second derivative, d²ℓ/dα² = Δvᵀ⋅A⋅Δv + Δvcᵀ⋅G⋅Δvc.
   if (d2ell_dalpha2 != nullptr) {
-    // N.B. This evaluation should be cheap given we called
-    // EvalConstraintsHessian() at the very start of the scope of this function.
-    const std::vector<MatrixX<T>>& G =
-        model_->EvalConstraintsHessian(context_alpha);
-
-    // First compute d2ell_dalpha2_scratch = G⋅Δvc.
-    d2ell_dalpha2_scratch->resize(model_->num_constraint_equations());
-    const int nc = model_->num_constraints();
-    int constraint_start = 0;
-    for (int i = 0; i < nc; ++i) {
-      const MatrixX<T>& G_i = G[i];
-      // Number of equations for the i-th constraint.
-      const int ni = G_i.rows();
-      const auto dvc_i = dvc.segment(constraint_start, ni);
-      d2ell_dalpha2_scratch->segment(constraint_start, ni) = G_i * dvc_i;
-      constraint_start += ni;
-    }
-
-    // d²ℓ/dα² = Δvcᵀ⋅G⋅Δvc
-    const T d2ellR_dalpha2 = dvc.dot(*d2ell_dalpha2_scratch);
-
     *d2ell_dalpha2 = d2ellA_dalpha2 + d2ellR_dalpha2;
 
     // Sanity check these terms are all positive.
@@ -348,11 +327,10 @@ template <typename T>
 std::pair<T, int> SapSolver<T>::PerformBackTrackingLineSearch(
     const systems::Context<T>& context,
     const SearchDirectionData& search_direction_data,
-    systems::Context<T>* scratch) const {
+    LineSearchWorkspace* workspace) const {
   DRAKE_DEMAND(parameters_.line_search_type ==
                SapSolverParameters::LineSearchType::kBackTracking);
-  DRAKE_DEMAND(scratch != nullptr);
-  DRAKE_DEMAND(scratch != &context);
+  DRAKE_DEMAND(workspace != nullptr);
   using std::abs;
   // Line search parameters.
   const double rho = parameters_.backtracking_line_search.rho;
@@ -382,8 +360,8 @@ std::pair<T, int> SapSolver<T>::PerformBackTrackingLineSearch(
 
   T alpha = parameters_.backtracking_line_search.alpha_max;
   T dell{NAN};
-  T ell =
-      CalcCostAlongLine(context, search_direction_data, alpha, scratch, &dell);
+  T ell = CalcCostAlongLine(context, search_direction_data, alpha, workspace,
+                            &dell);
 
   // If the cost is still decreasing at alpha, we accept this value.
   if (dell < 0) return std::make_pair(alpha, 0);
@@ -417,7 +395,7 @@ std::pair<T, int> SapSolver<T>::PerformBackTrackingLineSearch(
   int iteration = 1;
   for (; iteration < max_iterations; ++iteration) {
     alpha *= rho;
-    ell = CalcCostAlongLine(context, search_direction_data, alpha, scratch);
+    ell = CalcCostAlongLine(context, search_direction_data, alpha, workspace);
 
     // If variations in the cost are close to round-off errors (within some
     // threshold), it is because the gradient is close to zero and we return
@@ -461,7 +439,7 @@ std::pair<T, int> SapSolver<T>::PerformBackTrackingLineSearch(
 template <typename T>
 std::pair<T, int> SapSolver<T>::PerformExactLineSearch(
     const systems::Context<T>&, const SearchDirectionData&,
-    systems::Context<T>*) const {
+    LineSearchWorkspace*) const {
   throw std::logic_error(
       "SapSolver::PerformExactLineSearch(): Only T = double is supported.");
 }
@@ -470,11 +448,10 @@ template <>
 std::pair<double, int> SapSolver<double>::PerformExactLineSearch(
     const systems::Context<double>& context,
     const SearchDirectionData& search_direction_data,
-    systems::Context<double>* scratch) const {
+    LineSearchWorkspace* workspace) const {
   DRAKE_DEMAND(parameters_.line_search_type ==
                SapSolverParameters::LineSearchType::kExact);
-  DRAKE_DEMAND(scratch != nullptr);
-  DRAKE_DEMAND(scratch != &context);
+  DRAKE_DEMAND(workspace != nullptr);
   // dℓ/dα(α = 0) = ∇ᵥℓ(α = 0)⋅Δv.
   const VectorX<double>& ell_grad_v0 = model_->EvalCostGradient(context);
   const VectorX<double>& dv = search_direction_data.dv;
@@ -495,10 +472,8 @@ std::pair<double, int> SapSolver<double>::PerformExactLineSearch(
   const double alpha_max = parameters_.exact_line_search.alpha_max;
   double dell{NAN};
   double d2ell{NAN};
-  VectorX<double> vec_scratch;
-  const double ell0 =
-      CalcCostAlongLine(context, search_direction_data, alpha_max, scratch,
-                        &dell, &d2ell, &vec_scratch);
+  const double ell0 = CalcCostAlongLine(context, search_direction_data,
+                                        alpha_max, workspace, &dell, &d2ell);
 
   // If the cost is still decreasing at alpha_max, we accept this value.
   if (dell <= 0) return std::make_pair(alpha_max, 0);
@@ -523,11 +498,10 @@ std::pair<double, int> SapSolver<double>::PerformExactLineSearch(
     const SapSolver<double>& solver;
     const Context<double>& context0;  // Context at alpha = 0.
     const SearchDirectionData& search_direction_data;
-    Context<double>& scratch;  // Context at alpha != 0.
+    LineSearchWorkspace& workspace;
     // N.B. We normalize the gradient to minimize round-off errors as f(alpha) =
     // −ℓ'(α)/dell_scale.
     const double dell_scale;
-    VectorX<double> vec_scratch;
   };
 
   // N.B. At this point we know that dell_dalpha0 < 0. Also, if the line search
@@ -535,15 +509,15 @@ std::pair<double, int> SapSolver<double>::PerformExactLineSearch(
   // non-zero. Therefore we can safely divide by dell_dalpha0.
   // N.B. We then define f(alpha) = −ℓ'(α)/ℓ'₀ so that f(alpha=0) = -1.
   const double dell_scale = -dell_dalpha0;
-  EvalData data{*this, context, search_direction_data, *scratch, dell_scale};
+  EvalData data{*this, context, search_direction_data, *workspace, dell_scale};
 
   // Cost and gradient of f(α) = −ℓ'(α)/ℓ'₀.
   auto cost_and_gradient = [&data](double x) {
     double dell_dalpha;
     double d2ell_dalpha2;
     data.solver.CalcCostAlongLine(data.context0, data.search_direction_data, x,
-                                   &data.scratch, &dell_dalpha, &d2ell_dalpha2,
-                                   &data.vec_scratch);
+                                   &data.workspace, &dell_dalpha,
+                                   &d2ell_dalpha2);
     return std::make_pair(dell_dalpha / data.dell_scale,
                           d2ell_dalpha2 / data.dell_scale);
   };
@@ -624,7 +598,10 @@ std::unique_ptr<SuperNodalSolver> SapSolver<T>::MakeSuperNodalSolver() const {
 template <typename T>
 void SapSolver<T>::CallDenseSolver(const Context<T>& context,
                                    VectorX<T>* dv) const {
+  SteadyTimer timer;
   const MatrixX<T> H = CalcDenseHessian(context);
+  stats_.hessian_time += timer.Tick();
+  timer.Start();
 
   // Factorize Hessian.
   // TODO(amcastro-tri): when T = AutoDiffXd propagate gradients analytically
@@ -643,6 +620,7 @@ void SapSolver<T>::CallDenseSolver(const Context<T>& context,
   // Compute search direction.
   const VectorX<T> rhs = -model_->EvalCostGradient(context);
   *dv = H_ldlt.Solve(rhs);
+  stats_.factorization_time += timer.Tick();
 }
 
 template <typename T>
@@ -666,7 +644,10 @@ void SapSolver<T>::CallSuperNodalSolver(const Context<T>& context,
                                         SuperNodalSolver* supernodal_solver,
                                         VectorX<T>* dv) const {
   if constexpr (std::is_same_v<T, double>) {
+    SteadyTimer timer;
     UpdateSuperNodalSolver(context, supernodal_solver);
+    stats_.hessian_time += timer.Tick();
+    timer.Start();
     if (!supernodal_solver->Factor()) {
       throw std::logic_error("SapSolver: Supernodal factorization failed.");
     }
@@ -674,6 +655,7 @@ void SapSolver<T>::CallSuperNodalSolver(const Context<T>& context,
     // right hand side.
     *dv = -model_->EvalCostGradient(context);
     supernodal_solver->SolveInPlace(dv);
+    stats_.factorization_time += timer.Tick();
   } else {
     unused(context);
     unused(supernodal_solver);
@@ -696,10 +678,15 @@ void SapSolver<T>::CalcSearchDirectionData(
     CallDenseSolver(context, &data->dv);
   }
 
-  // Update Δp, Δvc and d²ellA/dα².
+  // Update Δp, Δvc, dellA/dα and d²ellA/dα². These are computed once per
+  // search direction so that the line search does not need to.
+  SteadyTimer timer;
   model_->constraints_bundle().J().Multiply(data->dv, &data->dvc);
   model_->MultiplyByDynamicsMatrix(data->dv, &data->dp);
+  data->dellA_dalpha = data->dp.dot(model_->GetVelocities(context) -
+                                    model_->v_star());
   data->d2ellA_dalpha2 = data->dv.dot(data->dp);
+  stats_.line_search_time += timer.Tick();
 }
 
 }  // namespace internal
@@ -211,6 +211,12 @@ class SapSolver {
       momentum_scale.clear();
       cost.clear();
       alpha.clear();
+      model_time = 0;
+      gradient_time = 0;
+      hessian_time = 0;
+      factorization_time = 0;
+      line_search_time = 0;
+      total_time = 0;
     }
     int num_iters{0};              // Number of Newton iterations.
     int num_line_search_iters{0};  // Total number of line search iterations.
@@ -236,6 +242,22 @@ class SapSolver {
     // Dimensionless momentum scale at each SAP Newton iteration. Of size
     // num_iters + 1.
     std::vector<double> momentum_scale;
+
+    // Wall-clock time, in seconds, spent in each phase of SolveWithGuess(),
+    // accumulated over all Newton iterations. Phases not listed (e.g. packing
+    // the results) are included in total_time only.
+    // Making the SapModel for the contact problem.
+    double model_time{0};
+    // Evaluating the cost, its gradient and the stopping criteria.
+    double gradient_time{0};
+    // Evaluating the constraints' Hessian G and assembling H = A + Jᵀ⋅G⋅J.
+    double hessian_time{0};
+    // Making the supernodal solver, factorizing H and solving for Δv.
+    double factorization_time{0};
+    // Line search, including the computation of Δp and Δvc.
+    double line_search_time{0};
+    // Total time spent in SolveWithGuess().
+    double total_time{0};
   };
 
   SapSolver() = default;
@@ -276,14 +298,19 @@ class SapSolver {
       dv.resize(num_velocities);
       dp.resize(num_velocities);
       dvc.resize(num_constraint_equations);
+      dellA_dalpha = NAN;
       d2ellA_dalpha2 = NAN;
     }
     VectorX<T> dv;          // Search direction.
     VectorX<T> dp;          // Momentum update Δp = A⋅Δv.
     VectorX<T> dvc;         // Constraints velocities update, Δvc=J⋅Δv.
+    T dellA_dalpha{NAN};    // dellA/dα at α = 0, = Δpᵀ⋅(v−v*).
     T d2ellA_dalpha2{NAN};  // d²ellA/dα² = Δvᵀ⋅A⋅Δv.
   };
 
+  using LineSearchWorkspace =
+      typename SapConstraintBundle<T>::LineSearchWorkspace;
+
   // Pack solution into SapSolverResults. Where v is the vector of
   // generalized velocities, vc is the vector of contact velocities and gamma is
   // the vector of generalized contact impulses.
@@ -306,27 +333,28 @@ class SapSolver {
   // Computes the cost ℓ(α) = ℓ(vᵐ + αΔvᵐ) for line search, where vᵐ and Δvᵐ are
   // the last Newton iteration values of generalized velocities and search
   // direction, respectively. This methods uses the O(n) strategy described in
-  // [Castro et al., 2021].
+  // [Castro et al., 2021]: the momentum cost is a quadratic in α with
+  // coefficients precomputed in `search_direction_data` and, since the
+  // constraint velocities are affine in α, the regularizer cost is computed
+  // from vc(α) = vc + αΔvc with per-constraint projections only, see
+  // SapConstraintBundle::CalcRegularizerCostAlongLine().
   //
   // @param context A SapModel context storing the state of the underlying
   //   model.
   // @param search_direction_data Search direction Δv and derived data.
   // @param alpha Step size α along Δv.
   //   Cost will be computed at ℓ(α) = ℓ(vᵐ + αΔvᵐ).
-  // @param scratch A SapModel context used as a scratchpad. Values stored in
-  //   this context do not affect the result of the computation. scratch must
-  //   not be nullptr and scratch != &context.
+  // @param workspace Scratch space for the per-constraint computations. It
+  //   must not be nullptr.
   // @param dell_dalpha If not nullptr, on return dell_dalpha contains the value
   //   of the derivative dℓ/dα = ∇ℓ(vᵐ)⋅Δvᵐ.
   // @param d2ell_dalpha2 If not nullptr then on return d2ell_dalpha2 contains
   //   the value of the second derivative d²ℓ/dα².
-  // @param d2ell_dalpha2_scratch A scratchpad needed when computing
-  //   d2ell_dalpha2. Must not be nullptr if d2ell_dalpha2 != nullptr.
   T CalcCostAlongLine(const systems::Context<T>& context,
                       const SearchDirectionData& search_direction_data,
-                      const T& alpha, systems::Context<T>* scratch,
-                      T* dell_dalpha = nullptr, T* d2ell_dalpha2 = nullptr,
-                      VectorX<T>* d2ell_dalpha2_scratch = nullptr) const;
+                      const T& alpha, LineSearchWorkspace* workspace,
+                      T* dell_dalpha = nullptr,
+                      T* d2ell_dalpha2 = nullptr) const;
 
   // Approximation to the 1D minimization problem α = argmin ℓ(α) = ℓ(v + αΔv)
   // over α. We define ϕ(α) = ℓ₀ + α c ℓ₀', where ℓ₀ = ℓ(0), ℓ₀' = dℓ/dα(0) and
@@ -343,32 +371,30 @@ class SapSolver {
   // @param context A SapModel context storing the state of the underlying
   //   model.
   // @param search_direction_data Search direction Δv and derived data.
-  // @param scratch_workspace A SapModel context used as a scratchpad. Values
-  //   stored in this context do not affect the result of the computation.
-  //   scratch_workspace must not be nullptr and scratch_workspace != &context.
+  // @param workspace Scratch space for CalcCostAlongLine(). It must not be
+  //   nullptr.
   //
   // @returns A pair (α, num_iterations) where α satisfies Armijo's criterion
   // and num_iterations is the number of backtracking iterations performed.
   std::pair<T, int> PerformBackTrackingLineSearch(
       const systems::Context<T>& context,
       const SearchDirectionData& search_direction_data,
-      systems::Context<T>* scratch_workspace) const;
+      LineSearchWorkspace* workspace) const;
 
   // Solves α = argmin ℓ(α) = ℓ(v + αΔv) using a Newton-based method.
   //
   // @param context A SapModel context storing the state of the underlying
   //   model.
   // @param search_direction_data Search direction Δv and derived data.
-  // @param scratch_workspace A SapModel context used as a scratchpad. Values
-  //   stored in this context do not affect the result of the computation.
-  //   scratch_workspace must not be nullptr and scratch_workspace != &context.
+  // @param workspace Scratch space for CalcCostAlongLine(). It must not be
+  //   nullptr.
   //
   // @returns A pair (α, num_iterations) with α the optimal line search step
   // size and num_iterations is the number of iterations performed.
   std::pair<T, int> PerformExactLineSearch(
       const systems::Context<T>& context,
       const SearchDirectionData& search_direction_data,
-      systems::Context<T>* scratch_workspace) const;
+      LineSearchWorkspace* workspace) const;
 
   // Computes a dense Hessian H(v) = A + Jᵀ⋅G(v)⋅J for the generalized
   // velocities state stored in `context`.
@@ -430,7 +456,7 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
 template <>
 std::pair<double, int> SapSolver<double>::PerformExactLineSearch(
     const systems::Context<double>&, const SearchDirectionData&,
-    systems::Context<double>*) const;
+    LineSearchWorkspace*) const;
 
 }  // namespace internal
 }  // namespace contact_solvers
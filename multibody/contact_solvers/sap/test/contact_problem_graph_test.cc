@@ -1,5 +1,7 @@
 #include "drake/multibody/contact_solvers/sap/contact_problem_graph.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 namespace drake {
@@ -129,6 +131,36 @@ TEST_F(ContactGraphTest, ResetGraph) {
   VerifyForExpectedGraph(graph);
 }
 
+TEST_F(ContactGraphTest, CalcIslands) {
+  // All participating cliques of the graph above form a single island, with
+  // clique 2 in no island.
+  const ContactProblemGraph graph = MakeGraph();
+  const std::vector<std::vector<int>> expected_single_island = {{0, 1, 2, 3}};
+  EXPECT_EQ(graph.CalcIslands(), expected_single_island);
+
+  // Three islands, {0, 4, 5}, {1, 6} and {3}, sketched below with the cluster
+  // indexes as labels. Islands are merged as clusters connect them (cluster 4
+  // joins the islands of cliques 0 and 5 after cluster 2).
+  //
+  //   ┌───┐ 0 ┌───┐ 4 ┌───┐      ┌───┐ 1 ┌───┐     ┌───┐   ┌───┐
+  //   │ 0 ├───┤ 4 ├───┤ 5 ├─┐    │ 1 ├───┤ 6 │     │ 3 ├─┐ │ 2 │
+  //   └───┘   └───┘   └───┘ │ 2  └───┘   └───┘     └─┬─┘ │ └───┘
+  //                         └─┘                      └───┘ 3
+  ContactProblemGraph islands_graph(7);
+  islands_graph.AddConstraint(0, 4, 3);
+  islands_graph.AddConstraint(6, 1, 3);
+  islands_graph.AddConstraint(5, 3);
+  islands_graph.AddConstraint(3, 1);
+  islands_graph.AddConstraint(5, 4, 3);
+  islands_graph.AddConstraint(1, 6, 3);  // Cluster 1 already existed.
+  const std::vector<std::vector<int>> expected_islands = {
+      {0, 2, 4}, {1}, {3}};
+  EXPECT_EQ(islands_graph.CalcIslands(), expected_islands);
+
+  // A graph without constraints has no islands.
+  EXPECT_TRUE(ContactProblemGraph(3).CalcIslands().empty());
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
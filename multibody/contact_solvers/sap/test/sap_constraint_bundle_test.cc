@@ -1,5 +1,6 @@
 #include "drake/multibody/contact_solvers/sap/sap_constraint_bundle.h"
 
+#include <cmath>
 #include <memory>
 
 #include <gtest/gtest.h>
@@ -262,6 +263,108 @@ TEST_F(SapConstraintBundleTest, ProjectImpulses) {
   }
 }
 
+// Verify that CalcRegularizerCostAlongLine() agrees with evaluating the
+// projection and the Hessian at vc(α) = vc + α⋅Δvc.
+TEST_F(SapConstraintBundleTest, CalcRegularizerCostAlongLine) {
+  const int nk = problem_->num_constraint_equations();
+  const VectorXd& R = bundle_->R();
+  const VectorXd vc = VectorXd::LinSpaced(nk, -1.0, 5.0);
+  const VectorXd dvc = VectorXd::LinSpaced(nk, 3.0, -2.0);
+  SapConstraintBundle<double>::LineSearchWorkspace workspace;
+  for (const double alpha : {0.0, 0.3, 1.0, 1.5}) {
+    const VectorXd vc_alpha = vc + alpha * dvc;
+    VectorXd y(nk);
+    bundle_->CalcUnprojectedImpulses(vc_alpha, &y);
+    VectorXd gamma(nk);
+    std::vector<MatrixXd> G(problem_->num_constraints());
+    bundle_->ProjectImpulsesAndCalcConstraintsHessian(y, &gamma, &G);
+    int offset = 0;
+    double d2ell_expected = 0;
+    for (const MatrixXd& G_i : G) {
+      const int ni = G_i.rows();
+      const auto dvc_i = dvc.segment(offset, ni);
+      d2ell_expected += dvc_i.dot(G_i * dvc_i);
+      offset += ni;
+    }
+    const double ell_expected = 0.5 * gamma.dot(R.asDiagonal() * gamma);
+    const double dell_expected = -dvc.dot(gamma);
+
+    double dell{NAN};
+    double d2ell{NAN};
+    const double ell = bundle_->CalcRegularizerCostAlongLine(
+        vc, dvc, alpha, &workspace, &dell, &d2ell);
+    const double kTolerance = 8 * std::numeric_limits<double>::epsilon();
+    EXPECT_NEAR(ell, ell_expected, kTolerance * ell_expected);
+    EXPECT_NEAR(dell, dell_expected, kTolerance * std::abs(dell_expected));
+    EXPECT_NEAR(d2ell, d2ell_expected, kTolerance * d2ell_expected);
+
+    // Derivatives are optional.
+    EXPECT_EQ(
+        bundle_->CalcRegularizerCostAlongLine(vc, dvc, alpha, &workspace), ell);
+  }
+}
+
+// Verify that projections are correctly composed when there are enough
+// constraints for them to be computed concurrently.
+GTEST_TEST(SapConstraintBundleLargeTest, ProjectImpulses) {
+  const int num_cliques = 3;
+  std::vector<MatrixXd> A = {MatrixXd::Ones(1, 1), MatrixXd::Ones(2, 2),
+                             MatrixXd::Ones(3, 3)};
+  SapContactProblem<double> problem(1.0e-3, std::move(A),
+                                    VectorXd::LinSpaced(6, 1., 6.));
+  const int num_constraints = 500;
+  for (int i = 0; i < num_constraints; ++i) {
+    const int clique0 = i % num_cliques;
+    const int clique1 = (i / num_cliques) % num_cliques;
+    const int size = 1 + i % 4;
+    const double param = 1.0 + i;
+    if (clique0 == clique1) {
+      problem.AddConstraint(
+          std::make_unique<TestConstraint>(clique0, size, param));
+    } else {
+      problem.AddConstraint(
+          std::make_unique<TestConstraint>(clique0, clique1, size, param));
+    }
+  }
+  const SapConstraintBundle<double> bundle(
+      &problem, VectorXd::Ones(num_constraints));
+  const int nk = bundle.num_constraint_equations();
+  const VectorXd y = VectorXd::LinSpaced(nk, -3., 5.);
+  VectorXd gamma(nk);
+  std::vector<MatrixXd> G(num_constraints);
+  bundle.ProjectImpulsesAndCalcConstraintsHessian(y, &gamma, &G);
+
+  // Constraints in the bundle are sorted according to the graph and therefore
+  // we map their impulses back to the original order to verify each
+  // projection. For TestConstraint we expect γᵢ = paramᵢ⋅Rᵢ⋅yᵢ and
+  // Gᵢ = paramᵢ⋅Iᵢ.
+  VectorXd params(nk);
+  int offset = 0;
+  for (const ContactProblemGraph::ConstraintCluster& e :
+       problem.graph().clusters()) {
+    for (int i : e.constraint_index()) {
+      const int ni = problem.get_constraint(i).num_constraint_equations();
+      params.segment(offset, ni).setConstant(1.0 + i);
+      offset += ni;
+    }
+  }
+  const VectorXd gamma_expected =
+      params.array() * bundle.R().array() * y.array();
+  EXPECT_TRUE(CompareMatrices(gamma, gamma_expected,
+                              std::numeric_limits<double>::epsilon(),
+                              MatrixCompareType::relative));
+  offset = 0;
+  for (int k = 0; k < num_constraints; ++k) {
+    const int ni = G[k].rows();
+    EXPECT_TRUE(CompareMatrices(G[k],
+                                params(offset) * MatrixXd::Identity(ni, ni),
+                                std::numeric_limits<double>::epsilon(),
+                                MatrixCompareType::relative));
+    offset += ni;
+  }
+  EXPECT_EQ(offset, nk);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
@@ -1,6 +1,7 @@
 #include "drake/multibody/contact_solvers/sap/sap_constraint.h"
 
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -139,6 +140,34 @@ GTEST_TEST(SapConstraint, TwoCliquesConstraintClone) {
   EXPECT_EQ(clone->second_clique_jacobian(), J34);
 }
 
+GTEST_TEST(SapConstraint, CloneWithRemappedCliques) {
+  const std::vector<int> clique_map = {-1, 2, -1, 0, 1};
+  TestConstraint single(4, Vector3d(1., 2., 3), J32);
+  std::unique_ptr<SapConstraint<double>> clone =
+      single.CloneWithRemappedCliques(clique_map);
+  EXPECT_NE(dynamic_cast<TestConstraint*>(clone.get()), nullptr);
+  EXPECT_EQ(clone->num_cliques(), 1);
+  EXPECT_EQ(clone->first_clique(), 1);
+  EXPECT_EQ(clone->constraint_function(), Vector3d(1., 2., 3));
+  EXPECT_EQ(clone->first_clique_jacobian(), J32);
+
+  TestConstraint pair(3, 1, Vector3d(1., 2., 3), J32, J34);
+  clone = pair.CloneWithRemappedCliques(clique_map);
+  EXPECT_EQ(clone->num_cliques(), 2);
+  EXPECT_EQ(clone->first_clique(), 0);
+  EXPECT_EQ(clone->second_clique(), 2);
+  EXPECT_EQ(clone->first_clique_jacobian(), J32);
+  EXPECT_EQ(clone->second_clique_jacobian(), J34);
+
+  // Cliques not in the map, or mapped to a negative index.
+  EXPECT_THROW(TestConstraint(5, Vector3d(1., 2., 3), J32)
+                   .CloneWithRemappedCliques(clique_map),
+               std::exception);
+  EXPECT_THROW(TestConstraint(3, 2, Vector3d(1., 2., 3), J32, J34)
+                   .CloneWithRemappedCliques(clique_map),
+               std::exception);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
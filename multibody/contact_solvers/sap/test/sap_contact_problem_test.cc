@@ -1,5 +1,8 @@
 #include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
 
+#include <memory>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/expect_throws_message.h"
@@ -253,6 +256,63 @@ GTEST_TEST(ContactProblem, Clone) {
   EXPECT_EQ(graph.num_constraint_equations(), 17);
 }
 
+GTEST_TEST(ContactProblem, MakeIslandProblems) {
+  // Cliques 0 and 4 form an island, cliques 1 and 3 form an island each and
+  // clique 2 is not constrained.
+  const double time_step = 0.01;
+  const std::vector<MatrixXd> A{S22, S33, S44, S22, S33};
+  const VectorXd v_star = VectorXd::LinSpaced(14, 1.0, 14.0);
+  SapContactProblem<double> problem(time_step, A, v_star);
+  problem.AddConstraint(std::make_unique<TestConstraint>(
+      2 /* num_equations */, 4 /* first_clique */, 3 /* first_clique_nv */,
+      0 /* second_clique */, 2 /* second_clique_nv */));
+  problem.AddConstraint(std::make_unique<TestConstraint>(
+      1 /* num_equations */, 3 /* clique */, 2 /* clique_nv */));
+  problem.AddConstraint(std::make_unique<TestConstraint>(
+      3 /* num_equations */, 1 /* clique */, 3 /* clique_nv */));
+  problem.AddConstraint(std::make_unique<TestConstraint>(
+      1 /* num_equations */, 0 /* clique */, 2 /* clique_nv */));
+
+  const std::vector<std::vector<int>> islands = problem.graph().CalcIslands();
+  ASSERT_EQ(islands.size(), 3);
+  std::vector<std::vector<int>> island_cliques;
+  std::vector<std::vector<int>> island_constraints;
+  const std::vector<std::unique_ptr<SapContactProblem<double>>> problems =
+      problem.MakeIslandProblems(islands, &island_cliques, &island_constraints);
+  ASSERT_EQ(problems.size(), 3);
+  const std::vector<std::vector<int>> expected_cliques = {{0, 4}, {3}, {1}};
+  const std::vector<std::vector<int>> expected_constraints = {
+      {0, 3}, {1}, {2}};
+  EXPECT_EQ(island_cliques, expected_cliques);
+  EXPECT_EQ(island_constraints, expected_constraints);
+
+  // Island {0, 4}.
+  const SapContactProblem<double>& island = *problems[0];
+  EXPECT_EQ(island.time_step(), time_step);
+  EXPECT_EQ(island.num_cliques(), 2);
+  EXPECT_EQ(island.num_velocities(), 5);
+  EXPECT_EQ(island.dynamics_matrix()[0], S22);
+  EXPECT_EQ(island.dynamics_matrix()[1], S33);
+  const VectorXd expected_v_star =
+      (VectorXd(5) << v_star.segment(0, 2), v_star.segment(11, 3)).finished();
+  EXPECT_EQ(island.v_star(), expected_v_star);
+  EXPECT_EQ(island.num_constraints(), 2);
+  EXPECT_EQ(island.num_constraint_equations(), 3);
+  EXPECT_EQ(island.get_constraint(0).first_clique(), 1);
+  EXPECT_EQ(island.get_constraint(0).second_clique(), 0);
+  EXPECT_EQ(island.get_constraint(1).first_clique(), 0);
+  EXPECT_EQ(island.get_constraint(1).num_cliques(), 1);
+
+  // Single clique islands.
+  EXPECT_EQ(problems[1]->num_velocities(), 2);
+  EXPECT_EQ(problems[1]->v_star(), v_star.segment(9, 2));
+  EXPECT_EQ(problems[1]->num_constraint_equations(), 1);
+  EXPECT_EQ(problems[2]->num_velocities(), 3);
+  EXPECT_EQ(problems[2]->v_star(), v_star.segment(2, 3));
+  EXPECT_EQ(problems[2]->num_constraint_equations(), 3);
+  EXPECT_EQ(problems[2]->get_constraint(0).first_clique(), 0);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
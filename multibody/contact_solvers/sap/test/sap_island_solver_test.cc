@@ -0,0 +1,169 @@
+#include "drake/multibody/contact_solvers/sap/sap_island_solver.h"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/contact_solvers/sap/sap_friction_cone_constraint.h"
+#include "drake/multibody/contact_solvers/sap/sap_solver.h"
+
+using Eigen::Matrix3d;
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+constexpr double kTimeStep = 0.01;
+constexpr double kGravity = 10.0;
+
+/* Makes a problem with `num_stacks` disjoint stacks of point masses resting on
+ the ground, the k-th stack with k + 1 points. Each point is a clique with
+ three degrees of freedom. The bottom point of each stack is in contact with
+ the ground and the remaining points with the point below. Stacks are
+ interleaved in the clique numbering, so that islands are not contiguous, and
+ the last clique is a free point in no island. */
+SapContactProblem<double> MakeStacksProblem(int num_stacks) {
+  std::vector<std::vector<int>> stacks(num_stacks);
+  int num_cliques = 0;
+  for (int level = 0; level < num_stacks; ++level) {
+    for (int s = level; s < num_stacks; ++s) {
+      stacks[s].push_back(num_cliques++);
+    }
+  }
+  const int free_clique = num_cliques++;
+
+  std::vector<MatrixXd> A(num_cliques);
+  VectorXd v_star(3 * num_cliques);
+  for (int c = 0; c < num_cliques; ++c) {
+    const double mass = 1.0 + 0.1 * c;
+    A[c] = mass * Matrix3d::Identity();
+    // Free motion from rest, with a small tangential velocity.
+    v_star.segment<3>(3 * c) = Vector3d(0.01 * c, -0.02, -kGravity * kTimeStep);
+  }
+  v_star.segment<3>(3 * free_clique) = Vector3d(1.0, 2.0, 3.0);
+
+  SapContactProblem<double> problem(kTimeStep, std::move(A), std::move(v_star));
+  SapFrictionConeConstraint<double>::Parameters parameters;
+  parameters.mu = 0.5;
+  parameters.stiffness = 1.0e5;
+  parameters.dissipation_time_scale = 0.01;
+  const MatrixXd J = Matrix3d::Identity();
+  for (const std::vector<int>& stack : stacks) {
+    problem.AddConstraint(std::make_unique<SapFrictionConeConstraint<double>>(
+        stack[0], J, -1.0e-4, parameters));
+    for (int k = 1; k < static_cast<int>(stack.size()); ++k) {
+      problem.AddConstraint(std::make_unique<SapFrictionConeConstraint<double>>(
+          stack[k], stack[k - 1], J, -J, -1.0e-4, parameters));
+    }
+  }
+  return problem;
+}
+
+GTEST_TEST(SapIslandSolver, DisjointStacks) {
+  const int num_stacks = 5;
+  const SapContactProblem<double> problem = MakeStacksProblem(num_stacks);
+  const VectorXd v_guess = VectorXd::Zero(problem.num_velocities());
+  SapSolverParameters parameters;
+  parameters.rel_tolerance = 1.0e-10;
+
+  SapSolver<double> sap;
+  sap.set_parameters(parameters);
+  SapSolverResults<double> expected;
+  ASSERT_EQ(sap.SolveWithGuess(problem, v_guess, &expected),
+            SapSolverStatus::kSuccess);
+
+  SapIslandSolver<double> island_sap;
+  island_sap.set_parameters(parameters);
+  SapSolverResults<double> results;
+  ASSERT_EQ(island_sap.SolveWithGuess(problem, v_guess, &results),
+            SapSolverStatus::kSuccess);
+  EXPECT_EQ(island_sap.num_islands(), num_stacks);
+
+  const double kTolerance = 1.0e-8;
+  EXPECT_TRUE(CompareMatrices(results.v, expected.v,
+                              kTolerance * expected.v.norm()));
+  EXPECT_TRUE(CompareMatrices(results.j, expected.j,
+                              kTolerance * expected.j.norm()));
+  EXPECT_TRUE(CompareMatrices(results.gamma, expected.gamma,
+                              kTolerance * expected.gamma.norm()));
+  EXPECT_TRUE(CompareMatrices(results.vc, expected.vc,
+                              kTolerance * expected.v.norm()));
+  // The free point is not in any island.
+  EXPECT_EQ(results.v.tail<3>(), problem.v_star().tail<3>());
+  EXPECT_EQ(results.j.tail<3>(), Vector3d::Zero());
+
+  // Each island converges on its own. The single point on the ground (the
+  // first island) is the easiest problem.
+  for (int i = 0; i < num_stacks; ++i) {
+    EXPECT_GT(island_sap.get_island_statistics(i).num_iters, 0);
+    EXPECT_LE(island_sap.get_island_statistics(i).num_iters,
+              sap.get_statistics().num_iters);
+  }
+  EXPECT_LE(island_sap.get_island_statistics(0).num_iters,
+            island_sap.get_island_statistics(num_stacks - 1).num_iters);
+  EXPECT_THROW(island_sap.get_island_statistics(num_stacks), std::exception);
+
+  // A clone has the same parameters, but none of the islands' solvers.
+  const std::unique_ptr<SapIslandSolver<double>> clone = island_sap.Clone();
+  EXPECT_EQ(clone->num_islands(), 0);
+  SapSolverResults<double> clone_results;
+  ASSERT_EQ(clone->SolveWithGuess(problem, v_guess, &clone_results),
+            SapSolverStatus::kSuccess);
+  EXPECT_EQ(clone_results.v, results.v);
+
+  // The solver can be reused with a problem with fewer islands.
+  const SapContactProblem<double> small_problem = MakeStacksProblem(2);
+  ASSERT_EQ(island_sap.SolveWithGuess(
+                small_problem, VectorXd::Zero(small_problem.num_velocities()),
+                &results),
+            SapSolverStatus::kSuccess);
+  EXPECT_EQ(island_sap.num_islands(), 2);
+  EXPECT_EQ(results.v.size(), small_problem.num_velocities());
+}
+
+// A problem with a single island is solved as a whole.
+GTEST_TEST(SapIslandSolver, SingleIsland) {
+  const SapContactProblem<double> problem = MakeStacksProblem(1);
+  const VectorXd v_guess = VectorXd::Zero(problem.num_velocities());
+
+  SapSolver<double> sap;
+  SapSolverResults<double> expected;
+  ASSERT_EQ(sap.SolveWithGuess(problem, v_guess, &expected),
+            SapSolverStatus::kSuccess);
+
+  SapIslandSolver<double> island_sap;
+  SapSolverResults<double> results;
+  ASSERT_EQ(island_sap.SolveWithGuess(problem, v_guess, &results),
+            SapSolverStatus::kSuccess);
+  EXPECT_EQ(island_sap.num_islands(), 1);
+  EXPECT_EQ(results.v, expected.v);
+  EXPECT_EQ(results.gamma, expected.gamma);
+  EXPECT_EQ(island_sap.get_island_statistics(0).num_iters,
+            sap.get_statistics().num_iters);
+}
+
+GTEST_TEST(SapIslandSolver, NoConstraints) {
+  const SapContactProblem<double> problem(
+      kTimeStep, {Matrix3d::Identity(), 2.0 * Matrix3d::Identity()},
+      VectorXd::LinSpaced(6, 1.0, 6.0));
+  SapIslandSolver<double> island_sap;
+  SapSolverResults<double> results;
+  ASSERT_EQ(island_sap.SolveWithGuess(problem, VectorXd::Zero(6), &results),
+            SapSolverStatus::kSuccess);
+  EXPECT_EQ(island_sap.num_islands(), 1);
+  EXPECT_EQ(results.v, problem.v_star());
+  EXPECT_EQ(results.j, VectorXd::Zero(6));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
@@ -50,6 +50,24 @@ class SapSolverTester {
       const SapSolver<double>& sap, const systems::Context<double>& context) {
     return sap.CalcDenseHessian(context);
   }
+
+  // Computes the search direction at the state stored in `context` with dense
+  // algebra and evaluates the cost ℓ(α) along it, with its first and second
+  // derivatives. On output, dv stores the search direction.
+  // @pre sap uses dense algebra.
+  static double CalcCostAlongLine(const SapSolver<double>& sap,
+                                  const systems::Context<double>& context,
+                                  double alpha, VectorXd* dv,
+                                  double* dell_dalpha, double* d2ell_dalpha2) {
+    const SapModel<double>& model = *sap.model_;
+    SapSolver<double>::SearchDirectionData data(
+        model.num_velocities(), model.num_constraint_equations());
+    sap.CalcSearchDirectionData(context, nullptr, &data);
+    *dv = data.dv;
+    SapSolver<double>::LineSearchWorkspace workspace;
+    return sap.CalcCostAlongLine(context, data, alpha, &workspace,
+                                 dell_dalpha, d2ell_dalpha2);
+  }
 };
 
 constexpr double kEps = std::numeric_limits<double>::epsilon();
@@ -1029,6 +1047,74 @@ TEST_P(SapNewtonIterationTest, GuessOutsideLimits) {
   CompareDenseAgainstSupernodal(v_guess);
 }
 
+// Verify the incremental evaluation of the cost along the search direction
+// used by the line search against a direct evaluation of the model at
+// v(α) = v + α⋅Δv.
+TEST_P(SapNewtonIterationTest, CostAlongLine) {
+  SapSolver<double> sap;
+  SapSolverParameters params;
+  params.line_search_type = GetParam();
+  params.use_dense_algebra = true;
+  sap.set_parameters(params);
+  SapSolverResults<double> result;
+  // Solve once so that the solver makes its model for the problem.
+  ASSERT_EQ(sap.SolveWithGuess(*sap_problem_, v_star_, &result),
+            SapSolverStatus::kSuccess);
+
+  // Arbitrary state outside the constraint bounds, so that the cost is not
+  // quadratic along the search direction.
+  const SapModel<double>& model = SapSolverTester::model(sap);
+  const auto context = model.MakeContext();
+  VectorXd v_guess = v_star_;
+  v_guess.segment<3>(2) = Vector3d(1.2 * vl_(0), v_star_(1), 1.1 * vu_(2));
+  auto v = model.GetMutableVelocities(context.get());
+  model.velocities_permutation().Apply(v_guess, &v);
+  const VectorXd v0 = model.GetVelocities(*context);
+
+  const auto context_alpha = model.MakeContext();
+  for (const double alpha : {0.0, 0.25, 1.0, 1.5}) {
+    VectorXd dv;
+    double dell{NAN};
+    double d2ell{NAN};
+    const double ell = SapSolverTester::CalcCostAlongLine(
+        sap, *context, alpha, &dv, &dell, &d2ell);
+
+    model.SetVelocities(v0 + alpha * dv, context_alpha.get());
+    const double ell_expected = model.EvalCost(*context_alpha);
+    const double dell_expected =
+        model.EvalCostGradient(*context_alpha).dot(dv);
+    const MatrixXd H = SapSolverTester::CalcDenseHessian(sap, *context_alpha);
+    const double d2ell_expected = dv.dot(H * dv);
+    EXPECT_NEAR(ell, ell_expected, 1.0e-14 * ell_expected);
+    EXPECT_NEAR(dell, dell_expected, 1.0e-12 * std::abs(ell_expected));
+    EXPECT_NEAR(d2ell, d2ell_expected, 1.0e-12 * d2ell_expected);
+  }
+}
+
+// Verify the time spent in each phase is reported.
+TEST_P(SapNewtonIterationTest, TimeStatistics) {
+  SapSolver<double> sap;
+  SapSolverParameters params;
+  params.line_search_type = GetParam();
+  sap.set_parameters(params);
+  VectorXd v_guess = v_star_;
+  v_guess.segment<3>(2) = Vector3d(1.2 * vl_(0), v_star_(1), 1.1 * vu_(2));
+  SapSolverResults<double> result;
+  ASSERT_EQ(sap.SolveWithGuess(*sap_problem_, v_guess, &result),
+            SapSolverStatus::kSuccess);
+
+  const SapSolver<double>::SolverStats& stats = sap.get_statistics();
+  EXPECT_GT(stats.num_iters, 1);
+  EXPECT_GT(stats.model_time, 0.0);
+  EXPECT_GT(stats.gradient_time, 0.0);
+  EXPECT_GT(stats.hessian_time, 0.0);
+  EXPECT_GT(stats.factorization_time, 0.0);
+  EXPECT_GT(stats.line_search_time, 0.0);
+  EXPECT_LE(stats.model_time + stats.gradient_time + stats.hessian_time +
+                stats.factorization_time + stats.line_search_time,
+            stats.total_time);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     TestLineSearchMethods, SapNewtonIterationTest,
     testing::Values(SapSolverParameters::LineSearchType::kBackTracking,
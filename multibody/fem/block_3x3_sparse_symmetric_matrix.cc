@@ -0,0 +1,137 @@
+#include "drake/multibody/fem/block_3x3_sparse_symmetric_matrix.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+
+Block3x3SparseSymmetricMatrix::Block3x3SparseSymmetricMatrix(
+    std::vector<std::vector<int>> sparsity_pattern)
+    : sparsity_pattern_(std::move(sparsity_pattern)) {
+  const int n = sparsity_pattern_.size();
+  column_starts_.resize(n + 1);
+  column_starts_[0] = 0;
+  for (int j = 0; j < n; ++j) {
+    const std::vector<int>& row_indices = sparsity_pattern_[j];
+    DRAKE_DEMAND(!row_indices.empty() && row_indices[0] == j);
+    DRAKE_DEMAND(std::is_sorted(row_indices.begin(), row_indices.end()));
+    DRAKE_DEMAND(row_indices.back() < n);
+    column_starts_[j + 1] = column_starts_[j] + row_indices.size();
+  }
+  blocks_.resize(column_starts_[n], Matrix3<double>::Zero());
+}
+
+int Block3x3SparseSymmetricMatrix::FindBlock(int i, int j) const {
+  DRAKE_ASSERT(0 <= j && j <= i && i < block_rows());
+  const std::vector<int>& row_indices = sparsity_pattern_[j];
+  const auto it = std::lower_bound(row_indices.begin(), row_indices.end(), i);
+  if (it == row_indices.end() || *it != i) return -1;
+  return it - row_indices.begin();
+}
+
+void Block3x3SparseSymmetricMatrix::SetZero() {
+  for (Matrix3<double>& b : blocks_) {
+    b.setZero();
+  }
+}
+
+void Block3x3SparseSymmetricMatrix::AddToBlock(
+    const Eigen::Ref<const VectorX<int>>& block_indices,
+    const Eigen::Ref<const MatrixX<double>>& block) {
+  const int num_indices = block_indices.size();
+  DRAKE_ASSERT(block.rows() == 3 * num_indices);
+  DRAKE_ASSERT(block.cols() == 3 * num_indices);
+  for (int a = 0; a < num_indices; ++a) {
+    for (int b = 0; b < num_indices; ++b) {
+      const int i = block_indices(a);
+      const int j = block_indices(b);
+      /* Only the lower triangular blocks are stored. The upper triangular
+       entries in `block` are the transpose of the lower ones by symmetry. */
+      if (i < j) continue;
+      const int k = FindBlock(i, j);
+      if (k < 0) {
+        throw std::logic_error(fmt::format(
+            "Block3x3SparseSymmetricMatrix::AddToBlock(): block ({}, {}) is "
+            "not in the sparsity pattern.",
+            i, j));
+      }
+      mutable_block(j, k) += block.template block<3, 3>(3 * a, 3 * b);
+    }
+  }
+}
+
+void Block3x3SparseSymmetricMatrix::Multiply(
+    const Eigen::Ref<const VectorX<double>>& x,
+    EigenPtr<VectorX<double>> y) const {
+  DRAKE_DEMAND(x.size() == cols());
+  DRAKE_DEMAND(y != nullptr);
+  DRAKE_DEMAND(y->size() == rows());
+  y->setZero();
+  for (int j = 0; j < block_cols(); ++j) {
+    const std::vector<int>& row_indices = sparsity_pattern_[j];
+    const auto xj = x.template segment<3>(3 * j);
+    /* Diagonal block. */
+    y->template segment<3>(3 * j).noalias() += diagonal_block(j) * xj;
+    /* Off-diagonal blocks contribute to both the (i, j) and the (j, i)
+     entries. */
+    for (int k = 1; k < static_cast<int>(row_indices.size()); ++k) {
+      const int i = row_indices[k];
+      const Matrix3<double>& Aij = block(j, k);
+      y->template segment<3>(3 * i).noalias() += Aij * xj;
+      y->template segment<3>(3 * j).noalias() +=
+          Aij.transpose() * x.template segment<3>(3 * i);
+    }
+  }
+}
+
+void Block3x3SparseSymmetricMatrix::ZeroRowsAndColumns(
+    const std::vector<int>& indexes, double value) {
+  if (indexes.empty()) return;
+  std::vector<bool> is_zeroed(rows(), false);
+  for (int index : indexes) {
+    DRAKE_DEMAND(0 <= index && index < rows());
+    is_zeroed[index] = true;
+  }
+  for (int j = 0; j < block_cols(); ++j) {
+    const std::vector<int>& row_indices = sparsity_pattern_[j];
+    for (int k = 0; k < static_cast<int>(row_indices.size()); ++k) {
+      const int i = row_indices[k];
+      Matrix3<double>& Aij = mutable_block(j, k);
+      for (int d = 0; d < 3; ++d) {
+        if (is_zeroed[3 * i + d]) Aij.row(d).setZero();
+        if (is_zeroed[3 * j + d]) Aij.col(d).setZero();
+      }
+      if (i == j) {
+        for (int d = 0; d < 3; ++d) {
+          if (is_zeroed[3 * j + d]) Aij(d, d) = value;
+        }
+      }
+    }
+  }
+}
+
+MatrixX<double> Block3x3SparseSymmetricMatrix::MakeDenseMatrix() const {
+  MatrixX<double> A = MatrixX<double>::Zero(rows(), cols());
+  for (int j = 0; j < block_cols(); ++j) {
+    const std::vector<int>& row_indices = sparsity_pattern_[j];
+    for (int k = 0; k < static_cast<int>(row_indices.size()); ++k) {
+      const int i = row_indices[k];
+      A.template block<3, 3>(3 * i, 3 * j) = block(j, k);
+      if (i != j) {
+        A.template block<3, 3>(3 * j, 3 * i) = block(j, k).transpose();
+      }
+    }
+  }
+  return A;
+}
+
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
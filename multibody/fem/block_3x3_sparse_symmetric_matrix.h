@@ -0,0 +1,111 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+
+/* A symmetric block sparse matrix whose nonzero blocks are all 3x3. This is the
+ natural storage for the tangent matrix of an FEM model where each block
+ corresponds to the coupling between two nodes. Only the lower triangular part
+ (including the diagonal blocks) is stored, column by column, in the order of
+ increasing block row indexes. The sparsity pattern is fixed at construction
+ and all operations preserve it.
+
+ Unlike PetscSymmetricBlockSparseMatrix, this class doesn't copy the data into
+ an external library and its storage can be operated on directly by the native
+ linear solvers (see BlockSparseCholeskySolver and
+ BlockSparseConjugateGradient). Writing into blocks in the same block column
+ from multiple threads concurrently is not safe, but writing into disjoint
+ blocks is. */
+class Block3x3SparseSymmetricMatrix {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Block3x3SparseSymmetricMatrix);
+
+  /* Constructs a zero matrix with the given sparsity pattern.
+   @param sparsity_pattern  `sparsity_pattern[j]` lists the block row indexes i
+                            of the nonzero blocks (i, j) in the j-th block
+                            column with i >= j. The number of block rows and
+                            block columns is `sparsity_pattern.size()`.
+   @pre Each entry of `sparsity_pattern` is sorted in increasing order, has no
+        duplicates, starts with the diagonal block j, and has all entries less
+        than `sparsity_pattern.size()`. */
+  explicit Block3x3SparseSymmetricMatrix(
+      std::vector<std::vector<int>> sparsity_pattern);
+
+  int rows() const { return 3 * block_cols(); }
+  int cols() const { return 3 * block_cols(); }
+  int block_rows() const { return block_cols(); }
+  int block_cols() const { return sparsity_pattern_.size(); }
+
+  /* Returns the number of stored (lower triangular) nonzero blocks. */
+  int num_blocks() const { return blocks_.size(); }
+
+  /* Returns the sparsity pattern provided at construction. */
+  const std::vector<std::vector<int>>& sparsity_pattern() const {
+    return sparsity_pattern_;
+  }
+
+  /* Returns the position k of the block (i, j), i >= j, in the j-th block
+   column, i.e. sparsity_pattern()[j][k] == i, or -1 if the block is not in the
+   sparsity pattern. */
+  int FindBlock(int i, int j) const;
+
+  /* Returns the k-th stored block in the j-th block column, i.e. block
+   (sparsity_pattern()[j][k], j).
+   @pre 0 <= j < block_cols() and 0 <= k < sparsity_pattern()[j].size(). */
+  const Matrix3<double>& block(int j, int k) const {
+    return blocks_[column_starts_[j] + k];
+  }
+  Matrix3<double>& mutable_block(int j, int k) {
+    return blocks_[column_starts_[j] + k];
+  }
+
+  /* Returns the diagonal block (j, j). */
+  const Matrix3<double>& diagonal_block(int j) const { return block(j, 0); }
+
+  /* Sets all blocks to zero while maintaining the sparsity pattern. */
+  void SetZero();
+
+  /* Accumulates the dense symmetric matrix `block` into the block rows and
+   block columns given by `block_indices`. Semantically equivalent to
+   PetscSymmetricBlockSparseMatrix::AddToBlock() with a block size of 3.
+   @pre block.rows() == block.cols() == 3 * block_indices.size().
+   @pre Every block (block_indices(a), block_indices(b)) is in the sparsity
+        pattern (or its transpose is).
+   @throws std::exception if a block is not in the sparsity pattern. */
+  void AddToBlock(const Eigen::Ref<const VectorX<int>>& block_indices,
+                  const Eigen::Ref<const MatrixX<double>>& block);
+
+  /* Performs y = A * x, where A is this matrix.
+   @pre x.size() == cols(), y != nullptr, and y->size() == rows(). */
+  void Multiply(const Eigen::Ref<const VectorX<double>>& x,
+                EigenPtr<VectorX<double>> y) const;
+
+  /* Zeros out all rows and columns whose (scalar) index is included in
+   `indexes` and sets the diagonal entry of these rows and columns to `value`.
+   This operation doesn't change the sparsity pattern.
+   @pre 0 <= indexes[i] < rows() for each i. */
+  void ZeroRowsAndColumns(const std::vector<int>& indexes, double value);
+
+  /* Makes a dense representation of this matrix. Expensive; this is meant for
+   testing and debugging. */
+  MatrixX<double> MakeDenseMatrix() const;
+
+ private:
+  std::vector<std::vector<int>> sparsity_pattern_;
+  /* The blocks of the j-th column are stored contiguously in
+   blocks_[column_starts_[j]], ..., blocks_[column_starts_[j + 1] - 1]. */
+  std::vector<int> column_starts_;
+  std::vector<Matrix3<double>> blocks_;
+};
+
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
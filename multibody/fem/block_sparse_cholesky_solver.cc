@@ -0,0 +1,304 @@
+#include "drake/multibody/fem/block_sparse_cholesky_solver.h"
+
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+
+void BlockSparseCholeskySolver::AnalyzePattern(
+    const Block3x3SparseSymmetricMatrix& A) {
+  analyzed_ = false;
+  factored_ = false;
+  sparsity_pattern_ = A.sparsity_pattern();
+  const int n = sparsity_pattern_.size();
+
+  std::vector<std::vector<int>> factor_pattern;
+  ComputeOrderingAndFactorPattern(sparsity_pattern_, &factor_pattern);
+
+  /* Group consecutive columns into (fundamental) supernodes. Column j joins
+   the supernode of column j-1 if j is the parent of j-1 in the elimination
+   tree and the two columns have the same sparsity pattern below j. */
+  supernodes_.clear();
+  col_to_supernode_.resize(n);
+  num_factor_blocks_ = 0;
+  for (int j = 0; j < n; ++j) {
+    num_factor_blocks_ += 1 + factor_pattern[j].size();
+    const bool extends_previous =
+        j > 0 && !factor_pattern[j - 1].empty() &&
+        factor_pattern[j - 1][0] == j &&
+        factor_pattern[j - 1].size() == factor_pattern[j].size() + 1;
+    if (!extends_previous) {
+      Supernode supernode;
+      supernode.first_col = j;
+      supernodes_.emplace_back(std::move(supernode));
+    }
+    supernodes_.back().last_col = j + 1;
+    col_to_supernode_[j] = supernodes_.size() - 1;
+  }
+  const int num_supernodes = supernodes_.size();
+  for (int s = 0; s < num_supernodes; ++s) {
+    Supernode& supernode = supernodes_[s];
+    supernode.rows = std::move(factor_pattern[supernode.last_col - 1]);
+    /* Every supernode whose rows intersect the columns of a later supernode
+     contributes to that supernode's columns. Since the rows are sorted, the
+     target supernodes are visited in nondecreasing order. */
+    int last_target = -1;
+    for (int i : supernode.rows) {
+      const int target = col_to_supernode_[i];
+      if (target != last_target) {
+        supernodes_[target].descendants.push_back(s);
+        last_target = target;
+      }
+    }
+  }
+
+  panels_.resize(num_supernodes);
+  for (int s = 0; s < num_supernodes; ++s) {
+    const Supernode& supernode = supernodes_[s];
+    const int w = supernode.width();
+    panels_[s].resize(3 * (w + supernode.rows.size()), 3 * w);
+  }
+
+  /* Record where each block of the input matrix goes in the panels. */
+  scatter_map_.clear();
+  scatter_map_.reserve(A.num_blocks());
+  for (int j = 0; j < n; ++j) {
+    for (int i : sparsity_pattern_[j]) {
+      const int pi = inverse_permutation_[i];
+      const int pj = inverse_permutation_[j];
+      const int row = std::max(pi, pj);
+      const int col = std::min(pi, pj);
+      ScatterEntry entry;
+      entry.supernode = col_to_supernode_[col];
+      const Supernode& supernode = supernodes_[entry.supernode];
+      entry.panel_row = PanelRow(supernode, row);
+      entry.panel_col = col - supernode.first_col;
+      entry.transpose = pi < pj;
+      scatter_map_.push_back(entry);
+    }
+  }
+  analyzed_ = true;
+}
+
+bool BlockSparseCholeskySolver::Factor(const Block3x3SparseSymmetricMatrix& A) {
+  DRAKE_DEMAND(is_analyzed_for(A));
+  factored_ = false;
+  for (MatrixX<double>& panel : panels_) {
+    panel.setZero();
+  }
+  /* Scatter the (permuted) lower triangular part of A into the panels. */
+  int b = 0;
+  for (int j = 0; j < A.block_cols(); ++j) {
+    const int num_blocks_in_column = sparsity_pattern_[j].size();
+    for (int k = 0; k < num_blocks_in_column; ++k, ++b) {
+      const ScatterEntry& entry = scatter_map_[b];
+      auto destination = panels_[entry.supernode].block<3, 3>(
+          3 * entry.panel_row, 3 * entry.panel_col);
+      if (entry.transpose) {
+        destination += A.block(j, k).transpose();
+      } else {
+        destination += A.block(j, k);
+      }
+    }
+  }
+
+  /* Left-looking supernodal factorization. `relative_index[i]` stores the
+   block row offset of the block row i into the panel of the supernode being
+   factored. */
+  std::vector<int> relative_index(block_cols(), -1);
+  MatrixX<double> update;
+  for (int s = 0; s < num_supernodes(); ++s) {
+    const Supernode& supernode = supernodes_[s];
+    MatrixX<double>& panel = panels_[s];
+    const int w = supernode.width();
+    const int num_rows = supernode.rows.size();
+    for (int c = supernode.first_col; c < supernode.last_col; ++c) {
+      relative_index[c] = c - supernode.first_col;
+    }
+    for (int k = 0; k < num_rows; ++k) {
+      relative_index[supernode.rows[k]] = w + k;
+    }
+
+    /* Subtract the contributions L_d⋅L_dᵀ from all descendants d. */
+    for (int d : supernode.descendants) {
+      const Supernode& descendant = supernodes_[d];
+      const MatrixX<double>& descendant_panel = panels_[d];
+      const std::vector<int>& rows = descendant.rows;
+      const int k0 = std::distance(
+          rows.begin(),
+          std::lower_bound(rows.begin(), rows.end(), supernode.first_col));
+      const int k1 = std::distance(
+          rows.begin(),
+          std::lower_bound(rows.begin(), rows.end(), supernode.last_col));
+      const int nr = rows.size() - k0;
+      const int nc = k1 - k0;
+      const int offset = 3 * (descendant.width() + k0);
+      update.noalias() = descendant_panel.middleRows(offset, 3 * nr) *
+                         descendant_panel.middleRows(offset, 3 * nc).transpose();
+      for (int c = 0; c < nc; ++c) {
+        const int panel_col = relative_index[rows[k0 + c]];
+        for (int r = c; r < nr; ++r) {
+          const int panel_row = relative_index[rows[k0 + r]];
+          panel.block<3, 3>(3 * panel_row, 3 * panel_col) -=
+              update.block<3, 3>(3 * r, 3 * c);
+        }
+      }
+    }
+
+    /* Factor the dense diagonal block in place and compute the off-diagonal
+     blocks as L_below = A_below⋅L_diag⁻ᵀ. */
+    Eigen::Ref<MatrixX<double>> diagonal = panel.topRows(3 * w);
+    const Eigen::LLT<Eigen::Ref<MatrixX<double>>> llt(diagonal);
+    if (llt.info() != Eigen::Success) return false;
+    auto below = panel.bottomRows(3 * num_rows);
+    diagonal.triangularView<Eigen::Lower>()
+        .transpose()
+        .solveInPlace<Eigen::OnTheRight>(below);
+  }
+  factored_ = true;
+  return true;
+}
+
+VectorX<double> BlockSparseCholeskySolver::Solve(
+    const Eigen::Ref<const VectorX<double>>& b) const {
+  VectorX<double> x = b;
+  SolveInPlace(&x);
+  return x;
+}
+
+void BlockSparseCholeskySolver::SolveInPlace(
+    EigenPtr<VectorX<double>> b) const {
+  DRAKE_DEMAND(b != nullptr);
+  if (!factored_) {
+    throw std::logic_error(
+        "BlockSparseCholeskySolver::SolveInPlace(): no valid factorization is "
+        "available. Call Factor() first.");
+  }
+  DRAKE_DEMAND(b->size() == 3 * block_cols());
+  const int n = block_cols();
+  VectorX<double> y(3 * n);
+  for (int i = 0; i < n; ++i) {
+    y.segment<3>(3 * i) = b->segment<3>(3 * permutation_[i]);
+  }
+  VectorX<double> below;
+  /* Forward substitution, L⋅z = y. */
+  for (int s = 0; s < num_supernodes(); ++s) {
+    const Supernode& supernode = supernodes_[s];
+    const MatrixX<double>& panel = panels_[s];
+    const int w = supernode.width();
+    const int num_rows = supernode.rows.size();
+    auto x = y.segment(3 * supernode.first_col, 3 * w);
+    panel.topRows(3 * w).triangularView<Eigen::Lower>().solveInPlace(x);
+    below.noalias() = panel.bottomRows(3 * num_rows) * x;
+    for (int k = 0; k < num_rows; ++k) {
+      y.segment<3>(3 * supernode.rows[k]) -= below.segment<3>(3 * k);
+    }
+  }
+  /* Backward substitution, Lᵀ⋅x = z. */
+  for (int s = num_supernodes() - 1; s >= 0; --s) {
+    const Supernode& supernode = supernodes_[s];
+    const MatrixX<double>& panel = panels_[s];
+    const int w = supernode.width();
+    const int num_rows = supernode.rows.size();
+    below.resize(3 * num_rows);
+    for (int k = 0; k < num_rows; ++k) {
+      below.segment<3>(3 * k) = y.segment<3>(3 * supernode.rows[k]);
+    }
+    auto x = y.segment(3 * supernode.first_col, 3 * w);
+    x.noalias() -= panel.bottomRows(3 * num_rows).transpose() * below;
+    panel.topRows(3 * w)
+        .triangularView<Eigen::Lower>()
+        .transpose()
+        .solveInPlace(x);
+  }
+  for (int i = 0; i < n; ++i) {
+    b->segment<3>(3 * permutation_[i]) = y.segment<3>(3 * i);
+  }
+}
+
+void BlockSparseCholeskySolver::ComputeOrderingAndFactorPattern(
+    const std::vector<std::vector<int>>& lower_pattern,
+    std::vector<std::vector<int>>* factor_pattern) {
+  const int n = lower_pattern.size();
+  /* The (symmetric) adjacency of the block graph, without self loops. */
+  std::vector<std::vector<int>> adjacency(n);
+  for (int j = 0; j < n; ++j) {
+    for (int i : lower_pattern[j]) {
+      if (i == j) continue;
+      adjacency[i].push_back(j);
+      adjacency[j].push_back(i);
+    }
+  }
+  for (std::vector<int>& neighbors : adjacency) {
+    std::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                    neighbors.end());
+  }
+
+  /* Minimum degree ordering on the elimination graph. Eliminating a node
+   connects all of its (uneliminated) neighbors into a clique; those neighbors
+   are exactly the sparsity pattern of the node's column in L. Ties are broken
+   by the node index so that the ordering is deterministic. */
+  std::set<std::pair<int, int>> degree_and_node;
+  for (int v = 0; v < n; ++v) {
+    degree_and_node.emplace(adjacency[v].size(), v);
+  }
+  permutation_.clear();
+  permutation_.reserve(n);
+  std::vector<std::vector<int>> eliminated_neighbors(n);
+  std::vector<int> merged;
+  while (!degree_and_node.empty()) {
+    const int v = degree_and_node.begin()->second;
+    degree_and_node.erase(degree_and_node.begin());
+    const std::vector<int>& clique = adjacency[v];
+    for (int u : clique) {
+      std::vector<int>& neighbors = adjacency[u];
+      degree_and_node.erase({static_cast<int>(neighbors.size()), u});
+      merged.clear();
+      std::set_union(neighbors.begin(), neighbors.end(), clique.begin(),
+                     clique.end(), std::back_inserter(merged));
+      neighbors.clear();
+      for (int w : merged) {
+        if (w != u && w != v) neighbors.push_back(w);
+      }
+      degree_and_node.emplace(neighbors.size(), u);
+    }
+    eliminated_neighbors[v] = std::move(adjacency[v]);
+    adjacency[v].clear();
+    permutation_.push_back(v);
+  }
+
+  inverse_permutation_.resize(n);
+  for (int i = 0; i < n; ++i) {
+    inverse_permutation_[permutation_[i]] = i;
+  }
+  factor_pattern->resize(n);
+  for (int i = 0; i < n; ++i) {
+    std::vector<int>& column = (*factor_pattern)[i];
+    column.clear();
+    for (int v : eliminated_neighbors[permutation_[i]]) {
+      column.push_back(inverse_permutation_[v]);
+    }
+    std::sort(column.begin(), column.end());
+  }
+}
+
+int BlockSparseCholeskySolver::PanelRow(const Supernode& supernode, int i) {
+  DRAKE_ASSERT(i >= supernode.first_col);
+  if (i < supernode.last_col) return i - supernode.first_col;
+  const auto it =
+      std::lower_bound(supernode.rows.begin(), supernode.rows.end(), i);
+  DRAKE_ASSERT(it != supernode.rows.end() && *it == i);
+  return supernode.width() + std::distance(supernode.rows.begin(), it);
+}
+
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
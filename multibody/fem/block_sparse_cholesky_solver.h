@@ -0,0 +1,144 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/fem/block_3x3_sparse_symmetric_matrix.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+
+/* A supernodal sparse Cholesky solver for symmetric positive definite matrices
+ stored as Block3x3SparseSymmetricMatrix.
+
+ The solver separates the symbolic analysis from the numerical factorization.
+ AnalyzePattern() computes a fill-reducing (minimum degree) ordering of the
+ block graph, the sparsity pattern of the Cholesky factor L, and groups columns
+ of L with identical sparsity into supernodes. Its result only depends on the
+ sparsity pattern of the matrix, so for FEM tangent matrices it is computed once
+ and reused across Newton iterations and time steps. Factor() then computes the
+ numerical factorization with dense kernels on each supernode (left-looking),
+ and Solve()/SolveInPlace() reuse the factorization for any number of
+ right-hand sides.
+
+ Example use case:
+
+   BlockSparseCholeskySolver solver;
+   solver.AnalyzePattern(A);
+   // For each Newton iteration:
+   //   ... update the values of A (but not its sparsity pattern) ...
+   if (!solver.Factor(A)) { ... }
+   solver.SolveInPlace(&b);  */
+class BlockSparseCholeskySolver {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BlockSparseCholeskySolver);
+
+  /* Constructs a solver with no symbolic analysis. */
+  BlockSparseCholeskySolver() = default;
+
+  /* Performs the symbolic analysis for matrices with the same sparsity pattern
+   as `A`. The values in `A` are not used. */
+  void AnalyzePattern(const Block3x3SparseSymmetricMatrix& A);
+
+  /* Returns true if the symbolic analysis has been performed for a matrix with
+   the same sparsity pattern as `A` so that Factor(A) can be called without
+   calling AnalyzePattern() first. */
+  bool is_analyzed_for(const Block3x3SparseSymmetricMatrix& A) const {
+    return analyzed_ && A.sparsity_pattern() == sparsity_pattern_;
+  }
+
+  /* Computes the numerical Cholesky factorization of `A`. Returns true on
+   success and false if `A` is found not to be (numerically) positive definite,
+   in which case the solver cannot be used for solving until the next
+   successful factorization.
+   @pre is_analyzed_for(A) is true. */
+  [[nodiscard]] bool Factor(const Block3x3SparseSymmetricMatrix& A);
+
+  /* Solves A⋅x = b and returns x, where A is the last successfully factored
+   matrix.
+   @throws std::exception if there's no valid factorization. */
+  VectorX<double> Solve(const Eigen::Ref<const VectorX<double>>& b) const;
+
+  /* Similar to Solve(), but writes the solution in `b`.
+   @pre b != nullptr. */
+  void SolveInPlace(EigenPtr<VectorX<double>> b) const;
+
+  /* The number of block columns in the analyzed matrix. */
+  int block_cols() const { return permutation_.size(); }
+
+  /* The number of supernodes found by the symbolic analysis. */
+  int num_supernodes() const { return supernodes_.size(); }
+
+  /* The number of 3x3 blocks in the lower triangular Cholesky factor L,
+   including the fill-in. */
+  int num_factor_blocks() const { return num_factor_blocks_; }
+
+ private:
+  /* A supernode is a set of consecutive (in the permuted ordering) block
+   columns of L that share the same sparsity pattern below their dense diagonal
+   block. */
+  struct Supernode {
+    /* The block columns [first_col, last_col) of L in the permuted ordering. */
+    int first_col{};
+    int last_col{};
+    /* The (sorted) block rows >= last_col that are nonzero in these
+     columns. */
+    std::vector<int> rows;
+    /* The indexes of the supernodes whose columns of L contribute to the
+     columns of this supernode in the left-looking factorization. */
+    std::vector<int> descendants;
+    int width() const { return last_col - first_col; }
+  };
+
+  /* The destination of the k-th block stored in the input matrix. */
+  struct ScatterEntry {
+    int supernode{};
+    /* Block row and block column offsets into the supernode's panel. */
+    int panel_row{};
+    int panel_col{};
+    /* Whether the block is transposed by the permutation. */
+    bool transpose{};
+  };
+
+  /* Computes a minimum degree ordering of the graph of the matrix and the
+   sparsity pattern of its Cholesky factor under that ordering. On return,
+   `permutation_` and `inverse_permutation_` are set and
+   `factor_pattern[j]` contains the sorted block rows i > j of the
+   nonzero blocks in column j of L (in the permuted ordering). */
+  void ComputeOrderingAndFactorPattern(
+      const std::vector<std::vector<int>>& lower_pattern,
+      std::vector<std::vector<int>>* factor_pattern);
+
+  /* Returns the block row offset of the block row `i` (in the permuted
+   ordering) into the panel of `supernode`. */
+  static int PanelRow(const Supernode& supernode, int i);
+
+  bool analyzed_{false};
+  bool factored_{false};
+  /* A copy of the sparsity pattern of the analyzed matrix. */
+  std::vector<std::vector<int>> sparsity_pattern_;
+  /* permutation_[i_new] = i_old and inverse_permutation_[i_old] = i_new. */
+  std::vector<int> permutation_;
+  std::vector<int> inverse_permutation_;
+  std::vector<Supernode> supernodes_;
+  /* col_to_supernode_[j] is the supernode containing block column j (in the
+   permuted ordering). */
+  std::vector<int> col_to_supernode_;
+  /* scatter_map_[b] is the destination of the b-th stored block of the input
+   matrix (in the storage order of Block3x3SparseSymmetricMatrix). */
+  std::vector<ScatterEntry> scatter_map_;
+  int num_factor_blocks_{0};
+  /* The dense panel of each supernode. The panel of supernode s has
+   3 * (width + rows.size()) rows and 3 * width columns. The top square part
+   stores the lower triangular diagonal factor and the bottom part stores the
+   off-diagonal blocks of L. */
+  std::vector<MatrixX<double>> panels_;
+};
+
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
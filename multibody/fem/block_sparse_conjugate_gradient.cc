@@ -0,0 +1,204 @@
+#include "drake/multibody/fem/block_sparse_conjugate_gradient.h"
+
+#include <algorithm>
+
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+
+bool BlockSparseConjugateGradient::Compute(
+    const Block3x3SparseSymmetricMatrix& A) {
+  const int n = A.block_cols();
+  switch (preconditioner_type_) {
+    case PreconditionerType::kNone:
+      return true;
+    case PreconditionerType::kBlockJacobi: {
+      inverse_diagonal_blocks_.resize(n);
+      for (int j = 0; j < n; ++j) {
+        /* The diagonal blocks of a positive definite matrix are positive
+         definite, so a failed factorization means `A` isn't either. */
+        const Eigen::LLT<Matrix3<double>> llt(A.diagonal_block(j));
+        if (llt.info() != Eigen::Success) {
+          drake::log()->debug(
+              "BlockSparseConjugateGradient: Diagonal block {} is not "
+              "positive definite.",
+              j);
+          return false;
+        }
+        inverse_diagonal_blocks_[j] = llt.solve(Matrix3<double>::Identity());
+      }
+      return true;
+    }
+    case PreconditionerType::kBlockIncompleteCholesky: {
+      /* Retry with an increasing diagonal shift if the incomplete
+       factorization breaks down. */
+      constexpr int kMaxNumShifts = 10;
+      double shift = 0.0;
+      for (int attempt = 0; attempt <= kMaxNumShifts; ++attempt) {
+        if (ComputeIncompleteCholesky(A, shift)) return true;
+        shift = (shift == 0.0) ? 1e-3 : 2.0 * shift;
+      }
+      drake::log()->debug(
+          "BlockSparseConjugateGradient: The block incomplete Cholesky "
+          "factorization failed.");
+      return false;
+    }
+  }
+  DRAKE_UNREACHABLE();
+}
+
+bool BlockSparseConjugateGradient::ComputeIncompleteCholesky(
+    const Block3x3SparseSymmetricMatrix& A, double shift) {
+  /* Only reallocate if the sparsity pattern changed. */
+  if (incomplete_factor_.sparsity_pattern() != A.sparsity_pattern()) {
+    incomplete_factor_ = A;
+  } else {
+    for (int j = 0; j < A.block_cols(); ++j) {
+      const int num_blocks_in_column = A.sparsity_pattern()[j].size();
+      for (int k = 0; k < num_blocks_in_column; ++k) {
+        incomplete_factor_.mutable_block(j, k) = A.block(j, k);
+      }
+    }
+  }
+  Block3x3SparseSymmetricMatrix& L = incomplete_factor_;
+  const std::vector<std::vector<int>>& pattern = L.sparsity_pattern();
+  /* Right-looking factorization that discards any fill-in outside of the
+   sparsity pattern of A. */
+  for (int j = 0; j < L.block_cols(); ++j) {
+    Matrix3<double>& Ljj = L.mutable_block(j, 0);
+    if (shift != 0.0) {
+      Ljj.diagonal() += shift * A.diagonal_block(j).diagonal();
+    }
+    const Eigen::LLT<Matrix3<double>> llt(Ljj);
+    if (llt.info() != Eigen::Success) return false;
+    Ljj = llt.matrixL();
+    const int num_blocks_in_column = pattern[j].size();
+    for (int k = 1; k < num_blocks_in_column; ++k) {
+      /* L_ij = A_ij⋅L_jj⁻ᵀ. */
+      Matrix3<double>& Lij = L.mutable_block(j, k);
+      Lij = llt.matrixU().solve<Eigen::OnTheRight>(Lij);
+    }
+    for (int b = 1; b < num_blocks_in_column; ++b) {
+      const int m = pattern[j][b];
+      for (int a = b; a < num_blocks_in_column; ++a) {
+        const int i = pattern[j][a];
+        const int k = L.FindBlock(i, m);
+        if (k < 0) continue;
+        L.mutable_block(m, k).noalias() -=
+            L.block(j, a) * L.block(j, b).transpose();
+      }
+    }
+  }
+  return true;
+}
+
+void BlockSparseConjugateGradient::ApplyPreconditioner(
+    const Eigen::Ref<const VectorX<double>>& r,
+    EigenPtr<VectorX<double>> z) const {
+  DRAKE_DEMAND(z != nullptr);
+  DRAKE_DEMAND(z->size() == r.size());
+  switch (preconditioner_type_) {
+    case PreconditionerType::kNone: {
+      *z = r;
+      return;
+    }
+    case PreconditionerType::kBlockJacobi: {
+      const int n = inverse_diagonal_blocks_.size();
+      DRAKE_DEMAND(3 * n == r.size());
+      for (int j = 0; j < n; ++j) {
+        z->segment<3>(3 * j).noalias() =
+            inverse_diagonal_blocks_[j] * r.segment<3>(3 * j);
+      }
+      return;
+    }
+    case PreconditionerType::kBlockIncompleteCholesky: {
+      const Block3x3SparseSymmetricMatrix& L = incomplete_factor_;
+      const std::vector<std::vector<int>>& pattern = L.sparsity_pattern();
+      const int n = L.block_cols();
+      DRAKE_DEMAND(3 * n == r.size());
+      *z = r;
+      /* Forward substitution, L⋅y = r. */
+      for (int j = 0; j < n; ++j) {
+        auto zj = z->segment<3>(3 * j);
+        L.diagonal_block(j).triangularView<Eigen::Lower>().solveInPlace(zj);
+        const int num_blocks_in_column = pattern[j].size();
+        for (int k = 1; k < num_blocks_in_column; ++k) {
+          z->segment<3>(3 * pattern[j][k]).noalias() -= L.block(j, k) * zj;
+        }
+      }
+      /* Backward substitution, Lᵀ⋅z = y. */
+      for (int j = n - 1; j >= 0; --j) {
+        auto zj = z->segment<3>(3 * j);
+        const int num_blocks_in_column = pattern[j].size();
+        for (int k = 1; k < num_blocks_in_column; ++k) {
+          zj.noalias() -=
+              L.block(j, k).transpose() * z->segment<3>(3 * pattern[j][k]);
+        }
+        L.diagonal_block(j)
+            .triangularView<Eigen::Lower>()
+            .transpose()
+            .solveInPlace(zj);
+      }
+      return;
+    }
+  }
+  DRAKE_UNREACHABLE();
+}
+
+bool BlockSparseConjugateGradient::Solve(
+    const Block3x3SparseSymmetricMatrix& A,
+    const Eigen::Ref<const VectorX<double>>& b,
+    EigenPtr<VectorX<double>> x) const {
+  DRAKE_DEMAND(x != nullptr);
+  DRAKE_DEMAND(b.size() == A.rows());
+  DRAKE_DEMAND(x->size() == A.rows());
+  num_iterations_ = 0;
+  const int n = b.size();
+  const int max_iterations = max_iterations_ > 0 ? max_iterations_ : n;
+  const double b_norm = b.norm();
+  if (b_norm == 0.0) {
+    x->setZero();
+    return true;
+  }
+  const double tolerance = relative_tolerance_ * b_norm;
+
+  r_.resize(n);
+  z_.resize(n);
+  p_.resize(n);
+  Ap_.resize(n);
+  A.Multiply(*x, &Ap_);
+  r_ = b - Ap_;
+  if (r_.norm() <= tolerance) return true;
+  ApplyPreconditioner(r_, &z_);
+  p_ = z_;
+  double rz = r_.dot(z_);
+  while (num_iterations_ < max_iterations) {
+    A.Multiply(p_, &Ap_);
+    const double pAp = p_.dot(Ap_);
+    if (pAp <= 0.0) {
+      drake::log()->debug(
+          "BlockSparseConjugateGradient: Encountered a direction of "
+          "nonpositive curvature.");
+      return false;
+    }
+    const double alpha = rz / pAp;
+    *x += alpha * p_;
+    r_ -= alpha * Ap_;
+    ++num_iterations_;
+    if (r_.norm() <= tolerance) return true;
+    ApplyPreconditioner(r_, &z_);
+    const double rz_next = r_.dot(z_);
+    const double beta = rz_next / rz;
+    rz = rz_next;
+    p_ = z_ + beta * p_;
+  }
+  return false;
+}
+
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/fem/block_3x3_sparse_symmetric_matrix.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+
+/* A preconditioned conjugate gradient solver for symmetric positive definite
+ matrices stored as Block3x3SparseSymmetricMatrix. All computations operate
+ directly on the block storage of the matrix.
+
+ Two block preconditioners are supported:
+  - kBlockJacobi: the inverse of the 3x3 diagonal blocks.
+  - kBlockIncompleteCholesky: a block incomplete Cholesky factorization with
+    zero fill-in (block IC(0)), i.e. the factor has the same sparsity pattern
+    as the lower triangular part of the matrix. If the incomplete factorization
+    breaks down, it is retried with an increasingly large diagonal shift
+    (Manteuffel, 1980).
+
+ The preconditioner storage is allocated based on the sparsity pattern of the
+ matrix and is reused as long as the pattern doesn't change.
+
+ Manteuffel, T. A. (1980). An incomplete factorization technique for positive
+ definite linear systems. Mathematics of computation, 34(150), 473-497. */
+class BlockSparseConjugateGradient {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BlockSparseConjugateGradient);
+
+  enum class PreconditionerType {
+    kNone,
+    kBlockJacobi,
+    kBlockIncompleteCholesky,
+  };
+
+  /* Constructs a solver with the given preconditioner. */
+  explicit BlockSparseConjugateGradient(
+      PreconditionerType preconditioner_type =
+          PreconditionerType::kBlockIncompleteCholesky)
+      : preconditioner_type_(preconditioner_type) {}
+
+  PreconditionerType preconditioner_type() const {
+    return preconditioner_type_;
+  }
+
+  /* Sets the relative tolerance. The iteration stops when ‖r‖ <= tol⋅‖b‖,
+   where r = b - A⋅x is the residual. The default value is 1e-5. */
+  void set_relative_tolerance(double tolerance) {
+    relative_tolerance_ = tolerance;
+  }
+  double relative_tolerance() const { return relative_tolerance_; }
+
+  /* Sets the maximum number of iterations. If nonpositive, the maximum number
+   of iterations is set to the size of the system. Defaults to zero. */
+  void set_max_iterations(int max_iterations) {
+    max_iterations_ = max_iterations;
+  }
+  int max_iterations() const { return max_iterations_; }
+
+  /* Computes the preconditioner for `A`. Must be called whenever the values of
+   `A` change before calling Solve(). Returns true on success and false if the
+   preconditioner can't be computed because `A` is found not to be
+   (numerically) positive definite: a diagonal block isn't positive definite
+   (block Jacobi), or the incomplete factorization still breaks down after the
+   largest diagonal shift (block IC(0)). After a failure, Solve() must not be
+   called until the next successful Compute(). */
+  [[nodiscard]] bool Compute(const Block3x3SparseSymmetricMatrix& A);
+
+  /* Solves A⋅x = b with the conjugate gradient method, where A is the matrix
+   last passed to Compute(). On input, `x` holds the initial guess. Returns
+   true if the iteration converged within the prescribed number of iterations.
+   @pre x != nullptr and x->size() == b.size() == A.rows().
+   @pre A is the same matrix (with the same values) last passed to Compute().
+   */
+  [[nodiscard]] bool Solve(const Block3x3SparseSymmetricMatrix& A,
+                           const Eigen::Ref<const VectorX<double>>& b,
+                           EigenPtr<VectorX<double>> x) const;
+
+  /* Returns the number of iterations taken by the last call to Solve(). */
+  int num_iterations() const { return num_iterations_; }
+
+  /* Applies the preconditioner, z = P⁻¹⋅r.
+   @pre Compute() has been called.
+   @pre z != nullptr and z->size() == r.size(). */
+  void ApplyPreconditioner(const Eigen::Ref<const VectorX<double>>& r,
+                           EigenPtr<VectorX<double>> z) const;
+
+ private:
+  /* Computes the block IC(0) factor of A + shift * diag(A). Returns false if
+   the factorization breaks down. */
+  bool ComputeIncompleteCholesky(const Block3x3SparseSymmetricMatrix& A,
+                                 double shift);
+
+  PreconditionerType preconditioner_type_{
+      PreconditionerType::kBlockIncompleteCholesky};
+  double relative_tolerance_{1e-5};
+  int max_iterations_{0};
+  mutable int num_iterations_{0};
+  /* The inverses of the diagonal blocks (block Jacobi). */
+  std::vector<Matrix3<double>> inverse_diagonal_blocks_;
+  /* The block IC(0) factor L with the sparsity pattern of the lower triangular
+   part of A. The diagonal blocks store the lower triangular Cholesky factors
+   of the pivots. */
+  Block3x3SparseSymmetricMatrix incomplete_factor_{
+      std::vector<std::vector<int>>{}};
+  /* Scratch vectors. */
+  mutable VectorX<double> r_, z_, p_, Ap_;
+};
+
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -102,6 +103,35 @@ class ConstitutiveModel {
     derived().CalcFirstPiolaStressDerivativeImpl(data, dPdF);
   }
 
+  /* The inputs and outputs of one evaluation of a constitutive model at
+   `num_locations` locations in CalcBatch(). */
+  struct BatchEntry {
+    /* The constitutive model to evaluate. */
+    const DerivedConstitutiveModel* model{};
+    /* The deformation gradients at the locations. */
+    const std::array<Matrix3<T>, num_locations>* deformation_gradient{};
+    /* The outputs. */
+    Data* data{};
+    std::array<T, num_locations>* Psi{};
+    std::array<Matrix3<T>, num_locations>* P{};
+    std::array<Eigen::Matrix<T, 9, 9>, num_locations>* dPdF{};
+  };
+
+  /* For each entry in `entries`, updates `data` with the given deformation
+   gradients and computes the energy density, the first Piola stress, and its
+   derivative with respect to the deformation gradient into `Psi`, `P` and
+   `dPdF` with the entry's `model`. This is equivalent to calling
+   Data::UpdateData() followed by CalcElasticEnergyDensity(),
+   CalcFirstPiolaStress() and CalcFirstPiolaStressDerivative() for each entry
+   (up to roundoff), but derived constitutive models may shadow CalcBatchImpl()
+   to evaluate many entries (e.g. the quadrature points of many elements) at
+   once, e.g. with SIMD instructions.
+   @pre All pointers in `entries` are non-null and the outputs of different
+   entries don't alias. */
+  static void CalcBatch(const std::vector<BatchEntry>& entries) {
+    DerivedConstitutiveModel::CalcBatchImpl(entries);
+  }
+
  protected:
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ConstitutiveModel);
 
@@ -138,6 +168,18 @@ class ConstitutiveModel {
                     NiceTypeName::Get(derived())));
   }
 
+  /* Derived classes may shadow this method to evaluate the entries of
+   CalcBatch() together. The default implementation evaluates them one at a
+   time. */
+  static void CalcBatchImpl(const std::vector<BatchEntry>& entries) {
+    for (const BatchEntry& entry : entries) {
+      entry.data->UpdateData(*entry.deformation_gradient);
+      entry.model->CalcElasticEnergyDensity(*entry.data, entry.Psi);
+      entry.model->CalcFirstPiolaStress(*entry.data, entry.P);
+      entry.model->CalcFirstPiolaStressDerivative(*entry.data, entry.dPdF);
+    }
+  }
+
  private:
   const DerivedConstitutiveModel& derived() const {
     return *static_cast<const DerivedConstitutiveModel*>(this);
@@ -0,0 +1,52 @@
+#include "drake/multibody/fem/corotated_batch_kernels.h"
+
+#include <cmath>
+
+#include "drake/multibody/fem/corotated_batch_kernels_lanes.h"
+
+/* Note that we do not include code from drake/common here so that we don't
+have to fight with Eigen regarding the enabling of AVX instructions. */
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+namespace {
+
+/* A single lane holding a plain double, for use with the kernels in
+corotated_batch_kernels_lanes.h. */
+struct PortableLanes {
+  using V = double;
+  using Mask = bool;
+  static constexpr int kWidth = 1;
+
+  static V Load(const double* x) { return *x; }
+  static void Store(double* x, V v) { *x = v; }
+  static V Broadcast(double d) { return d; }
+  static V MulAdd(V a, V b, V c) { return a * b + c; }
+  static V Sqrt(V a) { return std::sqrt(a); }
+  static V Abs(V a) { return std::abs(a); }
+  static V Select(Mask mask, V a, V b) { return mask ? a : b; }
+  static Mask Less(V a, V b) { return a < b; }
+  static Mask Equal(V a, V b) { return a == b; }
+  static Mask Or(Mask a, Mask b) { return a || b; }
+  static bool Any(Mask mask) { return mask; }
+  static Mask None() { return false; }
+};
+
+}  // namespace
+
+bool CalcCorotatedBatchPortable(const CorotatedBatchArrays& arrays) {
+  return corotated_batch::CalcBatch<PortableLanes>(arrays);
+}
+
+bool CalcCorotatedBatch(const CorotatedBatchArrays& arrays) {
+  static const bool use_avx = CorotatedBatchAvxSupported();
+  return use_avx ? CalcCorotatedBatchAvx(arrays)
+                 : CalcCorotatedBatchPortable(arrays);
+}
+
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "drake/multibody/fem/corotated_batch_kernels_avx2_fma.h"
+
+/* N.B. Do not include any other drake headers here because this file will be
+included by a compilation unit that may have a different opinion about whether
+SIMD instructions are enabled than Eigen does in the rest of Drake. */
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+
+/* Evaluates the fixed corotated constitutive model (see CorotatedModel) at all
+locations in `arrays`, which stores the inputs and outputs in
+structure-of-arrays layout (see CorotatedBatchArrays). The polar decomposition
+of the deformation gradients is computed with a branch-free Jacobi SVD instead
+of Eigen::JacobiSVD, and the results agree with the per-location computations
+in CorotatedModelData and CorotatedModel up to roundoff. The locations are
+evaluated four at a time with AVX2 instructions when
+CorotatedBatchAvxSupported() and one at a time otherwise.
+@returns false if the stress derivative is undefined at any location (see
+AddScaledRotationalDerivative()), in which case the outputs are unspecified. */
+bool CalcCorotatedBatch(const CorotatedBatchArrays& arrays);
+
+/* The portable implementation of CalcCorotatedBatch(), which is always
+available. It is exposed so that it can be tested (and benchmarked) regardless
+of whether it is used on this platform. */
+bool CalcCorotatedBatchPortable(const CorotatedBatchArrays& arrays);
+
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
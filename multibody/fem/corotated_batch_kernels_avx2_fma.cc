@@ -0,0 +1,85 @@
+#include "drake/multibody/fem/corotated_batch_kernels_avx2_fma.h"
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+
+#include "drake/multibody/fem/corotated_batch_kernels_lanes.h"
+#else
+#include <cstdlib>
+#include <iostream>
+#endif
+
+/* N.B. Do not include any other drake headers here because this file will be
+part of a compilation unit that may have a different opinion about whether SIMD
+instructions are enabled than Eigen does in the rest of Drake. */
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+
+#if defined(__AVX2__) && defined(__FMA__)
+namespace {
+
+/* Check if AVX2 is supported by the CPU. We can assume that OS support for AVX2
+is available if AVX2 is supported by hardware, and do not need to test if it is
+enabled in software as well. */
+bool CheckCpuForAvxSupport() {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+
+/* The lanes of an AVX2 register of four doubles, for use with the kernels in
+corotated_batch_kernels_lanes.h. Masks hold all ones or all zeros per lane. */
+struct AvxLanes {
+  using V = __m256d;
+  using Mask = __m256d;
+  static constexpr int kWidth = 4;
+
+  static V Load(const double* x) { return _mm256_loadu_pd(x); }
+  static void Store(double* x, V v) { _mm256_storeu_pd(x, v); }
+  static V Broadcast(double d) { return _mm256_set1_pd(d); }
+  static V MulAdd(V a, V b, V c) { return _mm256_fmadd_pd(a, b, c); }
+  static V Sqrt(V a) { return _mm256_sqrt_pd(a); }
+  static V Abs(V a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+  static V Select(Mask mask, V a, V b) { return _mm256_blendv_pd(b, a, mask); }
+  static Mask Less(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+  static Mask Equal(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+  static Mask Or(Mask a, Mask b) { return _mm256_or_pd(a, b); }
+  static bool Any(Mask mask) { return _mm256_movemask_pd(mask) != 0; }
+  static Mask None() { return _mm256_setzero_pd(); }
+};
+
+}  // namespace
+
+bool CorotatedBatchAvxSupported() {
+  static const bool avx_supported = CheckCpuForAvxSupport();
+  return avx_supported;
+}
+
+bool CalcCorotatedBatchAvx(const CorotatedBatchArrays& arrays) {
+  return corotated_batch::CalcBatch<AvxLanes>(arrays);
+}
+
+#else
+namespace {
+void AbortNotEnabledInBuild(const char* func) {
+  std::cerr << "abort: " << func << " is not enabled in build" << std::endl;
+  std::abort();
+}
+}  // namespace
+
+bool CorotatedBatchAvxSupported() {
+  return false;
+}
+
+bool CalcCorotatedBatchAvx(const CorotatedBatchArrays&) {
+  AbortNotEnabledInBuild(__func__);
+  return false;
+}
+#endif
+
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,70 @@
+#pragma once
+
+/* @file
+Declarations of the batched kernels for the fixed corotated constitutive model
+(see CorotatedModel) that are implemented with platform-specific SIMD
+instructions for speed. */
+
+/* N.B. Do not include any other drake headers here because this file will be
+included by a compilation unit that may have a different opinion about whether
+SIMD instructions are enabled than Eigen does in the rest of Drake. */
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+
+/* Pointers to the structure-of-arrays storage of the inputs and outputs of the
+batched corotated kernels, evaluated at `size` locations. Every scalar quantity
+is an array of (at least) `stride` doubles whose i-th entry belongs to the i-th
+location. A 3x3 matrix quantity is stored as 9 such arrays, one per entry in
+column major order, so that entry k of the matrix at location i is at index
+`k * stride + i`. Similarly, the 9x9 stress derivative is stored as 81 arrays in
+column major order.
+
+The inputs are the deformation gradients `F` and the Lamé parameters `mu` and
+`lambda` at each location, and the outputs are (see CorotatedModelData and
+CorotatedModel for their definitions):
+  - R, S: the polar decomposition F = R*S,
+  - Jm1: det(F) - 1,
+  - JFinvT: the cofactor matrix of F,
+  - Psi: the elastic energy density,
+  - P: the first Piola stress,
+  - dPdF: the derivative of P with respect to F.
+
+@pre stride is a positive multiple of 4 and size <= stride. All the entries up
+to `stride` (not just `size`) of the input arrays hold valid (finite) inputs, so
+that the kernels may evaluate full SIMD lanes; the extra outputs are
+unspecified. */
+struct CorotatedBatchArrays {
+  int size{};
+  int stride{};
+  const double* F{};
+  const double* mu{};
+  const double* lambda{};
+  double* R{};
+  double* S{};
+  double* Jm1{};
+  double* JFinvT{};
+  double* Psi{};
+  double* P{};
+  double* dPdF{};
+};
+
+/* Detects if the AVX2 implementation below is supported. Supported means that
+both (1) AVX2 and FMA were enabled at build time, and (2) the processor
+executing this code supports AVX2 and FMA instructions. */
+bool CorotatedBatchAvxSupported();
+
+/* Evaluates the batched corotated model at all locations in `arrays`, four
+locations at a time. Returns false if the stress derivative is undefined at any
+location (see AddScaledRotationalDerivative()), in which case the outputs are
+unspecified.
+
+Note: if AVX2 is not supported, calling this function will crash the program. */
+bool CalcCorotatedBatchAvx(const CorotatedBatchArrays& arrays);
+
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
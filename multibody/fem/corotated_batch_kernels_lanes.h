@@ -0,0 +1,392 @@
+#pragma once
+
+#include "drake/multibody/fem/corotated_batch_kernels_avx2_fma.h"
+
+/* N.B. Do not include any other drake headers (or any standard headers with
+inline functions) here because this file is included by compilation units that
+have different opinions about whether SIMD instructions are enabled. The
+kernels below only use the operations provided by their `Lanes` template
+argument. */
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+namespace corotated_batch {
+
+/* The implementation of the batched corotated kernels declared in
+corotated_batch_kernels.h, written once for any number of SIMD lanes. The
+`Lanes` template argument provides the vector type `V` holding one double per
+lane, the mask type `Mask`, the number of lanes `kWidth`, and the static
+functions Load(), Store(), Broadcast(), MulAdd() (a*b + c), Sqrt(), Abs(),
+Select() (per lane `mask ? a : b`), Less(), Equal(), Or(), Any() and None(). The
+arithmetic operators +, -, *, / must be defined on `V`.
+
+The polar decomposition F = R*S is computed from the singular value
+decomposition F = UΣVᵀ as R = UVᵀ and S = VΣVᵀ, where U and V are proper
+rotations and the smallest singular value carries the sign of det(F), which
+matches the convention of PolarDecompose(). The SVD itself is computed without
+any branches that depend on the values of the lanes (other than the early exit
+once all lanes have converged):
+  1. One-sided (Hestenes) Jacobi iterations orthogonalize the columns of F, i.e.
+     compute B = FV with orthogonal columns and V a rotation.
+  2. The columns of B and V are sorted by decreasing norm, flipping the sign of
+     one column per swap so that V remains a rotation.
+  3. Givens rotations compute the QR factorization B = UΣ, where Σ is
+     diagonal since the columns of B are orthogonal. The first two diagonal
+     entries are nonnegative and the last one has the sign of det(F).
+Unlike Jacobi iterations on FᵀF, the one-sided iterations operate on F directly
+and don't square its condition number. */
+
+/* Column major 3x3 matrices are stored in arrays of 9 vectors. */
+constexpr int Index(int row, int col) {
+  return 3 * col + row;
+}
+
+/* The iterations stop once |b_pᵀb_q| <= kJacobiTolerance * ‖b_p‖‖b_q‖ for all
+pairs of columns in all lanes, or after kMaxJacobiSweeps sweeps. The iterations
+converge quadratically and three or four sweeps are typically sufficient. */
+constexpr double kJacobiTolerance = 1e-15;
+constexpr int kMaxJacobiSweeps = 8;
+
+template <class Lanes>
+typename Lanes::V Dot(const typename Lanes::V* x, const typename Lanes::V* y) {
+  return Lanes::MulAdd(x[0], y[0], Lanes::MulAdd(x[1], y[1], x[2] * y[2]));
+}
+
+/* Sets x ← c x - s y and y ← s x + c y for the columns x and y. */
+template <class Lanes>
+void RotateColumns(typename Lanes::V c, typename Lanes::V s,
+                   typename Lanes::V* x, typename Lanes::V* y) {
+  for (int r = 0; r < 3; ++r) {
+    const typename Lanes::V x_r = x[r];
+    x[r] = c * x_r - s * y[r];
+    y[r] = Lanes::MulAdd(s, x_r, c * y[r]);
+  }
+}
+
+/* Swaps the columns x and y where y > x (per lane), negating one of them so
+that the determinant of the matrix is preserved. */
+template <class Lanes>
+void SwapColumns(typename Lanes::Mask swap, typename Lanes::V* x,
+                 typename Lanes::V* y) {
+  for (int r = 0; r < 3; ++r) {
+    const typename Lanes::V x_r = x[r];
+    x[r] = Lanes::Select(swap, y[r], x_r);
+    y[r] = Lanes::Select(swap, Lanes::Broadcast(0.0) - x_r, y[r]);
+  }
+}
+
+/* Applies the Givens rotation on rows p and q of B (and the corresponding
+columns of U such that the product UB is unchanged) that zeros B(q, col). */
+template <class Lanes>
+void ApplyGivensRotation(int p, int q, int col, typename Lanes::V* B,
+                         typename Lanes::V* U) {
+  using V = typename Lanes::V;
+  const V zero = Lanes::Broadcast(0.0);
+  const V one = Lanes::Broadcast(1.0);
+  const V a = B[Index(p, col)];
+  const V b = B[Index(q, col)];
+  const V rho = Lanes::Sqrt(Lanes::MulAdd(a, a, b * b));
+  const typename Lanes::Mask nonzero = Lanes::Less(zero, rho);
+  const V inv_rho = one / Lanes::Select(nonzero, rho, one);
+  const V c = Lanes::Select(nonzero, a * inv_rho, one);
+  const V s = Lanes::Select(nonzero, b * inv_rho, zero);
+  for (int k = 0; k < 3; ++k) {
+    const V x = B[Index(p, k)];
+    const V y = B[Index(q, k)];
+    B[Index(p, k)] = Lanes::MulAdd(c, x, s * y);
+    B[Index(q, k)] = c * y - s * x;
+  }
+  for (int r = 0; r < 3; ++r) {
+    const V x = U[Index(r, p)];
+    const V y = U[Index(r, q)];
+    U[Index(r, p)] = Lanes::MulAdd(c, x, s * y);
+    U[Index(r, q)] = c * y - s * x;
+  }
+}
+
+/* Computes Z = X * Y, or Z = X * Yᵀ if `transpose_Y` is true. */
+template <class Lanes>
+void Multiply(const typename Lanes::V* X, const typename Lanes::V* Y,
+              bool transpose_Y, typename Lanes::V* Z) {
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      typename Lanes::V sum = Lanes::Broadcast(0.0);
+      for (int k = 0; k < 3; ++k) {
+        const typename Lanes::V Y_kj =
+            transpose_Y ? Y[Index(j, k)] : Y[Index(k, j)];
+        sum = Lanes::MulAdd(X[Index(i, k)], Y_kj, sum);
+      }
+      Z[Index(i, j)] = sum;
+    }
+  }
+}
+
+/* Computes the cofactor matrix of M, see CalcCofactorMatrix(). */
+template <class Lanes>
+void CalcCofactor(const typename Lanes::V* M, typename Lanes::V* C) {
+  auto m = [M](int i, int j) {
+    return M[Index(i, j)];
+  };
+  C[Index(0, 0)] = m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1);
+  C[Index(0, 1)] = m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2);
+  C[Index(0, 2)] = m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0);
+  C[Index(1, 0)] = m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2);
+  C[Index(1, 1)] = m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0);
+  C[Index(1, 2)] = m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1);
+  C[Index(2, 0)] = m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1);
+  C[Index(2, 1)] = m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2);
+  C[Index(2, 2)] = m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+}
+
+/* Computes the polar decomposition F = R*S, see the class documentation. */
+template <class Lanes>
+void PolarDecompose(const typename Lanes::V* F, typename Lanes::V* R,
+                    typename Lanes::V* S) {
+  using V = typename Lanes::V;
+  using Mask = typename Lanes::Mask;
+  const V zero = Lanes::Broadcast(0.0);
+  const V one = Lanes::Broadcast(1.0);
+  const V two = Lanes::Broadcast(2.0);
+  const V tolerance_squared =
+      Lanes::Broadcast(kJacobiTolerance * kJacobiTolerance);
+  constexpr int kPairs[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+
+  V B[9];
+  V Vm[9];
+  for (int k = 0; k < 9; ++k) {
+    B[k] = F[k];
+    Vm[k] = (k % 4 == 0) ? one : zero;
+  }
+  for (int sweep = 0; sweep < kMaxJacobiSweeps; ++sweep) {
+    Mask rotated = Lanes::None();
+    for (const auto& [p, q] : kPairs) {
+      V* b_p = &B[3 * p];
+      V* b_q = &B[3 * q];
+      const V alpha = Dot<Lanes>(b_p, b_p);
+      const V beta = Dot<Lanes>(b_q, b_q);
+      const V gamma = Dot<Lanes>(b_p, b_q);
+      const Mask rotate =
+          Lanes::Less(tolerance_squared * alpha * beta, gamma * gamma);
+      /* The rotation [c s; -s c] that makes b_p and b_q orthogonal is given by
+       t = s/c = sign(ζ)/(|ζ| + √(1 + ζ²)) with ζ = (β − α)/(2γ), see e.g.
+       [Demmel and Veselić, 1992]. With d = β − α, w = 2γ and r = √(d² + w²),
+       this simplifies to c = (|d| + r)/√(2r(|d| + r)) and
+       s = sign(d)w/√(2r(|d| + r)), which only costs two square roots and a
+       division. Lanes that don't need a rotation get the identity. */
+      const V d = beta - alpha;
+      const V abs_d = Lanes::Abs(d);
+      const V w = two * gamma;
+      const V r = Lanes::Sqrt(Lanes::MulAdd(d, d, w * w));
+      const V abs_d_plus_r = abs_d + r;
+      const V inv_norm =
+          one / Lanes::Sqrt(Lanes::Select(rotate, two * r * abs_d_plus_r, one));
+      const V signed_w = Lanes::Select(Lanes::Less(d, zero), zero - w, w);
+      const V masked_c = Lanes::Select(rotate, abs_d_plus_r * inv_norm, one);
+      const V masked_s = Lanes::Select(rotate, signed_w * inv_norm, zero);
+      RotateColumns<Lanes>(masked_c, masked_s, b_p, b_q);
+      RotateColumns<Lanes>(masked_c, masked_s, &Vm[3 * p], &Vm[3 * q]);
+      rotated = Lanes::Or(rotated, rotate);
+    }
+    if (!Lanes::Any(rotated)) break;
+  }
+
+  /* Sort the columns by decreasing norm with a sorting network. */
+  for (const auto& [p, q] : kPairs) {
+    const Mask swap = Lanes::Less(Dot<Lanes>(&B[3 * p], &B[3 * p]),
+                                  Dot<Lanes>(&B[3 * q], &B[3 * q]));
+    SwapColumns<Lanes>(swap, &B[3 * p], &B[3 * q]);
+    SwapColumns<Lanes>(swap, &Vm[3 * p], &Vm[3 * q]);
+  }
+
+  V U[9];
+  for (int k = 0; k < 9; ++k) {
+    U[k] = (k % 4 == 0) ? one : zero;
+  }
+  ApplyGivensRotation<Lanes>(0, 1, 0, B, U);
+  ApplyGivensRotation<Lanes>(0, 2, 0, B, U);
+  ApplyGivensRotation<Lanes>(1, 2, 1, B, U);
+
+  Multiply<Lanes>(U, Vm, true, R);
+  V VSigma[9];
+  for (int k = 0; k < 3; ++k) {
+    const V sigma = B[Index(k, k)];
+    for (int r = 0; r < 3; ++r) {
+      VSigma[Index(r, k)] = Vm[Index(r, k)] * sigma;
+    }
+  }
+  Multiply<Lanes>(VSigma, Vm, true, S);
+}
+
+/* Evaluates the corotated model at the `Lanes::kWidth` locations starting at
+location `i`. Returns false if the stress derivative is undefined in any lane.
+See CorotatedModel for the formulas. */
+template <class Lanes>
+bool CalcLanes(const CorotatedBatchArrays& arrays, int i) {
+  using V = typename Lanes::V;
+  const int stride = arrays.stride;
+  const V zero = Lanes::Broadcast(0.0);
+  const V one = Lanes::Broadcast(1.0);
+  const V half = Lanes::Broadcast(0.5);
+  const V two = Lanes::Broadcast(2.0);
+
+  V F[9];
+  for (int k = 0; k < 9; ++k) {
+    F[k] = Lanes::Load(arrays.F + k * stride + i);
+  }
+  const V mu = Lanes::Load(arrays.mu + i);
+  const V lambda = Lanes::Load(arrays.lambda + i);
+
+  V R[9];
+  V S[9];
+  PolarDecompose<Lanes>(F, R, S);
+  V JFinvT[9];
+  CalcCofactor<Lanes>(F, JFinvT);
+  const V J = Lanes::MulAdd(
+      F[0], JFinvT[0], Lanes::MulAdd(F[1], JFinvT[1], F[2] * JFinvT[2]));
+  const V Jm1 = J - one;
+
+  /* Psi = μ‖F − R‖² + ½λ(J − 1)² and P = 2μ(F − R) + λ(J − 1)JF⁻ᵀ. */
+  const V two_mu = two * mu;
+  const V lambda_Jm1 = lambda * Jm1;
+  V F_minus_R_squared_norm = zero;
+  V P[9];
+  for (int k = 0; k < 9; ++k) {
+    const V F_minus_R = F[k] - R[k];
+    F_minus_R_squared_norm =
+        Lanes::MulAdd(F_minus_R, F_minus_R, F_minus_R_squared_norm);
+    P[k] = Lanes::MulAdd(two_mu, F_minus_R, lambda_Jm1 * JFinvT[k]);
+  }
+  const V Psi =
+      Lanes::MulAdd(mu, F_minus_R_squared_norm, half * lambda_Jm1 * Jm1);
+
+  /* The contributions to dPdF from the derivatives of Jm1 and F. */
+  V dPdF[81];
+  for (int c = 0; c < 9; ++c) {
+    const V lambda_JFinvT_c = lambda * JFinvT[c];
+    for (int r = 0; r < 9; ++r) {
+      dPdF[9 * c + r] = lambda_JFinvT_c * JFinvT[r];
+    }
+    dPdF[10 * c] = dPdF[10 * c] + two_mu;
+  }
+
+  /* The contribution from the derivatives of R, see
+   AddScaledRotationalDerivative() with scale = -2μ. */
+  V A[9];
+  const V trace_S = S[0] + S[4] + S[8];
+  for (int k = 0; k < 9; ++k) {
+    A[k] = zero - S[k];
+  }
+  for (int k = 0; k < 3; ++k) {
+    A[Index(k, k)] = A[Index(k, k)] + trace_S;
+  }
+  V cofactor_A[9];
+  CalcCofactor<Lanes>(A, cofactor_A);
+  const V det_A =
+      Lanes::MulAdd(A[0], cofactor_A[0],
+                    Lanes::MulAdd(A[1], cofactor_A[1], A[2] * cofactor_A[2]));
+  const typename Lanes::Mask singular = Lanes::Equal(det_A, zero);
+  const V scale_over_det_A =
+      (zero - two_mu) / Lanes::Select(singular, one, det_A);
+  V RA[9];
+  Multiply<Lanes>(R, A, false, RA);
+  V sRA[9];
+  for (int k = 0; k < 9; ++k) {
+    sRA[k] = scale_over_det_A * RA[k];
+  }
+  V sRART[9];
+  Multiply<Lanes>(sRA, R, true, sRART);
+  for (int a = 0; a < 3; ++a) {
+    for (int b = 0; b < 3; ++b) {
+      const int column_index = 3 * b + a;
+      for (int ii = 0; ii < 3; ++ii) {
+        for (int j = 0; j < 3; ++j) {
+          const int row_index = 3 * j + ii;
+          V& entry = dPdF[9 * column_index + row_index];
+          entry = Lanes::MulAdd(sRART[Index(ii, a)], A[Index(j, b)], entry) -
+                  sRA[Index(ii, b)] * RA[Index(a, j)];
+        }
+      }
+    }
+  }
+
+  /* The contribution from the derivatives of JFinvT, see
+   AddScaledCofactorMatrixDerivative() with scale = λ(J − 1). */
+  V M[9];
+  for (int k = 0; k < 9; ++k) {
+    M[k] = lambda_Jm1 * F[k];
+  }
+  auto add = [&dPdF](int row, int col, V value) {
+    dPdF[9 * col + row] = dPdF[9 * col + row] + value;
+  };
+  auto m = [&M](int row, int col) {
+    return M[Index(row, col)];
+  };
+  add(4, 0, m(2, 2));
+  add(5, 0, zero - m(1, 2));
+  add(7, 0, zero - m(2, 1));
+  add(8, 0, m(1, 1));
+  add(3, 1, zero - m(2, 2));
+  add(5, 1, m(0, 2));
+  add(6, 1, m(2, 1));
+  add(8, 1, zero - m(0, 1));
+  add(3, 2, m(1, 2));
+  add(4, 2, zero - m(0, 2));
+  add(6, 2, zero - m(1, 1));
+  add(7, 2, m(0, 1));
+  add(1, 3, zero - m(2, 2));
+  add(2, 3, m(1, 2));
+  add(7, 3, m(2, 0));
+  add(8, 3, zero - m(1, 0));
+  add(0, 4, m(2, 2));
+  add(2, 4, zero - m(0, 2));
+  add(6, 4, zero - m(2, 0));
+  add(8, 4, m(0, 0));
+  add(0, 5, zero - m(1, 2));
+  add(1, 5, m(0, 2));
+  add(6, 5, m(1, 0));
+  add(7, 5, zero - m(0, 0));
+  add(1, 6, m(2, 1));
+  add(2, 6, zero - m(1, 1));
+  add(4, 6, zero - m(2, 0));
+  add(5, 6, m(1, 0));
+  add(0, 7, zero - m(2, 1));
+  add(2, 7, m(0, 1));
+  add(3, 7, m(2, 0));
+  add(5, 7, zero - m(0, 0));
+  add(0, 8, m(1, 1));
+  add(1, 8, zero - m(0, 1));
+  add(3, 8, zero - m(1, 0));
+  add(4, 8, m(0, 0));
+
+  for (int k = 0; k < 9; ++k) {
+    Lanes::Store(arrays.R + k * stride + i, R[k]);
+    Lanes::Store(arrays.S + k * stride + i, S[k]);
+    Lanes::Store(arrays.JFinvT + k * stride + i, JFinvT[k]);
+    Lanes::Store(arrays.P + k * stride + i, P[k]);
+  }
+  for (int k = 0; k < 81; ++k) {
+    Lanes::Store(arrays.dPdF + k * stride + i, dPdF[k]);
+  }
+  Lanes::Store(arrays.Jm1 + i, Jm1);
+  Lanes::Store(arrays.Psi + i, Psi);
+  return !Lanes::Any(singular);
+}
+
+/* Evaluates the corotated model at all locations in `arrays`. Returns false if
+the stress derivative is undefined at any location. */
+template <class Lanes>
+bool CalcBatch(const CorotatedBatchArrays& arrays) {
+  bool success = true;
+  for (int i = 0; i < arrays.size; i += Lanes::kWidth) {
+    success = CalcLanes<Lanes>(arrays, i) && success;
+  }
+  return success;
+}
+
+}  // namespace corotated_batch
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
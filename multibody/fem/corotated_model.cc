@@ -1,10 +1,13 @@
 #include "drake/multibody/fem/corotated_model.h"
 
 #include <array>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "drake/common/autodiff.h"
 #include "drake/multibody/fem/calc_lame_parameters.h"
+#include "drake/multibody/fem/corotated_batch_kernels.h"
 #include "drake/multibody/fem/matrix_utilities.h"
 
 namespace drake {
@@ -71,6 +74,105 @@ void CorotatedModel<T, num_locations>::CalcFirstPiolaStressDerivativeImpl(
   }
 }
 
+namespace {
+
+/* The offsets (in multiples of the stride) of the quantities in the
+ structure-of-arrays storage used by CorotatedModel::CalcBatchImpl(). See
+ CorotatedBatchArrays. */
+constexpr int kFOffset = 0;
+constexpr int kMuOffset = kFOffset + 9;
+constexpr int kLambdaOffset = kMuOffset + 1;
+constexpr int kROffset = kLambdaOffset + 1;
+constexpr int kSOffset = kROffset + 9;
+constexpr int kJm1Offset = kSOffset + 9;
+constexpr int kJFinvTOffset = kJm1Offset + 1;
+constexpr int kPsiOffset = kJFinvTOffset + 9;
+constexpr int kPOffset = kPsiOffset + 1;
+constexpr int kdPdFOffset = kPOffset + 9;
+constexpr int kNumArrays = kdPdFOffset + 81;
+
+}  // namespace
+
+template <typename T, int num_locations>
+void CorotatedModel<T, num_locations>::CalcBatchImpl(
+    const std::vector<typename ConstitutiveModel<
+        CorotatedModel<T, num_locations>,
+        CorotatedModelTraits<T, num_locations>>::BatchEntry>& entries) {
+  using Base = ConstitutiveModel<CorotatedModel<T, num_locations>,
+                                 CorotatedModelTraits<T, num_locations>>;
+  if constexpr (!std::is_same_v<T, double>) {
+    Base::CalcBatchImpl(entries);
+  } else {
+    const int size = entries.size() * num_locations;
+    if (size == 0) return;
+    /* Pad to full SIMD lanes. The padding holds the (valid) undeformed
+     state. */
+    const int stride = (size + 3) / 4 * 4;
+    std::vector<double> storage(kNumArrays * stride, 0.0);
+    auto array = [&storage, stride](int offset) {
+      return storage.data() + offset * stride;
+    };
+    for (int i = 0; i < stride; ++i) {
+      for (int k = 0; k < 9; ++k) {
+        array(kFOffset + k)[i] = (k % 4 == 0) ? 1.0 : 0.0;
+      }
+    }
+    for (int e = 0; e < static_cast<int>(entries.size()); ++e) {
+      const auto& entry = entries[e];
+      for (int q = 0; q < num_locations; ++q) {
+        const int i = e * num_locations + q;
+        const double* F = (*entry.deformation_gradient)[q].data();
+        for (int k = 0; k < 9; ++k) {
+          array(kFOffset + k)[i] = F[k];
+        }
+        array(kMuOffset)[i] = entry.model->mu_;
+        array(kLambdaOffset)[i] = entry.model->lambda_;
+      }
+    }
+
+    CorotatedBatchArrays arrays;
+    arrays.size = size;
+    arrays.stride = stride;
+    arrays.F = array(kFOffset);
+    arrays.mu = array(kMuOffset);
+    arrays.lambda = array(kLambdaOffset);
+    arrays.R = array(kROffset);
+    arrays.S = array(kSOffset);
+    arrays.Jm1 = array(kJm1Offset);
+    arrays.JFinvT = array(kJFinvTOffset);
+    arrays.Psi = array(kPsiOffset);
+    arrays.P = array(kPOffset);
+    arrays.dPdF = array(kdPdFOffset);
+    if (!CalcCorotatedBatch(arrays)) {
+      /* Defer to the per-location computations for the error reporting. */
+      Base::CalcBatchImpl(entries);
+      return;
+    }
+
+    for (int e = 0; e < static_cast<int>(entries.size()); ++e) {
+      const auto& entry = entries[e];
+      Data& data = *entry.data;
+      for (int q = 0; q < num_locations; ++q) {
+        const int i = e * num_locations + q;
+        data.mutable_deformation_gradient()[q] =
+            (*entry.deformation_gradient)[q];
+        for (int k = 0; k < 9; ++k) {
+          data.R_[q].data()[k] = array(kROffset + k)[i];
+          data.S_[q].data()[k] = array(kSOffset + k)[i];
+          data.JFinvT_[q].data()[k] = array(kJFinvTOffset + k)[i];
+          (*entry.P)[q].data()[k] = array(kPOffset + k)[i];
+        }
+        data.Jm1_[q] = array(kJm1Offset)[i];
+        (*entry.Psi)[q] = array(kPsiOffset)[i];
+        double* dPdF = (*entry.dPdF)[q].data();
+        for (int k = 0; k < 81; ++k) {
+          dPdF[k] = array(kdPdFOffset + k)[i];
+        }
+      }
+    }
+  }
+}
+
 template class CorotatedModel<double, 1>;
 template class CorotatedModel<AutoDiffXd, 1>;
 
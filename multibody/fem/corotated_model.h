@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <vector>
 
 #include "drake/multibody/fem/constitutive_model.h"
 #include "drake/multibody/fem/corotated_model_data.h"
@@ -80,6 +81,16 @@ class CorotatedModel final
       const Data& data,
       std::array<Eigen::Matrix<T, 9, 9>, num_locations>* dPdF) const;
 
+  /* Shadows ConstitutiveModel::CalcBatchImpl(). For T = double, all locations
+   of all entries are evaluated together with CalcCorotatedBatch(), i.e. with
+   AVX2 instructions when available. The polar decompositions are computed with
+   a Jacobi SVD that agrees with the one in CorotatedModelData up to roundoff.
+   Other scalar types use the default implementation. */
+  static void CalcBatchImpl(
+      const std::vector<typename ConstitutiveModel<
+          CorotatedModel<T, num_locations>,
+          CorotatedModelTraits<T, num_locations>>::BatchEntry>& entries);
+
   T E_;       // Young's modulus, N/m².
   T nu_;      // Poisson's ratio.
   T mu_;      // Lamé's second parameter/Shear modulus, N/m².
@@ -10,6 +10,9 @@ namespace multibody {
 namespace fem {
 namespace internal {
 
+template <typename T, int num_locations>
+class CorotatedModel;
+
 /* Data supporting calculations in CorotatedModel. The constitutive model is
  described in section 3.4 in [Stomakhin, 2012]. In particular, this class stores
  the polar decomposition of the deformation gradient F, along with J-1 and JF⁻ᵀ
@@ -43,6 +46,9 @@ class CorotatedModelData
 
  private:
   friend DeformationGradientData<CorotatedModelData<T, num_locations>>;
+  /* CorotatedModel::CalcBatch() computes the data of many locations at once and
+   writes the results directly. */
+  friend class CorotatedModel<T, num_locations>;
 
   /* Shadows DeformationGradientData::UpdateFromDeformationGradient() as
    required by the CRTP base class. */
@@ -72,6 +72,14 @@ class DeformationGradientData<
     deformation_gradient_.fill(Matrix3<T>::Identity());
   }
 
+  /* Provides derived classes with write access to the deformation gradients
+   for when the dependent quantities are computed elsewhere (e.g. in batches),
+   so that UpdateFromDeformationGradient() must not be invoked. Callers are
+   responsible for keeping the dependent quantities in sync. */
+  std::array<Matrix3<T>, num_locations>& mutable_deformation_gradient() {
+    return deformation_gradient_;
+  }
+
   /* Derived classes *must* shadow this method to compute quantities derived
    from deformation gradients. `deformation_gradient()` will be up to date
    before any call to this method. */
@@ -50,6 +50,23 @@ void DirichletBoundaryCondition<T>::ApplyBoundaryConditionToTangentMatrix(
   tangent_matrix->ZeroRowsAndColumns(indexes, /* diagonal entry */ 1.0);
 }
 
+template <typename T>
+void DirichletBoundaryCondition<T>::ApplyBoundaryConditionToTangentMatrix(
+    internal::Block3x3SparseSymmetricMatrix* tangent_matrix) const {
+  DRAKE_DEMAND(tangent_matrix != nullptr);
+  if (index_to_boundary_state_.empty()) return;
+  VerifyIndexes(tangent_matrix->cols());
+
+  /* Zero out all rows and columns of the tangent matrix corresponding to
+   dofs under the BC (except the diagonal entry which is set to 1). */
+  std::vector<int> indexes(index_to_boundary_state_.size());
+  int i = 0;
+  for (const auto& it : index_to_boundary_state_) {
+    indexes[i++] = it.first;
+  }
+  tangent_matrix->ZeroRowsAndColumns(indexes, /* diagonal entry */ 1.0);
+}
+
 template <typename T>
 void DirichletBoundaryCondition<T>::ApplyHomogeneousBoundaryCondition(
     EigenPtr<VectorX<T>> v) const {
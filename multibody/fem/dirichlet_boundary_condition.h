@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "drake/common/eigen_types.h"
+#include "drake/multibody/fem/block_3x3_sparse_symmetric_matrix.h"
 #include "drake/multibody/fem/fem_state.h"
 #include "drake/multibody/fem/petsc_symmetric_block_sparse_matrix.h"
 
@@ -68,6 +69,11 @@ class DirichletBoundaryCondition {
   void ApplyBoundaryConditionToTangentMatrix(
       PetscSymmetricBlockSparseMatrix* tangent_matrix) const;
 
+  /* Overload of ApplyBoundaryConditionToTangentMatrix() for the native block
+   sparse tangent matrix. */
+  void ApplyBoundaryConditionToTangentMatrix(
+      Block3x3SparseSymmetricMatrix* tangent_matrix) const;
+
   /* Modifies the given vector `v` (e.g, the residual of the system or the
    velocities/positions) that arises from an FEM model without BC into the a
    vector for the same model subject to `this` BC. More specifically, the
@@ -0,0 +1,64 @@
+#include "drake/multibody/fem/element_coloring.h"
+
+#include <algorithm>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+
+std::vector<std::vector<int>> ComputeElementColoring(
+    const std::vector<std::vector<int>>& element_nodes) {
+  const int num_elements = element_nodes.size();
+  int num_nodes = 0;
+  for (const std::vector<int>& nodes : element_nodes) {
+    for (int n : nodes) {
+      DRAKE_DEMAND(n >= 0);
+      num_nodes = std::max(num_nodes, n + 1);
+    }
+  }
+
+  /* node_to_elements[n] lists the elements (in increasing order) that contain
+   node n. */
+  std::vector<std::vector<int>> node_to_elements(num_nodes);
+  for (int e = 0; e < num_elements; ++e) {
+    for (int n : element_nodes[e]) {
+      node_to_elements[n].push_back(e);
+    }
+  }
+
+  std::vector<int> element_color(num_elements, -1);
+  std::vector<std::vector<int>> colors;
+  /* forbidden[c] == e indicates that color c is taken by a neighbor of the
+   element e currently being colored. Stamping with the element index avoids
+   clearing the array for every element. */
+  std::vector<int> forbidden;
+  for (int e = 0; e < num_elements; ++e) {
+    for (int n : element_nodes[e]) {
+      for (int neighbor : node_to_elements[n]) {
+        /* Neighbors are sorted, so the remaining ones haven't been colored
+         yet. */
+        if (neighbor >= e) break;
+        forbidden[element_color[neighbor]] = e;
+      }
+    }
+    int c = 0;
+    while (c < static_cast<int>(forbidden.size()) && forbidden[c] == e) {
+      ++c;
+    }
+    if (c == static_cast<int>(colors.size())) {
+      colors.emplace_back();
+      forbidden.push_back(-1);
+    }
+    element_color[e] = c;
+    colors[c].push_back(e);
+  }
+  return colors;
+}
+
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
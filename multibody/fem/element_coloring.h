@@ -0,0 +1,33 @@
+#pragma once
+
+#include <vector>
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+
+/* Partitions a set of FEM elements into groups (colors) such that no two
+ elements in the same group share a node. Elements with the same color can
+ therefore scatter their contributions into global node-indexed quantities (e.g.
+ the residual or the tangent matrix) concurrently without any synchronization.
+
+ The coloring is computed greedily: elements are visited in increasing order of
+ their indices and each is assigned the smallest color not already taken by an
+ element sharing one of its nodes. The number of colors is bounded by one plus
+ the maximum number of elements adjacent to any single element, which is
+ typically a few dozen for tetrahedral meshes.
+
+ @param element_nodes  `element_nodes[e]` contains the node indices of the e-th
+                       element.
+ @returns The elements grouped by color. The c-th entry contains the indices of
+          all elements with color c in increasing order. Every element appears
+          in exactly one color and no color is empty.
+ @pre All node indices are non-negative. */
+std::vector<std::vector<int>> ComputeElementColoring(
+    const std::vector<std::vector<int>>& element_nodes);
+
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
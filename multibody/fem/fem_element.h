@@ -3,6 +3,7 @@
 #include <array>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "drake/common/eigen_types.h"
 #include "drake/multibody/fem/constitutive_model.h"
@@ -100,6 +101,23 @@ class FemElement {
     return static_cast<const DerivedElement*>(this)->DoComputeData(state);
   }
 
+  /* Computes the per-element data of `elements[i]` into `(*data)[i]` for all i
+   in [begin, end), which is equivalent to calling ComputeData() on each of
+   those elements (up to roundoff). Derived elements may shadow
+   DoComputeDataForRange() to compute the data of many elements at once, e.g.
+   to evaluate their constitutive models with SIMD instructions.
+   @pre 0 <= begin <= end <= elements.size() and data->size() >= end. */
+  static void ComputeDataForRange(const std::vector<DerivedElement>& elements,
+                                  int begin, int end,
+                                  const FemState<T>& state,
+                                  std::vector<Data>* data) {
+    DRAKE_ASSERT(data != nullptr);
+    DRAKE_ASSERT(0 <= begin && begin <= end);
+    DRAKE_ASSERT(end <= static_cast<int>(elements.size()));
+    DRAKE_ASSERT(end <= static_cast<int>(data->size()));
+    DerivedElement::DoComputeDataForRange(elements, begin, end, state, data);
+  }
+
   /* Calculates the tangent matrix for the element by combining the stiffness
    matrix, damping matrix, and the mass matrix according to the given `weights`.
    In particular, given a weight of (w₀, w₁, w₂), the tangent matrix is equal to
@@ -249,6 +267,18 @@ class FemElement {
     ThrowIfNotImplemented(__func__);
   }
 
+  /* `DerivedElement` may shadow `DoComputeDataForRange()` to compute the data
+   of many elements at once. The default implementation calls ComputeData() on
+   each element. */
+  static void DoComputeDataForRange(const std::vector<DerivedElement>& elements,
+                                    int begin, int end,
+                                    const FemState<T>& state,
+                                    std::vector<Data>* data) {
+    for (int i = begin; i < end; ++i) {
+      (*data)[i] = elements[i].ComputeData(state);
+    }
+  }
+
   /* `DerivedElement` must provide an implementation for
    `DoCalcInverseDynamics()` to provide the external force required to keep the
    element's state given by `data` in equilibrium. The caller guarantees that
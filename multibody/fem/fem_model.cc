@@ -1,5 +1,7 @@
 #include "drake/multibody/fem/fem_model.h"
 
+#include "drake/common/identifier.h"
+
 namespace drake {
 namespace multibody {
 namespace fem {
@@ -65,6 +67,34 @@ FemModel<T>::MakePetscSymmetricBlockSparseTangentMatrix() const {
   }
 }
 
+template <typename T>
+void FemModel<T>::CalcTangentMatrix(
+    const FemState<T>& fem_state, const Vector3<T>& weights,
+    internal::Block3x3SparseSymmetricMatrix* tangent_matrix) const {
+  if constexpr (std::is_same_v<T, double>) {
+    DRAKE_DEMAND(tangent_matrix != nullptr);
+    DRAKE_DEMAND(tangent_matrix->rows() == num_dofs());
+    ThrowIfModelStateIncompatible(__func__, fem_state);
+    DoCalcTangentMatrix(fem_state, weights, tangent_matrix);
+    dirichlet_bc_.ApplyBoundaryConditionToTangentMatrix(tangent_matrix);
+  } else {
+    throw std::logic_error(
+        "FemModel::CalcTangentMatrix() only supports double at the moment.");
+  }
+}
+
+template <typename T>
+std::unique_ptr<internal::Block3x3SparseSymmetricMatrix>
+FemModel<T>::MakeBlock3x3SparseSymmetricTangentMatrix() const {
+  if constexpr (std::is_same_v<T, double>) {
+    return DoMakeBlock3x3SparseSymmetricTangentMatrix();
+  } else {
+    throw std::logic_error(
+        "FemModel::MakeBlock3x3SparseSymmetricTangentMatrix() only supports "
+        "double at the moment.");
+  }
+}
+
 template <typename T>
 void FemModel<T>::ApplyBoundaryCondition(FemState<T>* fem_state) const {
   DRAKE_DEMAND(fem_state != nullptr);
@@ -75,7 +105,8 @@ void FemModel<T>::ApplyBoundaryCondition(FemState<T>* fem_state) const {
 template <typename T>
 FemModel<T>::FemModel()
     : fem_state_system_(std::make_unique<internal::FemStateSystem<T>>(
-          VectorX<T>(0), VectorX<T>(0), VectorX<T>(0))) {}
+          VectorX<T>(0), VectorX<T>(0), VectorX<T>(0))),
+      topology_id_(drake::internal::get_new_identifier()) {}
 
 template <typename T>
 void FemModel<T>::ThrowIfModelStateIncompatible(
@@ -94,6 +125,7 @@ void FemModel<T>::UpdateFemStateSystem() {
   fem_state_system_ = std::make_unique<internal::FemStateSystem<T>>(
       model_positions, model_velocities, model_accelerations);
   DeclareCacheEntries(fem_state_system_.get());
+  topology_id_ = drake::internal::get_new_identifier();
 }
 
 }  // namespace fem
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -9,6 +10,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/eigen_types.h"
+#include "drake/multibody/fem/block_3x3_sparse_symmetric_matrix.h"
 #include "drake/multibody/fem/dirichlet_boundary_condition.h"
 #include "drake/multibody/fem/fem_state.h"
 #include "drake/multibody/fem/petsc_symmetric_block_sparse_matrix.h"
@@ -130,6 +132,13 @@ class FemModel {
   /** The number of FEM elements in this model. */
   virtual int num_elements() const = 0;
 
+  /** (Internal use only) Returns an identifier of the current topology (the
+  nodes and elements) of this model. It changes whenever elements are added and
+  is never shared by two models, even if one is allocated where the other used
+  to be. Data that depend on the sparsity pattern of the tangent matrix can use
+  it to detect that they are stale. */
+  int64_t topology_id() const { return topology_id_; }
+
   /** Creates a default FemState compatible with this model. */
   std::unique_ptr<FemState<T>> MakeFemState() const;
 
@@ -175,6 +184,25 @@ class FemModel {
   std::unique_ptr<internal::PetscSymmetricBlockSparseMatrix>
   MakePetscSymmetricBlockSparseTangentMatrix() const;
 
+  /** Overload of CalcTangentMatrix() that writes the tangent matrix into the
+   native block sparse format.
+   @pre tangent_matrix != nullptr.
+   @pre `tangent_matrix` has the sparsity pattern of the tangent matrix of this
+   model. See MakeBlock3x3SparseSymmetricTangentMatrix().
+   @throws std::exception if the FEM state is incompatible with this model.
+   @throws std::exception if an element couples nodes whose block isn't in the
+   sparsity pattern of `tangent_matrix`.
+   @throws std::exception if T is not double. */
+  void CalcTangentMatrix(
+      const FemState<T>& fem_state, const Vector3<T>& weights,
+      internal::Block3x3SparseSymmetricMatrix* tangent_matrix) const;
+
+  /** Creates a Block3x3SparseSymmetricMatrix that has the sparsity pattern of
+   the tangent matrix of this FEM model. All entries are initialized to zero.
+   @throws std::exception if T is not double. */
+  std::unique_ptr<internal::Block3x3SparseSymmetricMatrix>
+  MakeBlock3x3SparseSymmetricTangentMatrix() const;
+
   /** Sets the gravity vector for all elements in this model. */
   void set_gravity_vector(const Vector3<T>& gravity) { gravity_ = gravity; }
 
@@ -233,6 +261,19 @@ class FemModel {
   virtual std::unique_ptr<internal::PetscSymmetricBlockSparseMatrix>
   DoMakePetscSymmetricBlockSparseTangentMatrix() const = 0;
 
+  /** FemModelImpl must override this method to provide an implementation for
+   the NVI CalcTangentMatrix() with the native block sparse matrix. The input
+   `fem_state` is guaranteed to be compatible with `this` FEM model, and the
+   input `tangent_matrix` is guaranteed to be non-null and properly sized. */
+  virtual void DoCalcTangentMatrix(
+      const FemState<T>& fem_state, const Vector3<T>& weights,
+      internal::Block3x3SparseSymmetricMatrix* tangent_matrix) const = 0;
+
+  /** FemModelImpl must override this method to provide an implementation for
+   the NVI MakeBlock3x3SparseSymmetricTangentMatrix(). */
+  virtual std::unique_ptr<internal::Block3x3SparseSymmetricMatrix>
+  DoMakeBlock3x3SparseSymmetricTangentMatrix() const = 0;
+
   /** Updates the system that manages the states and the cache entries of this
    FEM model. Must be called before calling MakeFemState() after the FEM model
    changes (e.g. adding new elements). */
@@ -253,6 +294,8 @@ class FemModel {
   /* The system that manages the states and cache entries of this FEM model.
    */
   std::unique_ptr<internal::FemStateSystem<T>> fem_state_system_;
+  /* Renewed along with `fem_state_system_`, see topology_id(). */
+  int64_t topology_id_{};
   Vector3<T> gravity_{0, 0, -9.81};
   /* The Dirichlet boundary condition that the model is subject to. */
   internal::DirichletBoundaryCondition<T> dirichlet_bc_;
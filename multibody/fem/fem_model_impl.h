@@ -10,6 +10,8 @@
 #include <vector>
 
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallel_for.h"
+#include "drake/multibody/fem/element_coloring.h"
 #include "drake/multibody/fem/fem_element.h"
 #include "drake/multibody/fem/fem_indexes.h"
 #include "drake/multibody/fem/fem_model.h"
@@ -24,7 +26,20 @@ namespace internal {
  This template parameter must be an instantiation of FemElement, which provides
  the scalar type and the compile time constants such as the natural dimension
  and the number of nodes/quadrature points in each element. See FemElements for
- more details. */
+ more details.
+
+ The per-element data cache entry is computed in chunks of consecutive
+ elements with FemElement::ComputeDataForRange(), which lets elements evaluate
+ their constitutive models in batches (see ConstitutiveModel::CalcBatch()).
+
+ When compiled with OpenMP, the per-element computations in CalcResidual(),
+ CalcTangentMatrix() and the per-element data cache entry are evaluated in
+ parallel. Elements are partitioned into colors such that elements of the same
+ color don't share any node (see ComputeElementColoring()), and the scatter of
+ element contributions into the global residual (and into the native
+ Block3x3SparseSymmetricMatrix tangent matrix) is done concurrently within one
+ color at a time, so no synchronization is needed. The results are independent
+ of the number of threads used. */
 template <class Element>
 class FemModelImpl : public FemModel<typename Element::T> {
  public:
@@ -76,26 +91,31 @@ class FemModelImpl : public FemModel<typename Element::T> {
      the old data. */
     residual->setZero();
     constexpr int kDim = 3;
-    /* Scratch space to store the contribution to the residual from each
-     element. */
-    Vector<T, Element::num_dofs> element_residual;
     const std::vector<Data>& element_data =
         fem_state.template EvalElementData<Data>(element_data_index_);
-    for (int e = 0; e < num_elements(); ++e) {
-      /* residual = Ma-fₑ(x)-fᵥ(x, v)-fₑₓₜ. */
-      /* The Ma-fₑ(x)-fᵥ(x, v) term. */
-      elements_[e].CalcInverseDynamics(element_data[e], &element_residual);
-      /* The -fₑₓₜ term. Currently the only type of external force is gravity.
-       */
-      elements_[e].AddScaledGravityForce(
-          element_data[e], -1.0, this->gravity_vector(), &element_residual);
-      const std::array<FemNodeIndex, Element::num_nodes>& element_node_indices =
-          elements_[e].node_indices();
-      for (int a = 0; a < Element::num_nodes; ++a) {
-        const int global_node = element_node_indices[a];
-        residual->template segment<kDim>(global_node * kDim) +=
-            element_residual.template segment<kDim>(a * kDim);
-      }
+    for (const std::vector<int>& color : element_colors_) {
+      drake::internal::ParallelFor(color.size(), [&](int i) {
+        const int e = color[i];
+        /* Scratch space to store the contribution to the residual from this
+         element. */
+        Vector<T, Element::num_dofs> element_residual;
+        /* residual = Ma-fₑ(x)-fᵥ(x, v)-fₑₓₜ. */
+        /* The Ma-fₑ(x)-fᵥ(x, v) term. */
+        elements_[e].CalcInverseDynamics(element_data[e], &element_residual);
+        /* The -fₑₓₜ term. Currently the only type of external force is
+         gravity. */
+        elements_[e].AddScaledGravityForce(
+            element_data[e], -1.0, this->gravity_vector(), &element_residual);
+        /* Elements of the same color touch disjoint nodes, so the scatter
+         below doesn't race. */
+        const std::array<FemNodeIndex, Element::num_nodes>&
+            element_node_indices = elements_[e].node_indices();
+        for (int a = 0; a < Element::num_nodes; ++a) {
+          const int global_node = element_node_indices[a];
+          residual->template segment<kDim>(global_node * kDim) +=
+              element_residual.template segment<kDim>(a * kDim);
+        }
+      });
     }
   }
 
@@ -108,22 +128,31 @@ class FemModelImpl : public FemModel<typename Element::T> {
       /* Clears the old data. */
       tangent_matrix->SetZero();
 
-      /* Scratch space to store the contribution to the tangent matrix from each
-       element. */
-      Vector<int, Element::num_nodes> block_indices;
       const std::vector<Data>& element_data =
           fem_state.template EvalElementData<Data>(element_data_index_);
-      Eigen::Matrix<T, Element::num_dofs, Element::num_dofs>
-          element_tangent_matrix;
-      for (int e = 0; e < num_elements(); ++e) {
-        elements_[e].CalcTangentMatrix(element_data[e], weights,
-                                       &element_tangent_matrix);
-        const std::array<FemNodeIndex, Element::num_nodes>&
-            element_node_indices = elements_[e].node_indices();
-        for (int a = 0; a < Element::num_nodes; ++a) {
-          block_indices(a) = element_node_indices[a];
+      /* Scratch space to store the contribution to the tangent matrix from
+       each element in the color being processed. */
+      std::vector<Eigen::Matrix<T, Element::num_dofs, Element::num_dofs>>
+          element_tangent_matrices(max_num_elements_per_color_);
+      Vector<int, Element::num_nodes> block_indices;
+      for (const std::vector<int>& color : element_colors_) {
+        const int num_elements_in_color = color.size();
+        drake::internal::ParallelFor(num_elements_in_color, [&](int i) {
+          const int e = color[i];
+          elements_[e].CalcTangentMatrix(element_data[e], weights,
+                                         &element_tangent_matrices[i]);
+        });
+        /* PETSc doesn't support concurrent insertion, so the (comparatively
+         cheap) accumulation into the global matrix is done serially. */
+        for (int i = 0; i < num_elements_in_color; ++i) {
+          const std::array<FemNodeIndex, Element::num_nodes>&
+              element_node_indices = elements_[color[i]].node_indices();
+          for (int a = 0; a < Element::num_nodes; ++a) {
+            block_indices(a) = element_node_indices[a];
+          }
+          tangent_matrix->AddToBlock(block_indices,
+                                     element_tangent_matrices[i]);
         }
-        tangent_matrix->AddToBlock(block_indices, element_tangent_matrix);
       }
     } else {
       DRAKE_UNREACHABLE();
@@ -188,8 +217,82 @@ class FemModelImpl : public FemModel<typename Element::T> {
     }
   }
 
+  void DoCalcTangentMatrix(
+      const FemState<T>& fem_state, const Vector3<T>& weights,
+      Block3x3SparseSymmetricMatrix* tangent_matrix) const final {
+    /* We already check for the scalar type in `CalcTangentMatrix()` but the `if
+     constexpr` here is still needed to make the compiler happy. */
+    if constexpr (std::is_same_v<T, double>) {
+      /* Clears the old data. */
+      tangent_matrix->SetZero();
+
+      const std::vector<Data>& element_data =
+          fem_state.template EvalElementData<Data>(element_data_index_);
+      for (const std::vector<int>& color : element_colors_) {
+        /* Unlike the PETSc matrix, the native matrix can be written to
+         concurrently as long as the blocks are disjoint, which holds for
+         elements of the same color. AddToBlock() throws for blocks outside of
+         the matrix's sparsity pattern; ParallelFor() rethrows it. */
+        drake::internal::ParallelFor(color.size(), [&](int i) {
+          const int e = color[i];
+          Eigen::Matrix<T, Element::num_dofs, Element::num_dofs>
+              element_tangent_matrix;
+          elements_[e].CalcTangentMatrix(element_data[e], weights,
+                                         &element_tangent_matrix);
+          const std::array<FemNodeIndex, Element::num_nodes>&
+              element_node_indices = elements_[e].node_indices();
+          Vector<int, Element::num_nodes> block_indices;
+          for (int a = 0; a < Element::num_nodes; ++a) {
+            block_indices(a) = element_node_indices[a];
+          }
+          tangent_matrix->AddToBlock(block_indices, element_tangent_matrix);
+        });
+      }
+    } else {
+      DRAKE_UNREACHABLE();
+    }
+  }
+
+  std::unique_ptr<Block3x3SparseSymmetricMatrix>
+  DoMakeBlock3x3SparseSymmetricTangentMatrix() const final {
+    /* We already check for the scalar type in
+     `MakeBlock3x3SparseSymmetricTangentMatrix()` but the `if constexpr` here
+     is still needed to make the compiler happy. */
+    if constexpr (std::is_same_v<T, double>) {
+      /* Create a nonzero block for each pair of nodes that are connected by an
+       edge in the mesh. Only the lower triangular blocks are stored, so the
+       block (i, j) with i >= j is recorded in the j-th block column. */
+      std::vector<std::vector<int>> sparsity_pattern(this->num_nodes());
+      for (int j = 0; j < this->num_nodes(); ++j) {
+        sparsity_pattern[j].push_back(j);
+      }
+      for (int e = 0; e < num_elements(); ++e) {
+        const std::array<FemNodeIndex, Element::num_nodes>&
+            element_node_indices = elements_[e].node_indices();
+        for (int a = 0; a < Element::num_nodes; ++a) {
+          for (int b = 0; b < Element::num_nodes; ++b) {
+            const int i = element_node_indices[a];
+            const int j = element_node_indices[b];
+            if (i > j) sparsity_pattern[j].push_back(i);
+          }
+        }
+      }
+      for (std::vector<int>& column : sparsity_pattern) {
+        std::sort(column.begin(), column.end());
+        column.erase(std::unique(column.begin(), column.end()), column.end());
+      }
+      return std::make_unique<Block3x3SparseSymmetricMatrix>(
+          std::move(sparsity_pattern));
+    } else {
+      DRAKE_UNREACHABLE();
+    }
+  }
+
   void DeclareCacheEntries(
       internal::FemStateSystem<T>* fem_state_system) final {
+    /* This is invoked every time new elements are built into the model, so
+     it's the right time to update the element coloring. */
+    UpdateElementColoring();
     element_data_index_ =
         fem_state_system
             ->DeclareCacheEntry(
@@ -205,14 +308,50 @@ class FemModelImpl : public FemModel<typename Element::T> {
     DRAKE_DEMAND(data != nullptr);
     data->resize(num_elements());
     const FemState<T> fem_state(&(this->fem_state_system()), &context);
-    for (int i = 0; i < num_elements(); ++i) {
-      (*data)[i] = elements_[i].ComputeData(fem_state);
+    /* The elements are processed in contiguous chunks so that elements can
+     compute their data in batches (see FemElement::ComputeDataForRange()).
+     Each chunk writes to its own entries, so no coloring is needed. */
+    const int num_chunks =
+        (num_elements() + kElementDataChunkSize - 1) / kElementDataChunkSize;
+    drake::internal::ParallelFor(num_chunks, [&](int c) {
+      const int begin = c * kElementDataChunkSize;
+      const int end = std::min(begin + kElementDataChunkSize, num_elements());
+      Element::ComputeDataForRange(elements_, begin, end, fem_state, data);
+    });
+  }
+
+  /* Partitions the elements into colors such that elements with the same color
+   don't share any node. */
+  void UpdateElementColoring() {
+    std::vector<std::vector<int>> element_nodes(num_elements());
+    for (int e = 0; e < num_elements(); ++e) {
+      const std::array<FemNodeIndex, Element::num_nodes>& element_node_indices =
+          elements_[e].node_indices();
+      element_nodes[e].assign(element_node_indices.begin(),
+                              element_node_indices.end());
+    }
+    element_colors_ = ComputeElementColoring(element_nodes);
+    max_num_elements_per_color_ = 0;
+    for (const std::vector<int>& color : element_colors_) {
+      max_num_elements_per_color_ =
+          std::max(max_num_elements_per_color_, static_cast<int>(color.size()));
     }
   }
 
+  /* The number of elements whose data is computed together in
+   CalcElementData(). It is large enough to fill the SIMD lanes of batched
+   constitutive model evaluations many times over and small enough for the
+   chunk's data to stay in cache and for the chunks to be balanced across
+   threads. */
+  static constexpr int kElementDataChunkSize = 64;
+
   /* FemElements owned by this model. */
   std::vector<Element> elements_;
   systems::CacheIndex element_data_index_;
+  /* The indices of the elements grouped by color. See UpdateElementColoring().
+   */
+  std::vector<std::vector<int>> element_colors_;
+  int max_num_elements_per_color_{0};
 };
 
 }  // namespace internal
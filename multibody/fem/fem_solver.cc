@@ -11,20 +11,61 @@ namespace internal {
 
 template <typename T>
 void FemSolverScratchData<T>::Resize(const FemModel<T>& model) {
+  if (model_topology_id_ == model.topology_id()) {
+    DRAKE_ASSERT(model_ == &model);
+    return;
+  }
+  model_ = &model;
+  model_topology_id_ = model.topology_id();
   b_.resize(model.num_dofs());
   dz_.resize(model.num_dofs());
-  tangent_matrix_ = model.MakePetscSymmetricBlockSparseTangentMatrix();
+  /* The tangent matrices are reallocated on the next access. */
+  tangent_matrix_.reset();
+  block_tangent_matrix_.reset();
+  /* The symbolic analysis is redone on the next solve as the sparsity pattern
+   no longer matches. */
+  cholesky_solver_ = internal::BlockSparseCholeskySolver();
+}
+
+template <typename T>
+const internal::PetscSymmetricBlockSparseMatrix&
+FemSolverScratchData<T>::tangent_matrix() const {
+  if (tangent_matrix_ == nullptr) {
+    DRAKE_DEMAND(model_ != nullptr);
+    tangent_matrix_ = model_->MakePetscSymmetricBlockSparseTangentMatrix();
+  }
+  return *tangent_matrix_;
+}
+
+template <typename T>
+const internal::Block3x3SparseSymmetricMatrix&
+FemSolverScratchData<T>::block_tangent_matrix() const {
+  if (block_tangent_matrix_ == nullptr) {
+    DRAKE_DEMAND(model_ != nullptr);
+    block_tangent_matrix_ = model_->MakeBlock3x3SparseSymmetricTangentMatrix();
+  }
+  return *block_tangent_matrix_;
 }
 
 template <typename T>
 std::unique_ptr<FemSolverScratchData<T>> FemSolverScratchData<T>::Clone()
     const {
   std::unique_ptr<FemSolverScratchData<T>> clone(new FemSolverScratchData<T>());
+  clone->model_ = this->model_;
+  clone->model_topology_id_ = this->model_topology_id_;
   clone->b_ = this->b_;
   clone->dz_ = this->dz_;
-  DRAKE_DEMAND(tangent_matrix_ != nullptr);
-  tangent_matrix_->AssembleIfNecessary();
-  clone->tangent_matrix_ = this->tangent_matrix_->Clone();
+  if (tangent_matrix_ != nullptr) {
+    tangent_matrix_->AssembleIfNecessary();
+    clone->tangent_matrix_ = this->tangent_matrix_->Clone();
+  }
+  if (block_tangent_matrix_ != nullptr) {
+    clone->block_tangent_matrix_ =
+        std::make_unique<internal::Block3x3SparseSymmetricMatrix>(
+            *this->block_tangent_matrix_);
+  }
+  clone->cholesky_solver_ = this->cholesky_solver_;
+  clone->conjugate_gradient_ = this->conjugate_gradient_;
   return clone;
 }
 
@@ -83,9 +124,7 @@ int FemSolver<T>::SolveWithInitialGuess(
   scratch->Resize(*model_);
 
   VectorX<T>& b = scratch->mutable_b();
-  VectorX<T>& dz = scratch->mutable_dz();
-  internal::PetscSymmetricBlockSparseMatrix& tangent_matrix =
-      scratch->mutable_tangent_matrix();
+  const VectorX<T>& dz = scratch->dz();
 
   model_->ApplyBoundaryCondition(state);
   model_->CalcResidual(*state, &b);
@@ -101,19 +140,8 @@ int FemSolver<T>::SolveWithInitialGuess(
          /* Equivalent to residual_norm < absolute_tolerance_ on first
             iteration. */
          !solver_converged(residual_norm, initial_residual_norm)) {
-    model_->CalcTangentMatrix(*state, integrator_->GetWeights(),
-                              &tangent_matrix);
-    tangent_matrix.AssembleIfNecessary();
-    /* Solve for A * dz = -b, where A is the tangent matrix. */
-    tangent_matrix.set_relative_tolerance(
-        linear_solve_tolerance(residual_norm, initial_residual_norm));
-    const auto linear_solve_status =
-        tangent_matrix.Solve(internal::PetscSymmetricBlockSparseMatrix::
-                                 SolverType::kConjugateGradient,
-                             internal::PetscSymmetricBlockSparseMatrix::
-                                 PreconditionerType::kIncompleteCholesky,
-                             -b, &dz);
-    if (linear_solve_status == PetscSolverStatus::kFailure) {
+    if (!SolveLinearSystem(*state, residual_norm, initial_residual_norm,
+                           scratch)) {
       drake::log()->warn(
           "Linear solve did not converge in Newton iterations in FemSolver.");
       return -1;
@@ -129,6 +157,68 @@ int FemSolver<T>::SolveWithInitialGuess(
   return iter;
 }
 
+template <typename T>
+bool FemSolver<T>::SolveLinearSystem(const FemState<T>& state,
+                                     const T& residual_norm,
+                                     const T& initial_residual_norm,
+                                     FemSolverScratchData<T>* scratch) const {
+  const VectorX<T>& b = scratch->b();
+  VectorX<T>& dz = scratch->mutable_dz();
+  const double tolerance =
+      linear_solve_tolerance(residual_norm, initial_residual_norm);
+  if (linear_solver_type_ == LinearSolverType::kPetscConjugateGradient) {
+    internal::PetscSymmetricBlockSparseMatrix& tangent_matrix =
+        scratch->mutable_tangent_matrix();
+    model_->CalcTangentMatrix(state, integrator_->GetWeights(),
+                              &tangent_matrix);
+    tangent_matrix.AssembleIfNecessary();
+    /* Solve for A * dz = -b, where A is the tangent matrix. */
+    tangent_matrix.set_relative_tolerance(tolerance);
+    const auto linear_solve_status =
+        tangent_matrix.Solve(internal::PetscSymmetricBlockSparseMatrix::
+                                 SolverType::kConjugateGradient,
+                             internal::PetscSymmetricBlockSparseMatrix::
+                                 PreconditionerType::kIncompleteCholesky,
+                             -b, &dz);
+    return linear_solve_status != PetscSolverStatus::kFailure;
+  }
+
+  internal::Block3x3SparseSymmetricMatrix& tangent_matrix =
+      scratch->mutable_block_tangent_matrix();
+  model_->CalcTangentMatrix(state, integrator_->GetWeights(), &tangent_matrix);
+  if (linear_solver_type_ == LinearSolverType::kBlockSparseCholesky) {
+    internal::BlockSparseCholeskySolver& cholesky =
+        scratch->mutable_cholesky_solver();
+    /* The symbolic analysis only depends on the sparsity pattern and is reused
+     across Newton iterations and time steps. */
+    if (!cholesky.is_analyzed_for(tangent_matrix)) {
+      cholesky.AnalyzePattern(tangent_matrix);
+    }
+    if (!cholesky.Factor(tangent_matrix)) return false;
+    dz = -b;
+    cholesky.SolveInPlace(&dz);
+    return true;
+  }
+
+  using PreconditionerType =
+      internal::BlockSparseConjugateGradient::PreconditionerType;
+  const PreconditionerType preconditioner_type =
+      linear_solver_type_ ==
+              LinearSolverType::kBlockSparseConjugateGradientBlockJacobi
+          ? PreconditionerType::kBlockJacobi
+          : PreconditionerType::kBlockIncompleteCholesky;
+  internal::BlockSparseConjugateGradient& cg =
+      scratch->mutable_conjugate_gradient();
+  if (cg.preconditioner_type() != preconditioner_type) {
+    cg = internal::BlockSparseConjugateGradient(preconditioner_type);
+  }
+  cg.set_relative_tolerance(tolerance);
+  if (!cg.Compute(tangent_matrix)) return false;
+  /* Solve for A * dz = -b with a zero initial guess. */
+  dz.setZero();
+  return cg.Solve(tangent_matrix, -b, &dz);
+}
+
 }  // namespace internal
 }  // namespace fem
 }  // namespace multibody
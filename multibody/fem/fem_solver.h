@@ -1,8 +1,12 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include "drake/common/eigen_types.h"
+#include "drake/multibody/fem/block_3x3_sparse_symmetric_matrix.h"
+#include "drake/multibody/fem/block_sparse_cholesky_solver.h"
+#include "drake/multibody/fem/block_sparse_conjugate_gradient.h"
 #include "drake/multibody/fem/discrete_time_integrator.h"
 #include "drake/multibody/fem/fem_model.h"
 #include "drake/multibody/fem/fem_state.h"
@@ -13,7 +17,13 @@ namespace fem {
 namespace internal {
 
 /* Holds the scratch data used in the solver to avoid unnecessary
- reallocation.
+ reallocation. Besides the tangent matrices, the scratch data also owns the
+ native linear solvers so that the symbolic analysis of the tangent matrix
+ (e.g. the fill-reducing ordering of BlockSparseCholeskySolver) and the
+ preconditioner storage are reused across Newton iterations and time steps.
+ The tangent matrices are only allocated when they are first accessed, so a
+ scratch data only holds the tangent matrix used by its linear solver (e.g.
+ the PETSc matrix is never allocated when a native solver is used).
  @tparam_double_only */
 template <typename T>
 class FemSolverScratchData {
@@ -23,7 +33,9 @@ class FemSolverScratchData {
   /* Constructs a scratch data that is compatible with the given model. */
   explicit FemSolverScratchData(const FemModel<T>& model) { Resize(model); }
 
-  /* Resizes scratch data to have sizes compatible with the given `model`. */
+  /* Resizes scratch data to have sizes compatible with the given `model`. This
+   is a no-op if the scratch data is already compatible with `model`, which
+   preserves the tangent matrices and the state of the linear solvers. */
   void Resize(const FemModel<T>& model);
 
   std::unique_ptr<FemSolverScratchData<T>> Clone() const;
@@ -34,21 +46,53 @@ class FemSolverScratchData {
   const VectorX<T>& b() const { return b_; }
   /* Returns the solution to A * dz = -b, where A is the tangent matrix. */
   const VectorX<T>& dz() const { return dz_; }
-  const internal::PetscSymmetricBlockSparseMatrix& tangent_matrix() const {
-    return *tangent_matrix_;
+  /* Returns the tangent matrix used by the PETSc linear solver. The matrix is
+   allocated on first access. */
+  const internal::PetscSymmetricBlockSparseMatrix& tangent_matrix() const;
+  /* Returns the tangent matrix in the native block sparse format used by
+   the kBlockSparseCholesky and kBlockSparseConjugateGradient linear
+   solvers. The matrix is allocated on first access. */
+  const internal::Block3x3SparseSymmetricMatrix& block_tangent_matrix() const;
+  /* Returns true if any of the tangent matrices has been allocated. */
+  bool has_tangent_matrix() const {
+    return tangent_matrix_ != nullptr || block_tangent_matrix_ != nullptr;
   }
 
   VectorX<T>& mutable_b() { return b_; }
   VectorX<T>& mutable_dz() { return dz_; }
   internal::PetscSymmetricBlockSparseMatrix& mutable_tangent_matrix() {
+    tangent_matrix();
     return *tangent_matrix_;
   }
+  internal::Block3x3SparseSymmetricMatrix& mutable_block_tangent_matrix() {
+    block_tangent_matrix();
+    return *block_tangent_matrix_;
+  }
+  internal::BlockSparseCholeskySolver& mutable_cholesky_solver() {
+    return cholesky_solver_;
+  }
+  internal::BlockSparseConjugateGradient& mutable_conjugate_gradient() {
+    return conjugate_gradient_;
+  }
 
  private:
   /* Private default constructor to facilitate cloning. */
   FemSolverScratchData() = default;
 
-  std::unique_ptr<internal::PetscSymmetricBlockSparseMatrix> tangent_matrix_;
+  /* The model and the model topology that the scratch data is sized for. The
+   topology id, rather than the model's address, is the key because elements
+   can be added to a model after the scratch data is allocated, and because a
+   different model can be allocated at the address of a destroyed one. */
+  const FemModel<T>* model_{nullptr};
+  int64_t model_topology_id_{0};
+  /* The tangent matrices are lazily allocated, see tangent_matrix() and
+   block_tangent_matrix(). */
+  mutable std::unique_ptr<internal::PetscSymmetricBlockSparseMatrix>
+      tangent_matrix_;
+  mutable std::unique_ptr<internal::Block3x3SparseSymmetricMatrix>
+      block_tangent_matrix_;
+  internal::BlockSparseCholeskySolver cholesky_solver_;
+  internal::BlockSparseConjugateGradient conjugate_gradient_;
   VectorX<T> b_;
   VectorX<T> dz_;
 };
@@ -60,12 +104,31 @@ class FemSolverScratchData {
  constraints) of the spatially discretized FEM model by one time step according
  to the prescribed discrete time integration scheme using a Newton-Raphson
  solver.
+
+ The linear systems in the Newton-Raphson iterations are solved with the
+ linear solver selected with set_linear_solver_type(). See LinearSolverType.
  @tparam_double_only */
 template <typename T>
 class FemSolver {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(FemSolver);
 
+  /* The linear solver used to solve for the Newton step. */
+  enum class LinearSolverType {
+    /* Conjugate gradient with incomplete Cholesky preconditioning through
+     PETSc. This is the default. */
+    kPetscConjugateGradient,
+    /* Native conjugate gradient with block incomplete Cholesky (IC(0))
+     preconditioning. See BlockSparseConjugateGradient. */
+    kBlockSparseConjugateGradient,
+    /* Native conjugate gradient with block Jacobi preconditioning. See
+     BlockSparseConjugateGradient. */
+    kBlockSparseConjugateGradientBlockJacobi,
+    /* Native supernodal sparse Cholesky factorization. See
+     BlockSparseCholeskySolver. */
+    kBlockSparseCholesky,
+  };
+
   /* Constructs a new FemSolver that solves the given `model` with the
    `integrator` provided to advance time.
    @note The `model` and `integrator` pointers persist in `this` FemSolver and
@@ -117,6 +180,14 @@ class FemSolver {
 
   double absolute_tolerance() const { return absolute_tolerance_; }
 
+  /* Sets the linear solver used in the Newton-Raphson iterations. The default
+   is LinearSolverType::kPetscConjugateGradient. */
+  void set_linear_solver_type(LinearSolverType linear_solver_type) {
+    linear_solver_type_ = linear_solver_type;
+  }
+
+  LinearSolverType linear_solver_type() const { return linear_solver_type_; }
+
   /* The solver is considered as converged if ‖r‖ <= max(εᵣ * ‖r₀‖, εₐ) where r
    and r₀ are `residual_norm` and `initial_residual_norm` respectively, and εᵣ
    and εₐ are relative and absolute tolerance respectively. */
@@ -146,6 +217,14 @@ class FemSolver {
   double linear_solve_tolerance(const T& residual_norm,
                                 const T& initial_residual_norm) const;
 
+  /* Computes the tangent matrix at `state` and solves A * dz = -b with the
+   linear solver selected by `linear_solver_type_`, where A is the tangent
+   matrix and b and dz are stored in `scratch`. Returns false if the linear
+   solve fails. */
+  bool SolveLinearSystem(const FemState<T>& state, const T& residual_norm,
+                         const T& initial_residual_norm,
+                         FemSolverScratchData<T>* scratch) const;
+
   /* The FEM model being solved by `this` solver. */
   const FemModel<T>* model_{nullptr};
   /* The discrete time integrator the solver uses. */
@@ -156,6 +235,8 @@ class FemSolver {
   /* Max number of Newton-Raphson iterations the solver takes before it gives
    up. */
   int kMaxIterations_{100};
+  LinearSolverType linear_solver_type_{
+      LinearSolverType::kPetscConjugateGradient};
 };
 
 }  // namespace internal
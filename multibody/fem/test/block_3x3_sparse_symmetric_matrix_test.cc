@@ -0,0 +1,123 @@
+#include "drake/multibody/fem/block_3x3_sparse_symmetric_matrix.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+namespace {
+
+using Eigen::Matrix3d;
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+constexpr double kEps = 1e-14;
+
+// clang-format off
+const Matrix3d A00 =
+    (Eigen::Matrix3d() << 1, 2, 3,
+                          2, 5, 6,
+                          3, 6, 19).finished();
+const Matrix3d A11 =
+    (Eigen::Matrix3d() << 11, 12, 13,
+                          12, 15, 16,
+                          13, 16, 19).finished();
+const Matrix3d A20 =
+    (Eigen::Matrix3d() << 11, 12, 13,
+                          14, 15, 16,
+                          17, 18, 19).finished();
+const Matrix3d A22 =
+    (Eigen::Matrix3d() << 21, 22, 23,
+                          22, 25, 26,
+                          23, 26, 29).finished();
+// clang-format on
+
+/* Makes the dense matrix
+   A =   A00 |  0  | A02
+        -----------------
+          0  | A11 |  0
+        -----------------
+         A20 |  0  | A22
+where A02 = A20.transpose(). */
+MatrixXd MakeDenseMatrix() {
+  MatrixXd A = MatrixXd::Zero(9, 9);
+  A.block<3, 3>(0, 0) = A00;
+  A.block<3, 3>(3, 3) = A11;
+  A.block<3, 3>(6, 0) = A20;
+  A.block<3, 3>(0, 6) = A20.transpose();
+  A.block<3, 3>(6, 6) = A22;
+  return A;
+}
+
+/* Makes the same matrix as MakeDenseMatrix() in the block sparse format by
+ adding its blocks in two calls to AddToBlock(). */
+Block3x3SparseSymmetricMatrix MakeBlockSparseMatrix() {
+  Block3x3SparseSymmetricMatrix A({{0, 2}, {1}, {2}});
+  const MatrixXd dense = MakeDenseMatrix();
+  Vector2<int> indices_02(0, 2);
+  MatrixXd A_02(6, 6);
+  A_02 << dense.block<3, 3>(0, 0), dense.block<3, 3>(0, 6),
+      dense.block<3, 3>(6, 0), dense.block<3, 3>(6, 6);
+  A.AddToBlock(indices_02, A_02);
+  A.AddToBlock(Vector1<int>(1), A11);
+  return A;
+}
+
+GTEST_TEST(Block3x3SparseSymmetricMatrixTest, Construction) {
+  const Block3x3SparseSymmetricMatrix A({{0, 2}, {1}, {2}});
+  EXPECT_EQ(A.rows(), 9);
+  EXPECT_EQ(A.cols(), 9);
+  EXPECT_EQ(A.block_rows(), 3);
+  EXPECT_EQ(A.block_cols(), 3);
+  EXPECT_EQ(A.num_blocks(), 4);
+  EXPECT_TRUE(CompareMatrices(A.MakeDenseMatrix(), MatrixXd::Zero(9, 9)));
+  EXPECT_EQ(A.FindBlock(2, 0), 1);
+  EXPECT_EQ(A.FindBlock(1, 0), -1);
+  EXPECT_EQ(A.FindBlock(2, 2), 0);
+}
+
+GTEST_TEST(Block3x3SparseSymmetricMatrixTest, AddToBlock) {
+  Block3x3SparseSymmetricMatrix A = MakeBlockSparseMatrix();
+  EXPECT_TRUE(CompareMatrices(A.MakeDenseMatrix(), MakeDenseMatrix()));
+  EXPECT_TRUE(CompareMatrices(A.block(0, 1), A20));
+  EXPECT_TRUE(CompareMatrices(A.diagonal_block(1), A11));
+
+  /* Adding to a block outside of the sparsity pattern throws. */
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      A.AddToBlock(Vector2<int>(0, 1), MatrixXd::Ones(6, 6)),
+      ".*block \\(1, 0\\) is not in the sparsity pattern.*");
+
+  A.SetZero();
+  EXPECT_TRUE(CompareMatrices(A.MakeDenseMatrix(), MatrixXd::Zero(9, 9)));
+}
+
+GTEST_TEST(Block3x3SparseSymmetricMatrixTest, Multiply) {
+  const Block3x3SparseSymmetricMatrix A = MakeBlockSparseMatrix();
+  const VectorXd x = VectorXd::LinSpaced(9, 0.0, 1.0);
+  VectorXd y(9);
+  A.Multiply(x, &y);
+  EXPECT_TRUE(CompareMatrices(y, MakeDenseMatrix() * x, kEps));
+}
+
+GTEST_TEST(Block3x3SparseSymmetricMatrixTest, ZeroRowsAndColumns) {
+  Block3x3SparseSymmetricMatrix A = MakeBlockSparseMatrix();
+  const std::vector<int> indexes = {1, 4, 6};
+  A.ZeroRowsAndColumns(indexes, 2.0);
+  MatrixXd expected = MakeDenseMatrix();
+  for (int i : indexes) {
+    expected.row(i).setZero();
+    expected.col(i).setZero();
+    expected(i, i) = 2.0;
+  }
+  EXPECT_TRUE(CompareMatrices(A.MakeDenseMatrix(), expected));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,116 @@
+#include "drake/multibody/fem/block_sparse_cholesky_solver.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+namespace {
+
+using Eigen::Matrix3d;
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+/* Makes a symmetric positive definite matrix with the sparsity of a k×k×k grid
+ of nodes where each node is coupled to its axis-aligned neighbors. Each edge
+ contributes a spring-like element matrix [K -K; -K K] with a SPD block K and
+ each node contributes a scaled identity mass block. */
+Block3x3SparseSymmetricMatrix MakeGridMatrix(int k) {
+  const int n = k * k * k;
+  auto node = [k](int x, int y, int z) {
+    return x + k * (y + k * z);
+  };
+  std::vector<std::vector<int>> pattern(n);
+  std::vector<std::pair<int, int>> edges;
+  for (int z = 0; z < k; ++z) {
+    for (int y = 0; y < k; ++y) {
+      for (int x = 0; x < k; ++x) {
+        const int i = node(x, y, z);
+        pattern[i].push_back(i);
+        if (x + 1 < k) edges.emplace_back(i, node(x + 1, y, z));
+        if (y + 1 < k) edges.emplace_back(i, node(x, y + 1, z));
+        if (z + 1 < k) edges.emplace_back(i, node(x, y, z + 1));
+      }
+    }
+  }
+  for (const auto& [i, j] : edges) {
+    pattern[std::min(i, j)].push_back(std::max(i, j));
+  }
+  for (auto& column : pattern) {
+    std::sort(column.begin(), column.end());
+  }
+  Block3x3SparseSymmetricMatrix A(std::move(pattern));
+  for (int e = 0; e < static_cast<int>(edges.size()); ++e) {
+    const auto& [i, j] = edges[e];
+    Matrix3d B;
+    B << 1, 0.1 * (e % 3), 0, 0, 1, 0.2, 0.05 * (e % 5), 0, 1;
+    const Matrix3d K = B * B.transpose();
+    MatrixXd element(6, 6);
+    element << K, -K, -K, K;
+    A.AddToBlock(Vector2<int>(i, j), element);
+  }
+  for (int i = 0; i < n; ++i) {
+    A.AddToBlock(Vector1<int>(i), 0.1 * Matrix3d::Identity());
+  }
+  return A;
+}
+
+GTEST_TEST(BlockSparseCholeskySolverTest, SolveMatchesDense) {
+  const Block3x3SparseSymmetricMatrix A = MakeGridMatrix(4);
+  BlockSparseCholeskySolver solver;
+  EXPECT_FALSE(solver.is_analyzed_for(A));
+  solver.AnalyzePattern(A);
+  EXPECT_TRUE(solver.is_analyzed_for(A));
+  EXPECT_EQ(solver.block_cols(), 64);
+  /* Fill-in is expected but the factor shouldn't be dense. */
+  EXPECT_GE(solver.num_factor_blocks(), A.num_blocks());
+  EXPECT_LT(solver.num_factor_blocks(), 64 * 65 / 2);
+  EXPECT_LT(solver.num_supernodes(), 64);
+  ASSERT_TRUE(solver.Factor(A));
+
+  const MatrixXd dense_A = A.MakeDenseMatrix();
+  const VectorXd b = VectorXd::LinSpaced(A.rows(), -1.0, 2.0);
+  const VectorXd expected_x = dense_A.llt().solve(b);
+  EXPECT_TRUE(CompareMatrices(solver.Solve(b), expected_x, 1e-12));
+  VectorXd x = b;
+  solver.SolveInPlace(&x);
+  EXPECT_TRUE(CompareMatrices(x, expected_x, 1e-12));
+}
+
+/* The symbolic analysis is reused when only the values change. */
+GTEST_TEST(BlockSparseCholeskySolverTest, RefactorWithSamePattern) {
+  Block3x3SparseSymmetricMatrix A = MakeGridMatrix(3);
+  BlockSparseCholeskySolver solver;
+  solver.AnalyzePattern(A);
+  ASSERT_TRUE(solver.Factor(A));
+  for (int i = 0; i < A.block_cols(); ++i) {
+    A.AddToBlock(Vector1<int>(i), (1.0 + i) * Matrix3d::Identity());
+  }
+  ASSERT_TRUE(solver.is_analyzed_for(A));
+  ASSERT_TRUE(solver.Factor(A));
+  const VectorXd b = VectorXd::Ones(A.rows());
+  EXPECT_TRUE(CompareMatrices(solver.Solve(b),
+                              A.MakeDenseMatrix().llt().solve(b), 1e-12));
+}
+
+GTEST_TEST(BlockSparseCholeskySolverTest, NotPositiveDefinite) {
+  Block3x3SparseSymmetricMatrix A({{0, 1}, {1}});
+  MatrixXd indefinite = MatrixXd::Identity(6, 6);
+  indefinite(4, 4) = -1.0;
+  A.AddToBlock(Vector2<int>(0, 1), indefinite);
+  BlockSparseCholeskySolver solver;
+  solver.AnalyzePattern(A);
+  EXPECT_FALSE(solver.Factor(A));
+  DRAKE_EXPECT_THROWS_MESSAGE(solver.Solve(VectorXd::Zero(6)),
+                              ".*no valid factorization.*");
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
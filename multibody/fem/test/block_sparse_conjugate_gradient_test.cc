@@ -0,0 +1,114 @@
+#include "drake/multibody/fem/block_sparse_conjugate_gradient.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+namespace {
+
+using Eigen::Matrix3d;
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+using PreconditionerType = BlockSparseConjugateGradient::PreconditionerType;
+
+/* Makes a symmetric positive definite matrix with the sparsity of a chain of
+ `n` nodes where consecutive nodes are coupled. */
+Block3x3SparseSymmetricMatrix MakeChainMatrix(int n) {
+  std::vector<std::vector<int>> pattern(n);
+  for (int i = 0; i < n; ++i) {
+    pattern[i].push_back(i);
+    if (i + 1 < n) pattern[i].push_back(i + 1);
+  }
+  Block3x3SparseSymmetricMatrix A(std::move(pattern));
+  for (int i = 0; i + 1 < n; ++i) {
+    Matrix3d B;
+    B << 2, 0.3, 0, 0.1 * (i % 4), 1, 0, 0, 0.2, 3;
+    const Matrix3d K = B * B.transpose();
+    MatrixXd element(6, 6);
+    element << K, -K, -K, K;
+    A.AddToBlock(Vector2<int>(i, i + 1), element);
+  }
+  for (int i = 0; i < n; ++i) {
+    A.AddToBlock(Vector1<int>(i), 0.01 * Matrix3d::Identity());
+  }
+  return A;
+}
+
+class BlockSparseConjugateGradientTest
+    : public ::testing::TestWithParam<PreconditionerType> {};
+
+TEST_P(BlockSparseConjugateGradientTest, Solve) {
+  const Block3x3SparseSymmetricMatrix A = MakeChainMatrix(20);
+  BlockSparseConjugateGradient cg(GetParam());
+  EXPECT_EQ(cg.preconditioner_type(), GetParam());
+  cg.set_relative_tolerance(1e-12);
+  /* Allow more iterations than the size of the system to accommodate the
+   loss of conjugacy due to round-off in the unpreconditioned case. */
+  cg.set_max_iterations(10 * A.rows());
+  ASSERT_TRUE(cg.Compute(A));
+  const VectorXd b = VectorXd::LinSpaced(A.rows(), -1.0, 1.0);
+  VectorXd x = VectorXd::Zero(A.rows());
+  ASSERT_TRUE(cg.Solve(A, b, &x));
+  const VectorXd expected_x = A.MakeDenseMatrix().llt().solve(b);
+  EXPECT_TRUE(CompareMatrices(x, expected_x, 1e-8, MatrixCompareType::relative));
+  EXPECT_GT(cg.num_iterations(), 0);
+
+  /* Solving again from the solution converges immediately. */
+  ASSERT_TRUE(cg.Solve(A, b, &x));
+  EXPECT_EQ(cg.num_iterations(), 0);
+}
+
+/* An indefinite matrix is reported by Compute() rather than thrown on or
+ turned into NaNs in the preconditioner. */
+TEST_P(BlockSparseConjugateGradientTest, IndefiniteMatrix) {
+  Block3x3SparseSymmetricMatrix A = MakeChainMatrix(5);
+  A.AddToBlock(Vector1<int>(2), -100.0 * Matrix3d::Identity());
+  BlockSparseConjugateGradient cg(GetParam());
+  /* Without a preconditioner there is nothing to compute. */
+  EXPECT_EQ(cg.Compute(A), GetParam() == PreconditionerType::kNone);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    AllPreconditioners, BlockSparseConjugateGradientTest,
+    ::testing::Values(PreconditionerType::kNone,
+                      PreconditionerType::kBlockJacobi,
+                      PreconditionerType::kBlockIncompleteCholesky));
+
+/* For a matrix whose lower triangular part has no fill-in under Cholesky
+ factorization (such as a chain), block IC(0) is the exact factorization and CG
+ converges in a single iteration. */
+GTEST_TEST(BlockSparseConjugateGradientExactTest, IncompleteCholeskyIsExact) {
+  const Block3x3SparseSymmetricMatrix A = MakeChainMatrix(10);
+  BlockSparseConjugateGradient cg(PreconditionerType::kBlockIncompleteCholesky);
+  cg.set_relative_tolerance(1e-10);
+  ASSERT_TRUE(cg.Compute(A));
+  const VectorXd b = VectorXd::Ones(A.rows());
+  VectorXd z(A.rows());
+  cg.ApplyPreconditioner(b, &z);
+  EXPECT_TRUE(CompareMatrices(z, A.MakeDenseMatrix().llt().solve(b), 1e-10,
+                              MatrixCompareType::relative));
+  VectorXd x = VectorXd::Zero(A.rows());
+  ASSERT_TRUE(cg.Solve(A, b, &x));
+  EXPECT_EQ(cg.num_iterations(), 1);
+}
+
+GTEST_TEST(BlockSparseConjugateGradientExactTest, MaxIterations) {
+  const Block3x3SparseSymmetricMatrix A = MakeChainMatrix(30);
+  BlockSparseConjugateGradient cg(PreconditionerType::kNone);
+  cg.set_relative_tolerance(1e-14);
+  cg.set_max_iterations(2);
+  ASSERT_TRUE(cg.Compute(A));
+  VectorXd x = VectorXd::Zero(A.rows());
+  EXPECT_FALSE(cg.Solve(A, VectorXd::Ones(A.rows()), &x));
+  EXPECT_EQ(cg.num_iterations(), 2);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
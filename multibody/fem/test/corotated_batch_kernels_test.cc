@@ -0,0 +1,202 @@
+#include "drake/multibody/fem/corotated_batch_kernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/math/rotation_matrix.h"
+#include "drake/multibody/fem/corotated_model.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+namespace {
+
+using Eigen::Matrix3d;
+
+constexpr double kTol = 1e-12;
+constexpr double kYoungsModulus = 3e4;
+constexpr double kPoissonsRatio = 0.3;
+
+/* Owns the structure-of-arrays storage for the batched kernels at the given
+ locations. */
+class BatchStorage {
+ public:
+  BatchStorage(const std::vector<Matrix3d>& F, double mu, double lambda)
+      : size_(F.size()), stride_((size_ + 3) / 4 * 4) {
+    storage_.resize(130 * stride_);
+    double* next = storage_.data();
+    auto take = [&next, this](int num_arrays) {
+      double* result = next;
+      next += num_arrays * stride_;
+      return result;
+    };
+    F_ = take(9);
+    mu_ = take(1);
+    lambda_ = take(1);
+    arrays_.size = size_;
+    arrays_.stride = stride_;
+    arrays_.F = F_;
+    arrays_.mu = mu_;
+    arrays_.lambda = lambda_;
+    arrays_.R = take(9);
+    arrays_.S = take(9);
+    arrays_.Jm1 = take(1);
+    arrays_.JFinvT = take(9);
+    arrays_.Psi = take(1);
+    arrays_.P = take(9);
+    arrays_.dPdF = take(81);
+    for (int i = 0; i < stride_; ++i) {
+      const Matrix3d F_i = i < size_ ? F[i] : Matrix3d::Identity();
+      for (int k = 0; k < 9; ++k) {
+        F_[k * stride_ + i] = F_i(k);
+      }
+      mu_[i] = mu;
+      lambda_[i] = lambda;
+    }
+  }
+
+  const CorotatedBatchArrays& arrays() const { return arrays_; }
+
+  /* Reads the 3x3 matrix starting at `array` for location i. */
+  Matrix3d GetMatrix3(const double* array, int i) const {
+    Matrix3d result;
+    for (int k = 0; k < 9; ++k) {
+      result(k) = array[k * stride_ + i];
+    }
+    return result;
+  }
+
+  Eigen::Matrix<double, 9, 9> GetdPdF(int i) const {
+    Eigen::Matrix<double, 9, 9> result;
+    for (int k = 0; k < 81; ++k) {
+      result(k) = arrays_.dPdF[k * stride_ + i];
+    }
+    return result;
+  }
+
+ private:
+  int size_{};
+  int stride_{};
+  std::vector<double> storage_;
+  double* F_{};
+  double* mu_{};
+  double* lambda_{};
+  CorotatedBatchArrays arrays_;
+};
+
+/* Returns a collection of deformation gradients that covers small and large
+ deformations, inverted elements, and nearly degenerate elements. Its size is
+ deliberately not a multiple of 4. */
+std::vector<Matrix3d> MakeDeformationGradients() {
+  std::vector<Matrix3d> F;
+  F.push_back(Matrix3d::Identity());
+  const Matrix3d R =
+      math::RotationMatrix<double>(math::RollPitchYaw<double>(1.0, 2.0, 3.0))
+          .matrix();
+  // clang-format off
+  const Matrix3d S = (Matrix3d() <<
+         6, 1, 2,
+         1, 4, 1,
+         2, 1, 5).finished();
+  // clang-format on
+  F.push_back(R);
+  F.push_back(R * S);
+  F.push_back(Matrix3d::Identity() + 0.01 * S);
+  /* Inverted. */
+  F.push_back(R * S * Vector3<double>(1, 1, -0.5).asDiagonal());
+  F.push_back(-R * S);
+  /* Nearly degenerate, and repeated singular values. */
+  F.push_back(R * Vector3<double>(1, 1e-3, 1e-4).asDiagonal());
+  F.push_back(R * Vector3<double>(2, 2, 1).asDiagonal() * R.transpose());
+  for (int i = 0; i < 21; ++i) {
+    const Matrix3d R_i =
+        math::RotationMatrix<double>(
+            math::RollPitchYaw<double>(0.3 * i, -0.7 * i, 1.1 * i))
+            .matrix();
+    Matrix3d F_i = R_i * (Matrix3d::Identity() + 0.05 * i * S / 6.0);
+    if (i % 4 == 3) F_i.col(i % 3) *= -0.2;
+    F.push_back(F_i);
+  }
+  return F;
+}
+
+/* Verifies the outputs of `calc` against CorotatedModelData and
+ CorotatedModel. */
+void VerifyAgainstCorotatedModel(
+    const std::function<bool(const CorotatedBatchArrays&)>& calc) {
+  const CorotatedModel<double, 1> model(kYoungsModulus, kPoissonsRatio);
+  const std::vector<Matrix3d> F = MakeDeformationGradients();
+  const BatchStorage storage(F, model.shear_modulus(),
+                             model.lame_first_parameter());
+  const CorotatedBatchArrays& arrays = storage.arrays();
+  ASSERT_TRUE(calc(arrays));
+  for (int i = 0; i < static_cast<int>(F.size()); ++i) {
+    SCOPED_TRACE(fmt::format("Location {}", i));
+    CorotatedModelData<double, 1> data;
+    data.UpdateData({F[i]});
+    std::array<double, 1> Psi;
+    std::array<Matrix3d, 1> P;
+    std::array<Eigen::Matrix<double, 9, 9>, 1> dPdF;
+    model.CalcElasticEnergyDensity(data, &Psi);
+    model.CalcFirstPiolaStress(data, &P);
+    model.CalcFirstPiolaStressDerivative(data, &dPdF);
+    /* Tolerances are relative to the scale of the quantities. The energy
+     density, the stress, and its derivative are additionally scaled by the
+     moduli, since roundoff in quantities that vanish (e.g. the stress of a
+     rigid rotation) is amplified by them. */
+    const double scale = std::max(1.0, F[i].norm());
+    const double moduli =
+        model.shear_modulus() + std::abs(model.lame_first_parameter());
+    EXPECT_TRUE(CompareMatrices(storage.GetMatrix3(arrays.R, i), data.R()[0],
+                                kTol));
+    EXPECT_TRUE(CompareMatrices(storage.GetMatrix3(arrays.S, i), data.S()[0],
+                                kTol * scale));
+    EXPECT_NEAR(arrays.Jm1[i], data.Jm1()[0], kTol * std::pow(scale, 3));
+    EXPECT_TRUE(CompareMatrices(storage.GetMatrix3(arrays.JFinvT, i),
+                                data.JFinvT()[0], kTol * scale * scale));
+    EXPECT_NEAR(arrays.Psi[i], Psi[0], kTol * (Psi[0] + moduli));
+    EXPECT_TRUE(CompareMatrices(storage.GetMatrix3(arrays.P, i), P[0],
+                                kTol * (P[0].norm() + moduli * scale)));
+    EXPECT_TRUE(CompareMatrices(storage.GetdPdF(i), dPdF[0],
+                                kTol * (dPdF[0].norm() + moduli)));
+  }
+}
+
+GTEST_TEST(CorotatedBatchKernelsTest, Portable) {
+  VerifyAgainstCorotatedModel(&CalcCorotatedBatchPortable);
+}
+
+GTEST_TEST(CorotatedBatchKernelsTest, Avx) {
+  if (!CorotatedBatchAvxSupported()) {
+    GTEST_SKIP() << "AVX2 is not supported on this build or processor.";
+  }
+  VerifyAgainstCorotatedModel(&CalcCorotatedBatchAvx);
+}
+
+GTEST_TEST(CorotatedBatchKernelsTest, Dispatch) {
+  VerifyAgainstCorotatedModel(&CalcCorotatedBatch);
+}
+
+/* The stress derivative is undefined when the sum of two singular values is
+ zero, which the kernels report. */
+GTEST_TEST(CorotatedBatchKernelsTest, UndefinedStressDerivative) {
+  const std::vector<Matrix3d> F = {Matrix3d::Identity(),
+                                   Vector3<double>(1, 1, -1).asDiagonal()};
+  const BatchStorage storage(F, 1.0, 1.0);
+  EXPECT_FALSE(CalcCorotatedBatchPortable(storage.arrays()));
+  EXPECT_FALSE(CalcCorotatedBatch(storage.arrays()));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
@@ -1,7 +1,12 @@
 #include "drake/multibody/fem/corotated_model.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/math/rotation_matrix.h"
 #include "drake/multibody/fem/test/constitutive_model_test_utilities.h"
 
 namespace drake {
@@ -30,6 +35,77 @@ GTEST_TEST(CorotatedModelTest, dPdFIsDerivativeOfP) {
   TestdPdFIsDerivativeOfP<CorotatedModel<AutoDiffXd, kNumLocations>>();
 }
 
+/* Tests that CalcBatch() agrees with the per-location Calc methods for a batch
+of models with different parameters. The batch size is deliberately not a
+multiple of the SIMD width. */
+template <typename T>
+void TestCalcBatch() {
+  using Model = CorotatedModel<T, kNumLocations>;
+  using Data = typename Model::Data;
+  using BatchEntry = typename Model::BatchEntry;
+  constexpr int kNumEntries = 7;
+  std::vector<Model> models;
+  std::vector<std::array<Matrix3<T>, kNumLocations>> F(kNumEntries);
+  std::vector<Data> data(kNumEntries);
+  std::vector<std::array<T, kNumLocations>> Psi(kNumEntries);
+  std::vector<std::array<Matrix3<T>, kNumLocations>> P(kNumEntries);
+  std::vector<std::array<Eigen::Matrix<T, 9, 9>, kNumLocations>> dPdF(
+      kNumEntries);
+  std::vector<BatchEntry> entries(kNumEntries);
+  for (int e = 0; e < kNumEntries; ++e) {
+    models.emplace_back(100.0 * (e + 1), 0.1 + 0.05 * e);
+  }
+  for (int e = 0; e < kNumEntries; ++e) {
+    for (int q = 0; q < kNumLocations; ++q) {
+      const Matrix3<double> R =
+          math::RotationMatrix<double>(
+              math::RollPitchYaw<double>(0.4 * e, -0.3 * q, 0.2 * e + q))
+              .matrix();
+      Matrix3<double> F_eq;
+      // clang-format off
+      F_eq << 1.2, 0.1 * e, 0.2,
+              0.3, 0.9, -0.1 * q,
+              0.0, 0.2, 1.1 - 0.3 * e;
+      // clang-format on
+      F[e][q] = (R * F_eq).template cast<T>();
+    }
+    entries[e] = {&models[e], &F[e], &data[e], &Psi[e], &P[e], &dPdF[e]};
+  }
+  Model::CalcBatch(entries);
+
+  for (int e = 0; e < kNumEntries; ++e) {
+    Data expected_data;
+    expected_data.UpdateData(F[e]);
+    std::array<T, kNumLocations> expected_Psi;
+    std::array<Matrix3<T>, kNumLocations> expected_P;
+    std::array<Eigen::Matrix<T, 9, 9>, kNumLocations> expected_dPdF;
+    models[e].CalcElasticEnergyDensity(expected_data, &expected_Psi);
+    models[e].CalcFirstPiolaStress(expected_data, &expected_P);
+    models[e].CalcFirstPiolaStressDerivative(expected_data, &expected_dPdF);
+    const double tol =
+        1e-12 * ExtractDoubleOrThrow(models[e].youngs_modulus());
+    for (int q = 0; q < kNumLocations; ++q) {
+      EXPECT_TRUE(CompareMatrices(data[e].deformation_gradient()[q],
+                                  F[e][q]));
+      EXPECT_TRUE(CompareMatrices(data[e].R()[q], expected_data.R()[q], 1e-14));
+      EXPECT_TRUE(CompareMatrices(data[e].S()[q], expected_data.S()[q], 1e-14));
+      EXPECT_NEAR(ExtractDoubleOrThrow(data[e].Jm1()[q]),
+                  ExtractDoubleOrThrow(expected_data.Jm1()[q]), 1e-14);
+      EXPECT_TRUE(CompareMatrices(data[e].JFinvT()[q],
+                                  expected_data.JFinvT()[q], 1e-14));
+      EXPECT_NEAR(ExtractDoubleOrThrow(Psi[e][q]),
+                  ExtractDoubleOrThrow(expected_Psi[q]), tol);
+      EXPECT_TRUE(CompareMatrices(P[e][q], expected_P[q], tol));
+      EXPECT_TRUE(CompareMatrices(dPdF[e][q], expected_dPdF[q], tol));
+    }
+  }
+}
+
+GTEST_TEST(CorotatedModelTest, CalcBatch) {
+  TestCalcBatch<double>();
+  TestCalcBatch<AutoDiffXd>();
+}
+
 }  // namespace test
 }  // namespace internal
 }  // namespace fem
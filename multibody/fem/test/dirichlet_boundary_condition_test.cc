@@ -71,6 +71,16 @@ class DirichletBoundaryConditionTest : public ::testing::Test {
     return A;
   }
 
+  /* Makes the same tangent matrix as MakePetscTangentMatrix() in the native
+   block sparse format. */
+  static Block3x3SparseSymmetricMatrix MakeBlockTangentMatrix() {
+    const DenseMatrix A_dense = MakePetscTangentMatrix()->MakeDenseMatrix();
+    Block3x3SparseSymmetricMatrix A({{0}, {1}});
+    A.mutable_block(0, 0) = A_dense.topLeftCorner<3, 3>();
+    A.mutable_block(1, 0) = A_dense.bottomRightCorner<3, 3>();
+    return A;
+  }
+
   /* The DirichletBoundaryCondition under test. */
   DirichletBoundaryCondition<double> bc_;
   unique_ptr<FemStateSystem<double>> fem_state_system_;
@@ -118,6 +128,10 @@ TEST_F(DirichletBoundaryConditionTest,
   auto A_petsc = MakePetscTangentMatrix();
   bc_.ApplyBoundaryConditionToTangentMatrix(A_petsc.get());
   EXPECT_TRUE(CompareMatrices(A_petsc->MakeDenseMatrix(), A_expected));
+
+  Block3x3SparseSymmetricMatrix A_block = MakeBlockTangentMatrix();
+  bc_.ApplyBoundaryConditionToTangentMatrix(&A_block);
+  EXPECT_TRUE(CompareMatrices(A_block.MakeDenseMatrix(), A_expected));
 }
 
 /* Tests out-of-bound boundary conditions throw an exception. */
@@ -135,6 +149,10 @@ TEST_F(DirichletBoundaryConditionTest, OutOfBound) {
   DRAKE_EXPECT_THROWS_MESSAGE(
       bc_.ApplyBoundaryConditionToTangentMatrix(A_petsc.get()),
       "An index of the Dirichlet boundary condition is out of range.");
+  Block3x3SparseSymmetricMatrix A_block = MakeBlockTangentMatrix();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      bc_.ApplyBoundaryConditionToTangentMatrix(&A_block),
+      "An index of the Dirichlet boundary condition is out of range.");
 }
 
 }  // namespace
@@ -0,0 +1,83 @@
+#include "drake/multibody/fem/element_coloring.h"
+
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include "drake/geometry/proximity/make_box_mesh.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+namespace {
+
+/* Verifies that every element is assigned exactly one color and that no two
+ elements with the same color share a node. */
+void CheckValidColoring(const std::vector<std::vector<int>>& element_nodes,
+                        const std::vector<std::vector<int>>& colors) {
+  std::vector<int> num_times_colored(element_nodes.size(), 0);
+  for (const std::vector<int>& color : colors) {
+    EXPECT_FALSE(color.empty());
+    std::set<int> nodes_in_color;
+    for (int e : color) {
+      ++num_times_colored[e];
+      for (int n : element_nodes[e]) {
+        EXPECT_TRUE(nodes_in_color.insert(n).second);
+      }
+    }
+  }
+  for (int count : num_times_colored) {
+    EXPECT_EQ(count, 1);
+  }
+}
+
+GTEST_TEST(ElementColoringTest, Empty) {
+  EXPECT_TRUE(ComputeElementColoring({}).empty());
+}
+
+GTEST_TEST(ElementColoringTest, Chain) {
+  /* A chain of segments 0-1-2-3-4. Greedy coloring alternates between two
+   colors. */
+  const std::vector<std::vector<int>> element_nodes = {
+      {0, 1}, {1, 2}, {2, 3}, {3, 4}};
+  const std::vector<std::vector<int>> colors =
+      ComputeElementColoring(element_nodes);
+  ASSERT_EQ(colors.size(), 2);
+  EXPECT_EQ(colors[0], std::vector<int>({0, 2}));
+  EXPECT_EQ(colors[1], std::vector<int>({1, 3}));
+  CheckValidColoring(element_nodes, colors);
+}
+
+GTEST_TEST(ElementColoringTest, DisjointElements) {
+  /* Elements that don't share any node all get the same color. */
+  const std::vector<std::vector<int>> element_nodes = {
+      {0, 1, 2, 3}, {4, 5, 6, 7}, {8, 9, 10, 11}};
+  const std::vector<std::vector<int>> colors =
+      ComputeElementColoring(element_nodes);
+  ASSERT_EQ(colors.size(), 1);
+  CheckValidColoring(element_nodes, colors);
+}
+
+GTEST_TEST(ElementColoringTest, TetrahedralMesh) {
+  const geometry::VolumeMesh<double> mesh =
+      geometry::internal::MakeBoxVolumeMesh<double>(
+          geometry::Box(1.0, 1.0, 1.0), 0.2);
+  std::vector<std::vector<int>> element_nodes(mesh.num_elements());
+  for (int e = 0; e < mesh.num_elements(); ++e) {
+    for (int a = 0; a < 4; ++a) {
+      element_nodes[e].push_back(mesh.element(e).vertex(a));
+    }
+  }
+  const std::vector<std::vector<int>> colors =
+      ComputeElementColoring(element_nodes);
+  /* The coloring should be much coarser than one element per color. */
+  EXPECT_LT(colors.size(), element_nodes.size() / 4);
+  CheckValidColoring(element_nodes, colors);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
@@ -1,5 +1,8 @@
 #include "drake/multibody/fem/fem_model.h"
 
+#include <utility>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -93,6 +96,40 @@ GTEST_TEST(FemModelTest, CalcTangentMatrix) {
                               MatrixCompareType::relative));
 }
 
+/* Verifies that the tangent matrix in the native block sparse format agrees
+ with the PETSc one. */
+GTEST_TEST(FemModelTest, CalcBlock3x3SparseSymmetricTangentMatrix) {
+  DummyModel model;
+  DummyModel::DummyBuilder builder(&model);
+  builder.AddTwoElementsWithSharedNodes();
+  builder.AddElementWithDistinctNodes();
+  builder.Build();
+  unique_ptr<FemState<double>> fem_state = model.MakeFemState();
+  const Vector3d weights(0.1, 0.2, 0.3);
+
+  unique_ptr<internal::PetscSymmetricBlockSparseMatrix> petsc_tangent_matrix =
+      model.MakePetscSymmetricBlockSparseTangentMatrix();
+  model.CalcTangentMatrix(*fem_state, weights, petsc_tangent_matrix.get());
+  petsc_tangent_matrix->AssembleIfNecessary();
+
+  unique_ptr<internal::Block3x3SparseSymmetricMatrix> tangent_matrix =
+      model.MakeBlock3x3SparseSymmetricTangentMatrix();
+  ASSERT_EQ(tangent_matrix->rows(), model.num_dofs());
+  ASSERT_EQ(tangent_matrix->cols(), model.num_dofs());
+  /* The two elements sharing nodes couple 4 nodes each, while the element
+   with distinct nodes adds 4 more nodes, giving 10 + 10 - 3 + 10 lower
+   triangular blocks, where 3 blocks are shared between the first two
+   elements. */
+  EXPECT_EQ(tangent_matrix->num_blocks(), 27);
+  /* Fill the matrix with garbage to verify that it's cleared. */
+  tangent_matrix->mutable_block(0, 0) = Eigen::Matrix3d::Constant(42.0);
+  model.CalcTangentMatrix(*fem_state, weights, tangent_matrix.get());
+  EXPECT_TRUE(CompareMatrices(tangent_matrix->MakeDenseMatrix(),
+                              petsc_tangent_matrix->MakeDenseMatrix(),
+                              std::numeric_limits<double>::epsilon(),
+                              MatrixCompareType::relative));
+}
+
 /* Verifies that performing calculations on incompatible model and states throws
  an exception. */
 GTEST_TEST(FemModelTest, IncompatibleModelState) {
@@ -126,6 +163,26 @@ GTEST_TEST(FemModelTest, IncompatibleModelState) {
       "CalcTangentMatrix.* model and state are not compatible.");
 }
 
+/* Verifies that writing the tangent matrix into a native matrix whose sparsity
+ pattern misses blocks of the model throws (rather than terminating the process
+ when the elements are processed in parallel). */
+GTEST_TEST(FemModelTest, CalcTangentMatrixWithIncompatiblePattern) {
+  DummyModel model;
+  DummyModel::DummyBuilder builder(&model);
+  builder.AddTwoElementsWithSharedNodes();
+  builder.Build();
+  unique_ptr<FemState<double>> fem_state = model.MakeFemState();
+  std::vector<std::vector<int>> diagonal_pattern(model.num_nodes());
+  for (int j = 0; j < model.num_nodes(); ++j) {
+    diagonal_pattern[j].push_back(j);
+  }
+  Block3x3SparseSymmetricMatrix tangent_matrix(std::move(diagonal_pattern));
+  const Vector3d weights(0.1, 0.2, 0.3);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      model.CalcTangentMatrix(*fem_state, weights, &tangent_matrix),
+      ".*block .* is not in the sparsity pattern.");
+}
+
 /* Verifies that multiple builders can build into the same FemModel. */
 GTEST_TEST(FemModelTest, MultipleBuilders) {
   DummyModel model;
@@ -242,6 +299,13 @@ GTEST_TEST(FemModelTest, DirichletBoundaryCondition) {
     bc.ApplyBoundaryConditionToTangentMatrix(tangent_matrix1.get());
     dense_tangent_matrix1 = tangent_matrix1->MakeDenseMatrix();
     EXPECT_TRUE(CompareMatrices(dense_tangent_matrix0, dense_tangent_matrix1));
+
+    /* Same for the native block sparse tangent matrix. */
+    unique_ptr<internal::Block3x3SparseSymmetricMatrix> tangent_matrix2 =
+        model.MakeBlock3x3SparseSymmetricTangentMatrix();
+    model.CalcTangentMatrix(*state0, weights, tangent_matrix2.get());
+    EXPECT_TRUE(CompareMatrices(dense_tangent_matrix0,
+                                tangent_matrix2->MakeDenseMatrix()));
   }
 }
 
@@ -1,11 +1,19 @@
 #include "drake/multibody/fem/fem_solver.h"
 
+#include <optional>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/proximity/make_box_mesh.h"
 #include "drake/multibody/fem/acceleration_newmark_scheme.h"
+#include "drake/multibody/fem/linear_constitutive_model.h"
+#include "drake/multibody/fem/linear_simplex_element.h"
+#include "drake/multibody/fem/simplex_gaussian_quadrature.h"
 #include "drake/multibody/fem/test/dummy_model.h"
+#include "drake/multibody/fem/volumetric_model.h"
 
 namespace drake {
 namespace multibody {
@@ -36,6 +44,74 @@ TEST_F(FemSolverTest, CloneScratchData) {
   const MatrixXd tangent_matrix_clone =
       clone->tangent_matrix().MakeDenseMatrix();
   EXPECT_EQ(tangent_matrix, tangent_matrix_clone);
+  EXPECT_EQ(scratch.block_tangent_matrix().MakeDenseMatrix(),
+            clone->block_tangent_matrix().MakeDenseMatrix());
+}
+
+/* Tests that the scratch data is only reallocated when the model changes. */
+TEST_F(FemSolverTest, ResizeScratchData) {
+  DummyModel::DummyBuilder builder(&model_);
+  builder.AddTwoElementsWithSharedNodes();
+  builder.Build();
+  FemSolverScratchData<double> scratch(model_);
+  /* The tangent matrices are allocated on first access. */
+  EXPECT_FALSE(scratch.has_tangent_matrix());
+  const Block3x3SparseSymmetricMatrix* tangent_matrix =
+      &scratch.block_tangent_matrix();
+  scratch.Resize(model_);
+  EXPECT_EQ(&scratch.block_tangent_matrix(), tangent_matrix);
+
+  DummyModel::DummyBuilder builder2(&model_);
+  builder2.AddElementWithDistinctNodes();
+  builder2.Build();
+  scratch.Resize(model_);
+  EXPECT_EQ(scratch.num_dofs(), model_.num_dofs());
+  EXPECT_EQ(scratch.block_tangent_matrix().rows(), model_.num_dofs());
+}
+
+/* Tests that the scratch data is reallocated for a different model with the
+ same number of dofs and elements, even if that model is allocated at the
+ address of a destroyed one. */
+TEST_F(FemSolverTest, ResizeScratchDataForNewModelAtSameAddress) {
+  std::optional<DummyModel> model;
+  model.emplace();
+  {
+    DummyModel::DummyBuilder builder(&*model);
+    builder.AddTwoElementsWithSharedNodes();
+    builder.AddElementWithDistinctNodes();
+    builder.Build();
+  }
+  FemSolverScratchData<double> scratch(*model);
+  const std::vector<std::vector<int>> old_pattern =
+      scratch.block_tangent_matrix().sparsity_pattern();
+
+  const DummyModel* old_address = &*model;
+  model.emplace();
+  ASSERT_EQ(&*model, old_address);
+  {
+    DummyModel::DummyBuilder builder(&*model);
+    builder.AddElementWithDistinctNodes();
+    builder.AddTwoElementsWithSharedNodes();
+    builder.Build();
+  }
+  ASSERT_EQ(model->num_dofs(), scratch.num_dofs());
+  ASSERT_EQ(model->num_elements(), 3);
+
+  scratch.Resize(*model);
+  const std::vector<std::vector<int>> expected_pattern =
+      model->MakeBlock3x3SparseSymmetricTangentMatrix()->sparsity_pattern();
+  EXPECT_NE(expected_pattern, old_pattern);
+  EXPECT_EQ(scratch.block_tangent_matrix().sparsity_pattern(),
+            expected_pattern);
+}
+
+TEST_F(FemSolverTest, LinearSolverType) {
+  using LinearSolverType = FemSolver<double>::LinearSolverType;
+  EXPECT_EQ(solver_.linear_solver_type(),
+            LinearSolverType::kPetscConjugateGradient);
+  solver_.set_linear_solver_type(LinearSolverType::kBlockSparseCholesky);
+  EXPECT_EQ(solver_.linear_solver_type(),
+            LinearSolverType::kBlockSparseCholesky);
 }
 
 TEST_F(FemSolverTest, Tolerance) {
@@ -92,6 +168,89 @@ TEST_F(FemSolverTest, AdvanceOneTimeStep) {
                               state->GetVelocities(), kEps));
 }
 
+/* The native linear solvers require a positive definite tangent matrix (the
+ tangent matrix of the DummyModel is indefinite), so they are tested with a
+ linear elastic box under gravity instead. The model is linear, so
+ AdvanceOneTimeStep() converges in one Newton iteration and the change in the
+ unknowns solves A * dz = -b, where A is the tangent matrix and b is the
+ residual at the initial state. */
+struct LinearSolverTestParam {
+  FemSolver<double>::LinearSolverType type;
+  /* The relative tolerance for comparing against the dense solution. */
+  double tolerance;
+};
+
+class FemSolverLinearSolverTest
+    : public ::testing::TestWithParam<LinearSolverTestParam> {
+ protected:
+  using QuadratureType = SimplexGaussianQuadrature<3, 1>;
+  using IsoparametricElementType =
+      LinearSimplexElement<double, 3, 3, QuadratureType::num_quadrature_points>;
+  using ConstitutiveModelType =
+      LinearConstitutiveModel<double, QuadratureType::num_quadrature_points>;
+  using ElementType = VolumetricElement<IsoparametricElementType,
+                                        QuadratureType, ConstitutiveModelType>;
+
+  void SetUp() override {
+    const geometry::Box box(0.1, 0.1, 0.1);
+    const geometry::VolumeMesh<double> mesh =
+        geometry::internal::MakeBoxVolumeMesh<double>(box, 0.025);
+    VolumetricModel<ElementType>::VolumetricBuilder builder(&model_);
+    builder.AddLinearTetrahedralElements(
+        mesh, ConstitutiveModelType(1e5, 0.4), 1000.0,
+        DampingModel<double>(0.01, 0.02));
+    builder.Build();
+  }
+
+  VolumetricModel<ElementType> model_;
+  AccelerationNewmarkScheme<double> integrator_{kDt, kGamma, kBeta};
+  FemSolver<double> solver_{&model_, &integrator_};
+};
+
+TEST_P(FemSolverLinearSolverTest, AdvanceOneTimeStep) {
+  solver_.set_linear_solver_type(GetParam().type);
+  std::unique_ptr<FemState<double>> state0 = model_.MakeFemState();
+  std::unique_ptr<FemState<double>> state = model_.MakeFemState();
+  FemSolverScratchData<double> scratch(model_);
+  EXPECT_EQ(solver_.AdvanceOneTimeStep(*state0, state.get(), &scratch), 1);
+
+  auto tangent_matrix = model_.MakeBlock3x3SparseSymmetricTangentMatrix();
+  model_.CalcTangentMatrix(*state0, integrator_.GetWeights(),
+                           tangent_matrix.get());
+  const MatrixXd A = tangent_matrix->MakeDenseMatrix();
+  VectorX<double> b(model_.num_dofs());
+  model_.CalcResidual(*state0, &b);
+  const VectorX<double> dz = A.llt().solve(-b);
+  std::unique_ptr<FemState<double>> expected_state = model_.MakeFemState();
+  integrator_.UpdateStateFromChangeInUnknowns(dz, expected_state.get());
+  EXPECT_TRUE(CompareMatrices(state->GetAccelerations(),
+                              expected_state->GetAccelerations(),
+                              GetParam().tolerance *
+                                  expected_state->GetAccelerations().norm()));
+
+  /* Take another step with the same scratch data to exercise the reuse of the
+   symbolic analysis and the preconditioner storage. */
+  std::unique_ptr<FemState<double>> state2 = model_.MakeFemState();
+  EXPECT_EQ(solver_.AdvanceOneTimeStep(*state0, state2.get(), &scratch), 1);
+  EXPECT_TRUE(CompareMatrices(state2->GetAccelerations(),
+                              state->GetAccelerations(), kEps));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    AllLinearSolvers, FemSolverLinearSolverTest,
+    ::testing::Values(
+        LinearSolverTestParam{
+            FemSolver<double>::LinearSolverType::kPetscConjugateGradient, 1e-3},
+        LinearSolverTestParam{FemSolver<double>::LinearSolverType::
+                                  kBlockSparseConjugateGradient,
+                              1e-3},
+        LinearSolverTestParam{FemSolver<double>::LinearSolverType::
+                                  kBlockSparseConjugateGradientBlockJacobi,
+                              1e-3},
+        LinearSolverTestParam{
+            FemSolver<double>::LinearSolverType::kBlockSparseCholesky,
+            1e-12}));
+
 // TODO(xuchenhan-tri): Unit tests that cover other exit conditions of
 // the iterative solver are missing.
 
@@ -364,6 +364,73 @@ TEST_F(VolumetricElementTest, AddScaledGravityForce) {
                               scaled_gravity_force, kEpsilon));
 }
 
+/* ComputeDataForRange() evaluates the constitutive models of many elements
+together. Verify that it agrees with ComputeData() for a collection of double
+elements with different deformations and material parameters. */
+GTEST_TEST(VolumetricElementBatchTest, ComputeDataForRange) {
+  using IsoparametricElementD =
+      internal::LinearSimplexElement<double, kNaturalDimension,
+                                     kSpatialDimension, kNumQuads>;
+  using ElementD = VolumetricElement<IsoparametricElementD, QuadratureType,
+                                     CorotatedModel<double, kNumQuads>>;
+  using DataD = typename ElementD::Data;
+  constexpr int kNumElements = 11;
+  constexpr int kNumNodesPerElement = ElementD::num_nodes;
+  const int num_dofs = kNumElements * ElementD::num_dofs;
+
+  std::vector<ElementD> elements;
+  // clang-format off
+  const Eigen::Matrix<double, kSpatialDimension, kNumNodesPerElement> X =
+      (Eigen::Matrix<double, kSpatialDimension, kNumNodesPerElement>() <<
+          -0.10, 0.90, 0.02, 0.10,
+           1.33, 0.23, 0.04, 0.01,
+           0.20, 0.03, 2.31, -0.12).finished();
+  // clang-format on
+  for (int e = 0; e < kNumElements; ++e) {
+    std::array<FemNodeIndex, kNumNodesPerElement> node_indices;
+    for (int a = 0; a < kNumNodesPerElement; ++a) {
+      node_indices[a] = FemNodeIndex(kNumNodesPerElement * e + a);
+    }
+    elements.emplace_back(node_indices,
+                          CorotatedModel<double, kNumQuads>(1e4 * (e + 1), 0.3),
+                          X, 1000.0, DampingModel<double>(0, 0));
+  }
+  /* Deform each element with an arbitrary rotation and stretch. */
+  VectorX<double> q(num_dofs);
+  for (int e = 0; e < kNumElements; ++e) {
+    const Matrix3<double> R =
+        math::RotationMatrix<double>(
+            math::RollPitchYaw<double>(0.3 * e, -0.2 * e, 0.1 * e))
+            .matrix();
+    const Vector3<double> stretch(1.0 + 0.05 * e, 1.0, 1.0 - 0.03 * e);
+    for (int a = 0; a < kNumNodesPerElement; ++a) {
+      q.segment<3>(3 * (kNumNodesPerElement * e + a)) =
+          R * stretch.asDiagonal() * X.col(a);
+    }
+  }
+  FemStateSystem<double> fem_state_system(q, 0.1 * q, -0.2 * q);
+  const FemState<double> state(&fem_state_system);
+
+  std::vector<DataD> data(kNumElements);
+  ElementD::ComputeDataForRange(elements, 0, kNumElements, state, &data);
+  for (int e = 0; e < kNumElements; ++e) {
+    const DataD expected = elements[e].ComputeData(state);
+    const double tol = 1e-12 * 1e4 * (e + 1);
+    EXPECT_TRUE(CompareMatrices(data[e].element_q, expected.element_q));
+    EXPECT_TRUE(CompareMatrices(data[e].element_v, expected.element_v));
+    EXPECT_TRUE(CompareMatrices(data[e].element_a, expected.element_a));
+    for (int quad = 0; quad < kNumQuads; ++quad) {
+      EXPECT_TRUE(
+          CompareMatrices(data[e].deformation_gradient_data.R()[quad],
+                          expected.deformation_gradient_data.R()[quad], 1e-14));
+      EXPECT_NEAR(data[e].Psi[quad], expected.Psi[quad], tol);
+      EXPECT_TRUE(CompareMatrices(data[e].P[quad], expected.P[quad], tol));
+      EXPECT_TRUE(
+          CompareMatrices(data[e].dPdF[quad], expected.dPdF[quad], tol));
+    }
+  }
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace fem
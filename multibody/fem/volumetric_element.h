@@ -3,6 +3,7 @@
 #include <array>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "drake/common/eigen_types.h"
 #include "drake/multibody/fem/fem_element.h"
@@ -424,6 +425,36 @@ class VolumetricElement
     return data;
   }
 
+  /* Implements FemElement::DoComputeDataForRange(). The states and deformation
+   gradients are computed one element at a time, but the constitutive models of
+   all elements in the range are evaluated together with
+   ConstitutiveModel::CalcBatch(). */
+  static void DoComputeDataForRange(
+      const std::vector<VolumetricElement>& elements, int begin, int end,
+      const FemState<T>& state, std::vector<Data>* data) {
+    const int num_elements = end - begin;
+    std::vector<std::array<Matrix3<T>, num_quadrature_points>>
+        deformation_gradients(num_elements);
+    std::vector<typename ConstitutiveModelType::BatchEntry> entries(
+        num_elements);
+    for (int i = 0; i < num_elements; ++i) {
+      const VolumetricElement& element = elements[begin + i];
+      Data& element_data = (*data)[begin + i];
+      element_data.element_q =
+          element.ExtractElementDofs(state.GetPositions());
+      element_data.element_v =
+          element.ExtractElementDofs(state.GetVelocities());
+      element_data.element_a =
+          element.ExtractElementDofs(state.GetAccelerations());
+      deformation_gradients[i] =
+          element.CalcDeformationGradient(element_data.element_q);
+      entries[i] = {&element.constitutive_model(), &deformation_gradients[i],
+                    &element_data.deformation_gradient_data, &element_data.Psi,
+                    &element_data.P, &element_data.dPdF};
+    }
+    ConstitutiveModelType::CalcBatch(entries);
+  }
+
   /* Calculates the deformation gradient at all quadrature points in this
    element.
    @param[in] element_q  The positions of the nodes of the element in a flat
@@ -0,0 +1,443 @@
+#include "drake/multibody/parsing/detail_package_crawler.h"
+
+#include <unistd.h>
+
+#include <atomic>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <regex>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <drake_vendor/tinyxml2.h>
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/filesystem.h"
+#include "drake/common/hash.h"
+#include "drake/common/parallel_for.h"
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+using std::runtime_error;
+using std::string;
+using tinyxml2::XMLDocument;
+using tinyxml2::XMLElement;
+
+namespace {
+
+// Removes leading and trailing whitespace and line breaks from a string.
+string RemoveBreaksAndIndentation(string target) {
+  static const std::regex midspan_breaks("\\s*\\n\\s*");
+  static const string whitespace_characters = " \r\n\t";
+  target.erase(0, target.find_first_not_of(whitespace_characters));
+  target.erase(target.find_last_not_of(whitespace_characters) + 1);
+  return std::regex_replace(target, midspan_breaks, " ");
+}
+
+}  // namespace
+
+std::tuple<string, std::optional<string>> ParsePackageManifest(
+    const string& package_xml_file) {
+  DRAKE_DEMAND(!package_xml_file.empty());
+  XMLDocument xml_doc;
+  xml_doc.LoadFile(package_xml_file.data());
+  if (xml_doc.ErrorID()) {
+    throw runtime_error("package_map.cc: GetPackageName(): "
+        "Failed to parse XML in file \"" + package_xml_file + "\".\n" +
+        xml_doc.ErrorName());
+  }
+
+  XMLElement* package_node = xml_doc.FirstChildElement("package");
+  if (!package_node) {
+    throw runtime_error("package_map.cc: GetPackageName(): "
+        "ERROR: XML file \"" + package_xml_file + "\" does not contain "
+        "element <package>.");
+  }
+
+  XMLElement* name_node = package_node->FirstChildElement("name");
+  if (!name_node) {
+    throw runtime_error("package_map.cc: GetPackageName(): "
+        "ERROR: <package> element does not contain element <name> "
+        "(XML file \"" + package_xml_file + "\").");
+  }
+
+  // Throws an exception if the name node does not have any children.
+  DRAKE_THROW_UNLESS(!name_node->NoChildren());
+  const string package_name = name_node->FirstChild()->Value();
+  DRAKE_THROW_UNLESS(package_name != "");
+
+  std::optional<string> deprecated_message;
+  XMLElement* export_node = package_node->FirstChildElement("export");
+  if (export_node) {
+    XMLElement* deprecated_node = export_node->FirstChildElement("deprecated");
+    if (deprecated_node) {
+      if (deprecated_node->NoChildren()) {
+        deprecated_message = {""};
+      } else {
+        deprecated_message = {
+          RemoveBreaksAndIndentation(deprecated_node->FirstChild()->Value())
+        };
+      }
+    }
+  }
+
+  return {package_name, deprecated_message};
+}
+
+namespace {
+
+const char* const kIndexDirEnvironmentVariable = "DRAKE_PACKAGE_MAP_INDEX_DIR";
+
+// The first line of an index file; bump the version when changing the format.
+const char* const kIndexHeader = "drake-package-index 1";
+
+// Something the crawl found, in the order it was found: either a package, or
+// a directory whose contents couldn't be listed.
+struct CrawlItem {
+  // The package's directory (with a trailing slash), or the directory that
+  // couldn't be listed.
+  string path;
+  // The name of the package, or empty for a directory that couldn't be listed.
+  string package_name;
+  std::optional<string> deprecated_message;
+};
+
+// The result of a crawl, along with what's needed to tell if it's still
+// current: the modification time of every directory and manifest it visited.
+struct CrawlIndex {
+  std::vector<CrawlItem> items;
+  std::vector<std::pair<string, int64_t>> stamps;
+};
+
+// Returns the modification time of `path`, or -1 if it can't be read.
+int64_t GetModificationTime(const filesystem::path& path) {
+  std::error_code ec;
+  const auto time = filesystem::last_write_time(path, ec);
+  if (ec) { return -1; }
+  return time.time_since_epoch().count();
+}
+
+// A directory visited by the crawl, and what was found in it.
+struct VisitedDirectory {
+  filesystem::path path;
+  int64_t modification_time{-1};
+  // True iff the directory contains a stop marker; nothing else is examined.
+  bool stopped{false};
+  // The directory's manifest (or empty if it has none) and what it declares,
+  // or the error from parsing it.
+  filesystem::path manifest;
+  int64_t manifest_modification_time{-1};
+  std::tuple<string, std::optional<string>> package;
+  std::exception_ptr error;
+  // True iff the directory's contents couldn't be listed.
+  bool unreadable{false};
+  // The subdirectories to crawl, as found by Visit(), and then as indices
+  // into the list of visited directories.
+  std::vector<filesystem::path> subdirectories;
+  std::vector<int> children;
+};
+
+// Examines the directory `dir->path`, as one step of CrawlForPackages(). This
+// is called concurrently for distinct directories, so it must not throw.
+void Visit(bool stop_at_package, const std::vector<string>& stop_markers,
+           VisitedDirectory* dir) {
+  // The modification times are read before the contents, so that a change
+  // that races with the crawl always invalidates its index.
+  dir->modification_time = GetModificationTime(dir->path);
+  std::error_code ec;
+  for (const string& marker : stop_markers) {
+    if (filesystem::exists(dir->path / marker, ec)) {
+      dir->stopped = true;
+      return;
+    }
+  }
+  const filesystem::path manifest = dir->path / "package.xml";
+  if (filesystem::exists(manifest, ec)) {
+    dir->manifest = manifest;
+    dir->manifest_modification_time = GetModificationTime(manifest);
+    try {
+      dir->package = ParsePackageManifest(manifest.string());
+    } catch (...) {
+      dir->error = std::current_exception();
+      return;
+    }
+    if (stop_at_package) {
+      return;
+    }
+  }
+  filesystem::directory_iterator iter(dir->path, ec);
+  if (ec) {
+    dir->unreadable = true;
+    return;
+  }
+  for (; iter != filesystem::directory_iterator(); iter.increment(ec)) {
+    if (ec) { break; }
+    if (iter->is_directory(ec)) {
+      const string filename = iter->path().filename().string();
+      // Skips hidden directories (including "." and "..").
+      if (filename.at(0) == '.') {
+        continue;
+      }
+      dir->subdirectories.push_back(iter->path());
+    }
+  }
+}
+
+// Visits the tree of directories rooted at `root`, one level at a time, with
+// the directories of each level visited in parallel.
+std::vector<VisitedDirectory> VisitTree(
+    const filesystem::path& root, bool stop_at_package,
+    const std::vector<string>& stop_markers) {
+  std::vector<VisitedDirectory> dirs(1);
+  dirs[0].path = root;
+  for (int begin = 0; begin < static_cast<int>(dirs.size());) {
+    const int end = dirs.size();
+    drake::internal::ParallelFor(end - begin, [&](int k) {
+      Visit(stop_at_package, stop_markers, &dirs[begin + k]);
+    });
+    for (int i = begin; i < end; ++i) {
+      std::vector<filesystem::path> subdirectories =
+          std::move(dirs[i].subdirectories);
+      for (filesystem::path& subdirectory : subdirectories) {
+        dirs[i].children.push_back(dirs.size());
+        dirs.emplace_back().path = std::move(subdirectory);
+      }
+    }
+    begin = end;
+  }
+  return dirs;
+}
+
+// Appends what was found in `dirs[index]` and its subdirectories to `items`,
+// in depth-first order. Returns the first manifest error (in that order), if
+// any, in which case the items end just before it.
+std::exception_ptr Flatten(const std::vector<VisitedDirectory>& dirs,
+                           int index, bool stop_at_package,
+                           std::vector<CrawlItem>* items) {
+  const VisitedDirectory& dir = dirs[index];
+  if (dir.stopped) {
+    return nullptr;
+  }
+  if (!dir.manifest.empty()) {
+    if (dir.error) {
+      return dir.error;
+    }
+    const auto& [package_name, deprecated_message] = dir.package;
+    items->push_back({dir.path.string() + "/", package_name,
+                      deprecated_message});
+    if (stop_at_package) {
+      return nullptr;
+    }
+  }
+  if (dir.unreadable) {
+    items->push_back({dir.path.string(), "", std::nullopt});
+    return nullptr;
+  }
+  for (int child : dir.children) {
+    std::exception_ptr error = Flatten(dirs, child, stop_at_package, items);
+    if (error) {
+      return error;
+    }
+  }
+  return nullptr;
+}
+
+// Returns true iff the modification times of everything the crawl visited are
+// unchanged.
+bool IsCurrent(const CrawlIndex& index) {
+  std::atomic<bool> stale{false};
+  const int n = index.stamps.size();
+  drake::internal::ParallelFor(n, [&](int i) {
+    const auto& [path, modification_time] = index.stamps[i];
+    if (GetModificationTime(path) != modification_time) {
+      stale = true;
+    }
+  });
+  return !stale;
+}
+
+// Splits `line` at tabs.
+std::vector<string> SplitFields(const string& line) {
+  std::vector<string> fields;
+  size_t begin = 0;
+  while (true) {
+    const size_t end = line.find('\t', begin);
+    fields.push_back(line.substr(begin, end - begin));
+    if (end == string::npos) {
+      return fields;
+    }
+    begin = end + 1;
+  }
+}
+
+// Loads the index saved in `filename` for the crawl identified by `key`.
+// Returns nullopt if there's no such index, or if it's unreadable or stale.
+std::optional<CrawlIndex> LoadIndex(const string& filename, const string& key) {
+  std::ifstream file(filename);
+  string line;
+  if (!std::getline(file, line) || line != kIndexHeader) {
+    return std::nullopt;
+  }
+  if (!std::getline(file, line) || line != key) {
+    return std::nullopt;
+  }
+  CrawlIndex index;
+  while (std::getline(file, line)) {
+    const std::vector<string> fields = SplitFields(line);
+    if (fields[0] == "s" && fields.size() == 3) {
+      // A corrupt modification time invalidates the index, like any other
+      // malformed line.
+      const string& text = fields[1];
+      int64_t modification_time{};
+      const auto [end, error] = std::from_chars(
+          text.data(), text.data() + text.size(), modification_time);
+      if (error != std::errc{} || end != text.data() + text.size()) {
+        return std::nullopt;
+      }
+      index.stamps.emplace_back(fields[2], modification_time);
+    } else if (fields[0] == "p" && fields.size() == 3) {
+      index.items.push_back({fields[1], fields[2], std::nullopt});
+    } else if (fields[0] == "p" && fields.size() == 4) {
+      index.items.push_back({fields[1], fields[2], fields[3]});
+    } else if (fields[0] == "u" && fields.size() == 2) {
+      index.items.push_back({fields[1], "", std::nullopt});
+    } else {
+      return std::nullopt;
+    }
+  }
+  if (!IsCurrent(index)) {
+    return std::nullopt;
+  }
+  return index;
+}
+
+// Saves `index` into `filename` for the crawl identified by `key`. The file is
+// written to a temporary file first, which is then renamed, so that concurrent
+// readers never see a partial index. Failures are only logged; the index is
+// merely an optimization.
+void SaveIndex(const string& filename, const string& key,
+               const CrawlIndex& index) {
+  // Names containing tabs or line breaks can't be saved in this format.
+  auto is_plain = [](const string& text) {
+    return text.find_first_of("\t\n\r") == string::npos;
+  };
+  for (const auto& [path, modification_time] : index.stamps) {
+    if (!is_plain(path)) { return; }
+  }
+  for (const CrawlItem& item : index.items) {
+    if (!is_plain(item.path) || !is_plain(item.package_name) ||
+        !is_plain(item.deprecated_message.value_or(""))) {
+      return;
+    }
+  }
+  const string temp_filename = fmt::format("{}.{}.tmp", filename, getpid());
+  {
+    std::ofstream file(temp_filename);
+    file << kIndexHeader << "\n" << key << "\n";
+    for (const auto& [path, modification_time] : index.stamps) {
+      file << fmt::format("s\t{}\t{}\n", modification_time, path);
+    }
+    for (const CrawlItem& item : index.items) {
+      if (item.package_name.empty()) {
+        file << fmt::format("u\t{}\n", item.path);
+      } else if (!item.deprecated_message.has_value()) {
+        file << fmt::format("p\t{}\t{}\n", item.path, item.package_name);
+      } else {
+        file << fmt::format("p\t{}\t{}\t{}\n", item.path, item.package_name,
+                            *item.deprecated_message);
+      }
+    }
+    if (!file.good()) {
+      log()->debug("PackageMap: could not write index file {}", filename);
+      return;
+    }
+  }
+  std::error_code ec;
+  filesystem::rename(temp_filename, filename, ec);
+  if (ec) {
+    log()->debug("PackageMap: could not write index file {}", filename);
+    filesystem::remove(temp_filename, ec);
+  }
+}
+
+// Crawls the tree rooted at `root`, returning everything found and, if a
+// manifest can't be parsed, the error (in which case the index ends just
+// before the offending package).
+std::pair<CrawlIndex, std::exception_ptr> Crawl(
+    const filesystem::path& root, bool stop_at_package,
+    const std::vector<string>& stop_markers) {
+  const std::vector<VisitedDirectory> dirs =
+      VisitTree(root, stop_at_package, stop_markers);
+  CrawlIndex index;
+  std::exception_ptr error = Flatten(dirs, 0, stop_at_package, &index.items);
+  for (const VisitedDirectory& dir : dirs) {
+    index.stamps.emplace_back(dir.path.string(), dir.modification_time);
+    if (!dir.manifest.empty()) {
+      index.stamps.emplace_back(dir.manifest.string(),
+                                dir.manifest_modification_time);
+    }
+  }
+  return {std::move(index), error};
+}
+
+}  // namespace
+
+void CrawlForPackages(const string& path, bool stop_at_package,
+                      const std::vector<string>& stop_markers,
+                      const AddCrawledPackage& add_package) {
+  DRAKE_DEMAND(!path.empty());
+  const filesystem::path root = filesystem::path(path).lexically_normal();
+
+  // The index (if any) is identified by the absolute root and the options.
+  std::optional<string> index_filename;
+  string key;
+  const char* const index_dir = std::getenv(kIndexDirEnvironmentVariable);
+  if (index_dir != nullptr && index_dir[0] != '\0') {
+    std::error_code ec;
+    key = fmt::format("{}\t{}\t{}", filesystem::absolute(root, ec).string(),
+                      stop_at_package, fmt::join(stop_markers, ":"));
+    drake::internal::FNV1aHasher hasher;
+    hasher(key.data(), key.size());
+    index_filename = fmt::format("{}/{:016x}.package_index", index_dir,
+                                 static_cast<size_t>(hasher));
+  }
+
+  std::optional<CrawlIndex> index;
+  std::exception_ptr error;
+  if (index_filename.has_value()) {
+    index = LoadIndex(*index_filename, key);
+    if (index.has_value()) {
+      log()->debug("PackageMap: using index {} for {}", *index_filename, path);
+    }
+  }
+  if (!index.has_value()) {
+    std::tie(index, error) = Crawl(root, stop_at_package, stop_markers);
+    if (index_filename.has_value() && !error) {
+      SaveIndex(*index_filename, key, *index);
+    }
+  }
+
+  for (const CrawlItem& item : index->items) {
+    if (item.package_name.empty()) {
+      log()->warn("Unable to open directory: {}", item.path);
+    } else {
+      add_package(item.package_name, item.path, item.deprecated_message);
+    }
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+// Parses the package.xml file specified by package_xml_file. Finds and returns
+// the name of the package and an optional deprecation message.
+// @throws std::exception if the file can't be parsed or doesn't name a
+// package.
+std::tuple<std::string, std::optional<std::string>> ParsePackageManifest(
+    const std::string& package_xml_file);
+
+// The function called for each package found by CrawlForPackages(), with the
+// package's name, its directory (with a trailing slash), and its optional
+// deprecation message.
+using AddCrawledPackage = std::function<void(
+    const std::string& package_name, const std::string& package_path,
+    const std::optional<std::string>& deprecated_message)>;
+
+// Recursively crawls through @p path looking for package.xml files, calling
+// @p add_package for each of them. Packages are reported in depth-first order
+// (a package before the packages in its subdirectories, and subdirectories in
+// the order the file system lists them); hidden directories are skipped.
+//
+// Each level of the directory tree is visited in parallel (when Drake is built
+// with OpenMP), which matters most on network file systems, where the latency
+// of listing a directory or reading a manifest dominates.
+//
+// When the environment variable DRAKE_PACKAGE_MAP_INDEX_DIR names a directory,
+// the result of each crawl is saved there, in an index file specific to @p
+// path, @p stop_at_package, and @p stop_markers. A later crawl with the same
+// arguments replays the index instead of crawling, provided the modification
+// times of every directory and manifest it visited are unchanged. (Adding or
+// removing a package, a subdirectory, or a stop marker changes the
+// modification time of the directory that contains it.)
+//
+// @param[in] stop_at_package When passed true, do not crawl into
+// subdirectories of packages which have already been found.
+// @param[in] stop_markers When a directory contains one or more files or
+// directories with one of the given names, do not crawl into that directory
+// or any subdirectories when searching for packages.
+// @throws std::exception if a package.xml file can't be parsed, after having
+// reported the packages that precede it.
+void CrawlForPackages(const std::string& path, bool stop_at_package,
+                      const std::vector<std::string>& stop_markers,
+                      const AddCrawledPackage& add_package);
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -458,7 +458,7 @@ RigidTransformd MakeGeometryPoseFromSdfCollision(
 
 ProximityProperties MakeProximityPropertiesForCollision(
     const DiagnosticPolicy& diagnostic,
-    const sdf::Collision& sdf_collision) {
+    const sdf::Collision& sdf_collision, ResolveFilename resolve_filename) {
   const sdf::ElementPtr collision_element = sdf_collision.Element();
   DRAKE_DEMAND(collision_element != nullptr);
 
@@ -488,7 +488,8 @@ ProximityProperties MakeProximityPropertiesForCollision(
       "drake:relaxation_time",
       "drake:point_contact_stiffness",
       "drake:mu_dynamic",
-      "drake:mu_static"};
+      "drake:mu_static",
+      "drake:precompiled_dir"};
     CheckSupportedElements(diagnostic, drake_element,
                            supported_proximity_elements);
 
@@ -525,6 +526,18 @@ ProximityProperties MakeProximityPropertiesForCollision(
 
     properties = ParseProximityProperties(
         diagnostic, read_double, is_rigid, is_compliant);
+
+    if (MaybeGetChildElement(*drake_element, "drake:precompiled_dir") !=
+        nullptr) {
+      const std::string directory = resolve_filename(
+          diagnostic, GetChildElementValue<std::string>(
+                          *drake_element, "drake:precompiled_dir"));
+      // An unresolved directory has already been reported.
+      if (!directory.empty()) {
+        properties.AddProperty(geometry::internal::kHydroGroup,
+                               geometry::internal::kPrecompiledDir, directory);
+      }
+    }
   }
 
   // TODO(SeanCurtis-TRI): Remove all of this legacy parsing code based on
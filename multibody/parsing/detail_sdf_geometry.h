@@ -163,6 +163,7 @@ math::RigidTransformd MakeGeometryPoseFromSdfCollision(
  | drake:mu_static                  | material     | coulomb_friction          | See note below on friction.                                                                                                      |
  | drake:rigid_hydroelastic         | hydroelastic | compliance_type           | Requests a rigid hydroelastic representation. Cannot be combined *with* soft_hydroelastic.                                       |
  | drake:compliant_hydroelastic     | hydroelastic | compliance_type           | Requests a compliant hydroelastic representation. Cannot be combined *with* rigid_hydroelastic. Requires a value for hydroelastic_modulus. |
+ | drake:precompiled_dir            | hydroelastic | precompiled_dir           | The value is a directory of precompiled hydroelastic representations, resolved with `resolve_filename`.                         |
 
  <h3>Coefficients of friction</h3>
 
@@ -187,7 +188,7 @@ math::RigidTransformd MakeGeometryPoseFromSdfCollision(
  the ('material', 'coulomb_friction') property.  */
 geometry::ProximityProperties MakeProximityPropertiesForCollision(
     const drake::internal::DiagnosticPolicy& diagnostic,
-    const sdf::Collision& sdf_collision);
+    const sdf::Collision& sdf_collision, ResolveFilename resolve_filename);
 
 /* Parses friction coefficients from `sdf_collision`.
  This method looks for the definitions specific to ODE, as given by the SDF
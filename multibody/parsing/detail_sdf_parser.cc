@@ -933,7 +933,8 @@ std::vector<LinkInfo> AddLinksFromSpecification(
           const RigidTransformd X_LC =
               MakeGeometryPoseFromSdfCollision(sdf_collision, X_LG);
           geometry::ProximityProperties props =
-              MakeProximityPropertiesForCollision(diagnostic, sdf_collision);
+              MakeProximityPropertiesForCollision(
+                  diagnostic, sdf_collision, resolve_filename);
           plant->RegisterCollisionGeometry(body, X_LC, *shape,
                                            sdf_collision.Name(),
                                            std::move(props));
@@ -676,6 +676,26 @@ std::optional<geometry::GeometryInstance> ParseCollision(
     props = ParseProximityProperties(
         diagnostic.MakePolicyForNode(drake_element), read_double,
         rigid_element != nullptr, compliant_element != nullptr);
+
+    const XMLElement* const precompiled_dir_node =
+        drake_element->FirstChildElement("drake:precompiled_dir");
+    if (precompiled_dir_node != nullptr) {
+      std::string uri;
+      if (!ParseStringAttribute(precompiled_dir_node, "value", &uri)) {
+        diagnostic.Error(*precompiled_dir_node,
+                         "Unable to read the 'value' attribute for the"
+                         " <drake:precompiled_dir> tag");
+      } else {
+        const std::string directory =
+            ResolveUri(diagnostic.MakePolicyForNode(precompiled_dir_node),
+                       uri, package_map, root_dir);
+        // ResolveUri already emitted an error message if it failed.
+        if (!directory.empty()) {
+          props.AddProperty(geometry::internal::kHydroGroup,
+                            geometry::internal::kPrecompiledDir, directory);
+        }
+      }
+    }
   }
 
   // TODO(SeanCurtis-TRI): Remove all of this legacy parsing code based on
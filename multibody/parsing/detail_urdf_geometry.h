@@ -187,6 +187,7 @@ std::optional<geometry::GeometryInstance> ParseVisual(
  | drake:mu_static                  | material     | coulomb_friction          | See note below on friction.                                                                                                      |
  | drake:rigid_hydroelastic         | hydroelastic | compliance_type           | Requests a rigid hydroelastic representation. Cannot be combined *with* soft_hydroelastic.                                       |
  | drake:compliant_hydroelastic     | hydroelastic | compliance_type           | Requests a compliant hydroelastic representation. Cannot be combined *with* rigid_hydroelastic. Requires a value for hydroelastic_modulus. |
+ | drake:precompiled_dir            | hydroelastic | precompiled_dir           | The value is a directory of precompiled hydroelastic representations: a package:// URI or a path relative to the URDF file.     |
 
  <h3>Coefficients of friction</h3>
 
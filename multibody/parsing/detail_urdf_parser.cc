@@ -22,6 +22,7 @@
 #include "drake/multibody/parsing/detail_tinyxml.h"
 #include "drake/multibody/parsing/detail_tinyxml2_diagnostic.h"
 #include "drake/multibody/parsing/detail_urdf_geometry.h"
+#include "drake/multibody/parsing/detail_xml_document_cache.h"
 #include "drake/multibody/parsing/package_map.h"
 #include "drake/multibody/parsing/scoped_names.h"
 #include "drake/multibody/plant/multibody_plant.h"
@@ -898,7 +899,24 @@ std::optional<ModelInstanceIndex> AddModelFromUrdf(
   DRAKE_THROW_UNLESS(!plant->is_finalized());
   TinyXml2Diagnostic diag(&workspace.diagnostic, &data_source);
 
-  // Opens the URDF file and feeds it into the XML parser.
+  // Files are parsed through the document cache, so that a model that is
+  // added many times is only parsed once. The cached documents are shared and
+  // must not be modified; UrdfParser only reads from the document, but
+  // tinyxml2's accessors (and our ElementNode) traffic in non-const pointers.
+  if (data_source.IsFilename()) {
+    const std::shared_ptr<const XMLDocument> cached =
+        XmlDocumentCache::GetInstance().Get(data_source.filename());
+    if (cached != nullptr) {
+      UrdfParser parser(&data_source, model_name_in, parent_model_name,
+                        data_source.GetRootDir(),
+                        const_cast<XMLDocument*>(cached.get()), workspace);
+      return parser.Parse();
+    }
+  }
+
+  // Opens the URDF file and feeds it into the XML parser. For files, this is
+  // only reached when the cache couldn't read or parse the file, and serves to
+  // report the error.
   XMLDocument xml_doc;
   if (data_source.IsFilename()) {
     xml_doc.LoadFile(data_source.filename().c_str());
@@ -0,0 +1,119 @@
+#include "drake/multibody/parsing/detail_xml_document_cache.h"
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <set>
+
+#include <fmt/format.h>
+
+#include "drake/common/never_destroyed.h"
+#include "drake/common/parallel_for.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+using tinyxml2::XMLAttribute;
+using tinyxml2::XMLDocument;
+using tinyxml2::XMLElement;
+using tinyxml2::XMLNode;
+
+namespace {
+
+// Reads the entire file, or returns nullopt if it can't be read.
+std::optional<std::string> ReadFile(const std::string& filename) {
+  std::ifstream file(filename, std::ios::binary);
+  if (!file.is_open()) return std::nullopt;
+  std::string contents{std::istreambuf_iterator<char>(file),
+                       std::istreambuf_iterator<char>()};
+  if (file.bad()) return std::nullopt;
+  return contents;
+}
+
+// Forces tinyxml2 to resolve (in place) every string in the tree rooted at
+// `node` and its siblings, so that later reads don't modify the document.
+void ResolveStrings(const XMLNode* node) {
+  for (; node != nullptr; node = node->NextSibling()) {
+    node->Value();
+    if (const XMLElement* element = node->ToElement()) {
+      for (const XMLAttribute* attribute = element->FirstAttribute();
+           attribute != nullptr; attribute = attribute->Next()) {
+        attribute->Name();
+        attribute->Value();
+      }
+    }
+    ResolveStrings(node->FirstChild());
+  }
+}
+
+}  // namespace
+
+class XmlDocumentCache::Impl {
+ public:
+  explicit Impl(int64_t max_bytes) : documents("XmlDocumentCache", max_bytes) {}
+
+  drake::internal::ContentKeyedCache<drake::internal::ContentDigest,
+                                     XMLDocument>
+      documents;
+};
+
+XmlDocumentCache::XmlDocumentCache(int64_t max_bytes)
+    : impl_(std::make_unique<Impl>(max_bytes)) {}
+
+XmlDocumentCache::~XmlDocumentCache() = default;
+
+XmlDocumentCache& XmlDocumentCache::GetInstance() {
+  static never_destroyed<XmlDocumentCache> instance;
+  return instance.access();
+}
+
+XmlDocumentCache::Stats XmlDocumentCache::GetStats() const {
+  return impl_->documents.GetStats();
+}
+
+int64_t XmlDocumentCache::max_bytes() const {
+  return impl_->documents.max_bytes();
+}
+
+void XmlDocumentCache::Clear() {
+  impl_->documents.Clear();
+}
+
+std::shared_ptr<const XMLDocument> XmlDocumentCache::Get(
+    const std::string& filename) {
+  const std::optional<std::string> contents = ReadFile(filename);
+  if (!contents.has_value()) return nullptr;
+  return impl_->documents.GetOrCompute(
+      drake::internal::DigestContents(contents->data(), contents->size()),
+      static_cast<int64_t>(contents->size()),
+      [&]() -> std::shared_ptr<const XMLDocument> {
+        auto document = std::make_shared<XMLDocument>();
+        document->Parse(contents->data(), contents->size());
+        // Don't cache failures; the caller's own parse will report the error.
+        if (document->ErrorID()) return nullptr;
+        ResolveStrings(document->FirstChild());
+        return document;
+      },
+      [&]() {
+        return fmt::format("'{}'", filename);
+      });
+}
+
+void XmlDocumentCache::Prefetch(const std::vector<std::string>& filenames) {
+  const std::set<std::string> unique(filenames.begin(), filenames.end());
+  const std::vector<std::string> todo(unique.begin(), unique.end());
+  drake::internal::ParallelFor(static_cast<int>(todo.size()), [&](int i) {
+    try {
+      Get(todo[i]);
+    } catch (...) {
+      // The failure will recur, and be reported, when the caller parses the
+      // file itself.
+    }
+  });
+}
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <drake_vendor/tinyxml2.h>
+
+#include "drake/common/content_keyed_cache.h"
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+// A process-wide, thread-safe cache of parsed XML documents, used to avoid
+// re-parsing model files (e.g., a robot URDF that is added to a scene many
+// times, or to many plants). It is a drake::internal::ContentKeyedCache (see
+// there for the byte budget, eviction, and concurrency semantics) keyed on the
+// digest of each file's contents and charged the size of the file. Reading and
+// hashing the file is still done on every request, but that is far cheaper
+// than building the document. (A cache of weak references would not do, since
+// Prefetch() drops the documents it parses right away.)
+//
+// The cached documents are shared, so they must never be modified. Before a
+// document is published, every string in it is resolved once (tinyxml2
+// otherwise decodes entities and normalizes whitespace in place on first
+// access), after which reading the document from multiple threads is safe.
+//
+// Only documents that parse successfully are cached. Callers are expected to
+// fall back to their uncached path (with its own error reporting) when the
+// cache returns nullptr.
+class XmlDocumentCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(XmlDocumentCache)
+
+  using Stats = drake::internal::ContentKeyedCacheStats;
+
+  // The default byte budget of a cache.
+  static constexpr int64_t kDefaultMaxBytes = int64_t{64} << 20;
+
+  // Constructs an empty cache whose entries are charged against a budget of
+  // `max_bytes`. Most code should share the process-wide instance returned by
+  // GetInstance(); separate instances are useful for testing.
+  // @throws std::exception if max_bytes < 0.
+  explicit XmlDocumentCache(int64_t max_bytes = kDefaultMaxBytes);
+
+  ~XmlDocumentCache();
+
+  // Returns the process-wide instance.
+  static XmlDocumentCache& GetInstance();
+
+  // Returns the parsed document for the file named `filename`, parsing it on
+  // a miss. Returns nullptr if the file can't be read or is not well-formed
+  // XML.
+  std::shared_ptr<const tinyxml2::XMLDocument> Get(
+      const std::string& filename);
+
+  // Parses the given files concurrently (when Drake is built with OpenMP),
+  // adding them to the cache so that later calls to Get() are hits. Files
+  // that can't be read or parsed are skipped; the errors are left for the
+  // caller's (serial) parsing to report. Duplicate names are parsed once.
+  void Prefetch(const std::vector<std::string>& filenames);
+
+  // Returns a snapshot of the cache's statistics.
+  Stats GetStats() const;
+
+  // Returns the byte budget of this cache.
+  int64_t max_bytes() const;
+
+  // Evicts all entries and resets the statistics. Documents previously
+  // returned remain valid for as long as their callers hold on to them.
+  void Clear();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
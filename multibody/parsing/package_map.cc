@@ -1,16 +1,11 @@
 #include "drake/multibody/parsing/package_map.h"
 
-#include <algorithm>
 #include <cstdlib>
 #include <initializer_list>
 #include <optional>
-#include <regex>
 #include <sstream>
-#include <tuple>
 #include <utility>
 
-#include <drake_vendor/tinyxml2.h>
-
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_path.h"
 #include "drake/common/drake_throw.h"
@@ -18,23 +13,62 @@
 #include "drake/common/find_resource.h"
 #include "drake/common/text_logging.h"
 #include "drake/common/unused.h"
+#include "drake/multibody/parsing/detail_package_crawler.h"
 
 namespace drake {
 namespace multibody {
 
-using std::runtime_error;
 using std::string;
-using tinyxml2::XMLDocument;
-using tinyxml2::XMLElement;
 
 PackageMap::PackageMap()
     : PackageMap{FindResourceOrThrow("drake/package.xml")} {}
 
+PackageMap::PackageMap(const PackageMap& other) {
+  std::lock_guard<std::mutex> lock(other.mutex_);
+  map_ = other.map_;
+  pending_crawls_ = other.pending_crawls_;
+}
+
+PackageMap& PackageMap::operator=(const PackageMap& other) {
+  if (this != &other) {
+    std::scoped_lock lock(mutex_, other.mutex_);
+    map_ = other.map_;
+    pending_crawls_ = other.pending_crawls_;
+  }
+  return *this;
+}
+
+PackageMap::PackageMap(PackageMap&& other) {
+  std::lock_guard<std::mutex> lock(other.mutex_);
+  map_ = std::move(other.map_);
+  pending_crawls_ = std::move(other.pending_crawls_);
+  other.map_.clear();
+  other.pending_crawls_.clear();
+}
+
+PackageMap& PackageMap::operator=(PackageMap&& other) {
+  if (this != &other) {
+    std::scoped_lock lock(mutex_, other.mutex_);
+    map_ = std::move(other.map_);
+    pending_crawls_ = std::move(other.pending_crawls_);
+    other.map_.clear();
+    other.pending_crawls_.clear();
+  }
+  return *this;
+}
+
 PackageMap PackageMap::MakeEmpty() {
   return PackageMap(std::initializer_list<std::string>());
 }
 
 void PackageMap::Add(const string& package_name, const string& package_path) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  CrawlPending();
+  AddLocked(package_name, package_path);
+}
+
+void PackageMap::AddLocked(const string& package_name,
+                           const string& package_path) {
   if (!AddPackageIfNew(package_name, package_path)) {
     throw std::runtime_error(fmt::format(
         "PackageMap already contains package \"{}\" with path \"{}\" that "
@@ -44,17 +78,27 @@ void PackageMap::Add(const string& package_name, const string& package_path) {
 }
 
 void PackageMap::AddMap(const PackageMap& other_map) {
-  for (const auto& [package_name, data] : other_map.map_) {
-    Add(package_name, data.path);
-    SetDeprecated(package_name, data.deprecated_message);
+  // Copying first avoids holding both locks (or deadlocking on self-add).
+  const PackageMap other_copy(other_map);
+  std::lock_guard<std::mutex> other_lock(other_copy.mutex_);
+  other_copy.CrawlPending();
+  std::lock_guard<std::mutex> lock(mutex_);
+  CrawlPending();
+  for (const auto& [package_name, data] : other_copy.map_) {
+    AddLocked(package_name, data.path);
+    map_.at(package_name).deprecated_message = data.deprecated_message;
   }
 }
 
 bool PackageMap::Contains(const string& package_name) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  CrawlPendingUnlessKnown(package_name);
   return map_.find(package_name) != map_.end();
 }
 
 void PackageMap::Remove(const string& package_name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  CrawlPending();
   if (map_.erase(package_name) == 0) {
     throw std::runtime_error(
         "Could not find and remove package://" + package_name + " from the "
@@ -64,21 +108,29 @@ void PackageMap::Remove(const string& package_name) {
 
 void PackageMap::SetDeprecated(const std::string& package_name,
     std::optional<std::string> deprecated_message) {
-  DRAKE_DEMAND(Contains(package_name));
+  std::lock_guard<std::mutex> lock(mutex_);
+  CrawlPending();
+  DRAKE_DEMAND(map_.count(package_name) > 0);
   map_.at(package_name).deprecated_message = std::move(deprecated_message);
 }
 
 int PackageMap::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  CrawlPending();
   return map_.size();
 }
 
 std::optional<std::string> PackageMap::GetDeprecated(
     const std::string& package_name) const {
-  DRAKE_DEMAND(Contains(package_name));
+  std::lock_guard<std::mutex> lock(mutex_);
+  CrawlPendingUnlessKnown(package_name);
+  DRAKE_DEMAND(map_.count(package_name) > 0);
   return map_.at(package_name).deprecated_message;
 }
 
 std::vector<std::string> PackageMap::GetPackageNames() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  CrawlPending();
   std::vector<std::string> package_names;
   package_names.reserve(map_.size());
   for (const auto& [package_name, data] : map_) {
@@ -91,7 +143,11 @@ std::vector<std::string> PackageMap::GetPackageNames() const {
 const string& PackageMap::GetPath(
     const string& package_name,
     std::optional<std::string>* deprecated_message) const {
-  DRAKE_DEMAND(Contains(package_name));
+  std::lock_guard<std::mutex> lock(mutex_);
+  CrawlPendingUnlessKnown(package_name);
+  DRAKE_DEMAND(map_.count(package_name) > 0);
+  // Entries are never modified by const member functions once added, so the
+  // returned reference remains valid after the lock is released.
   const auto& package_data = map_.at(package_name);
 
   // Check if we need to produce a deprecation warning.
@@ -120,7 +176,8 @@ const string& PackageMap::GetPath(
 
 void PackageMap::PopulateFromFolder(const string& path) {
   DRAKE_DEMAND(!path.empty());
-  CrawlForPackages(path);
+  std::lock_guard<std::mutex> lock(mutex_);
+  pending_crawls_.push_back({path, false, {}});
 }
 
 void PackageMap::PopulateFromEnvironment(const string& environment_variable) {
@@ -136,17 +193,18 @@ void PackageMap::PopulateFromEnvironment(const string& environment_variable) {
   if (value == nullptr) {
     return;
   }
+  std::lock_guard<std::mutex> lock(mutex_);
   std::istringstream iss{string(value)};
   string path;
   while (std::getline(iss, path, ':')) {
     if (!path.empty()) {
-      CrawlForPackages(path);
+      pending_crawls_.push_back({path, false, {}});
     }
   }
 }
 
 void PackageMap::PopulateFromRosPackagePath() {
-  const std::vector<std::string_view> stop_markers = {
+  const std::vector<std::string> stop_markers = {
     "AMENT_IGNORE",
     "CATKIN_IGNORE",
     "COLCON_IGNORE",
@@ -156,11 +214,12 @@ void PackageMap::PopulateFromRosPackagePath() {
   if (value == nullptr) {
     return;
   }
+  std::lock_guard<std::mutex> lock(mutex_);
   std::istringstream input{string(value)};
   string path;
   while (std::getline(input, path, ':')) {
     if (!path.empty()) {
-      CrawlForPackages(path, true, stop_markers);
+      pending_crawls_.push_back({path, true, stop_markers});
     }
   }
 }
@@ -173,73 +232,14 @@ string GetParentDirectory(const string& directory) {
   return filesystem::path(directory).parent_path().string();
 }
 
-// Removes leading and trailing whitespace and line breaks from a string.
-string RemoveBreaksAndIndentation(string target) {
-  static const std::regex midspan_breaks("\\s*\\n\\s*");
-  static const string whitespace_characters = " \r\n\t";
-  target.erase(0, target.find_first_not_of(whitespace_characters));
-  target.erase(target.find_last_not_of(whitespace_characters) + 1);
-  return std::regex_replace(target, midspan_breaks, " ");
-}
-
-// Parses the package.xml file specified by package_xml_file. Finds and returns
-// the name of the package and an optional deprecation message.
-std::tuple<string, std::optional<string>> ParsePackageManifest(
-    const string& package_xml_file) {
-  DRAKE_DEMAND(!package_xml_file.empty());
-  XMLDocument xml_doc;
-  xml_doc.LoadFile(package_xml_file.data());
-  if (xml_doc.ErrorID()) {
-    throw runtime_error("package_map.cc: GetPackageName(): "
-        "Failed to parse XML in file \"" + package_xml_file + "\".\n" +
-        xml_doc.ErrorName());
-  }
-
-  XMLElement* package_node = xml_doc.FirstChildElement("package");
-  if (!package_node) {
-    throw runtime_error("package_map.cc: GetPackageName(): "
-        "ERROR: XML file \"" + package_xml_file + "\" does not contain "
-        "element <package>.");
-  }
-
-  XMLElement* name_node = package_node->FirstChildElement("name");
-  if (!name_node) {
-    throw runtime_error("package_map.cc: GetPackageName(): "
-        "ERROR: <package> element does not contain element <name> "
-        "(XML file \"" + package_xml_file + "\").");
-  }
-
-  // Throws an exception if the name node does not have any children.
-  DRAKE_THROW_UNLESS(!name_node->NoChildren());
-  const string package_name = name_node->FirstChild()->Value();
-  DRAKE_THROW_UNLESS(package_name != "");
-
-  std::optional<string> deprecated_message;
-  XMLElement* export_node = package_node->FirstChildElement("export");
-  if (export_node) {
-    XMLElement* deprecated_node = export_node->FirstChildElement("deprecated");
-    if (deprecated_node) {
-      if (deprecated_node->NoChildren()) {
-        deprecated_message = {""};
-      } else {
-        deprecated_message = {
-          RemoveBreaksAndIndentation(deprecated_node->FirstChild()->Value())
-        };
-      }
-    }
-  }
-
-  return {package_name, deprecated_message};
-}
-
 }  // namespace
 
 bool PackageMap::AddPackageIfNew(const string& package_name,
-    const string& path) {
+    const string& path) const {
   DRAKE_DEMAND(!package_name.empty());
   DRAKE_DEMAND(!path.empty());
   // Don't overwrite entries in the map.
-  if (!Contains(package_name)) {
+  if (map_.count(package_name) == 0) {
     drake::log()->trace(
         "PackageMap: Adding package://{}: {}", package_name, path);
     if (!filesystem::is_directory(path)) {
@@ -268,55 +268,44 @@ PackageMap::PackageMap(std::initializer_list<std::string> manifest_paths) {
   }
 }
 
-void PackageMap::CrawlForPackages(const string& path, bool stop_at_package,
-    const std::vector<std::string_view>& stop_markers) {
-  DRAKE_DEMAND(!path.empty());
-  filesystem::path dir = filesystem::path(path).lexically_normal();
-  if (std::any_of(stop_markers.begin(), stop_markers.end(),
-      [dir](std::string_view name){return filesystem::exists(dir / name);})) {
-    return;
+void PackageMap::CrawlPending() const {
+  // Each crawl is dequeued before it starts, so that a crawl that throws isn't
+  // repeated by the next call.
+  while (!pending_crawls_.empty()) {
+    const PendingCrawl crawl = std::move(pending_crawls_.front());
+    pending_crawls_.erase(pending_crawls_.begin());
+    internal::CrawlForPackages(
+        crawl.path, crawl.stop_at_package, crawl.stop_markers,
+        [this](const string& package_name, const string& package_path,
+               const std::optional<string>& deprecated_message) {
+          if (AddPackageIfNew(package_name, package_path)) {
+            map_.at(package_name).deprecated_message = deprecated_message;
+          }
+        });
   }
-  filesystem::path manifest = dir / "package.xml";
-  if (filesystem::exists(manifest)) {
-    const auto [package_name, deprecated_message] =
-        ParsePackageManifest(manifest.string());
-    const string package_path = dir.string();
-    if (AddPackageIfNew(package_name, package_path + "/")) {
-      SetDeprecated(package_name, deprecated_message);
-    }
-    if (stop_at_package) {
-      return;
-    }
-  }
-  std::error_code ec;
-  filesystem::directory_iterator iter(dir, ec);
-  if (ec) {
-    log()->warn("Unable to open directory: {}", path);
-    return;
-  }
-  for (const auto& entry : iter) {
-    if (entry.is_directory()) {
-      const string filename = entry.path().filename().string();
-      // Skips hidden directories (including "." and "..").
-      if (filename.at(0) == '.') {
-        continue;
-      }
-      CrawlForPackages(entry.path().string(), stop_at_package, stop_markers);
-    }
+}
+
+void PackageMap::CrawlPendingUnlessKnown(const string& package_name) const {
+  if (map_.count(package_name) == 0) {
+    CrawlPending();
   }
 }
 
 void PackageMap::AddPackageXml(const string& filename) {
-  const auto [package_name, deprecated_message] = ParsePackageManifest(
-      filename);
+  const auto [package_name, deprecated_message] =
+      internal::ParsePackageManifest(filename);
   const string package_path = GetParentDirectory(filename);
-  Add(package_name, package_path);
-  SetDeprecated(package_name, deprecated_message);
+  std::lock_guard<std::mutex> lock(mutex_);
+  CrawlPending();
+  AddLocked(package_name, package_path);
+  map_.at(package_name).deprecated_message = deprecated_message;
 }
 
 std::ostream& operator<<(std::ostream& out, const PackageMap& package_map) {
+    std::lock_guard<std::mutex> lock(package_map.mutex_);
+    package_map.CrawlPending();
     out << "PackageMap:\n";
-    if (package_map.size() == 0)
+    if (package_map.map_.size() == 0)
       out << "  [EMPTY!]\n";
     for (const auto& entry : package_map.map_) {
       out << "  - " << entry.first << ": " << entry.second.path << "\n";
@@ -2,21 +2,41 @@
 
 #include <initializer_list>
 #include <map>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
 
-#include "drake/common/drake_copyable.h"
-
 namespace drake {
 namespace multibody {
 
 /// Maps ROS package names to their full path on the local file system. It is
 /// used by the SDF and URDF parsers when parsing files that reference ROS
 /// packages for resources like mesh files.
+///
+/// The Populate...() functions don't crawl the file system right away; they
+/// only record where to search. The search happens the first time that it's
+/// needed: when a package that isn't already known is looked up, when all
+/// packages are listed (e.g., size() or GetPackageNames()), or before the map
+/// is modified. So a program that only uses packages it has added explicitly
+/// (e.g., `drake`) never pays for crawling a large ROS_PACKAGE_PATH. Note that
+/// this also defers any warnings and errors from crawling (e.g., a malformed
+/// `package.xml`) to that first use.
+///
+/// Setting the environment variable DRAKE_PACKAGE_MAP_INDEX_DIR to a writable
+/// directory makes the results of crawling persist across processes: the
+/// crawl is replayed from an index file there for as long as the
+/// modification times of the directories and manifests it visited are
+/// unchanged.
+///
+/// Because of the deferred crawling, the const member functions may modify
+/// the map's internal state; they are nonetheless safe to call concurrently.
 class PackageMap final {
  public:
-  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(PackageMap)
+  PackageMap(const PackageMap&);
+  PackageMap& operator=(const PackageMap&);
+  PackageMap(PackageMap&&);
+  PackageMap& operator=(PackageMap&&);
 
   /// A constructor that initializes a default map containing only the top-
   /// level `drake` manifest.
@@ -135,27 +155,45 @@ class PackageMap final {
   // file paths.
   PackageMap(std::initializer_list<std::string> manifest_paths);
 
-  // Recursively crawls through @p path looking for package.xml files. Adds
-  // the packages defined by these package.xml files to this PackageMap.
-  //
-  // @param[in] stop_at_package When passed true, do not crawl into
-  // subdirectories of packages which have already been found.
-  // @param[in] stop_markers When a directory contains one or more files or
-  // directories with one of the given names, do not crawl into that directory
-  // or any subdirectories when searching for packages.
-  void CrawlForPackages(const std::string& path,
-      bool stop_at_package = false,
-      const std::vector<std::string_view>& stop_markers = {});
+  // The arguments of a deferred call to internal::CrawlForPackages().
+  struct PendingCrawl {
+    std::string path;
+    bool stop_at_package{false};
+    std::vector<std::string> stop_markers;
+  };
+
+  // Performs all pending crawls, adding the packages they find to map_. On
+  // error, the crawls up to and including the failing one are dropped. The
+  // caller must hold mutex_.
+  void CrawlPending() const;
+
+  // Performs all pending crawls if @p package_name is not yet known; i.e.,
+  // crawls only when needed to answer a question about @p package_name. The
+  // caller must hold mutex_.
+  void CrawlPendingUnlessKnown(const std::string& package_name) const;
+
+  // Same as Add(), without locking. The caller must hold mutex_.
+  void AddLocked(const std::string& package_name,
+      const std::string& package_path);
 
   // This method is the same as Add() except if package_name is already present
   // with a different path, then this method prints a warning and returns false
-  // without adding the new path. Returns true otherwise.
+  // without adding the new path. Returns true otherwise. The caller must hold
+  // mutex_.
   bool AddPackageIfNew(const std::string& package_name,
-      const std::string& path);
+      const std::string& path) const;
+
+  // Guards map_ and pending_crawls_, which the const member functions modify
+  // when crawling. Copies and moves get their own mutex.
+  mutable std::mutex mutex_;
 
   // The key is the name of a ROS package and the value is a struct containing
   // information about that package.
-  std::map<std::string, struct PackageData> map_;
+  mutable std::map<std::string, struct PackageData> map_;
+
+  // Crawls requested by the Populate...() functions that haven't happened yet,
+  // in the order they were requested.
+  mutable std::vector<PendingCrawl> pending_crawls_;
 };
 
 }  // namespace multibody
@@ -6,6 +6,7 @@
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "drake/common/diagnostic_policy.h"
 #include "drake/common/filesystem.h"
@@ -15,6 +16,7 @@
 #include "drake/multibody/parsing/detail_collision_filter_group_resolver.h"
 #include "drake/multibody/parsing/detail_composite_parse.h"
 #include "drake/multibody/parsing/detail_path_utils.h"
+#include "drake/multibody/parsing/detail_xml_document_cache.h"
 #include "drake/multibody/parsing/parser.h"
 #include "drake/multibody/parsing/scoped_names.h"
 
@@ -31,6 +33,7 @@ using drake::multibody::FixedOffsetFrame;
 using drake::multibody::Frame;
 using drake::multibody::internal::CollisionFilterGroupResolver;
 using drake::multibody::internal::CompositeParse;
+using drake::multibody::internal::XmlDocumentCache;
 using drake::multibody::ModelInstanceIndex;
 using drake::multibody::MultibodyPlant;
 using drake::multibody::PackageMap;
@@ -81,6 +84,34 @@ void AddWeld(
   }
 }
 
+// Parses the URDF files added by the `add_model` entries of `directives` into
+// the document cache, concurrently. Adding the models to the plant must still
+// happen serially and in order, but it then finds the documents in the cache.
+// SDFormat (and MJCF) files are left to the serial pass, because libsdformat
+// calls back into the plant while loading (for nested URDF includes), so its
+// parsing can't be separated from adding to the plant. Errors (e.g.,
+// unresolvable URIs) are ignored here and reported by the serial pass.
+void PrefetchUrdfModels(
+    const ModelDirectives& directives, const PackageMap& package_map) {
+  drake::internal::DiagnosticPolicy quiet;
+  quiet.SetActionForWarnings([](const auto&) {});
+  quiet.SetActionForErrors([](const auto&) {});
+  std::vector<std::string> files;
+  for (const auto& directive : directives.directives) {
+    if (!directive.add_model) { continue; }
+    std::string file = drake::multibody::internal::ResolveUri(
+        quiet, directive.add_model->file, package_map, "");
+    const std::string ext = fs::path(file).extension().string();
+    if ((ext == ".urdf") || (ext == ".URDF")) {
+      files.push_back(std::move(file));
+    }
+  }
+  // A single file gains nothing from being parsed ahead of time.
+  if (files.size() > 1) {
+    XmlDocumentCache::GetInstance().Prefetch(files);
+  }
+}
+
 void ProcessModelDirectivesImpl(
     const ModelDirectives& directives, MultibodyPlant<double>* plant,
     std::vector<ModelInstanceInfo>* added_models, Parser* parser,
@@ -100,6 +131,8 @@ void ProcessModelDirectivesImpl(
     return GetScopedFrameByName(*plant, PrefixName(model_namespace, name));
   };
 
+  PrefetchUrdfModels(directives, parser->package_map());
+
   for (auto& directive : directives.directives) {
     if (directive.add_model) {
       ModelInstanceInfo info;
@@ -9,6 +9,8 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/filesystem.h"
+#include "drake/geometry/proximity_properties.h"
 #include "drake/geometry/scene_graph.h"
 #include "drake/multibody/parsing/detail_common.h"
 #include "drake/multibody/parsing/test/test_loaders.h"
@@ -150,6 +152,35 @@ TEST_P(MultibodyPlantLinkTests, LinksWithCollisions) {
             default_friction());
 }
 
+// Verifies that the directory of precompiled hydroelastic representations is
+// resolved relative to the model file.
+TEST_P(MultibodyPlantLinkTests, PrecompiledDir) {
+  LoadMultibodyPlantAndSceneGraph();
+
+  const std::vector<GeometryId>& link3_collision_geometry_ids =
+      plant_.GetCollisionGeometriesForBody(plant_.GetBodyByName("link3"));
+  ASSERT_EQ(link3_collision_geometry_ids.size(), 1);
+  const geometry::ProximityProperties* properties =
+      scene_graph_.model_inspector().GetProximityProperties(
+          link3_collision_geometry_ids[0]);
+  ASSERT_NE(properties, nullptr);
+  const filesystem::path directory =
+      properties->GetProperty<std::string>(geometry::internal::kHydroGroup,
+                                           geometry::internal::kPrecompiledDir);
+  EXPECT_TRUE(directory.is_absolute());
+  EXPECT_EQ(directory.filename(), "urdf_parser_test");
+  EXPECT_TRUE(filesystem::is_directory(directory));
+
+  // The other collision geometries don't have the property.
+  const std::vector<GeometryId>& link1_collision_geometry_ids =
+      plant_.GetCollisionGeometriesForBody(plant_.GetBodyByName("link1"));
+  ASSERT_EQ(link1_collision_geometry_ids.size(), 2);
+  EXPECT_FALSE(scene_graph_.model_inspector()
+                   .GetProximityProperties(link1_collision_geometry_ids[0])
+                   ->HasProperty(geometry::internal::kHydroGroup,
+                                 geometry::internal::kPrecompiledDir));
+}
+
 
 INSTANTIATE_TEST_SUITE_P(SdfMultibodyPlantLinkTests,
                         MultibodyPlantLinkTests,
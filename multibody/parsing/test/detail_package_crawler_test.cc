@@ -0,0 +1,214 @@
+#include "drake/multibody/parsing/detail_package_crawler.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "drake/common/filesystem.h"
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+namespace fs = drake::filesystem;
+
+// A package found by the crawler.
+struct Found {
+  std::string name;
+  std::string path;
+  std::optional<std::string> deprecated_message;
+};
+
+class PackageCrawlerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    root_ = temp_directory() + "/root";
+    fs::create_directory(root_);
+  }
+
+  void TearDown() override {
+    ::unsetenv("DRAKE_PACKAGE_MAP_INDEX_DIR");
+  }
+
+  // Writes a package.xml declaring `name` into `root_/dir`, creating the
+  // directory as needed.
+  void WritePackage(const std::string& dir, const std::string& name,
+                    const std::string& extra = "") {
+    fs::create_directories(root_ + "/" + dir);
+    std::ofstream(root_ + "/" + dir + "/package.xml")
+        << fmt::format("<package><name>{}</name>{}</package>\n", name, extra);
+  }
+
+  std::vector<Found> Crawl(bool stop_at_package = false,
+                           const std::vector<std::string>& markers = {}) {
+    std::vector<Found> result;
+    CrawlForPackages(root_, stop_at_package, markers,
+                     [&result](const std::string& name,
+                               const std::string& path,
+                               const std::optional<std::string>& message) {
+                       result.push_back({name, path, message});
+                     });
+    return result;
+  }
+
+  // Returns the names of the packages found, mapped to their order.
+  static std::map<std::string, int> Names(const std::vector<Found>& found) {
+    std::map<std::string, int> result;
+    for (int i = 0; i < static_cast<int>(found.size()); ++i) {
+      result[found[i].name] = i;
+    }
+    return result;
+  }
+
+  std::string root_;
+};
+
+TEST_F(PackageCrawlerTest, Crawl) {
+  WritePackage("a", "a");
+  WritePackage("a/sub", "a_sub");
+  WritePackage("b/c", "c");
+  WritePackage(".hidden", "hidden");
+  WritePackage("d", "d");
+  std::ofstream(root_ + "/d/COLCON_IGNORE");
+
+  const std::vector<Found> found = Crawl();
+  std::map<std::string, int> names = Names(found);
+  ASSERT_EQ(names.size(), 4);
+  ASSERT_EQ(names.count("a_sub"), 1);
+  // Packages are reported in depth-first order.
+  EXPECT_LT(names.at("a"), names.at("a_sub"));
+  EXPECT_EQ(found[names.at("a")].path, root_ + "/a/");
+  EXPECT_EQ(found[names.at("c")].path, root_ + "/b/c/");
+
+  // ROS-style crawling stops at packages and at markers.
+  names = Names(Crawl(true, {"COLCON_IGNORE"}));
+  EXPECT_EQ(names.size(), 2);
+  EXPECT_EQ(names.count("a"), 1);
+  EXPECT_EQ(names.count("c"), 1);
+}
+
+TEST_F(PackageCrawlerTest, Deprecation) {
+  WritePackage("x", "x",
+               "<export><deprecated>\n  Use y.\n</deprecated></export>");
+  WritePackage("y", "y", "<export><deprecated/></export>");
+  WritePackage("z", "z");
+  const std::vector<Found> found = Crawl();
+  const std::map<std::string, int> names = Names(found);
+  EXPECT_EQ(found[names.at("x")].deprecated_message, "Use y.");
+  EXPECT_EQ(found[names.at("y")].deprecated_message, "");
+  EXPECT_EQ(found[names.at("z")].deprecated_message, std::nullopt);
+}
+
+TEST_F(PackageCrawlerTest, Errors) {
+  // A directory that doesn't exist is only a warning.
+  std::vector<Found> found;
+  CrawlForPackages("/does/not/exist", false, {},
+                   [&found](const std::string& name, const std::string& path,
+                            const std::optional<std::string>& message) {
+                     found.push_back({name, path, message});
+                   });
+  EXPECT_TRUE(found.empty());
+
+  // A malformed manifest is an error.
+  WritePackage("a", "a");
+  fs::create_directories(root_ + "/a/bad");
+  std::ofstream(root_ + "/a/bad/package.xml") << "<package>";
+  DRAKE_EXPECT_THROWS_MESSAGE(Crawl(), ".*Failed to parse XML[\\s\\S]*");
+}
+
+TEST_F(PackageCrawlerTest, Index) {
+  const std::string index_dir = temp_directory() + "/index";
+  fs::create_directory(index_dir);
+  ::setenv("DRAKE_PACKAGE_MAP_INDEX_DIR", index_dir.c_str(), 1);
+  auto num_index_files = [&index_dir]() {
+    int count = 0;
+    for ([[maybe_unused]] const auto& entry :
+         fs::directory_iterator(index_dir)) {
+      ++count;
+    }
+    return count;
+  };
+
+  WritePackage("a", "a");
+  WritePackage("b/c", "c", "<export><deprecated>Old.</deprecated></export>");
+  const std::vector<Found> crawled = Crawl();
+  ASSERT_EQ(crawled.size(), 2);
+  EXPECT_EQ(num_index_files(), 1);
+
+  // A different crawl of the same root gets its own index.
+  EXPECT_EQ(Crawl(true, {"COLCON_IGNORE"}).size(), 2);
+  EXPECT_EQ(num_index_files(), 2);
+
+  // Change a manifest behind the index's back (restoring its modification
+  // time); the index is used, so the change goes unnoticed.
+  const std::string manifest = root_ + "/a/package.xml";
+  const auto time = fs::last_write_time(manifest);
+  WritePackage("a", "renamed");
+  fs::last_write_time(manifest, time);
+  std::vector<Found> replayed = Crawl();
+  ASSERT_EQ(replayed.size(), 2);
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_EQ(replayed[i].name, crawled[i].name);
+    EXPECT_EQ(replayed[i].path, crawled[i].path);
+    EXPECT_EQ(replayed[i].deprecated_message, crawled[i].deprecated_message);
+  }
+
+  // Touching the manifest invalidates the index.
+  fs::last_write_time(manifest, time + std::chrono::seconds(1));
+  EXPECT_EQ(Names(Crawl()).count("renamed"), 1);
+
+  // So does adding a package anywhere in the tree.
+  WritePackage("b/e", "e");
+  EXPECT_EQ(Names(Crawl()).count("e"), 1);
+  EXPECT_EQ(Crawl().size(), 3);
+}
+
+TEST_F(PackageCrawlerTest, CorruptIndex) {
+  const std::string index_dir = temp_directory() + "/index";
+  fs::create_directory(index_dir);
+  ::setenv("DRAKE_PACKAGE_MAP_INDEX_DIR", index_dir.c_str(), 1);
+  WritePackage("a", "a");
+  ASSERT_EQ(Crawl().size(), 1);
+  std::vector<fs::path> index_files;
+  for (const auto& entry : fs::directory_iterator(index_dir)) {
+    index_files.push_back(entry.path());
+  }
+  ASSERT_EQ(index_files.size(), 1);
+
+  // Replace the modification times in the index with garbage, and rename the
+  // package behind the index's back. The corrupt index is ignored and the
+  // tree is crawled again.
+  std::string contents;
+  {
+    std::ifstream file(index_files[0]);
+    std::string line;
+    while (std::getline(file, line)) {
+      if (line.rfind("s\t", 0) == 0) {
+        line = "s\tnot_a_number" + line.substr(line.find('\t', 2));
+      }
+      contents += line + "\n";
+    }
+  }
+  ASSERT_NE(contents.find("not_a_number"), std::string::npos);
+  std::ofstream(index_files[0]) << contents;
+  const std::string manifest = root_ + "/a/package.xml";
+  const auto time = fs::last_write_time(manifest);
+  WritePackage("a", "renamed");
+  fs::last_write_time(manifest, time);
+  const std::vector<Found> found = Crawl();
+  ASSERT_EQ(found.size(), 1);
+  EXPECT_EQ(found[0].name, "renamed");
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
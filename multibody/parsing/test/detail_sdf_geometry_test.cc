@@ -1141,7 +1141,7 @@ TEST_F(SceneGraphParserDetail, MakeProximityPropertiesForCollision) {
     <drake:mu_static>4.75</drake:mu_static>
   </drake:proximity_properties>)""");
     ProximityProperties properties = MakeProximityPropertiesForCollision(
-        diagnostic_, *sdf_collision);
+        diagnostic_, *sdf_collision, NoopResolveFilename);
     assert_single_property(properties, geometry::internal::kHydroGroup,
                            geometry::internal::kRezHint, 2.5);
     assert_single_property(properties, geometry::internal::kHydroGroup,
@@ -1160,7 +1160,7 @@ TEST_F(SceneGraphParserDetail, MakeProximityPropertiesForCollision) {
     <drake:rigid_hydroelastic/>
   </drake:proximity_properties>)""");
     ProximityProperties properties = MakeProximityPropertiesForCollision(
-        diagnostic_, *sdf_collision);
+        diagnostic_, *sdf_collision, NoopResolveFilename);
     ASSERT_TRUE(properties.HasProperty(geometry::internal::kHydroGroup,
                                        geometry::internal::kComplianceType));
     EXPECT_EQ(properties.GetProperty<geometry::internal::HydroelasticType>(
@@ -1175,7 +1175,7 @@ TEST_F(SceneGraphParserDetail, MakeProximityPropertiesForCollision) {
     <drake:compliant_hydroelastic/>
   </drake:proximity_properties>)""");
     ProximityProperties properties = MakeProximityPropertiesForCollision(
-        diagnostic_, *sdf_collision);
+        diagnostic_, *sdf_collision, NoopResolveFilename);
     ASSERT_TRUE(properties.HasProperty(geometry::internal::kHydroGroup,
                                        geometry::internal::kComplianceType));
     EXPECT_EQ(properties.GetProperty<geometry::internal::HydroelasticType>(
@@ -1192,7 +1192,8 @@ TEST_F(SceneGraphParserDetail, MakeProximityPropertiesForCollision) {
     <drake:soft_hydroelastic/>
   </drake:proximity_properties>)""");
     DRAKE_EXPECT_THROWS_MESSAGE(
-        MakeProximityPropertiesForCollision(diagnostic_, *sdf_collision),
+        MakeProximityPropertiesForCollision(diagnostic_, *sdf_collision,
+                                            NoopResolveFilename),
         "A <collision> geometry has defined the unsupported tag "
         "<drake:soft_hydroelastic>. Please change it to "
         "<drake:compliant_hydroelastic>.");
@@ -1206,7 +1207,8 @@ TEST_F(SceneGraphParserDetail, MakeProximityPropertiesForCollision) {
     <drake:compliant_hydroelastic/>
   </drake:proximity_properties>)""");
     DRAKE_EXPECT_THROWS_MESSAGE(
-        MakeProximityPropertiesForCollision(diagnostic_, *sdf_collision),
+        MakeProximityPropertiesForCollision(diagnostic_, *sdf_collision,
+                                            NoopResolveFilename),
         "A <collision> geometry has defined mutually-exclusive tags .*rigid.* "
         "and .*compliant.*");
   }
@@ -1224,7 +1226,7 @@ TEST_F(SceneGraphParserDetail, MakeProximityPropertiesForCollision) {
     </friction>
   </surface>)""");
     ProximityProperties properties = MakeProximityPropertiesForCollision(
-        diagnostic_, *sdf_collision);
+        diagnostic_, *sdf_collision, NoopResolveFilename);
     assert_friction(properties, {0.8, 0.3});
   }
 
@@ -1249,12 +1251,39 @@ TEST_F(SceneGraphParserDetail, MakeProximityPropertiesForCollision) {
       warning = detail;
     });
     ProximityProperties properties =
-        MakeProximityPropertiesForCollision(diagnostic, *sdf_collision);
+        MakeProximityPropertiesForCollision(diagnostic, *sdf_collision,
+                                            NoopResolveFilename);
     EXPECT_THAT(warning.message, ::testing::MatchesRegex(
         ".*collision.*some_geo.*ode.*ignored.*"));
     assert_friction(properties, {0.3, 0.3});
   }
 
+  // Case: the precompiled directory is resolved with the given function, and
+  // omitted if it can't be resolved.
+  {
+    unique_ptr<sdf::Collision> sdf_collision = make_sdf_collision(R"""(
+  <drake:proximity_properties>
+    <drake:precompiled_dir>some_dir</drake:precompiled_dir>
+  </drake:proximity_properties>)""");
+    ProximityProperties properties = MakeProximityPropertiesForCollision(
+        diagnostic_, *sdf_collision,
+        [](const DiagnosticPolicy&, std::string uri) {
+          return "/resolved/" + uri;
+        });
+    EXPECT_EQ(properties.GetProperty<std::string>(
+                  geometry::internal::kHydroGroup,
+                  geometry::internal::kPrecompiledDir),
+              "/resolved/some_dir");
+
+    properties = MakeProximityPropertiesForCollision(
+        diagnostic_, *sdf_collision,
+        [](const DiagnosticPolicy&, std::string) {
+          return std::string();
+        });
+    EXPECT_FALSE(properties.HasProperty(geometry::internal::kHydroGroup,
+                                        geometry::internal::kPrecompiledDir));
+  }
+
   // Note: we're not explicitly testing negative friction coefficients or
   // dynamic > static because we rely on the CoulombFriction constructor to
   // handle that.
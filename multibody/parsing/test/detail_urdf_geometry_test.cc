@@ -690,6 +690,34 @@ TEST_F(UrdfGeometryTest, CollisionSmokeTest) {
   VerifyFriction(properties, {3.5, 3.25});
 }
 
+// Verify the directory of precompiled hydroelastic representations is resolved
+// like any other URI, and that problems with it are reported.
+TEST_F(UrdfGeometryTest, CollisionPrecompiledDir) {
+  const ProximityProperties& properties = ParseCollisionDocGood(R"""(
+  <drake:proximity_properties>
+    <drake:precompiled_dir
+        value="package://drake/multibody/parsing/test/urdf_parser_test"/>
+  </drake:proximity_properties>)""");
+  const std::string& directory = properties.GetProperty<std::string>(
+      geometry::internal::kHydroGroup, geometry::internal::kPrecompiledDir);
+  EXPECT_THAT(directory, MatchesRegex("/.*/multibody/parsing/test/"
+                                      "urdf_parser_test"));
+
+  ParseCollisionDoc(R"""(
+  <drake:proximity_properties>
+    <drake:precompiled_dir/>
+  </drake:proximity_properties>)""");
+  EXPECT_THAT(TakeError(), MatchesRegex(".*'value'.*drake:precompiled_dir.*"));
+
+  const ProximityProperties& missing = ParseCollisionDocGood(R"""(
+  <drake:proximity_properties>
+    <drake:precompiled_dir value="package://drake/no_such_directory"/>
+  </drake:proximity_properties>)""");
+  EXPECT_THAT(TakeError(), MatchesRegex(".*no_such_directory.*not exist.*"));
+  EXPECT_FALSE(missing.HasProperty(geometry::internal::kHydroGroup,
+                                   geometry::internal::kPrecompiledDir));
+}
+
 TEST_F(UrdfGeometryTest, TestCollisionNameExhaustion) {
   // Test that name exhaustion doesn't cause ParseCollsion() to throw from
   // geometry back end code, and that it emits an appropriate error.
@@ -0,0 +1,137 @@
+#include "drake/multibody/parsing/detail_xml_document_cache.h"
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+using tinyxml2::XMLDocument;
+using tinyxml2::XMLElement;
+
+class XmlDocumentCacheTest : public ::testing::Test {
+ protected:
+  std::string WriteFile(const std::string& name, const std::string& contents) {
+    const std::string filename = dir_ + "/" + name;
+    std::ofstream(filename) << contents;
+    return filename;
+  }
+
+  const std::string dir_{temp_directory()};
+  XmlDocumentCache dut_;
+};
+
+TEST_F(XmlDocumentCacheTest, KeyedOnContents) {
+  const std::string contents = R"""(<robot name="a &amp; b">
+  <link name="  spaced  "/>
+</robot>)""";
+  const std::string file1 = WriteFile("one.urdf", contents);
+  const std::string file2 = WriteFile("two.urdf", contents);
+
+  std::shared_ptr<const XMLDocument> first = dut_.Get(file1);
+  ASSERT_NE(first, nullptr);
+  const XMLElement* robot = first->FirstChildElement("robot");
+  ASSERT_NE(robot, nullptr);
+  EXPECT_STREQ(robot->Attribute("name"), "a & b");
+  EXPECT_STREQ(robot->FirstChildElement("link")->Attribute("name"),
+               "  spaced  ");
+  EXPECT_EQ(dut_.GetStats().misses, 1);
+
+  // The same contents under a different name share the document.
+  EXPECT_EQ(dut_.Get(file2), first);
+  EXPECT_EQ(dut_.Get(file1), first);
+  EXPECT_EQ(dut_.GetStats().hits, 2);
+
+  // Editing the file yields a new document.
+  WriteFile("one.urdf", "<robot name='c'/>");
+  std::shared_ptr<const XMLDocument> edited = dut_.Get(file1);
+  ASSERT_NE(edited, nullptr);
+  EXPECT_NE(edited, first);
+  EXPECT_STREQ(edited->FirstChildElement("robot")->Attribute("name"), "c");
+  EXPECT_EQ(dut_.GetStats().misses, 2);
+
+  // Clearing evicts the entries (but not the documents held by callers).
+  dut_.Clear();
+  EXPECT_EQ(dut_.GetStats().hits, 0);
+  EXPECT_EQ(dut_.GetStats().misses, 0);
+  EXPECT_NE(dut_.Get(file2), first);
+  EXPECT_STREQ(robot->Attribute("name"), "a & b");
+}
+
+TEST_F(XmlDocumentCacheTest, Failures) {
+  EXPECT_EQ(dut_.Get(dir_ + "/no_such_file.urdf"), nullptr);
+
+  // Malformed documents are not cached.
+  const std::string bad = WriteFile("bad.urdf", "<robot>");
+  EXPECT_EQ(dut_.Get(bad), nullptr);
+  EXPECT_EQ(dut_.Get(bad), nullptr);
+  EXPECT_EQ(dut_.GetStats().misses, 2);
+  EXPECT_EQ(dut_.GetStats().hits, 0);
+}
+
+// Each entry is charged the size of its file (17 bytes here); the least
+// recently used entries are evicted once the budget is exceeded.
+TEST_F(XmlDocumentCacheTest, EvictionHonorsBudget) {
+  XmlDocumentCache dut(34);
+  EXPECT_EQ(dut.max_bytes(), 34);
+  const std::string a = WriteFile("a.urdf", "<robot name='a'/>");
+  const std::string b = WriteFile("b.urdf", "<robot name='b'/>");
+  const std::string c = WriteFile("c.urdf", "<robot name='c'/>");
+
+  std::shared_ptr<const XMLDocument> document_a = dut.Get(a);
+  ASSERT_NE(document_a, nullptr);
+  ASSERT_NE(dut.Get(b), nullptr);
+  EXPECT_EQ(dut.GetStats().bytes, 34);
+  // Touch a, so that b becomes the least recently used.
+  EXPECT_EQ(dut.Get(a), document_a);
+  ASSERT_NE(dut.Get(c), nullptr);
+  EXPECT_EQ(dut.GetStats().evictions, 1);
+  EXPECT_EQ(dut.GetStats().bytes, 34);
+  EXPECT_EQ(dut.Get(a), document_a);
+  EXPECT_EQ(dut.GetStats().misses, 3);
+  ASSERT_NE(dut.Get(b), nullptr);
+  EXPECT_EQ(dut.GetStats().misses, 4);
+  EXPECT_EQ(dut.GetStats().evictions, 2);
+
+  // Documents outlive their eviction.
+  dut.Clear();
+  EXPECT_STREQ(document_a->FirstChildElement("robot")->Attribute("name"), "a");
+}
+
+TEST_F(XmlDocumentCacheTest, Prefetch) {
+  std::vector<std::string> filenames;
+  for (int i = 0; i < 8; ++i) {
+    filenames.push_back(WriteFile(fmt::format("model{}.urdf", i),
+                                  fmt::format("<robot name='r{}'/>", i)));
+  }
+  // Duplicates and bad files are tolerated.
+  filenames.push_back(filenames.front());
+  filenames.push_back(WriteFile("bad.urdf", "<robot"));
+  filenames.push_back(dir_ + "/no_such_file.urdf");
+
+  dut_.Prefetch(filenames);
+  EXPECT_EQ(dut_.GetStats().misses, 9);
+  EXPECT_EQ(dut_.GetStats().hits, 0);
+
+  for (int i = 0; i < 8; ++i) {
+    std::shared_ptr<const XMLDocument> document = dut_.Get(filenames[i]);
+    ASSERT_NE(document, nullptr);
+    EXPECT_EQ(document->FirstChildElement("robot")->Attribute("name"),
+              fmt::format("r{}", i));
+  }
+  EXPECT_EQ(dut_.GetStats().hits, 8);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
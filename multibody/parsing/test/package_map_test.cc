@@ -1,11 +1,13 @@
 #include "drake/multibody/parsing/package_map.h"
 
 #include <algorithm>
+#include <fstream>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/filesystem.h"
 #include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/unused.h"
 
@@ -342,6 +344,28 @@ GTEST_TEST(PackageMapTest, TestDeprecation) {
   }
 }
 
+// Tests that crawling is deferred until a package is needed, so that only
+// lookups that miss pay for it (and see its errors).
+GTEST_TEST(PackageMapTest, TestDeferredCrawling) {
+  const string root_path = temp_directory();
+  filesystem::create_directory(root_path + "/bad");
+  std::ofstream(root_path + "/bad/package.xml") << "<package>";
+
+  PackageMap package_map;
+  EXPECT_NO_THROW(package_map.PopulateFromFolder(root_path));
+
+  // Known packages are found without crawling; copies keep the pending crawl.
+  EXPECT_TRUE(package_map.Contains("drake"));
+  const PackageMap copy(package_map);
+  DRAKE_EXPECT_THROWS_MESSAGE(package_map.Contains("unknown"),
+                              ".*Failed to parse XML[\\s\\S]*");
+  DRAKE_EXPECT_THROWS_MESSAGE(copy.size(), ".*Failed to parse XML[\\s\\S]*");
+
+  // A crawl that failed isn't repeated.
+  EXPECT_FALSE(package_map.Contains("unknown"));
+  EXPECT_EQ(package_map.size(), 1);
+}
+
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
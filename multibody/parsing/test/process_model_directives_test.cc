@@ -4,6 +4,8 @@
 #include <memory>
 #include <sstream>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -11,6 +13,7 @@
 #include "drake/common/find_resource.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/math/rigid_transform.h"
+#include "drake/multibody/parsing/detail_xml_document_cache.h"
 #include "drake/multibody/parsing/scoped_names.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/multibody/tree/revolute_joint.h"
@@ -336,6 +339,38 @@ GTEST_TEST(ProcessModelDirectivesTest, DefaultPositions) {
       0.2);
 }
 
+// Adding the same URDF file many times parses it only once: the copies are
+// served from the document cache (after a parallel prefetch), and still
+// produce independent models.
+GTEST_TEST(ProcessModelDirectivesTest, RepeatedUrdfModels) {
+  const int kNumCopies = 4;
+  std::string yaml = "directives:\n";
+  for (int i = 0; i < kNumCopies; ++i) {
+    yaml += fmt::format(
+        "- add_model:\n"
+        "    name: acrobot{}\n"
+        "    file: package://drake/multibody/benchmarks/acrobot/acrobot.urdf\n",
+        i);
+  }
+  auto& cache = internal::XmlDocumentCache::GetInstance();
+  cache.Clear();
+
+  MultibodyPlant<double> plant(0.0);
+  Parser parser(&plant);
+  const std::vector<ModelInstanceInfo> added =
+      ProcessModelDirectives(LoadModelDirectivesFromString(yaml), &parser);
+  ASSERT_EQ(added.size(), kNumCopies);
+  for (int i = 0; i < kNumCopies; ++i) {
+    EXPECT_EQ(added[i].model_name, fmt::format("acrobot{}", i));
+    EXPECT_TRUE(plant.HasBodyNamed("Link2", added[i].model_instance));
+  }
+
+  // The file was parsed once, by the prefetch; every model was then added
+  // from the cached document.
+  EXPECT_EQ(cache.GetStats().misses, 1);
+  EXPECT_EQ(cache.GetStats().hits, kNumCopies);
+}
+
 // Make sure we have good error messages.
 GTEST_TEST(ProcessModelDirectivesTest, ErrorMessages) {
   // When the user gives a bogus filename, at minimum we must echo it back to
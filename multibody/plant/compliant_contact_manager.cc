@@ -12,12 +12,12 @@
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/proximity_properties.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
+#include "drake/multibody/plant/contact_jacobian_blocks.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/multibody/plant/sap_driver.h"
 #include "drake/multibody/triangle_quadrature/gaussian_triangle_quadrature_rule.h"
 #include "drake/systems/framework/context.h"
 
-using drake::geometry::GeometryId;
 using drake::geometry::PenetrationAsPointPair;
 using drake::multibody::contact_solvers::internal::ContactSolverResults;
 using drake::multibody::internal::DiscreteContactPair;
@@ -110,38 +110,19 @@ CompliantContactManager<T>::CalcContactKinematics(
   // Quick no-op exit.
   if (num_contacts == 0) return contact_kinematics;
 
-  // Scratch workspace variables.
-  const int nv = plant().num_velocities();
-  Matrix3X<T> Jv_WAc_W(3, nv);
-  Matrix3X<T> Jv_WBc_W(3, nv);
-  Matrix3X<T> Jv_AcBc_W(3, nv);
+  // Jacobian blocks J_AcBc_W, computed for all contact points at once.
+  using JacobianTreeBlock =
+      typename ContactPairKinematics<T>::JacobianTreeBlock;
+  std::vector<std::vector<JacobianTreeBlock>> jacobian_blocks =
+      CalcContactJacobianTreeBlocks(
+          this->internal_tree(), context, this->geometry_id_to_body_index(),
+          contact_pairs);
 
-  const Frame<T>& frame_W = plant().world_frame();
   for (int icontact = 0; icontact < num_contacts; ++icontact) {
     const auto& point_pair = contact_pairs[icontact];
 
-    const GeometryId geometryA_id = point_pair.id_A;
-    const GeometryId geometryB_id = point_pair.id_B;
-
-    BodyIndex bodyA_index = this->geometry_id_to_body_index().at(geometryA_id);
-    const Body<T>& bodyA = plant().get_body(bodyA_index);
-    BodyIndex bodyB_index = this->geometry_id_to_body_index().at(geometryB_id);
-    const Body<T>& bodyB = plant().get_body(bodyB_index);
-
     // Contact normal from point A into B.
     const Vector3<T>& nhat_W = -point_pair.nhat_BA_W;
-    const Vector3<T>& p_WC = point_pair.p_WC;
-
-    // Since v_AcBc_W = v_WBc - v_WAc the relative velocity Jacobian will be:
-    //   J_AcBc_W = Jv_WBc_W - Jv_WAc_W.
-    // That is the relative velocity at C is v_AcBc_W = J_AcBc_W * v.
-    this->internal_tree().CalcJacobianTranslationalVelocity(
-        context, JacobianWrtVariable::kV, bodyA.body_frame(), frame_W, p_WC,
-        frame_W, frame_W, &Jv_WAc_W);
-    this->internal_tree().CalcJacobianTranslationalVelocity(
-        context, JacobianWrtVariable::kV, bodyB.body_frame(), frame_W, p_WC,
-        frame_W, frame_W, &Jv_WBc_W);
-    Jv_AcBc_W = Jv_WBc_W - Jv_WAc_W;
 
     // Define a contact frame C at the contact point such that the z-axis Cz
     // equals nhat_W. The tangent vectors are arbitrary, with the only
@@ -149,39 +130,14 @@ CompliantContactManager<T>::CalcContactKinematics(
     math::RotationMatrix<T> R_WC =
         math::RotationMatrix<T>::MakeFromOneVector(nhat_W, 2);
 
-    const TreeIndex& treeA_index =
-        tree_topology().body_to_tree_index(bodyA_index);
-    const TreeIndex& treeB_index =
-        tree_topology().body_to_tree_index(bodyB_index);
-    // Sanity check, at least one must be valid.
-    DRAKE_DEMAND(treeA_index.is_valid() || treeB_index.is_valid());
-
-    // We have at most two blocks per contact.
-    std::vector<typename ContactPairKinematics<T>::JacobianTreeBlock>
-        jacobian_blocks;
-    jacobian_blocks.reserve(2);
-
-    // Tree A contribution to contact Jacobian Jv_W_AcBc_C.
-    if (treeA_index.is_valid()) {
-      Matrix3X<T> J = R_WC.matrix().transpose() *
-                      Jv_AcBc_W.middleCols(
-                          tree_topology().tree_velocities_start(treeA_index),
-                          tree_topology().num_tree_velocities(treeA_index));
-      jacobian_blocks.emplace_back(treeA_index, std::move(J));
-    }
-
-    // Tree B contribution to contact Jacobian Jv_W_AcBc_C.
-    // This contribution must be added only if B is different from A.
-    if ((treeB_index.is_valid() && !treeA_index.is_valid()) ||
-        (treeB_index.is_valid() && treeB_index != treeA_index)) {
-      Matrix3X<T> J = R_WC.matrix().transpose() *
-                      Jv_AcBc_W.middleCols(
-                          tree_topology().tree_velocities_start(treeB_index),
-                          tree_topology().num_tree_velocities(treeB_index));
-      jacobian_blocks.emplace_back(treeB_index, std::move(J));
+    // We have at most two blocks per contact, one per tree. Re-express each
+    // block J_AcBc_W in the contact frame to obtain Jv_W_AcBc_C.
+    for (auto& block : jacobian_blocks[icontact]) {
+      block.J = R_WC.matrix().transpose() * block.J;
     }
 
-    contact_kinematics.emplace_back(point_pair.phi0, std::move(jacobian_blocks),
+    contact_kinematics.emplace_back(point_pair.phi0,
+                                    std::move(jacobian_blocks[icontact]),
                                     std::move(R_WC));
   }
 
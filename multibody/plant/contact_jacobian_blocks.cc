@@ -0,0 +1,104 @@
+#include "drake/multibody/plant/contact_jacobian_blocks.h"
+
+#include <utility>
+
+#include "drake/common/parallel_for.h"
+#include "drake/math/cross_product.h"
+#include "drake/multibody/plant/contact_parallelism.h"
+#include "drake/multibody/tree/body.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+template <typename T>
+std::vector<std::vector<typename ContactPairKinematics<T>::JacobianTreeBlock>>
+CalcContactJacobianTreeBlocks(
+    const MultibodyTree<T>& tree, const systems::Context<T>& context,
+    const std::unordered_map<geometry::GeometryId, BodyIndex>&
+        geometry_id_to_body_index,
+    const std::vector<DiscreteContactPair<T>>& contact_pairs) {
+  using JacobianTreeBlock =
+      typename ContactPairKinematics<T>::JacobianTreeBlock;
+  const MultibodyTreeTopology& topology = tree.get_topology();
+  const int num_contacts = contact_pairs.size();
+
+  // Bodies A and B for each contact pair.
+  std::vector<std::pair<BodyIndex, BodyIndex>> pair_bodies(num_contacts);
+  for (int i = 0; i < num_contacts; ++i) {
+    pair_bodies[i] = {geometry_id_to_body_index.at(contact_pairs[i].id_A),
+                      geometry_id_to_body_index.at(contact_pairs[i].id_B)};
+  }
+
+  // Spatial velocity Jacobian Js_V_WBo_W of the origin of each body B in
+  // contact, restricted to the columns of the body's tree, along with the
+  // position p_WBo of its origin. Bodies with no tree have zero Jacobian and
+  // are skipped. The Jacobian of a point P fixed to B then follows from the
+  // shift v_WP = v_WBo + w_WB x p_BoP_W.
+  std::vector<int> body_to_slot(tree.num_bodies(), -1);
+  std::vector<MatrixX<T>> Js_V_WBo_W;
+  std::vector<Vector3<T>> p_WBo;
+  MatrixX<T> Js_V_WBo_W_full(6, tree.num_velocities());
+  for (const auto& [body_A, body_B] : pair_bodies) {
+    for (const BodyIndex& body_index : {body_A, body_B}) {
+      const TreeIndex tree_index = topology.body_to_tree_index(body_index);
+      if (!tree_index.is_valid() || body_to_slot[body_index] >= 0) continue;
+      const Body<T>& body = tree.get_body(body_index);
+      tree.CalcJacobianSpatialVelocity(
+          context, JacobianWrtVariable::kV, body.body_frame(),
+          Vector3<T>::Zero(), tree.world_frame(), tree.world_frame(),
+          &Js_V_WBo_W_full);
+      body_to_slot[body_index] = Js_V_WBo_W.size();
+      Js_V_WBo_W.push_back(Js_V_WBo_W_full.middleCols(
+          topology.tree_velocities_start(tree_index),
+          topology.num_tree_velocities(tree_index)));
+      p_WBo.push_back(tree.EvalBodyPoseInWorld(context, body).translation());
+    }
+  }
+
+  // With the per-body data above, the Jacobians of different contact points
+  // are independent and can be computed concurrently. The Jacobian of point
+  // Bc relative to point Ac is J_AcBc_W = Jv_WBc_W − Jv_WAc_W.
+  std::vector<std::vector<JacobianTreeBlock>> blocks(num_contacts);
+  drake::internal::ParallelForOptions parallel_options;
+  parallel_options.parallelize = ParallelizeContactLoops<T>(num_contacts);
+  drake::internal::ParallelFor(num_contacts, [&](int i) {
+    const Vector3<T>& p_WC = contact_pairs[i].p_WC;
+    // Returns Jv_WPc_W for point Pc of `body` coincident with C, on the
+    // columns of the body's tree.
+    auto calc_point_jacobian = [&](BodyIndex body) -> Matrix3X<T> {
+      const int slot = body_to_slot[body];
+      const MatrixX<T>& Js = Js_V_WBo_W[slot];
+      const Vector3<T> p_BoC_W = p_WC - p_WBo[slot];
+      return Js.template bottomRows<3>() -
+             math::VectorToSkewSymmetric(p_BoC_W) * Js.template topRows<3>();
+    };
+
+    const auto& [body_A, body_B] = pair_bodies[i];
+    const TreeIndex tree_A = topology.body_to_tree_index(body_A);
+    const TreeIndex tree_B = topology.body_to_tree_index(body_B);
+    // Sanity check, at least one must be valid.
+    DRAKE_DEMAND(tree_A.is_valid() || tree_B.is_valid());
+    std::vector<JacobianTreeBlock>& pair_blocks = blocks[i];
+    pair_blocks.reserve(2);
+    const bool same_tree =
+        tree_A.is_valid() && tree_B.is_valid() && tree_A == tree_B;
+    if (tree_A.is_valid()) {
+      Matrix3X<T> J = -calc_point_jacobian(body_A);
+      if (same_tree) J += calc_point_jacobian(body_B);
+      pair_blocks.emplace_back(tree_A, std::move(J));
+    }
+    if (tree_B.is_valid() && !same_tree) {
+      pair_blocks.emplace_back(tree_B, calc_point_jacobian(body_B));
+    }
+  }, parallel_options);
+
+  return blocks;
+}
+
+DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    (&CalcContactJacobianTreeBlocks<T>))
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/eigen_types.h"
+#include "drake/geometry/geometry_ids.h"
+#include "drake/multibody/plant/contact_pair_kinematics.h"
+#include "drake/multibody/plant/discrete_contact_pair.h"
+#include "drake/multibody/tree/multibody_tree.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+// For each contact pair between geometries A and B in `contact_pairs`, computes
+// the Jacobian J_AcBc_W of the velocity v_AcBc_W of point Bc (fixed to the body
+// of geometry B) relative to point Ac (fixed to the body of geometry A), both
+// coincident with the contact point C, with respect to the generalized
+// velocities v and expressed in the world frame W. That is, v_AcBc_W =
+// J_AcBc_W⋅v.
+//
+// Only the columns of J_AcBc_W for the one or two trees of the bodies in
+// contact can be non-zero, and the Jacobian for the i-th contact pair is
+// returned as one 3 x num_tree_velocities(t) block per tree t in the i-th entry
+// of the result, for bodies A and B in that order. Bodies with no tree (e.g.
+// the world or bodies welded to it) contribute no block, and a single block is
+// returned when both bodies belong to the same tree.
+//
+// This is equivalent to calling
+// MultibodyTree::CalcJacobianTranslationalVelocity() for points Ac and Bc of
+// each contact pair, though much cheaper for many contact points (e.g. the
+// quadrature points of hydroelastic contact): the spatial velocity Jacobian of
+// each body in contact is computed only once and then shifted to each of its
+// contact points, operating only on the columns of the body's tree.
+//
+// @pre Each geometry in `contact_pairs` has an entry in
+// `geometry_id_to_body_index`.
+template <typename T>
+std::vector<std::vector<typename ContactPairKinematics<T>::JacobianTreeBlock>>
+CalcContactJacobianTreeBlocks(
+    const MultibodyTree<T>& tree, const systems::Context<T>& context,
+    const std::unordered_map<geometry::GeometryId, BodyIndex>&
+        geometry_id_to_body_index,
+    const std::vector<DiscreteContactPair<T>>& contact_pairs);
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "drake/common/parallel_for.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+/* Below this number of contact points, loops over the contact points of a
+ discrete contact problem run serially since the overhead of a parallel region
+ outweighs the work. */
+constexpr int kMinContactsForParallelism = 256;
+
+/* Returns true if a loop over the `num_contacts` contact points of a discrete
+ contact problem should run in parallel. See
+ drake::internal::ShouldParallelize(). */
+template <typename T>
+bool ParallelizeContactLoops(int num_contacts) {
+  return drake::internal::ShouldParallelize<T>(num_contacts,
+                                               kMinContactsForParallelism);
+}
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -1,5 +1,6 @@
 #include "drake/multibody/plant/contact_results.h"
 
+#include <memory>
 #include <utility>
 
 namespace drake {
@@ -26,27 +27,28 @@ ContactResults<T>& ContactResults<T>::operator=(
     hydroelastic_contact_info_ =
         std::vector<const HydroelasticContactInfo<T>*>();
   } else {
-    // If this currently holds pointers, we need to change the type.
-    if (hydroelastic_contact_vector_ownership_mode() == kAliasedPointers) {
-      hydroelastic_contact_info_ =
-          std::vector<std::unique_ptr<HydroelasticContactInfo<T>>>();
-    }
-
-    // Copy the HydroelasticContactInfo data.
-    std::vector<std::unique_ptr<HydroelasticContactInfo<T>>>&
-        hydroelastic_contact_vector =
-            hydroelastic_contact_vector_of_unique_ptrs();
-    hydroelastic_contact_vector.resize(
-        contact_results.num_hydroelastic_contacts());
-    for (int i = 0; i < contact_results.num_hydroelastic_contacts(); ++i) {
-      const HydroelasticContactInfo<T>& contact_info =
-          contact_results.hydroelastic_contact_info(i);
-      hydroelastic_contact_vector[i] =
-          std::make_unique<HydroelasticContactInfo<T>>(contact_info);
+    if (contact_results.hydroelastic_contact_vector_ownership_mode() ==
+        kOwnsCopies) {
+      // The HydroelasticContactInfo data is immutable and can be shared.
+      hydroelastic_contact_info_ = contact_results.hydroelastic_contact_info_;
+    } else {
+      // Copy the aliased HydroelasticContactInfo data.
+      const std::vector<const HydroelasticContactInfo<T>*>& aliased_contacts =
+          contact_results.hydroelastic_contact_vector_of_pointers();
+      std::vector<std::shared_ptr<const HydroelasticContactInfo<T>>>
+          hydroelastic_contact_vector;
+      hydroelastic_contact_vector.reserve(aliased_contacts.size());
+      for (const HydroelasticContactInfo<T>* contact_info : aliased_contacts) {
+        hydroelastic_contact_vector.push_back(
+            std::make_shared<const HydroelasticContactInfo<T>>(*contact_info));
+      }
+      hydroelastic_contact_info_ = std::move(hydroelastic_contact_vector);
     }
   }
 
   point_pairs_info_ = contact_results.point_pairs_info_;
+  hydroelastic_body_pair_forces_ =
+      contact_results.hydroelastic_body_pair_forces_;
   plant_ = contact_results.plant_;
 
   return *this;
@@ -69,8 +71,9 @@ void ContactResults<T>::Clear() {
   if (hydroelastic_contact_vector_ownership_mode() == kAliasedPointers) {
     hydroelastic_contact_vector_of_pointers().clear();
   } else {
-    hydroelastic_contact_vector_of_unique_ptrs().clear();
+    hydroelastic_contact_vector_of_shared_ptrs().clear();
   }
+  hydroelastic_body_pair_forces_.clear();
   plant_ = nullptr;
 }
 
@@ -88,10 +91,17 @@ ContactResults<T>::hydroelastic_contact_info(int i) const {
   if (hydroelastic_contact_vector_ownership_mode() == kAliasedPointers) {
     return *hydroelastic_contact_vector_of_pointers()[i];
   } else {
-    return *hydroelastic_contact_vector_of_unique_ptrs()[i];
+    return *hydroelastic_contact_vector_of_shared_ptrs()[i];
   }
 }
 
+template <typename T>
+const BodyPairSpatialForce<T>&
+ContactResults<T>::hydroelastic_body_pair_force(int i) const {
+  DRAKE_DEMAND(i >= 0 && i < num_hydroelastic_body_pair_forces());
+  return hydroelastic_body_pair_forces_[i];
+}
+
 template <typename T>
 void ContactResults<T>::AddContactInfo(
     const HydroelasticContactInfo<T>* hydroelastic_contact_info) {
@@ -107,7 +117,7 @@ int ContactResults<T>::num_hydroelastic_contacts() const {
     return static_cast<int>(hydroelastic_contact_vector_of_pointers().size());
   } else {
     return static_cast<int>(
-        hydroelastic_contact_vector_of_unique_ptrs().size());
+        hydroelastic_contact_vector_of_shared_ptrs().size());
   }
 }
 
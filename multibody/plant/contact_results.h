@@ -9,8 +9,10 @@
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
+#include "drake/multibody/math/spatial_algebra.h"
 #include "drake/multibody/plant/hydroelastic_contact_info.h"
 #include "drake/multibody/plant/point_pair_contact_info.h"
+#include "drake/multibody/tree/multibody_tree_indexes.h"
 
 namespace drake {
 namespace multibody {
@@ -19,11 +21,38 @@ namespace multibody {
 template <typename T> class MultibodyPlant;
 #endif
 
+/**
+ The net spatial force due to hydroelastic contact between two bodies A and B,
+ summed over all of the contact surfaces between them. MultibodyPlant reports
+ hydroelastic contact in this form, instead of with HydroelasticContactInfo,
+ when its ContactResultsReportingLevel is kNetForces.
+
+ @tparam_default_scalar
+ */
+template <typename T>
+struct BodyPairSpatialForce {
+  /** Index of body A, the body with the smaller index of the pair. */
+  BodyIndex bodyA_index;
+
+  /** Index of body B, the body with the larger index of the pair. */
+  BodyIndex bodyB_index;
+
+  /** Net spatial force on body A, applied at its origin Ao and expressed in the
+   world frame W. The force on body B is equal and opposite to this force once
+   shifted to the same point. */
+  SpatialForce<T> F_Ao_W;
+};
+
 /**
  A container class storing the contact results information for each contact
- pair for a given state of the simulation. Note that copying this data structure
- is expensive when `num_hydroelastic_contacts() > 0` because a deep copy is
- performed.
+ pair for a given state of the simulation. The level of detail of hydroelastic
+ contact information is set with
+ MultibodyPlant::set_contact_results_reporting_level().
+
+ Copying this data structure is cheap once it owns its data: copies share
+ ownership of the (immutable) HydroelasticContactInfo. The first copy of the
+ results computed by MultibodyPlant, however, which alias data owned by the
+ plant's cache, makes a deep copy when `num_hydroelastic_contacts() > 0`.
 
  @tparam_default_scalar
  */
@@ -54,6 +83,17 @@ class ContactResults {
    method aborts. */
   const HydroelasticContactInfo<T>& hydroelastic_contact_info(int i) const;
 
+  /** Returns the number of body pairs with hydroelastic contact reported as a
+   net spatial force, see BodyPairSpatialForce. */
+  int num_hydroelastic_body_pair_forces() const {
+    return static_cast<int>(hydroelastic_body_pair_forces_.size());
+  }
+
+  /** Retrieves the ith BodyPairSpatialForce instance. The input index i must be
+   in the range [0, `num_hydroelastic_body_pair_forces()` - 1] or this method
+   aborts. */
+  const BodyPairSpatialForce<T>& hydroelastic_body_pair_force(int i) const;
+
   /** Returns the plant that produced these contact results. In most cases the
   result will be non-null, but default-constructed results might have nulls. */
   const MultibodyPlant<T>* plant() const;
@@ -78,6 +118,11 @@ class ContactResults {
    pointer must remain valid for the lifetime of this object. */
   void AddContactInfo(
       const HydroelasticContactInfo<T>* hydroelastic_contact_info);
+
+  /* Add the net hydroelastic spatial force between a pair of bodies. */
+  void AddContactInfo(const BodyPairSpatialForce<T>& body_pair_force) {
+    hydroelastic_body_pair_forces_.push_back(body_pair_force);
+  }
   #endif
 
  private:
@@ -103,36 +148,41 @@ class ContactResults {
         hydroelastic_contact_info_);
   }
 
-  const std::vector<std::unique_ptr<HydroelasticContactInfo<T>>>&
-  hydroelastic_contact_vector_of_unique_ptrs() const {
-    return std::get<std::vector<std::unique_ptr<HydroelasticContactInfo<T>>>>(
+  const std::vector<std::shared_ptr<const HydroelasticContactInfo<T>>>&
+  hydroelastic_contact_vector_of_shared_ptrs() const {
+    return std::get<
+        std::vector<std::shared_ptr<const HydroelasticContactInfo<T>>>>(
         hydroelastic_contact_info_);
   }
 
-  std::vector<std::unique_ptr<HydroelasticContactInfo<T>>>&
-  hydroelastic_contact_vector_of_unique_ptrs() {
-    return std::get<std::vector<std::unique_ptr<HydroelasticContactInfo<T>>>>(
+  std::vector<std::shared_ptr<const HydroelasticContactInfo<T>>>&
+  hydroelastic_contact_vector_of_shared_ptrs() {
+    return std::get<
+        std::vector<std::shared_ptr<const HydroelasticContactInfo<T>>>>(
         hydroelastic_contact_info_);
   }
 
   std::vector<PointPairContactInfo<T>> point_pairs_info_;
 
+  std::vector<BodyPairSpatialForce<T>> hydroelastic_body_pair_forces_;
+
   /* We use a variant type to keep from copying already owned data (from a
    cache), i.e., the HydroelasticContactInfo, into this data structure, if
    possible. By default, the variant stores the first type, i.e.,
    std::vector<const HydroelasticContactInfo<T>*>. If this data structure is
    copied, however, the variant changes to instead store the second type, a
-   vector of unique pointers. In that case, all of the underlying
+   vector of shared pointers. In that case, all of the underlying
    HydroelasticContactInfo objects are copied and
    AddContactInfo(const HydroelasticContactInfo*) can no longer be called on the
-   copy (see assertion in AddContactInfo).
+   copy (see assertion in AddContactInfo). Copies of a copy share the same
+   HydroelasticContactInfo objects, which are never modified.
 
    Note that we jump through these hoops because storing ContactResults into
    a cache entry requires that it be placed into a Value<ContactResults>, which
    in turn requires that ContactResults be copyable.
    */
   std::variant<std::vector<const HydroelasticContactInfo<T>*>,
-               std::vector<std::unique_ptr<HydroelasticContactInfo<T>>>>
+               std::vector<std::shared_ptr<const HydroelasticContactInfo<T>>>>
       hydroelastic_contact_info_;
 
   const MultibodyPlant<T>* plant_{nullptr};
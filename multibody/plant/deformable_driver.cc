@@ -213,7 +213,8 @@ void DeformableDriver<T>::CalcFreeMotionFemState(
   const FemModel<T>& model = deformable_model_->GetFemModel(id);
   // TODO(xuchenhan-tri): We should expose an API to set the solver tolerance
   // here.
-  const FemSolver<T> solver(&model, integrator_.get());
+  FemSolver<T> solver(&model, integrator_.get());
+  solver.set_linear_solver_type(deformable_model_->linear_solver_type());
   FemSolverScratchData<T>& scratch =
       manager_->plant()
           .get_cache_entry(cache_indexes_.fem_solver_scratches.at(index))
@@ -1,7 +1,10 @@
 #include "drake/multibody/plant/deformable_model.h"
 
+#include <stdexcept>
 #include <utility>
 
+#include <fmt/format.h>
+
 #include "drake/geometry/proximity/volume_mesh.h"
 #include "drake/multibody/fem/corotated_model.h"
 #include "drake/multibody/fem/fem_state.h"
@@ -60,6 +63,27 @@ DeformableBodyId DeformableModel<T>::RegisterDeformableBody(
   return body_id;
 }
 
+template <typename T>
+void DeformableModel<T>::SetLinearSolver(std::string_view linear_solver) {
+  this->ThrowIfSystemResourcesDeclared(__func__);
+  const std::pair<LinearSolverType, const char*> kLinearSolvers[] = {
+      {LinearSolverType::kPetscConjugateGradient, "petsc_conjugate_gradient"},
+      {LinearSolverType::kBlockSparseConjugateGradient,
+       "block_sparse_conjugate_gradient"},
+      {LinearSolverType::kBlockSparseConjugateGradientBlockJacobi,
+       "block_sparse_conjugate_gradient_block_jacobi"},
+      {LinearSolverType::kBlockSparseCholesky, "block_sparse_cholesky"},
+  };
+  for (const auto& [value, name] : kLinearSolvers) {
+    if (name == linear_solver) {
+      linear_solver_type_ = value;
+      return;
+    }
+  }
+  throw std::logic_error(
+      fmt::format("Unknown linear_solver: '{}'", linear_solver));
+}
+
 template <typename T>
 systems::DiscreteStateIndex DeformableModel<T>::GetDiscreteStateIndex(
     DeformableBodyId id) const {
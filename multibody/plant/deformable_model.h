@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -9,6 +10,7 @@
 #include "drake/common/identifier.h"
 #include "drake/multibody/fem/deformable_body_config.h"
 #include "drake/multibody/fem/fem_model.h"
+#include "drake/multibody/fem/fem_solver.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/multibody/plant/physical_model.h"
 
@@ -34,6 +36,9 @@ class DeformableModel final : public multibody::internal::PhysicalModel<T> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DeformableModel)
 
+  using LinearSolverType =
+      typename fem::internal::FemSolver<T>::LinearSolverType;
+
   /* Construct a DeformableModel to be owned by the given MultibodyPlant.
    @pre plant != nullptr.
    @pre Finalize() has not been called on `plant`. */
@@ -107,6 +112,21 @@ class DeformableModel final : public multibody::internal::PhysicalModel<T> {
    @throws std::exception if no body with the given `id` has been registered. */
   geometry::GeometryId GetGeometryId(DeformableBodyId id) const;
 
+  /* Sets, by name, the linear solver that the FEM solvers of all deformable
+   bodies use for their Newton steps. Valid names are:
+   - "petsc_conjugate_gradient" (the default)
+   - "block_sparse_conjugate_gradient"
+   - "block_sparse_conjugate_gradient_block_jacobi"
+   - "block_sparse_cholesky"
+   Refer to fem::internal::FemSolver::LinearSolverType for details.
+   @throws std::exception if `linear_solver` is not a valid name.
+   @throws std::exception if Finalize() has been called on the multibody plant
+   owning this deformable model. */
+  void SetLinearSolver(std::string_view linear_solver);
+
+  /* Returns the linear solver set with SetLinearSolver(). */
+  LinearSolverType linear_solver_type() const { return linear_solver_type_; }
+
   /* Returns the output port of the vertex positions for all registered
    deformable bodies.
    @throws std::exception if MultibodyPlant::Finalize() has not been called yet.
@@ -163,6 +183,8 @@ class DeformableModel final : public multibody::internal::PhysicalModel<T> {
   std::unordered_map<DeformableBodyId, std::unique_ptr<fem::FemModel<T>>>
       fem_models_;
   std::vector<DeformableBodyId> body_ids_;
+  LinearSolverType linear_solver_type_{
+      LinearSolverType::kPetscConjugateGradient};
   systems::OutputPortIndex vertex_positions_port_index_;
 };
 
@@ -87,10 +87,24 @@ class HydroelasticContactInfo {
       std::unique_ptr<geometry::ContactSurface<T>> contact_surface,
       const SpatialForce<T>& F_Ac_W,
       std::vector<HydroelasticQuadraturePointData<T>>&& quadrature_point_data)
+      : HydroelasticContactInfo(
+            std::shared_ptr<const geometry::ContactSurface<T>>(
+                std::move(contact_surface)),
+            F_Ac_W, std::move(quadrature_point_data)) {}
+
+  /** This constructor shares ownership of `contact_surface` with other owners,
+   e.g. other copies of the same %HydroelasticContactInfo, see
+   HydroelasticContactInfo(const HydroelasticContactInfo&). In all other
+   respects, it is identical to the @ref hydro_contact_info_non_owning_ctor
+   "other overload" that takes `contact_surface` by raw pointer.  */
+  HydroelasticContactInfo(
+      std::shared_ptr<const geometry::ContactSurface<T>> contact_surface,
+      const SpatialForce<T>& F_Ac_W,
+      std::vector<HydroelasticQuadraturePointData<T>>&& quadrature_point_data)
       : contact_surface_(std::move(contact_surface)),
         F_Ac_W_(F_Ac_W),
         quadrature_point_data_(std::move(quadrature_point_data)) {
-    DRAKE_DEMAND(std::get<std::unique_ptr<geometry::ContactSurface<T>>>(
+    DRAKE_DEMAND(std::get<std::shared_ptr<const geometry::ContactSurface<T>>>(
                      contact_surface_) != nullptr);
   }
   // @}
@@ -99,21 +113,29 @@ class HydroelasticContactInfo {
   /// MoveAssignable.
   //@{
 
-  /** Clones this data structure, making deep copies of all underlying data.
-   @note The new object will contain a cloned ContactSurface even if the
-         original was constructed using a raw pointer referencing an existing
-         ContactSurface.
+  /** Copies this data structure. Contact surfaces are immutable, and therefore
+   the new object shares ownership of the ContactSurface of `info` when `info`
+   owns it. Otherwise, when `info` was constructed using a raw pointer
+   referencing an existing ContactSurface, the new object contains a clone of
+   that ContactSurface so that it does not depend on its lifetime. All other
+   data is deep copied.
    */
   HydroelasticContactInfo(const HydroelasticContactInfo& info) {
     *this = info;
   }
 
-  /** Clones this object in the same manner as the copy constructor.
+  /** Copies this object in the same manner as the copy constructor.
    @see HydroelasticContactInfo(const HydroelasticContactInfo&)
    */
   HydroelasticContactInfo& operator=(const HydroelasticContactInfo& info) {
-    contact_surface_ =
-        std::make_unique<geometry::ContactSurface<T>>(info.contact_surface());
+    if (this == &info) return *this;
+    if (std::holds_alternative<const geometry::ContactSurface<T>*>(
+            info.contact_surface_)) {
+      contact_surface_ = std::make_shared<const geometry::ContactSurface<T>>(
+          info.contact_surface());
+    } else {
+      contact_surface_ = info.contact_surface_;
+    }
     F_Ac_W_ = info.F_Ac_W_;
     quadrature_point_data_ = info.quadrature_point_data_;
     return *this;
@@ -131,8 +153,8 @@ class HydroelasticContactInfo {
             contact_surface_)) {
       return *std::get<const geometry::ContactSurface<T>*>(contact_surface_);
     } else {
-      return *std::get<std::unique_ptr<geometry::ContactSurface<T>>>
-                  (contact_surface_);
+      return *std::get<std::shared_ptr<const geometry::ContactSurface<T>>>(
+          contact_surface_);
     }
   }
 
@@ -152,7 +174,8 @@ class HydroelasticContactInfo {
  private:
   // Note that the mesh of the contact surface is defined in the world frame.
   std::variant<const geometry::ContactSurface<T>*,
-                 std::unique_ptr<geometry::ContactSurface<T>>> contact_surface_;
+               std::shared_ptr<const geometry::ContactSurface<T>>>
+      contact_surface_;
 
   // The spatial force applied at the centroid (Point C) of the surface mesh.
   SpatialForce<T> F_Ac_W_;
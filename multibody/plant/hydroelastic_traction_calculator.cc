@@ -27,7 +27,6 @@ void HydroelasticTractionCalculator<T>::
         std::vector<HydroelasticQuadraturePointData<T>>*
             traction_at_quadrature_points,
         SpatialForce<T>* F_Ac_W) const {
-  DRAKE_DEMAND(traction_at_quadrature_points != nullptr);
   DRAKE_DEMAND(F_Ac_W != nullptr);
 
   // Use a second-order Gaussian quadrature rule. For linear pressure fields,
@@ -46,8 +45,10 @@ void HydroelasticTractionCalculator<T>::
 
   // Reserve enough memory to keep from doing repeated heap allocations in the
   // quadrature process.
-  traction_at_quadrature_points->clear();
-  traction_at_quadrature_points->reserve(data.surface.num_faces());
+  if (traction_at_quadrature_points != nullptr) {
+    traction_at_quadrature_points->clear();
+    traction_at_quadrature_points->reserve(data.surface.num_faces());
+  }
 
   // Integrate the tractions over all triangles in the contact surface.
   for (int i = 0; i < data.surface.num_faces(); ++i) {
@@ -58,12 +59,17 @@ void HydroelasticTractionCalculator<T>::
       std::function<SpatialForce<T>(const Vector3<T>&)> traction_Ac_W =
           [this, &data, i, dissipation, mu_coulomb,
            traction_at_quadrature_points](const Vector3<T>& Q_barycentric) {
-            traction_at_quadrature_points->emplace_back(CalcTractionAtPoint(
-                data, i, Q_barycentric, dissipation, mu_coulomb));
-            const HydroelasticQuadraturePointData<T>& traction_output =
-                traction_at_quadrature_points->back();
-            return ComputeSpatialTractionAtAcFromTractionAtAq(
-                data, traction_output.p_WQ, traction_output.traction_Aq_W);
+            HydroelasticQuadraturePointData<T> traction_output =
+                CalcTractionAtPoint(data, i, Q_barycentric, dissipation,
+                                    mu_coulomb);
+            const SpatialForce<T> Ft_Ac_W =
+                ComputeSpatialTractionAtAcFromTractionAtAq(
+                    data, traction_output.p_WQ, traction_output.traction_Aq_W);
+            if (traction_at_quadrature_points != nullptr) {
+              traction_at_quadrature_points->push_back(
+                  std::move(traction_output));
+            }
+            return Ft_Ac_W;
           };
 
       // Compute the integral over the triangle to get a force from the
@@ -74,14 +80,15 @@ void HydroelasticTractionCalculator<T>::
       // Update the spatial force at the centroid.
       (*F_Ac_W) += Fi_Ac_W;
     } else {
-      traction_at_quadrature_points->emplace_back(
-          CalcTractionAtCentroid(data, i, dissipation, mu_coulomb));
-      const HydroelasticQuadraturePointData<T>& traction_output =
-          traction_at_quadrature_points->back();
+      HydroelasticQuadraturePointData<T> traction_output =
+          CalcTractionAtCentroid(data, i, dissipation, mu_coulomb);
       const SpatialForce<T> traction_Ac_W =
           ComputeSpatialTractionAtAcFromTractionAtAq(
               data, traction_output.p_WQ, traction_output.traction_Aq_W);
       (*F_Ac_W) += data.surface.area(i) * traction_Ac_W;
+      if (traction_at_quadrature_points != nullptr) {
+        traction_at_quadrature_points->push_back(std::move(traction_output));
+      }
     }
   }
 }
@@ -98,7 +98,9 @@ class HydroelasticTractionCalculator {
           energy along the direction of the surface normals.
    @param mu_coulomb the nonnegative coefficient for Coulomb friction.
    @param[out] quadrature_point_data the intermediate data computed by the
-               quadrature process. This vector is cleared on entry.
+               quadrature process. This vector is cleared on entry. It may be
+               null, in which case the intermediate data is discarded (which
+               saves its allocation when it won't be reported).
    @param[out] F_Ac_W the spatial force computed by the hydroelastic model that
                acts on the body attached to geometry M (which is affixed to Body
                A) in `data`'s ContactSurface. This spatial force is applied at
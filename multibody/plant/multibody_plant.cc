@@ -3,9 +3,13 @@
 #include <algorithm>
 #include <functional>
 #include <limits>
+#include <map>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "drake/common/drake_throw.h"
@@ -22,6 +26,7 @@
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/contact_solvers/sparse_linear_operator.h"
 #include "drake/multibody/hydroelastics/hydroelastic_engine.h"
+#include "drake/multibody/plant/contact_jacobian_blocks.h"
 #include "drake/multibody/plant/discrete_contact_pair.h"
 #include "drake/multibody/plant/externally_applied_spatial_force.h"
 #include "drake/multibody/plant/hydroelastic_traction_calculator.h"
@@ -367,6 +372,12 @@ MultibodyPlant<T>::MultibodyPlant(double time_step)
                "hydroelastic_with_fallback");
   DRAKE_DEMAND(contact_solver_enum_ == DiscreteContactSolver::kTamsi);
   DRAKE_DEMAND(MultibodyPlantConfig{}.discrete_contact_solver == "tamsi");
+  DRAKE_DEMAND(contact_results_reporting_level_ ==
+               ContactResultsReportingLevel::kFull);
+  DRAKE_DEMAND(MultibodyPlantConfig{}.contact_results_reporting_level ==
+               "full");
+  DRAKE_DEMAND(use_block_sparse_tamsi_ ==
+               MultibodyPlantConfig{}.use_block_sparse_tamsi);
 }
 
 template <typename T>
@@ -433,6 +444,8 @@ MultibodyPlant<T>::MultibodyPlant(const MultibodyPlant<U>& other)
     contact_model_ = other.contact_model_;
     contact_solver_enum_ = other.contact_solver_enum_;
     contact_surface_representation_ = other.contact_surface_representation_;
+    contact_results_reporting_level_ = other.contact_results_reporting_level_;
+    use_block_sparse_tamsi_ = other.use_block_sparse_tamsi_;
     // geometry_query_port_ is set during DeclareSceneGraphPorts() below.
     // geometry_pose_port_ is set during DeclareSceneGraphPorts() below.
     // scene_graph_ is set to nullptr in FinalizePlantOnly() below.
@@ -622,6 +635,31 @@ DiscreteContactSolver MultibodyPlant<T>::get_discrete_contact_solver()
   return contact_solver_enum_;
 }
 
+template <typename T>
+void MultibodyPlant<T>::set_contact_results_reporting_level(
+    ContactResultsReportingLevel level) {
+  DRAKE_MBP_THROW_IF_FINALIZED();
+  contact_results_reporting_level_ = level;
+}
+
+template <typename T>
+ContactResultsReportingLevel
+MultibodyPlant<T>::get_contact_results_reporting_level() const {
+  return contact_results_reporting_level_;
+}
+
+template <typename T>
+void MultibodyPlant<T>::set_use_block_sparse_tamsi(
+    bool use_block_sparse_tamsi) {
+  DRAKE_MBP_THROW_IF_FINALIZED();
+  use_block_sparse_tamsi_ = use_block_sparse_tamsi;
+}
+
+template <typename T>
+bool MultibodyPlant<T>::get_use_block_sparse_tamsi() const {
+  return use_block_sparse_tamsi_;
+}
+
 template <typename T>
 ContactModel MultibodyPlant<T>::get_contact_model() const {
   return contact_model_;
@@ -1170,6 +1208,10 @@ const CoulombFriction<double>& MultibodyPlant<T>::GetCoulombFriction(
 template <typename T>
 void MultibodyPlant<T>::ApplyDefaultCollisionFilters() {
   DRAKE_DEMAND(geometry_source_is_registered());
+  // All of the default filters are collected into a single declaration and
+  // applied at once; applying one declaration per joint dominated Finalize()
+  // for scenes with thousands of bodies.
+  CollisionFilterDeclaration filters;
   // Disallow collisions between adjacent bodies. Adjacency is implied by the
   // existence of a joint between bodies.
   for (JointIndex j{0}; j < num_joints(); ++j) {
@@ -1181,10 +1223,8 @@ void MultibodyPlant<T>::ApplyDefaultCollisionFilters() {
     std::optional<FrameId> parent_id = GetBodyFrameIdIfExists(parent.index());
 
     if (child_id && parent_id) {
-      scene_graph_->collision_filter_manager().Apply(
-        CollisionFilterDeclaration().ExcludeBetween(
-          geometry::GeometrySet(*child_id),
-          geometry::GeometrySet(*parent_id)));
+      filters.ExcludeBetween(geometry::GeometrySet(*child_id),
+                             geometry::GeometrySet(*parent_id));
     }
   }
   // We explicitly exclude collisions within welded subgraphs.
@@ -1198,10 +1238,9 @@ void MultibodyPlant<T>::ApplyDefaultCollisionFilters() {
     for (BodyIndex body_index : subgraph) {
       subgraph_bodies.push_back(&get_body(body_index));
     }
-    auto geometries = CollectRegisteredGeometries(subgraph_bodies);
-    scene_graph_->collision_filter_manager().Apply(
-        CollisionFilterDeclaration().ExcludeWithin(geometries));
+    filters.ExcludeWithin(CollectRegisteredGeometries(subgraph_bodies));
   }
+  scene_graph_->collision_filter_manager().Apply(filters);
 }
 
 template <typename T>
@@ -1269,61 +1308,28 @@ void MultibodyPlant<T>::CalcNormalAndTangentContactJacobians(
   // sized.
   if (num_contacts == 0) return;
 
-  const Frame<T>& frame_W = world_frame();
+  // For each contact pair, the Jacobian J_AcBc_W of the velocity of Bc (point
+  // of body B coincident with the contact point C) relative to Ac (point of
+  // body A coincident with C), such that v_AcBc_W = v_WBc - v_WAc =
+  // J_AcBc_W⋅v. It is computed for all contact points at once and stored as
+  // blocks for the (at most two) trees of bodies A and B. The columns for all
+  // other trees are zero.
+  using JacobianTreeBlock =
+      typename internal::ContactPairKinematics<T>::JacobianTreeBlock;
+  const std::vector<std::vector<JacobianTreeBlock>> jacobian_blocks =
+      internal::CalcContactJacobianTreeBlocks(
+          internal_tree(), context, geometry_id_to_body_index_, contact_pairs);
+  const internal::MultibodyTreeTopology& topology =
+      internal_tree().get_topology();
+
+  Jn.setZero();
+  Jt.setZero();
   for (int icontact = 0; icontact < num_contacts; ++icontact) {
     const auto& point_pair = contact_pairs[icontact];
 
-    const GeometryId geometryA_id = point_pair.id_A;
-    const GeometryId geometryB_id = point_pair.id_B;
-
-    const BodyIndex bodyA_index = FindBodyByGeometryId(geometryA_id);
-    const BodyIndex bodyB_index = FindBodyByGeometryId(geometryB_id);
-    const Body<T>& bodyA = get_body(bodyA_index);
-    const Body<T>& bodyB = get_body(bodyB_index);
-
     // Penetration depth > 0 if bodies interpenetrate.
     const Vector3<T>& nhat_BA_W = point_pair.nhat_BA_W;
-    const Vector3<T>& p_WC = point_pair.p_WC;
-
-    // For point Ac (origin of frame A shifted to C), calculate Jv_v_WAc (Ac's
-    // translational velocity Jacobian in the world frame W with respect to
-    // generalized velocities v).  Note: Ac's translational velocity in W can
-    // be written in terms of this Jacobian as v_WAc = Jv_v_WAc * v.
-    Matrix3X<T> Jv_WAc(3, this->num_velocities());
-    internal_tree().CalcJacobianTranslationalVelocity(context,
-                                                      JacobianWrtVariable::kV,
-                                                      bodyA.body_frame(),
-                                                      frame_W,
-                                                      p_WC,
-                                                      frame_W,
-                                                      frame_W,
-                                                      &Jv_WAc);
-
-    // Similarly, for point Bc (origin of frame B shifted to C), calculate
-    // Jv_v_WBc (Bc's translational velocity Jacobian in W with respect to v).
-    Matrix3X<T> Jv_WBc(3, this->num_velocities());
-    internal_tree().CalcJacobianTranslationalVelocity(context,
-                                                      JacobianWrtVariable::kV,
-                                                      bodyB.body_frame(),
-                                                      frame_W,
-                                                      p_WC,
-                                                      frame_W,
-                                                      frame_W,
-                                                      &Jv_WBc);
-
-    // Computation of the normal separation velocities Jacobian Jn:
-    //
-    // The velocity of Bc relative to Ac is
-    //   v_AcBc_W = v_WBc - v_WAc.
-    // From where the separation velocity is computed as
-    //   vn = -v_AcBc_W.dot(nhat_BA_W) = -nhat_BA_Wᵀ⋅v_AcBc_W
-    // where the negative sign stems from the sign convention for vn and xdot.
-    // This can be written in terms of the Jacobians as
-    //   vn = -nhat_BA_Wᵀ⋅(Jv_WBc - Jv_WAc)⋅v
-    Jn.row(icontact) = nhat_BA_W.transpose() * (Jv_WAc - Jv_WBc);
-
-    // Computation of the tangential velocities Jacobian Jt:
-    //
+
     // Compute the orientation of a contact frame C at the contact point such
     // that the z-axis Cz equals to nhat_BA_W. The tangent vectors are
     // arbitrary, with the only requirement being that they form a valid right
@@ -1337,14 +1343,29 @@ void MultibodyPlant<T>::CalcNormalAndTangentContactJacobians(
     const Vector3<T> that1_W = R_WC.matrix().col(0);  // that1 = Cx.
     const Vector3<T> that2_W = R_WC.matrix().col(1);  // that2 = Cy.
 
-    // The velocity of Bc relative to Ac is
-    //   v_AcBc_W = v_WBc - v_WAc.
-    // The first two components of this velocity in C corresponds to the
-    // tangential velocities in a plane normal to nhat_BA.
-    //   vx_AcBc_C = that1⋅v_AcBc = that1ᵀ⋅(Jv_WBc - Jv_WAc)⋅v
-    //   vy_AcBc_C = that2⋅v_AcBc = that2ᵀ⋅(Jv_WBc - Jv_WAc)⋅v
-    Jt.row(2 * icontact)     = that1_W.transpose() * (Jv_WBc - Jv_WAc);
-    Jt.row(2 * icontact + 1) = that2_W.transpose() * (Jv_WBc - Jv_WAc);
+    for (const auto& block : jacobian_blocks[icontact]) {
+      const int start = topology.tree_velocities_start(block.tree);
+      const int nt = topology.num_tree_velocities(block.tree);
+
+      // Computation of the normal separation velocities Jacobian Jn:
+      //
+      // The separation velocity is computed as
+      //   vn = -v_AcBc_W.dot(nhat_BA_W) = -nhat_BA_Wᵀ⋅v_AcBc_W
+      // where the negative sign stems from the sign convention for vn and
+      // xdot. This can be written in terms of the Jacobians as
+      //   vn = -nhat_BA_Wᵀ⋅J_AcBc_W⋅v
+      Jn.row(icontact).segment(start, nt) = -nhat_BA_W.transpose() * block.J;
+
+      // Computation of the tangential velocities Jacobian Jt:
+      //
+      // The first two components of v_AcBc in C corresponds to the tangential
+      // velocities in a plane normal to nhat_BA.
+      //   vx_AcBc_C = that1⋅v_AcBc = that1ᵀ⋅J_AcBc_W⋅v
+      //   vy_AcBc_C = that2⋅v_AcBc = that2ᵀ⋅J_AcBc_W⋅v
+      Jt.row(2 * icontact).segment(start, nt) = that1_W.transpose() * block.J;
+      Jt.row(2 * icontact + 1).segment(start, nt) =
+          that2_W.transpose() * block.J;
+    }
   }
 }
 
@@ -1668,11 +1689,51 @@ void MultibodyPlant<T>::AppendContactResultsContinuousHydroelastic(
   const internal::HydroelasticContactInfoAndBodySpatialForces<T>&
       contact_info_and_spatial_body_forces =
           EvalHydroelasticContactForces(context);
+
+  if (contact_results_reporting_level_ !=
+      ContactResultsReportingLevel::kNetForces) {
+    // N.B. The quadrature point data is only stored at the kFull level, see
+    // CalcHydroelasticContactForces().
+    for (const HydroelasticContactInfo<T>& contact_info :
+         contact_info_and_spatial_body_forces.contact_info) {
+      // Note: caching dependencies guarantee that the lifetime of contact_info
+      // is valid for the lifetime of the contact results.
+      contact_results->AddContactInfo(&contact_info);
+    }
+    return;
+  }
+
+  // Accumulate the net spatial force on the body with the smaller index of
+  // each pair, at its origin. Body pairs are reported in order of first
+  // appearance.
+  std::map<std::pair<BodyIndex, BodyIndex>, int> body_pair_to_index;
+  std::vector<BodyPairSpatialForce<T>> body_pair_forces;
   for (const HydroelasticContactInfo<T>& contact_info :
        contact_info_and_spatial_body_forces.contact_info) {
-    // Note: caching dependencies guarantee that the lifetime of contact_info is
-    // valid for the lifetime of the contact results.
-    contact_results->AddContactInfo(&contact_info);
+    const ContactSurface<T>& surface = contact_info.contact_surface();
+    BodyIndex bodyA_index = FindBodyByGeometryId(surface.id_M());
+    BodyIndex bodyB_index = FindBodyByGeometryId(surface.id_N());
+    // Spatial force on body A at the centroid C.
+    SpatialForce<T> F_Ac_W = contact_info.F_Ac_W();
+    if (bodyB_index < bodyA_index) {
+      std::swap(bodyA_index, bodyB_index);
+      F_Ac_W = -F_Ac_W;
+    }
+    const Vector3<T>& p_WAo =
+        EvalBodyPoseInWorld(context, get_body(bodyA_index)).translation();
+    const Vector3<T> p_CAo_W = p_WAo - surface.centroid();
+    const SpatialForce<T> F_Ao_W = F_Ac_W.Shift(p_CAo_W);
+
+    const auto [it, inserted] = body_pair_to_index.emplace(
+        std::pair(bodyA_index, bodyB_index), body_pair_forces.size());
+    if (inserted) {
+      body_pair_forces.push_back({bodyA_index, bodyB_index, F_Ao_W});
+    } else {
+      body_pair_forces[it->second].F_Ao_W += F_Ao_W;
+    }
+  }
+  for (const BodyPairSpatialForce<T>& body_pair_force : body_pair_forces) {
+    contact_results->AddContactInfo(body_pair_force);
   }
 }
 
@@ -2054,10 +2115,15 @@ void MultibodyPlant<T>::CalcHydroelasticContactForces(
         geometryM_id, geometryN_id, inspector);
 
     // Integrate the hydroelastic traction field over the contact surface.
+    // Quadrature point data is only collected when it is reported.
     std::vector<HydroelasticQuadraturePointData<T>> traction_output;
     SpatialForce<T> F_Ac_W;
     traction_calculator.ComputeSpatialForcesAtCentroidFromHydroelasticModel(
-        data, dissipation, dynamic_friction, &traction_output, &F_Ac_W);
+        data, dissipation, dynamic_friction,
+        contact_results_reporting_level_ == ContactResultsReportingLevel::kFull
+            ? &traction_output
+            : nullptr,
+        &F_Ac_W);
 
     // Shift the traction at the centroid to tractions at the body origins.
     SpatialForce<T> F_Ao_W, F_Bo_W;
@@ -2289,6 +2355,8 @@ TamsiSolverResult MultibodyPlant<T>::SolveUsingSubStepping(
     TamsiSolver<T>* tamsi_solver,
     int num_substeps,
     const MatrixX<T>& M0, const MatrixX<T>& Jn, const MatrixX<T>& Jt,
+    const std::vector<MatrixX<T>>* M0_blocks,
+    const internal::TamsiBlockSparseJacobians<T>* tamsi_jacobians,
     const VectorX<T>& minus_tau,
     const VectorX<T>& stiffness, const VectorX<T>& damping,
     const VectorX<T>& mu,
@@ -2307,13 +2375,31 @@ TamsiSolverResult MultibodyPlant<T>::SolveUsingSubStepping(
     // Discrete update before applying friction forces.
     // We denote this state x* = [q*, v*], the "star" state.
     // Generalized momentum "star", before contact forces are applied.
-    VectorX<T> p_star_substep = M0 * v0_substep - dt_substep * minus_tau;
+    VectorX<T> p_star_substep(v0_substep.size());
+    if (tamsi_jacobians != nullptr) {
+      // M0 is block diagonal, with one block per tree.
+      for (int t = 0; t < tamsi_jacobians->num_trees(); ++t) {
+        const int start = tamsi_jacobians->tree_start(t);
+        const int size = tamsi_jacobians->tree_size(t);
+        p_star_substep.segment(start, size) =
+            (*M0_blocks)[t] * v0_substep.segment(start, size) -
+            dt_substep * minus_tau.segment(start, size);
+      }
+    } else {
+      p_star_substep = M0 * v0_substep - dt_substep * minus_tau;
+    }
 
     // Update the data.
-    tamsi_solver->SetTwoWayCoupledProblemData(
-        &M0, &Jn, &Jt,
-        &p_star_substep, &fn0_substep,
-        &stiffness, &damping, &mu);
+    if (tamsi_jacobians != nullptr) {
+      internal::TamsiSolverBlockSparseAttorney<T>::SetTwoWayCoupledProblemData(
+          tamsi_solver, M0_blocks, tamsi_jacobians, &p_star_substep,
+          &fn0_substep, &stiffness, &damping, &mu);
+    } else {
+      tamsi_solver->SetTwoWayCoupledProblemData(
+          &M0, &Jn, &Jt,
+          &p_star_substep, &fn0_substep,
+          &stiffness, &damping, &mu);
+    }
 
     info = tamsi_solver->SolveWithGuess(dt_substep, v0_substep);
 
@@ -2648,10 +2734,6 @@ void MultibodyPlant<T>::CalcContactSolverResults(
       EvalDiscreteContactPairs(context0);
   const int num_contacts = contact_pairs.size();
 
-  // Compute normal and tangential velocity Jacobians at t0.
-  const internal::ContactJacobians<T>& contact_jacobians =
-      EvalContactJacobians(context0);
-
   // Get friction coefficient into a single vector. Static friction is ignored
   // by the time stepping scheme.
   std::vector<CoulombFriction<double>> combined_friction_pairs =
@@ -2686,23 +2768,27 @@ void MultibodyPlant<T>::CalcContactSolverResults(
     results->ft.setZero();
     results->vn.setZero();
     results->vt.setZero();
-    results->tau_contact = contact_jacobians.Jn.transpose() * results->fn;
+    results->tau_contact =
+        EvalContactJacobians(context0).Jn.transpose() * results->fn;
     return;
   }
 
   // Joint locking: reduce solver inputs.
   MatrixX<T> M0_unlocked = SelectRowsCols(M0, indices);
   VectorX<T> minus_tau_unlocked = SelectRows(minus_tau, indices);
-  MatrixX<T> Jn_unlocked = SelectCols(contact_jacobians.Jn, indices);
-  MatrixX<T> Jt_unlocked = SelectCols(contact_jacobians.Jt, indices);
-  MatrixX<T> Jc_unlocked = SelectCols(contact_jacobians.Jc, indices);
-
   VectorX<T> v0_unlocked = SelectRows(v0, indices);
 
   contact_solvers::internal::ContactSolverResults<T> results_unlocked;
   results_unlocked.Resize(indices.size(), num_contacts);
 
+  // The contact Jacobians for all velocities, stored per tree. Only computed
+  // for the block-sparse TAMSI path below.
+  std::unique_ptr<internal::TamsiBlockSparseJacobians<T>> full_jacobians;
+
   if (contact_solver_ != nullptr) {
+    const internal::ContactJacobians<T>& contact_jacobians =
+        EvalContactJacobians(context0);
+    const MatrixX<T> Jc_unlocked = SelectCols(contact_jacobians.Jc, indices);
     CallContactSolver(contact_solver_.get(), context0.get_time(), v0_unlocked,
                       M0_unlocked, minus_tau_unlocked, phi0, Jc_unlocked,
                       stiffness, damping, mu, &results_unlocked);
@@ -2726,17 +2812,58 @@ void MultibodyPlant<T>::CalcContactSolverResults(
     // workspace if needed.
     tamsi_solver.ResizeIfNeeded(indices.size());
 
-    CallTamsiSolver(&tamsi_solver, context0.get_time(), v0_unlocked,
-                    M0_unlocked, minus_tau_unlocked, fn0, Jn_unlocked,
-                    Jt_unlocked, stiffness, damping, mu, &results_unlocked);
+    // If requested, and for T = double only, TAMSI is given block-sparse
+    // problem data, so that the cost of its Newton-Raphson iterations scales
+    // with the number of contact points and trees in contact rather than with
+    // nv², and so that the symbolic analysis of its sparse linear solver is
+    // reused across time steps while the pairs of trees in contact don't
+    // change. The contact Jacobians are computed per tree and the dense Jn and
+    // Jt are never formed. See set_use_block_sparse_tamsi().
+    bool use_block_sparse = false;
+    if constexpr (std::is_same_v<T, double>) {
+      use_block_sparse = use_block_sparse_tamsi_;
+    }
+    if (use_block_sparse) {
+      std::vector<MatrixX<T>> M0_blocks;
+      std::unique_ptr<internal::TamsiBlockSparseJacobians<T>> tamsi_jacobians;
+      CalcTamsiBlockSparseProblemData(context0, contact_pairs, indices,
+                                      M0_unlocked, &M0_blocks, &full_jacobians,
+                                      &tamsi_jacobians);
+      // Without locked velocities, the Jacobians for the unlocked velocities
+      // are the full Jacobians.
+      const internal::TamsiBlockSparseJacobians<T>& jacobians =
+          tamsi_jacobians != nullptr ? *tamsi_jacobians : *full_jacobians;
+      CallTamsiSolver(&tamsi_solver, context0.get_time(), v0_unlocked,
+                      M0_unlocked, minus_tau_unlocked, fn0, MatrixX<T>(),
+                      MatrixX<T>(), &M0_blocks, &jacobians, stiffness,
+                      damping, mu, &results_unlocked);
+    } else {
+      const internal::ContactJacobians<T>& contact_jacobians =
+          EvalContactJacobians(context0);
+      const MatrixX<T> Jn_unlocked = SelectCols(contact_jacobians.Jn, indices);
+      const MatrixX<T> Jt_unlocked = SelectCols(contact_jacobians.Jt, indices);
+      CallTamsiSolver(&tamsi_solver, context0.get_time(), v0_unlocked,
+                      M0_unlocked, minus_tau_unlocked, fn0, Jn_unlocked,
+                      Jt_unlocked, nullptr, nullptr, stiffness, damping, mu,
+                      &results_unlocked);
+    }
   }
 
   // Joint locking: expand reduced outputs.
   results->v_next = ExpandRows(results_unlocked.v_next,
                                 num_velocities(), indices);
-  results->tau_contact =
-      contact_jacobians.Jn.transpose() * results_unlocked.fn +
-      contact_jacobians.Jt.transpose() * results_unlocked.ft;
+  if (full_jacobians != nullptr) {
+    results->tau_contact.resize(num_velocities());
+    full_jacobians->MultiplyByTranspose(results_unlocked.fn,
+                                        results_unlocked.ft,
+                                        &results->tau_contact);
+  } else {
+    const internal::ContactJacobians<T>& contact_jacobians =
+        EvalContactJacobians(context0);
+    results->tau_contact =
+        contact_jacobians.Jn.transpose() * results_unlocked.fn +
+        contact_jacobians.Jt.transpose() * results_unlocked.ft;
+  }
 
   results->fn = results_unlocked.fn;
   results->ft = results_unlocked.ft;
@@ -2782,13 +2909,118 @@ void MultibodyPlant<T>::CalcJointLockingIndices(
   DRAKE_DEMAND(static_cast<int>(indices.size()) == unlocked_cursor);
 }
 
+template <typename T>
+void MultibodyPlant<T>::CalcTamsiBlockSparseProblemData(
+    const systems::Context<T>& context,
+    const std::vector<internal::DiscreteContactPair<T>>& contact_pairs,
+    const std::vector<int>& unlocked_indices, const MatrixX<T>& M0,
+    std::vector<MatrixX<T>>* M0_blocks,
+    std::unique_ptr<internal::TamsiBlockSparseJacobians<T>>* full_jacobians,
+    std::unique_ptr<internal::TamsiBlockSparseJacobians<T>>* jacobians) const {
+  DRAKE_DEMAND(M0_blocks != nullptr);
+  DRAKE_DEMAND(full_jacobians != nullptr);
+  DRAKE_DEMAND(jacobians != nullptr);
+  const internal::MultibodyTreeTopology& topology =
+      internal_tree().get_topology();
+  using Block = typename internal::TamsiBlockSparseJacobians<T>::Block;
+  const int num_contacts = contact_pairs.size();
+  const int num_trees = topology.num_trees();
+
+  // The Jacobian J_AcBc_W of each contact pair, restricted to the columns of
+  // the (at most two) trees of the bodies in contact, is expressed in the
+  // contact frame C with rows for the normal and the two tangential
+  // directions. See CalcNormalAndTangentContactJacobians() for the sign
+  // conventions and the choice of C.
+  using JacobianTreeBlock =
+      typename internal::ContactPairKinematics<T>::JacobianTreeBlock;
+  const std::vector<std::vector<JacobianTreeBlock>> jacobian_blocks =
+      internal::CalcContactJacobianTreeBlocks(
+          internal_tree(), context, geometry_id_to_body_index_, contact_pairs);
+  std::vector<std::vector<Block>> full_contact_blocks(num_contacts);
+  for (int ic = 0; ic < num_contacts; ++ic) {
+    const math::RotationMatrix<T> R_WC =
+        math::RotationMatrix<T>::MakeFromOneVector(
+            contact_pairs[ic].nhat_BA_W, 2);
+    // Rows for vn = -nhat_BA_Wᵀ⋅v_AcBc_W and the tangential velocities
+    // that1ᵀ⋅v_AcBc_W and that2ᵀ⋅v_AcBc_W.
+    Matrix3<T> R;
+    R.row(0) = -R_WC.matrix().col(2).transpose();
+    R.row(1) = R_WC.matrix().col(0).transpose();
+    R.row(2) = R_WC.matrix().col(1).transpose();
+    for (const JacobianTreeBlock& block : jacobian_blocks[ic]) {
+      full_contact_blocks[ic].push_back(
+          Block{block.tree, R * block.J});
+    }
+  }
+  std::vector<int> tree_sizes(num_trees);
+  for (internal::TreeIndex t(0); t < num_trees; ++t) {
+    tree_sizes[t] = topology.num_tree_velocities(t);
+  }
+
+  // The velocities of a tree are contiguous and, since unlocked_indices is
+  // sorted, so are its unlocked velocities. Trees with all of their
+  // velocities locked are left out.
+  std::vector<int> tree_to_block(num_trees, -1);
+  std::vector<int> block_starts;
+  std::vector<int> block_sizes;
+  for (internal::TreeIndex t(0); t < num_trees; ++t) {
+    const int start = topology.tree_velocities_start(t);
+    const int end = start + topology.num_tree_velocities(t);
+    const auto first = std::lower_bound(unlocked_indices.begin(),
+                                        unlocked_indices.end(), start);
+    const auto last = std::lower_bound(first, unlocked_indices.end(), end);
+    if (first == last) continue;
+    tree_to_block[t] = block_sizes.size();
+    block_starts.push_back(first - unlocked_indices.begin());
+    block_sizes.push_back(last - first);
+  }
+  const int num_blocks = block_sizes.size();
+  DRAKE_DEMAND(std::accumulate(block_sizes.begin(), block_sizes.end(), 0) ==
+               static_cast<int>(unlocked_indices.size()));
+
+  M0_blocks->resize(num_blocks);
+  for (int b = 0; b < num_blocks; ++b) {
+    (*M0_blocks)[b] =
+        M0.block(block_starts[b], block_starts[b], block_sizes[b],
+                 block_sizes[b]);
+  }
+
+  // With locked velocities, the Jacobians for the unlocked velocities keep
+  // the unlocked columns of the trees with any unlocked velocity.
+  if (static_cast<int>(unlocked_indices.size()) == num_velocities()) {
+    *jacobians = nullptr;
+  } else {
+    std::vector<std::vector<Block>> contact_blocks(num_contacts);
+    for (int ic = 0; ic < num_contacts; ++ic) {
+      for (const Block& full_block : full_contact_blocks[ic]) {
+        const internal::TreeIndex t(full_block.tree);
+        const int b = tree_to_block[t];
+        if (b < 0) continue;
+        const int tree_start = topology.tree_velocities_start(t);
+        Matrix3X<T> J(3, block_sizes[b]);
+        for (int k = 0; k < block_sizes[b]; ++k) {
+          J.col(k) = full_block.J.col(
+              unlocked_indices[block_starts[b] + k] - tree_start);
+        }
+        contact_blocks[ic].push_back(Block{b, std::move(J)});
+      }
+    }
+    *jacobians = std::make_unique<internal::TamsiBlockSparseJacobians<T>>(
+        std::move(block_sizes), std::move(contact_blocks));
+  }
+  *full_jacobians = std::make_unique<internal::TamsiBlockSparseJacobians<T>>(
+      std::move(tree_sizes), std::move(full_contact_blocks));
+}
+
 template <typename T>
 void MultibodyPlant<T>::CallTamsiSolver(
     TamsiSolver<T>* tamsi_solver,
     const T& time0, const VectorX<T>& v0, const MatrixX<T>& M0,
     const VectorX<T>& minus_tau, const VectorX<T>& fn0, const MatrixX<T>& Jn,
-    const MatrixX<T>& Jt, const VectorX<T>& stiffness,
-    const VectorX<T>& damping, const VectorX<T>& mu,
+    const MatrixX<T>& Jt, const std::vector<MatrixX<T>>* M0_blocks,
+    const internal::TamsiBlockSparseJacobians<T>* tamsi_jacobians,
+    const VectorX<T>& stiffness, const VectorX<T>& damping,
+    const VectorX<T>& mu,
     contact_solvers::internal::ContactSolverResults<T>* results) const {
   // Solve for v and the contact forces.
   TamsiSolverResult info{TamsiSolverResult::kMaxIterationsReached};
@@ -2811,7 +3043,8 @@ void MultibodyPlant<T>::CallTamsiSolver(
   do {
     ++num_substeps;
     info = SolveUsingSubStepping(tamsi_solver, num_substeps, M0, Jn, Jt,
-                                 minus_tau, stiffness, damping, mu, v0, fn0);
+                                 M0_blocks, tamsi_jacobians, minus_tau,
+                                 stiffness, damping, mu, v0, fn0);
   } while (info != TamsiSolverResult::kSuccess &&
            num_substeps < kNumMaxSubTimeSteps);
 
@@ -145,6 +145,27 @@ enum class DiscreteContactSolver {
   kSap,
 };
 
+/// The level of detail of the hydroelastic contact information reported in the
+/// ContactResults computed by a %MultibodyPlant, see
+/// MultibodyPlant::set_contact_results_reporting_level(). Coarser levels are
+/// cheaper to compute, copy and publish; e.g. a logger that only needs net
+/// wrenches should not pay for copies of every contact surface mesh. Point
+/// contact is always reported with PointPairContactInfo, which is cheap
+/// regardless of the level.
+enum class ContactResultsReportingLevel {
+  /// Hydroelastic contact is only reported as the net spatial force between
+  /// each pair of bodies, see ContactResults::hydroelastic_body_pair_force().
+  /// No ContactSurface is copied.
+  kNetForces,
+  /// One HydroelasticContactInfo is reported per contact surface, with the
+  /// ContactSurface and the spatial force at its centroid, but without
+  /// quadrature point data.
+  kPairSummary,
+  /// HydroelasticContactInfo is reported with all of its data, including the
+  /// tractions and slip velocities at each quadrature point.
+  kFull,
+};
+
 /// @cond
 // Helper macro to throw an exception within methods that should not be called
 // post-finalize.
@@ -1710,6 +1731,31 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   /// Returns the contact solver type used for discrete %MultibodyPlant models.
   DiscreteContactSolver get_discrete_contact_solver() const;
 
+  /// Sets the level of detail of hydroelastic contact information reported by
+  /// the contact results output port, see ContactResultsReportingLevel.
+  /// The default level is ContactResultsReportingLevel::kFull.
+  /// @throws std::exception iff called post-finalize.
+  void set_contact_results_reporting_level(ContactResultsReportingLevel level);
+
+  /// Returns the level of detail of hydroelastic contact information reported
+  /// by the contact results output port.
+  ContactResultsReportingLevel get_contact_results_reporting_level() const;
+
+  /// (Experimental) Sets whether discrete updates with
+  /// DiscreteContactSolver::kTamsi give the TAMSI solver block-sparse problem
+  /// data, with one block per tree of the model, instead of the dense mass
+  /// matrix and contact Jacobians. The cost of the block-sparse solve scales
+  /// with the number of contact points and of trees in contact instead of
+  /// with the square of the number of velocities, which pays off for models
+  /// with many trees. This only affects %MultibodyPlant<double>; other scalar
+  /// types always use the dense problem data. The default is `false`.
+  /// @throws std::exception iff called post-finalize.
+  void set_use_block_sparse_tamsi(bool use_block_sparse_tamsi);
+
+  /// Returns whether discrete TAMSI updates use block-sparse problem data, see
+  /// set_use_block_sparse_tamsi().
+  bool get_use_block_sparse_tamsi() const;
+
   /// Return the default value for contact representation, given the desired
   /// time step. Discrete systems default to use polygons; continuous systems
   /// default to use triangles.
@@ -4555,13 +4601,38 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // to perform the update using a step size dt_substep = dt/num_substeps.
   // During the time span dt the problem data M, Jn, Jt and minus_tau, are
   // approximated to be constant, a first order approximation.
+  // If `tamsi_jacobians` is not nullptr, the solver is given the block-sparse
+  // M0_blocks and tamsi_jacobians instead of the dense M0, Jn and Jt, which
+  // are then unused, see CalcTamsiBlockSparseProblemData().
   TamsiSolverResult SolveUsingSubStepping(
       TamsiSolver<T>* tamsi_solver,
       int num_substeps, const MatrixX<T>& M0, const MatrixX<T>& Jn,
-      const MatrixX<T>& Jt, const VectorX<T>& minus_tau,
+      const MatrixX<T>& Jt, const std::vector<MatrixX<T>>* M0_blocks,
+      const internal::TamsiBlockSparseJacobians<T>* tamsi_jacobians,
+      const VectorX<T>& minus_tau,
       const VectorX<T>& stiffness, const VectorX<T>& damping,
       const VectorX<T>& mu, const VectorX<T>& v0, const VectorX<T>& fn0) const;
 
+  // Helper for CalcContactSolverResults() to make the block-sparse version of
+  // the TamsiSolver problem data for the given `contact_pairs`. The contact
+  // Jacobians are computed per tree with CalcContactJacobianTreeBlocks(), so
+  // the dense Jn and Jt are never formed.
+  // On output, `full_jacobians` stores the contact Jacobians for all
+  // velocities, with one tree of velocities per tree of the MultibodyTree.
+  // `jacobians` stores them restricted to the (sorted) `unlocked_indices`,
+  // with one tree of velocities per tree with unlocked velocities, or nullptr
+  // if no velocity is locked, in which case `full_jacobians` applies.
+  // `M0_blocks` stores the diagonal blocks for each of these trees of M0, the
+  // mass matrix restricted to the unlocked velocities.
+  void CalcTamsiBlockSparseProblemData(
+      const systems::Context<T>& context,
+      const std::vector<internal::DiscreteContactPair<T>>& contact_pairs,
+      const std::vector<int>& unlocked_indices, const MatrixX<T>& M0,
+      std::vector<MatrixX<T>>* M0_blocks,
+      std::unique_ptr<internal::TamsiBlockSparseJacobians<T>>* full_jacobians,
+      std::unique_ptr<internal::TamsiBlockSparseJacobians<T>>* jacobians)
+      const;
+
   // This method performs the computation of the impulses to advance the state
   // stored in `context0` in time.
   // Contact forces and velocities are computed and stored in `results`. See
@@ -4963,12 +5034,17 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
 
   // Helper to invoke our TamsiSolver. This method and `CallContactSolver()` are
   // disjoint methods. One should only use one or the other, but not both.
+  // If `tamsi_jacobians` is not nullptr, the block-sparse M0_blocks and
+  // tamsi_jacobians are used in place of M0, Jn and Jt, see
+  // SolveUsingSubStepping().
   void CallTamsiSolver(
       TamsiSolver<T>* tamsi_solver,
       const T& time0, const VectorX<T>& v0, const MatrixX<T>& M0,
       const VectorX<T>& minus_tau, const VectorX<T>& fn0, const MatrixX<T>& Jn,
-      const MatrixX<T>& Jt, const VectorX<T>& stiffness,
-      const VectorX<T>& damping, const VectorX<T>& mu,
+      const MatrixX<T>& Jt, const std::vector<MatrixX<T>>* M0_blocks,
+      const internal::TamsiBlockSparseJacobians<T>* tamsi_jacobians,
+      const VectorX<T>& stiffness, const VectorX<T>& damping,
+      const VectorX<T>& mu,
       contact_solvers::internal::ContactSolverResults<T>* results) const;
 
   // Helper to invoke ContactSolver when one is available. This method and
@@ -5114,6 +5190,17 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // GetDefaultContactSurfaceRepresentation().
   geometry::HydroelasticContactRepresentation contact_surface_representation_{};
 
+  // The level of detail of hydroelastic contact results. Keep this in sync
+  // with the default value in multibody_plant_config.h; there are already
+  // assertions in the cc file that enforce this.
+  ContactResultsReportingLevel contact_results_reporting_level_{
+      ContactResultsReportingLevel::kFull};
+
+  // Whether TAMSI is given block-sparse problem data, see
+  // set_use_block_sparse_tamsi(). Keep this in sync with the default value in
+  // multibody_plant_config.h.
+  bool use_block_sparse_tamsi_{false};
+
   // Port handles for geometry:
   systems::InputPortIndex geometry_query_port_;
   systems::OutputPortIndex geometry_pose_port_;
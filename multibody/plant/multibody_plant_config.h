@@ -22,6 +22,8 @@ struct MultibodyPlantConfig {
     a->Visit(DRAKE_NVP(contact_model));
     a->Visit(DRAKE_NVP(discrete_contact_solver));
     a->Visit(DRAKE_NVP(contact_surface_representation));
+    a->Visit(DRAKE_NVP(contact_results_reporting_level));
+    a->Visit(DRAKE_NVP(use_block_sparse_tamsi));
   }
 
   /// Configures the MultibodyPlant::MultibodyPlant() constructor time_step.
@@ -62,6 +64,17 @@ struct MultibodyPlantConfig {
   /// chosen above; keep this consistent with
   /// MultibodyPlant::GetDefaultContactSurfaceRepresentation().
   std::string contact_surface_representation{"polygon"};
+
+  /// Configures the MultibodyPlant::set_contact_results_reporting_level().
+  /// Refer to drake::multibody::ContactResultsReportingLevel for details.
+  /// Valid strings are:
+  /// - "net_forces"
+  /// - "pair_summary"
+  /// - "full"
+  std::string contact_results_reporting_level{"full"};
+
+  /// Configures the MultibodyPlant::set_use_block_sparse_tamsi().
+  bool use_block_sparse_tamsi{false};
 };
 
 }  // namespace multibody
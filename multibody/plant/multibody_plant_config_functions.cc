@@ -25,6 +25,10 @@ AddResult AddMultibodyPlant(
   result.plant.set_contact_surface_representation(
       internal::GetContactSurfaceRepresentationFromString(
           config.contact_surface_representation));
+  result.plant.set_contact_results_reporting_level(
+      internal::GetContactResultsReportingLevelFromString(
+          config.contact_results_reporting_level));
+  result.plant.set_use_block_sparse_tamsi(config.use_block_sparse_tamsi);
   return result;
 }
 
@@ -72,6 +76,20 @@ constexpr const char* EnumToChars(ContactRep enum_value) {
   }
 }
 
+// Use a switch() statement here, to ensure the compiler sends us a reminder
+// when somebody adds a new value to the enum. New values must be listed here
+// as well as in the list of kContactResultsReportingLevels below.
+constexpr const char* EnumToChars(ContactResultsReportingLevel enum_value) {
+  switch (enum_value) {
+    case ContactResultsReportingLevel::kNetForces:
+      return "net_forces";
+    case ContactResultsReportingLevel::kPairSummary:
+      return "pair_summary";
+    case ContactResultsReportingLevel::kFull:
+      return "full";
+  }
+}
+
 template <typename Enum>
 struct NamedEnum {
   // An implicit conversion here enables the convenient initializer_list syntax
@@ -99,6 +117,13 @@ constexpr std::array<NamedEnum<ContactRep>, 2> kContactReps{{
   {ContactRep::kPolygon},
 }};
 
+constexpr std::array<NamedEnum<ContactResultsReportingLevel>, 3>
+    kContactResultsReportingLevels{{
+  {ContactResultsReportingLevel::kNetForces},
+  {ContactResultsReportingLevel::kPairSummary},
+  {ContactResultsReportingLevel::kFull},
+}};
+
 }  // namespace
 
 ContactModel GetContactModelFromString(std::string_view contact_model) {
@@ -164,6 +189,28 @@ std::string GetStringFromContactSurfaceRepresentation(
   DRAKE_UNREACHABLE();
 }
 
+ContactResultsReportingLevel GetContactResultsReportingLevelFromString(
+    std::string_view contact_results_reporting_level) {
+  for (const auto& [value, name] : kContactResultsReportingLevels) {
+    if (name == contact_results_reporting_level) {
+      return value;
+    }
+  }
+  throw std::logic_error(fmt::format(
+      "Unknown contact_results_reporting_level: '{}'",
+      contact_results_reporting_level));
+}
+
+std::string GetStringFromContactResultsReportingLevel(
+    ContactResultsReportingLevel contact_results_reporting_level) {
+  for (const auto& [value, name] : kContactResultsReportingLevels) {
+    if (value == contact_results_reporting_level) {
+      return name;
+    }
+  }
+  DRAKE_UNREACHABLE();
+}
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
@@ -55,6 +55,20 @@ GetContactSurfaceRepresentationFromString(
 std::string GetStringFromContactSurfaceRepresentation(
     geometry::HydroelasticContactRepresentation contact_representation);
 
+// (Exposed for unit testing only.)
+// Parses a string name for a contact results reporting level and returns the
+// enumerated value. Valid string names are listed in MultibodyPlantConfig's
+// class overview.
+// @throws std::exception if an invalid string is passed in.
+ContactResultsReportingLevel GetContactResultsReportingLevelFromString(
+    std::string_view contact_results_reporting_level);
+
+// (Exposed for unit testing only.)
+// Returns the string name of an enumerated value for a contact results
+// reporting level.
+std::string GetStringFromContactResultsReportingLevel(
+    ContactResultsReportingLevel contact_results_reporting_level);
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
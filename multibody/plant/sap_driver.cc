@@ -11,8 +11,8 @@
 #include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
 #include "drake/multibody/contact_solvers/sap/sap_friction_cone_constraint.h"
 #include "drake/multibody/contact_solvers/sap/sap_holonomic_constraint.h"
+#include "drake/multibody/contact_solvers/sap/sap_island_solver.h"
 #include "drake/multibody/contact_solvers/sap/sap_limit_constraint.h"
-#include "drake/multibody/contact_solvers/sap/sap_solver.h"
 #include "drake/multibody/contact_solvers/sap/sap_solver_results.h"
 #include "drake/multibody/plant/compliant_contact_manager.h"
 #include "drake/multibody/plant/multibody_plant.h"
@@ -26,8 +26,8 @@ using drake::multibody::contact_solvers::internal::SapConstraint;
 using drake::multibody::contact_solvers::internal::SapContactProblem;
 using drake::multibody::contact_solvers::internal::SapFrictionConeConstraint;
 using drake::multibody::contact_solvers::internal::SapHolonomicConstraint;
+using drake::multibody::contact_solvers::internal::SapIslandSolver;
 using drake::multibody::contact_solvers::internal::SapLimitConstraint;
-using drake::multibody::contact_solvers::internal::SapSolver;
 using drake::multibody::contact_solvers::internal::SapSolverResults;
 using drake::multibody::contact_solvers::internal::SapSolverStatus;
 
@@ -65,6 +65,13 @@ void SapDriver<T>::DeclareCacheEntries(
       {plant().cache_entry_ticket(
           manager().cache_indexes_.discrete_contact_pairs)});
   contact_problem_ = contact_problem_cache_entry.cache_index();
+
+  const auto& island_solver_cache_entry = mutable_manager->DeclareCacheEntry(
+      "SAP island solver scratch",
+      systems::ValueProducer(SapIslandSolver<T>(),
+                             &systems::ValueProducer::NoopCalc),
+      {systems::SystemBase::nothing_ticket()});
+  island_solver_ = island_solver_cache_entry.cache_index();
 }
 
 template <typename T>
@@ -419,8 +426,15 @@ void SapDriver<T>::CalcContactSolverResults(
       context.get_discrete_state(manager().multibody_state_index()).value();
   const auto v0 = x0.bottomRows(this->plant().num_velocities());
 
-  // Solve contact problem.
-  SapSolver<T> sap;
+  // Solve contact problem. Islands of the problem not coupled by any
+  // constraint are solved independently, see SapIslandSolver. The solver is
+  // kept in a scratch cache entry, so that the solvers of the islands are
+  // reused from one discrete update to the next.
+  SapIslandSolver<T>& sap =
+      plant()
+          .get_cache_entry(island_solver_)
+          .get_mutable_cache_entry_value(context)
+          .template GetMutableValueOrThrow<SapIslandSolver<T>>();
   sap.set_parameters(sap_parameters_);
   SapSolverResults<T> sap_results;
   const SapSolverStatus status =
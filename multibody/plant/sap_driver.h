@@ -174,6 +174,9 @@ class SapDriver {
   // the driver only has const access to the manager.
   const CompliantContactManager<T>* const manager_{nullptr};
   systems::CacheIndex contact_problem_;
+  // Scratch cache entry holding the SapIslandSolver, so that the solvers of
+  // the islands and their allocations are reused across discrete updates.
+  systems::CacheIndex island_solver_;
   // Vector of joint damping coefficients, of size plant().num_velocities().
   // This information is extracted during the call to ExtractModelInfo().
   VectorX<T> joint_damping_;
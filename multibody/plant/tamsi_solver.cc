@@ -3,15 +3,35 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
+
 #include "drake/common/extract_double.h"
+#include "drake/common/parallel_for.h"
+#include "drake/common/unused.h"
 #include "drake/math/linear_solve.h"
+#include "drake/multibody/plant/contact_parallelism.h"
 
 namespace drake {
 namespace multibody {
 namespace internal {
+namespace {
+
+// Below this number of trees, the overhead of a parallel region is not worth
+// it. See also kMinContactsForParallelism.
+constexpr int kMinTreesForParallelism = 16;
+
+// Loops over contact points hand them to threads this many at a time, since a
+// single contact point is too little work to be scheduled on its own.
+constexpr int kContactsPerChunk = 16;
+
+}  // namespace
+
 template <typename T>
 T TalsLimiter<T>::CalcAlpha(
     const Eigen::Ref<const Vector2<T>>& v,
@@ -244,6 +264,235 @@ T TalsLimiter<T>::SolveQuadraticForTheSmallestPositiveRoot(
   return alpha;
 }
 
+template <typename T>
+TamsiBlockSparseJacobians<T>::TamsiBlockSparseJacobians(
+    std::vector<int> tree_sizes,
+    std::vector<std::vector<Block>> contact_blocks)
+    : tree_size_(std::move(tree_sizes)),
+      contact_blocks_(std::move(contact_blocks)) {
+  const int num_trees = tree_size_.size();
+  tree_start_.resize(num_trees);
+  for (int t = 0; t < num_trees; ++t) {
+    DRAKE_THROW_UNLESS(tree_size_[t] >= 0);
+    tree_start_[t] = num_velocities_;
+    num_velocities_ += tree_size_[t];
+  }
+
+  tree_contacts_.resize(num_trees);
+  const int nc = contact_blocks_.size();
+  for (int ic = 0; ic < nc; ++ic) {
+    const std::vector<Block>& blocks = contact_blocks_[ic];
+    const int num_blocks = blocks.size();
+    for (int b = 0; b < num_blocks; ++b) {
+      const int t = blocks[b].tree;
+      DRAKE_THROW_UNLESS(0 <= t && t < num_trees);
+      DRAKE_THROW_UNLESS(blocks[b].J.cols() == tree_size_[t]);
+      // Each contact point contributes at most one block per tree.
+      DRAKE_THROW_UNLESS(tree_contacts_[t].empty() ||
+                         tree_contacts_[t].back().first != ic);
+      tree_contacts_[t].emplace_back(ic, b);
+    }
+  }
+}
+
+template <typename T>
+void TamsiBlockSparseJacobians<T>::Multiply(
+    const Eigen::Ref<const VectorX<T>>& v, EigenPtr<VectorX<T>> vn,
+    EigenPtr<VectorX<T>> vt) const {
+  DRAKE_DEMAND(v.size() == num_velocities());
+  DRAKE_DEMAND(vn != nullptr && vn->size() == num_contacts());
+  DRAKE_DEMAND(vt != nullptr && vt->size() == 2 * num_contacts());
+  for (int ic = 0; ic < num_contacts(); ++ic) {
+    Vector3<T> vc = Vector3<T>::Zero();
+    for (const Block& block : contact_blocks_[ic]) {
+      vc.noalias() +=
+          block.J * v.segment(tree_start_[block.tree], tree_size_[block.tree]);
+    }
+    (*vn)(ic) = vc(0);
+    vt->template segment<2>(2 * ic) = vc.template tail<2>();
+  }
+}
+
+template <typename T>
+void TamsiBlockSparseJacobians<T>::MultiplyByTranspose(
+    const Eigen::Ref<const VectorX<T>>& fn,
+    const Eigen::Ref<const VectorX<T>>& ft, EigenPtr<VectorX<T>> tau) const {
+  DRAKE_DEMAND(fn.size() == num_contacts());
+  DRAKE_DEMAND(ft.size() == 2 * num_contacts());
+  DRAKE_DEMAND(tau != nullptr && tau->size() == num_velocities());
+  tau->setZero();
+  for (int ic = 0; ic < num_contacts(); ++ic) {
+    const Vector3<T> fc(fn(ic), ft(2 * ic), ft(2 * ic + 1));
+    for (const Block& block : contact_blocks_[ic]) {
+      tau->segment(tree_start_[block.tree], tree_size_[block.tree])
+          .noalias() += block.J.transpose() * fc;
+    }
+  }
+}
+
+template <typename T>
+void TamsiBlockSparseJacobians<T>::MultiplyTangentialByTranspose(
+    const Eigen::Ref<const VectorX<T>>& ft, EigenPtr<VectorX<T>> tau) const {
+  DRAKE_DEMAND(ft.size() == 2 * num_contacts());
+  DRAKE_DEMAND(tau != nullptr && tau->size() == num_velocities());
+  tau->setZero();
+  for (int ic = 0; ic < num_contacts(); ++ic) {
+    const auto ft_ic = ft.template segment<2>(2 * ic);
+    for (const Block& block : contact_blocks_[ic]) {
+      tau->segment(tree_start_[block.tree], tree_size_[block.tree])
+          .noalias() += block.J.template bottomRows<2>().transpose() * ft_ic;
+    }
+  }
+}
+
+// The Newton-Raphson Jacobian of a problem with block-sparse Jacobians has
+// the form J = M + ∑ Jc,aᵀ (δt Wc Jc,b), see CalcWeightedJacobianBlocks(),
+// and it is therefore non-zero only for the diagonal blocks of the trees and
+// for the blocks (ta, tb) of each pair of trees ta and tb coupled by a contact
+// point. This class stores J as an Eigen::SparseMatrix with all the entries of
+// these blocks, such that the sparsity pattern only depends on the pairs of
+// coupled trees. In the two-way coupled scheme the friction forces depend on
+// the normal velocities through the normal forces, which makes J
+// non-symmetric, so a (sparse) Cholesky factorization doesn't apply. We
+// factorize J with SparseLU for both schemes. The symbolic analysis (the
+// fill-reducing ordering) is performed only when the pattern changes.
+class TamsiSparseNewtonSolver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TamsiSparseNewtonSolver)
+
+  TamsiSparseNewtonSolver() = default;
+
+  // Sets the sparsity pattern of J for the problem with the given `jacobians`.
+  // This is a no-op, preserving the symbolic analysis, if the pairs of trees
+  // coupled by a contact point and the tree sizes are unchanged.
+  void SetSparsityPattern(
+      const TamsiBlockSparseJacobians<double>& jacobians) {
+    const int num_trees = jacobians.num_trees();
+    std::vector<int> tree_sizes(num_trees);
+    std::vector<std::vector<int>> coupled_trees(num_trees);
+    for (int t = 0; t < num_trees; ++t) {
+      tree_sizes[t] = jacobians.tree_size(t);
+      std::vector<int>& trees = coupled_trees[t];
+      trees.push_back(t);
+      for (const auto& tree_contact : jacobians.tree_contacts(t)) {
+        for (const auto& block :
+             jacobians.contact_blocks(tree_contact.first)) {
+          trees.push_back(block.tree);
+        }
+      }
+      std::sort(trees.begin(), trees.end());
+      trees.erase(std::unique(trees.begin(), trees.end()), trees.end());
+    }
+    if (tree_sizes == tree_sizes_ && coupled_trees == coupled_trees_) return;
+
+    tree_sizes_ = std::move(tree_sizes);
+    coupled_trees_ = std::move(coupled_trees);
+    // The rows of each column of J are sorted in a compressed column-major
+    // SparseMatrix. Therefore, in every column of tree tb, the entries of the
+    // block (ta, tb) start at the same offset, the sum of the sizes of the
+    // trees coupled to tb that precede ta.
+    block_offsets_.resize(num_trees);
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int tb = 0; tb < num_trees; ++tb) {
+      block_offsets_[tb].clear();
+      int offset = 0;
+      for (int ta : coupled_trees_[tb]) {
+        block_offsets_[tb].push_back(offset);
+        offset += tree_sizes_[ta];
+        for (int j = 0; j < tree_sizes_[tb]; ++j) {
+          for (int i = 0; i < tree_sizes_[ta]; ++i) {
+            triplets.emplace_back(jacobians.tree_start(ta) + i,
+                                  jacobians.tree_start(tb) + j, 0.0);
+          }
+        }
+      }
+    }
+    const int nv = jacobians.num_velocities();
+    J_.resize(nv, nv);
+    J_.setFromTriplets(triplets.begin(), triplets.end());
+    J_.makeCompressed();
+    symbolic_analysis_valid_ = false;
+  }
+
+  // Assembles J = M + ∑ Jc,aᵀ weighted_blocks[ic][b], where M is given by its
+  // diagonal blocks for each tree, and factorizes it. Returns false if the
+  // factorization fails.
+  // @pre SetSparsityPattern() was called with `jacobians`.
+  bool Factor(const std::vector<MatrixX<double>>& M,
+              const TamsiBlockSparseJacobians<double>& jacobians,
+              const std::vector<std::vector<Matrix3X<double>>>&
+                  weighted_blocks) {
+    DRAKE_DEMAND(J_.rows() == jacobians.num_velocities());
+    Eigen::Map<VectorX<double>>(J_.valuePtr(), J_.nonZeros()).setZero();
+    const int num_trees = jacobians.num_trees();
+    // Each thread fills the columns of a given tree tb.
+    drake::internal::ParallelForOptions parallel_options;
+    parallel_options.parallelize = drake::internal::ShouldParallelize<double>(
+        num_trees, kMinTreesForParallelism);
+    drake::internal::ParallelFor(num_trees, [&](int tb) {
+      const int col_start = jacobians.tree_start(tb);
+      // Returns the offset of the block (ta, tb) of J within each column of
+      // tree tb.
+      auto block_offset = [&](int ta) {
+        const std::vector<int>& trees = coupled_trees_[tb];
+        const int index =
+            std::lower_bound(trees.begin(), trees.end(), ta) - trees.begin();
+        DRAKE_ASSERT(trees[index] == ta);
+        return block_offsets_[tb][index];
+      };
+      // Returns the entries of the block (ta, tb) of J, at `offset`, in its
+      // k-th column.
+      auto block_column = [&](int ta, int offset, int k) {
+        return Eigen::Map<VectorX<double>>(
+            J_.valuePtr() + J_.outerIndexPtr()[col_start + k] + offset,
+            tree_sizes_[ta]);
+      };
+      const int diagonal_offset = block_offset(tb);
+      for (int k = 0; k < tree_sizes_[tb]; ++k) {
+        block_column(tb, diagonal_offset, k) += M[tb].col(k);
+      }
+      for (const auto& [ic, b] : jacobians.tree_contacts(tb)) {
+        const Matrix3X<double>& weighted_block_b = weighted_blocks[ic][b];
+        for (const auto& block_a : jacobians.contact_blocks(ic)) {
+          const int offset = block_offset(block_a.tree);
+          for (int k = 0; k < tree_sizes_[tb]; ++k) {
+            block_column(block_a.tree, offset, k).noalias() +=
+                block_a.J.transpose() * weighted_block_b.col(k);
+          }
+        }
+      }
+    }, parallel_options);
+    if (!symbolic_analysis_valid_) {
+      J_lu_.analyzePattern(J_);
+      symbolic_analysis_valid_ = true;
+      ++num_symbolic_analyses_;
+    }
+    J_lu_.factorize(J_);
+    return J_lu_.info() == Eigen::Success;
+  }
+
+  // Returns the solution x to J x = b.
+  // @pre Factor() succeeded.
+  VectorX<double> Solve(const VectorX<double>& b) const {
+    return J_lu_.solve(b);
+  }
+
+  int num_symbolic_analyses() const { return num_symbolic_analyses_; }
+
+ private:
+  std::vector<int> tree_sizes_;
+  // For each tree tb, the sorted trees ta such that the block (ta, tb) of J is
+  // non-zero, including tb itself.
+  std::vector<std::vector<int>> coupled_trees_;
+  // For each tree tb, the offset of the entries of block (ta, tb) within each
+  // column of tb, for each tree ta in coupled_trees_[tb].
+  std::vector<std::vector<int>> block_offsets_;
+  Eigen::SparseMatrix<double> J_;
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> J_lu_;
+  bool symbolic_analysis_valid_{false};
+  int num_symbolic_analyses_{0};
+};
+
 }  // namespace internal
 
 template <typename T>
@@ -258,6 +507,9 @@ TamsiSolver<T>::TamsiSolver(int nv) :
   DRAKE_THROW_UNLESS(nv >= 0);
 }
 
+template <typename T>
+TamsiSolver<T>::~TamsiSolver() = default;
+
 template <typename T>
 void TamsiSolver<T>::SetOneWayCoupledProblemData(
     EigenPtr<const MatrixX<T>> M,
@@ -274,6 +526,8 @@ void TamsiSolver<T>::SetOneWayCoupledProblemData(
   // Keep references to the problem data.
   problem_data_aliases_.SetOneWayCoupledData(M, Jn, Jt, p_star, fn, mu);
   variable_size_workspace_.ResizeIfNeeded(nc_, nv_);
+  block_sparse_jacobians_ = nullptr;
+  block_diagonal_M_ = nullptr;
 }
 
 template <typename T>
@@ -296,6 +550,78 @@ void TamsiSolver<T>::SetTwoWayCoupledProblemData(
   problem_data_aliases_.SetTwoWayCoupledData(M, Jn, Jt, p_star, fn0, stiffness,
                                              dissipation, mu);
   variable_size_workspace_.ResizeIfNeeded(nc_, nv_);
+  block_sparse_jacobians_ = nullptr;
+  block_diagonal_M_ = nullptr;
+}
+
+template <typename T>
+void TamsiSolver<T>::SetBlockSparseOneWayCoupledProblemData(
+    const std::vector<MatrixX<T>>* M,
+    const internal::TamsiBlockSparseJacobians<T>* jacobians,
+    EigenPtr<const VectorX<T>> p_star, EigenPtr<const VectorX<T>> fn,
+    EigenPtr<const VectorX<T>> mu) {
+  DRAKE_DEMAND(M && jacobians && p_star && fn && mu);
+  nc_ = fn->size();
+  DRAKE_THROW_UNLESS(p_star->size() == nv_);
+  DRAKE_THROW_UNLESS(jacobians->num_velocities() == nv_);
+  DRAKE_THROW_UNLESS(jacobians->num_contacts() == nc_);
+  DRAKE_THROW_UNLESS(mu->size() == nc_);
+  SetBlockSparseJacobians(*M, *jacobians);
+  // Keep references to the problem data. M and the Jacobians are referenced
+  // by block_diagonal_M_ and block_sparse_jacobians_.
+  problem_data_aliases_.SetOneWayCoupledData(nullptr, nullptr, nullptr,
+                                             p_star, fn, mu);
+  variable_size_workspace_.ResizeIfNeeded(nc_, nv_);
+}
+
+template <typename T>
+void TamsiSolver<T>::SetBlockSparseTwoWayCoupledProblemData(
+    const std::vector<MatrixX<T>>* M,
+    const internal::TamsiBlockSparseJacobians<T>* jacobians,
+    EigenPtr<const VectorX<T>> p_star, EigenPtr<const VectorX<T>> fn0,
+    EigenPtr<const VectorX<T>> stiffness,
+    EigenPtr<const VectorX<T>> dissipation, EigenPtr<const VectorX<T>> mu) {
+  DRAKE_DEMAND(M && jacobians && p_star && fn0 && stiffness && dissipation &&
+               mu);
+  nc_ = fn0->size();
+  DRAKE_THROW_UNLESS(p_star->size() == nv_);
+  DRAKE_THROW_UNLESS(jacobians->num_velocities() == nv_);
+  DRAKE_THROW_UNLESS(jacobians->num_contacts() == nc_);
+  DRAKE_THROW_UNLESS(mu->size() == nc_);
+  DRAKE_THROW_UNLESS(stiffness->size() == nc_);
+  DRAKE_THROW_UNLESS(dissipation->size() == nc_);
+  SetBlockSparseJacobians(*M, *jacobians);
+  // Keep references to the problem data. M and the Jacobians are referenced
+  // by block_diagonal_M_ and block_sparse_jacobians_.
+  problem_data_aliases_.SetTwoWayCoupledData(nullptr, nullptr, nullptr,
+                                             p_star, fn0, stiffness,
+                                             dissipation, mu);
+  variable_size_workspace_.ResizeIfNeeded(nc_, nv_);
+}
+
+template <typename T>
+void TamsiSolver<T>::SetBlockSparseJacobians(
+    const std::vector<MatrixX<T>>& M,
+    const internal::TamsiBlockSparseJacobians<T>& jacobians) {
+  const int num_trees = jacobians.num_trees();
+  DRAKE_THROW_UNLESS(static_cast<int>(M.size()) == num_trees);
+  for (int t = 0; t < num_trees; ++t) {
+    DRAKE_THROW_UNLESS(M[t].rows() == jacobians.tree_size(t) &&
+                       M[t].cols() == jacobians.tree_size(t));
+  }
+  block_diagonal_M_ = &M;
+  block_sparse_jacobians_ = &jacobians;
+  weighted_jacobian_blocks_.resize(nc_);
+  for (int ic = 0; ic < nc_; ++ic) {
+    weighted_jacobian_blocks_[ic].resize(jacobians.contact_blocks(ic).size());
+  }
+  if constexpr (std::is_same_v<T, double>) {
+    if (sparse_newton_solver_ == nullptr) {
+      sparse_newton_solver_ =
+          std::make_unique<internal::TamsiSparseNewtonSolver>();
+    }
+    sparse_newton_solver_->SetSparsityPattern(jacobians);
+  }
 }
 
 template <typename T>
@@ -465,6 +791,28 @@ void TamsiSolver<T>::CalcNormalForces(
     // clashes with local variables.
     EigenPtr<VectorX<T>> fn_ptr,
     EigenPtr<MatrixX<T>> Gn_ptr) const {
+  if (!has_two_way_coupling()) {
+    // Copy the input normal force (i.e. it is fixed).
+    *fn_ptr = problem_data_aliases_.fn();
+    return;
+  }
+
+  auto dfn_dvn = variable_size_workspace_.mutable_dfn_dvn();
+  CalcNormalForces(vn, dt, fn_ptr, &dfn_dvn);
+
+  // We use the chain rule to compute Gn = ∇ᵥfₙ. Since ∇ᵥvₙ = Jn, we have:
+  auto& Gn = *Gn_ptr;
+  Gn = dfn_dvn.asDiagonal() * Jn;
+}
+
+template <typename T>
+void TamsiSolver<T>::CalcNormalForces(
+    const Eigen::Ref<const VectorX<T>>& vn,
+    double dt,
+    // We change from fn/dfn_dvn in the header to fn_ptr, dfn_dvn_ptr here to
+    // avoid name clashes with local variables.
+    EigenPtr<VectorX<T>> fn_ptr,
+    EigenPtr<VectorX<T>> dfn_dvn_ptr) const {
   using std::max;
   const int nc = nc_;  // Number of contact points.
 
@@ -509,13 +857,9 @@ void TamsiSolver<T>::CalcNormalForces(
   // function of vₙ (on a per contact basis, that's why the use of .array()
   // operations below). dfₙ/dvₙ = -d⋅H(1 − d vₙ)⋅(fₙ₀ − h k vₙ)₊  - h⋅k⋅(1 − d
   // vₙ)₊⋅H(fₙ₀ − h k vₙ) Note that dfₙ/dvₙ < 0 always.
-  const VectorX<T> dfn_dvn = -(
+  *dfn_dvn_ptr = -(
       dissipation.array() * H_damping_factor.array() * undamped_fn.array() +
       dt * stiffness.array() * damping_factor.array() * H_undamped_fn.array());
-
-  // We use the chain rule to compute Gn = ∇ᵥfₙ. Since ∇ᵥvₙ = Jn, we have:
-  auto& Gn = *Gn_ptr;
-  Gn = dfn_dvn.asDiagonal() * Jn;
 }
 
 template <typename T>
@@ -582,6 +926,110 @@ void TamsiSolver<T>::CalcJacobian(
   }
 }
 
+template <typename T>
+void TamsiSolver<T>::CalcWeightedJacobianBlocks(
+    const Eigen::Ref<const VectorX<T>>& dfn_dvn,
+    const std::vector<Matrix2<T>>& dft_dvt,
+    const Eigen::Ref<const VectorX<T>>& t_hat,
+    const Eigen::Ref<const VectorX<T>>& mu_vt, double dt) const {
+  DRAKE_DEMAND(block_sparse_jacobians_ != nullptr);
+  const internal::TamsiBlockSparseJacobians<T>& jacobians =
+      *block_sparse_jacobians_;
+  const int nc = nc_;
+  const bool two_way_coupling = has_two_way_coupling();
+
+  // With Gn = diag(dfn_dvn) Jn, the Jacobian computed by CalcJacobian() can be
+  // written as a sum of contributions from each contact point:
+  //   J = M + δt ∑ Jcᵀ Wc Jc
+  // where Jc = [Jₙ(ic, :); Jₜ(2ic:2ic+1, :)] stacks the rows of the ic-th
+  // contact point and Wc is the 3x3 matrix
+  //   Wc = | −dfₙ/dvₙ                0       |
+  //        |  μ(‖vₜ‖) t̂ dfₙ/dvₙ    dft_dvt |
+  // where the entries involving dfₙ/dvₙ are only present for the two-way
+  // coupled scheme. Since Jc only has non-zero blocks for a few trees, each
+  // contact point only contributes to a few blocks of J: with blocks a and b
+  // for trees ta and tb, it adds Jc,aᵀ (δt Wc Jc,b) to the block of J for the
+  // rows of ta and the columns of tb. Here we compute the weighted blocks
+  // δt Wc Jc,b, which is independent for each contact point.
+  drake::internal::ParallelForOptions parallel_options;
+  parallel_options.parallelize = internal::ParallelizeContactLoops<T>(nc);
+  parallel_options.chunk_size = internal::kContactsPerChunk;
+  drake::internal::ParallelFor(nc, [&](int ic) {
+    Matrix3<T> W = Matrix3<T>::Zero();
+    W.template bottomRightCorner<2, 2>() = dft_dvt[ic];
+    if (two_way_coupling) {
+      W(0, 0) = -dfn_dvn(ic);
+      W.template bottomLeftCorner<2, 1>() =
+          mu_vt(ic) * dfn_dvn(ic) * t_hat.template segment<2>(2 * ic);
+    }
+    W *= dt;
+    const auto& blocks = jacobians.contact_blocks(ic);
+    std::vector<Matrix3X<T>>& weighted_blocks = weighted_jacobian_blocks_[ic];
+    for (size_t b = 0; b < blocks.size(); ++b) {
+      weighted_blocks[b].noalias() = W * blocks[b].J;
+    }
+  }, parallel_options);
+}
+
+template <typename T>
+void TamsiSolver<T>::CalcBlockSparseJacobian(EigenPtr<MatrixX<T>> J) const {
+  DRAKE_DEMAND(block_sparse_jacobians_ != nullptr);
+  const internal::TamsiBlockSparseJacobians<T>& jacobians =
+      *block_sparse_jacobians_;
+  const int num_trees = jacobians.num_trees();
+  J->setZero();
+  // We accumulate the contributions of each contact point one tree (block row
+  // of J) at a time so that the trees can be processed concurrently.
+  drake::internal::ParallelForOptions parallel_options;
+  parallel_options.parallelize = drake::internal::ShouldParallelize<T>(
+      num_trees, internal::kMinTreesForParallelism);
+  drake::internal::ParallelFor(num_trees, [&](int t) {
+    const int row_start = jacobians.tree_start(t);
+    const int num_rows = jacobians.tree_size(t);
+    J->block(row_start, row_start, num_rows, num_rows) =
+        (*block_diagonal_M_)[t];
+    for (const auto& [ic, a] : jacobians.tree_contacts(t)) {
+      const auto& blocks = jacobians.contact_blocks(ic);
+      const Matrix3X<T>& Jc_a = blocks[a].J;
+      const std::vector<Matrix3X<T>>& weighted_blocks =
+          weighted_jacobian_blocks_[ic];
+      for (size_t b = 0; b < blocks.size(); ++b) {
+        const int tb = blocks[b].tree;
+        J->block(row_start, jacobians.tree_start(tb), num_rows,
+                 jacobians.tree_size(tb))
+            .noalias() += Jc_a.transpose() * weighted_blocks[b];
+      }
+    }
+  }, parallel_options);
+}
+
+template <typename T>
+bool TamsiSolver<T>::SolveWithSparseNewtonSolver(
+    const Eigen::Ref<const VectorX<T>>& residual, VectorX<T>* Delta_v) const {
+  if constexpr (std::is_same_v<T, double>) {
+    DRAKE_DEMAND(sparse_newton_solver_ != nullptr);
+    if (!sparse_newton_solver_->Factor(*block_diagonal_M_,
+                                       *block_sparse_jacobians_,
+                                       weighted_jacobian_blocks_)) {
+      return false;
+    }
+    *Delta_v = sparse_newton_solver_->Solve(-residual);
+    return true;
+  } else {
+    unused(residual, Delta_v);
+    throw std::logic_error(
+        "TamsiSolver: the sparse Newton-Raphson solver is only supported for "
+        "T = double.");
+  }
+}
+
+template <typename T>
+int TamsiSolver<T>::num_sparse_symbolic_analyses() const {
+  return sparse_newton_solver_ == nullptr
+             ? 0
+             : sparse_newton_solver_->num_symbolic_analyses();
+}
+
 template <typename T>
 T TamsiSolver<T>::CalcAlpha(
     const Eigen::Ref<const VectorX<T>>& vt,
@@ -617,15 +1065,26 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
   if (nc_ == 0) {
     fixed_size_workspace_.mutable_tau_f().setZero();
     fixed_size_workspace_.mutable_tau().setZero();
-    const Eigen::Ref<const MatrixX<T>> M = problem_data_aliases_.M();
     const Eigen::Ref<const VectorX<T>> p_star = problem_data_aliases_.p_star();
     auto& v = fixed_size_workspace_.mutable_v();
     // With no friction forces Eq. (3) in the documentation reduces to
     // M vˢ⁺¹ = p*.
-    // Note: We need M.eval() here since LinearSolver needs MatrixBase and M is
-    // an Eigen::Ref.
-    math::LinearSolver<Eigen::LDLT, MatrixX<T>> M_ldlt(M.eval());
-    v = M_ldlt.Solve(p_star);
+    if (block_sparse_jacobians_ != nullptr) {
+      // M is block diagonal.
+      for (int t = 0; t < block_sparse_jacobians_->num_trees(); ++t) {
+        const int start = block_sparse_jacobians_->tree_start(t);
+        const int size = block_sparse_jacobians_->tree_size(t);
+        const math::LinearSolver<Eigen::LDLT, MatrixX<T>> M_ldlt(
+            (*block_diagonal_M_)[t]);
+        v.segment(start, size) = M_ldlt.Solve(p_star.segment(start, size));
+      }
+    } else {
+      const Eigen::Ref<const MatrixX<T>> M = problem_data_aliases_.M();
+      // Note: We need M.eval() here since LinearSolver needs MatrixBase and M
+      // is an Eigen::Ref.
+      math::LinearSolver<Eigen::LDLT, MatrixX<T>> M_ldlt(M.eval());
+      v = M_ldlt.Solve(p_star);
+    }
     // "One iteration" with exactly "zero" vt_error.
     statistics_.Update(0.0);
     return TamsiSolverResult::kSuccess;
@@ -640,10 +1099,21 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
   const double v_contact_tolerance =
       parameters_.relative_tolerance * parameters_.stiction_tolerance;
 
-  // Convenient aliases to problem data.
-  const auto M = problem_data_aliases_.M();
-  const auto Jn = problem_data_aliases_.Jn();
-  const auto Jt = problem_data_aliases_.Jt();
+  // Convenient aliases to problem data. M and the Jacobians are either dense
+  // or block-sparse.
+  const internal::TamsiBlockSparseJacobians<T>* block_sparse_jacobians =
+      block_sparse_jacobians_;
+  const bool has_block_sparse_jacobians = block_sparse_jacobians != nullptr;
+  const MatrixX<T> empty_matrix;
+  const Eigen::Ref<const MatrixX<T>> M =
+      has_block_sparse_jacobians ? Eigen::Ref<const MatrixX<T>>(empty_matrix)
+                                 : problem_data_aliases_.M();
+  const Eigen::Ref<const MatrixX<T>> Jn =
+      has_block_sparse_jacobians ? Eigen::Ref<const MatrixX<T>>(empty_matrix)
+                                 : problem_data_aliases_.Jn();
+  const Eigen::Ref<const MatrixX<T>> Jt =
+      has_block_sparse_jacobians ? Eigen::Ref<const MatrixX<T>>(empty_matrix)
+                                 : problem_data_aliases_.Jt();
   const auto p_star = problem_data_aliases_.p_star();
 
   // Convenient aliases to fixed size workspace variables.
@@ -663,6 +1133,7 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
   auto Delta_vt = variable_size_workspace_.mutable_Delta_vt();
   auto& dft_dvt = variable_size_workspace_.mutable_dft_dvt();
   auto Gn = variable_size_workspace_.mutable_Gn();
+  auto dfn_dvn = variable_size_workspace_.mutable_dfn_dvn();
   auto mu_vt = variable_size_workspace_.mutable_mu();
   auto t_hat = variable_size_workspace_.mutable_t_hat();
   auto fn = variable_size_workspace_.mutable_fn();
@@ -678,10 +1149,14 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
 
   for (int iter = 0; iter < max_iterations; ++iter) {
     // Update normal and tangential velocities.
-    vn = Jn * v;
-    vt = Jt * v;
-
-    CalcNormalForces(vn, Jn, dt, &fn, &Gn);
+    if (has_block_sparse_jacobians) {
+      block_sparse_jacobians->Multiply(v, &vn, &vt);
+      CalcNormalForces(vn, dt, &fn, &dfn_dvn);
+    } else {
+      vn = Jn * v;
+      vt = Jt * v;
+      CalcNormalForces(vn, Jn, dt, &fn, &Gn);
+    }
 
     // Update v_slip, t_hat, mus and ft as a function of vt and fn.
     CalcFrictionForces(vt, fn, &v_slip, &t_hat, &mu_vt, &ft);
@@ -691,41 +1166,75 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
     // Convergence is monitored in both tangential and normal directions.
     if (std::max(vt_error, vn_error) < v_contact_tolerance) {
       // Update generalized forces and return.
-      tau_f = Jt.transpose() * ft;
-      tau = tau_f + Jn.transpose() * fn;
+      if (has_block_sparse_jacobians) {
+        block_sparse_jacobians->MultiplyTangentialByTranspose(ft, &tau_f);
+        block_sparse_jacobians->MultiplyByTranspose(fn, ft, &tau);
+      } else {
+        tau_f = Jt.transpose() * ft;
+        tau = tau_f + Jn.transpose() * fn;
+      }
       return TamsiSolverResult::kSuccess;
     }
 
     // Newton-Raphson residual.
-    residual =
-        M * v - p_star - dt * Jn.transpose() * fn - dt * Jt.transpose() * ft;
+    if (has_block_sparse_jacobians) {
+      // We use Delta_v as scratch for the generalized contact forces. M is
+      // block diagonal.
+      block_sparse_jacobians->MultiplyByTranspose(fn, ft, &Delta_v);
+      for (int t = 0; t < block_sparse_jacobians->num_trees(); ++t) {
+        const int start = block_sparse_jacobians->tree_start(t);
+        const int size = block_sparse_jacobians->tree_size(t);
+        residual.segment(start, size).noalias() =
+            (*block_diagonal_M_)[t] * v.segment(start, size);
+      }
+      residual -= p_star + dt * Delta_v;
+    } else {
+      residual =
+          M * v - p_star - dt * Jn.transpose() * fn - dt * Jt.transpose() * ft;
+    }
 
     // Compute gradient dft_dvt = ∇ᵥₜfₜ(vₜ) as a function of fn, mus,
     // t_hat and v_slip.
     CalcFrictionForcesGradient(fn, mu_vt, t_hat, v_slip, &dft_dvt);
 
-    // Newton-Raphson Jacobian, J = ∇ᵥR, as a function of M, dft_dvt, Jt, dt.
-    CalcJacobian(M, Jn, Jt, Gn, dft_dvt, t_hat, mu_vt, dt, &J);
-
     // TODO(amcastro-tri): Consider using a cheap iterative solver like CG.
     // Since we are in a non-linear iteration, an approximate cheap solution
     // is probably best.
     // TODO(amcastro-tri): Consider using a matrix-free iterative method to
     // avoid computing M and J. CG and the Krylov family can be matrix-free.
-    if (has_two_way_coupling()) {
-      // LU Factorization of the Newton-Raphson Jacobian J. Only used for
-      // two-way coupled problems with non-symmetric Jacobian.
-      const math::LinearSolver<Eigen::PartialPivLU, MatrixX<T>> J_lu(J);
-      Delta_v = J_lu.Solve(-residual);
-    } else {
-      // LDLT Factorization of the Newton-Raphson Jacobian J. Only used for
-      // one-way coupled problems with symmetric Jacobian.
-      const math::LinearSolver<Eigen::LDLT, MatrixX<T>> J_ldlt(J);
-      Delta_v = J_ldlt.Solve(-residual);
-      const auto& eigen_solver = J_ldlt.eigen_linear_solver();
-      if (eigen_solver.info() != Eigen::Success) {
+    if (has_block_sparse_jacobians) {
+      CalcWeightedJacobianBlocks(dfn_dvn, dft_dvt, t_hat, mu_vt, dt);
+    }
+    if (has_block_sparse_jacobians && std::is_same_v<T, double>) {
+      // The Newton-Raphson Jacobian is only formed within the sparse solver,
+      // exploiting its sparsity.
+      if (!SolveWithSparseNewtonSolver(residual, &Delta_v)) {
         return TamsiSolverResult::kLinearSolverFailed;
       }
+    } else {
+      // Newton-Raphson Jacobian, J = ∇ᵥR, as a function of M, dft_dvt, Jt,
+      // dt.
+      if (has_block_sparse_jacobians) {
+        CalcBlockSparseJacobian(&J);
+      } else {
+        CalcJacobian(M, Jn, Jt, Gn, dft_dvt, t_hat, mu_vt, dt, &J);
+      }
+
+      if (has_two_way_coupling()) {
+        // LU Factorization of the Newton-Raphson Jacobian J. Only used for
+        // two-way coupled problems with non-symmetric Jacobian.
+        const math::LinearSolver<Eigen::PartialPivLU, MatrixX<T>> J_lu(J);
+        Delta_v = J_lu.Solve(-residual);
+      } else {
+        // LDLT Factorization of the Newton-Raphson Jacobian J. Only used for
+        // one-way coupled problems with symmetric Jacobian.
+        const math::LinearSolver<Eigen::LDLT, MatrixX<T>> J_ldlt(J);
+        Delta_v = J_ldlt.Solve(-residual);
+        const auto& eigen_solver = J_ldlt.eigen_linear_solver();
+        if (eigen_solver.info() != Eigen::Success) {
+          return TamsiSolverResult::kLinearSolverFailed;
+        }
+      }
     }
 
     // Since we keep Jt constant we have that:
@@ -736,11 +1245,14 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
     // determine by limiting the maximum angle change between vₜᵏ and vₜᵏ⁺¹.
     // For multiple contact points, we choose the minimum α among all contact
     // points.
-    Delta_vt = Jt * Delta_v;
-
     // Similarly to Δvₜᵏ above, we define the update in the normal velocities
     // as Δvₙᵏ = Jₙ Δvᵏ.
-    Delta_vn = Jn * Delta_v;
+    if (has_block_sparse_jacobians) {
+      block_sparse_jacobians->Multiply(Delta_v, &Delta_vn, &Delta_vt);
+    } else {
+      Delta_vt = Jt * Delta_v;
+      Delta_vn = Jn * Delta_v;
+    }
 
     // We monitor convergence in both normal and tangential velocities.
     vn_error = ExtractDoubleOrThrow(Delta_vn.norm());
@@ -788,5 +1300,8 @@ T TamsiSolver<T>::RegularizedFrictionDerivative(
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     struct ::drake::multibody::internal::TalsLimiter)
 
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::internal::TamsiBlockSparseJacobians)
+
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::multibody::TamsiSolver)
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "drake/common/default_scalars.h"
@@ -159,6 +160,92 @@ struct TalsLimiter {
   static T SolveQuadraticForTheSmallestPositiveRoot(
       const T& a, const T& b, const T& c);
 };
+
+// The contact Jacobians Jₙ and Jₜ of a TamsiSolver problem, stored
+// block-sparse and regrouped per contact point.
+// The columns (generalized velocities) are partitioned into "trees", given by
+// the tree sizes provided at construction. Typically, each tree corresponds to
+// a tree of a MultibodyTree forest. For the ic-th contact point we stack the
+// rows of Jₙ and Jₜ into Jc = [Jₙ(ic, :); Jₜ(2ic, :); Jₜ(2ic+1, :)], of
+// size 3 x nv. Jc is non-zero only for the few trees in contact at that point
+// (one or two for point contact) and we only store those 3 x nt blocks, with
+// nt the number of velocities of a given tree. Trees with no contact points
+// have no blocks at all.
+template <typename T>
+class TamsiBlockSparseJacobians {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TamsiBlockSparseJacobians)
+
+  // The non-zero block of Jc for a given tree.
+  struct Block {
+    int tree{};
+    // Of size 3 x nt, with rows for the normal and the two tangential
+    // directions, in that order.
+    Matrix3X<T> J;
+  };
+
+  // Constructs the Jacobians for a system with generalized velocities
+  // partitioned into consecutive trees of sizes `tree_sizes`, given the
+  // non-zero blocks of Jc for each contact point in `contact_blocks`.
+  // @throws std::exception if a tree size is negative.
+  // @throws std::exception if a block refers to a tree not in
+  // [0, tree_sizes.size()), or if its size is not 3 x nt.
+  // @throws std::exception if a contact point has two blocks for the same
+  // tree.
+  TamsiBlockSparseJacobians(std::vector<int> tree_sizes,
+                            std::vector<std::vector<Block>> contact_blocks);
+
+  int num_contacts() const { return contact_blocks_.size(); }
+
+  int num_velocities() const { return num_velocities_; }
+
+  int num_trees() const { return tree_start_.size(); }
+
+  // The index of the first velocity of the t-th tree.
+  int tree_start(int t) const { return tree_start_[t]; }
+
+  // The number of velocities of the t-th tree.
+  int tree_size(int t) const { return tree_size_[t]; }
+
+  // The non-zero blocks of Jc for the ic-th contact point.
+  const std::vector<Block>& contact_blocks(int ic) const {
+    return contact_blocks_[ic];
+  }
+
+  // Pairs (ic, b) such that contact_blocks(ic)[b] is a block of the t-th
+  // tree.
+  const std::vector<std::pair<int, int>>& tree_contacts(int t) const {
+    return tree_contacts_[t];
+  }
+
+  // Computes vn = Jₙ v and vt = Jₜ v.
+  void Multiply(const Eigen::Ref<const VectorX<T>>& v, EigenPtr<VectorX<T>> vn,
+                EigenPtr<VectorX<T>> vt) const;
+
+  // Computes tau = Jₙᵀ fn + Jₜᵀ ft.
+  void MultiplyByTranspose(const Eigen::Ref<const VectorX<T>>& fn,
+                           const Eigen::Ref<const VectorX<T>>& ft,
+                           EigenPtr<VectorX<T>> tau) const;
+
+  // Computes tau = Jₜᵀ ft.
+  void MultiplyTangentialByTranspose(const Eigen::Ref<const VectorX<T>>& ft,
+                                     EigenPtr<VectorX<T>> tau) const;
+
+ private:
+  int num_velocities_{0};
+  std::vector<int> tree_start_;
+  std::vector<int> tree_size_;
+  std::vector<std::vector<Block>> contact_blocks_;
+  std::vector<std::vector<std::pair<int, int>>> tree_contacts_;
+};
+
+// The sparse LU factorization of the Newton-Raphson Jacobian used by
+// TamsiSolver<double> for problems with block-sparse Jacobians. Defined in
+// tamsi_solver.cc.
+class TamsiSparseNewtonSolver;
+
+template <typename T>
+class TamsiSolverBlockSparseAttorney;
 }  // namespace internal
 
 /// The result from TamsiSolver::SolveWithGuess() used to report the
@@ -511,6 +598,8 @@ class TamsiSolver {
   /// @throws std::exception if nv is non-positive.
   explicit TamsiSolver(int nv);
 
+  ~TamsiSolver();
+
   /// Change the working size of the solver to use `nv` generalized
   /// velocities. This can be used to either shrink or grow the workspaces.
   /// @throws std::exception if nv is non-positive.
@@ -738,6 +827,7 @@ class TamsiSolver {
  private:
   // Helper class for unit testing.
   friend class TamsiSolverTester;
+  friend class internal::TamsiSolverBlockSparseAttorney<T>;
 
   // Contains all the references that define the problem to be solved.
   // These references must remain valid at least from the time they are set with
@@ -752,9 +842,9 @@ class TamsiSolver {
         EigenPtr<const MatrixX<T>> Jn, EigenPtr<const MatrixX<T>> Jt,
         EigenPtr<const VectorX<T>> p_star,
         EigenPtr<const VectorX<T>> fn, EigenPtr<const VectorX<T>> mu) {
-      DRAKE_DEMAND(M != nullptr);
-      DRAKE_DEMAND(Jn != nullptr);
-      DRAKE_DEMAND(Jt != nullptr);
+      // M, Jn and Jt are nullptr for problems with block-sparse Jacobians.
+      DRAKE_DEMAND((M == nullptr) == (Jn == nullptr));
+      DRAKE_DEMAND((Jn == nullptr) == (Jt == nullptr));
       DRAKE_DEMAND(p_star != nullptr);
       DRAKE_DEMAND(fn != nullptr);
       DRAKE_DEMAND(mu != nullptr);
@@ -779,9 +869,9 @@ class TamsiSolver {
         EigenPtr<const VectorX<T>> fn0,
         EigenPtr<const VectorX<T>> stiffness,
         EigenPtr<const VectorX<T>> dissipation, EigenPtr<const VectorX<T>> mu) {
-      DRAKE_DEMAND(M != nullptr);
-      DRAKE_DEMAND(Jn != nullptr);
-      DRAKE_DEMAND(Jt != nullptr);
+      // M, Jn and Jt are nullptr for problems with block-sparse Jacobians.
+      DRAKE_DEMAND((M == nullptr) == (Jn == nullptr));
+      DRAKE_DEMAND((Jn == nullptr) == (Jt == nullptr));
       DRAKE_DEMAND(p_star != nullptr);
       DRAKE_DEMAND(fn0 != nullptr);
       DRAKE_DEMAND(stiffness != nullptr);
@@ -822,16 +912,21 @@ class TamsiSolver {
       return coupling_scheme_ == kTwoWayCoupled;
     }
 
+    // The dense mass matrix and Jacobians. They must not be called for
+    // problems with block-sparse Jacobians.
     Eigen::Ref<const MatrixX<T>> M() const {
       DRAKE_ASSERT_VOID(DemandValid());
+      DRAKE_ASSERT(M_ptr_ != nullptr);
       return *M_ptr_;
     }
     Eigen::Ref<const MatrixX<T>> Jn() const {
       DRAKE_ASSERT_VOID(DemandValid());
+      DRAKE_ASSERT(Jn_ptr_ != nullptr);
       return *Jn_ptr_;
     }
     Eigen::Ref<const MatrixX<T>> Jt() const {
       DRAKE_ASSERT_VOID(DemandValid());
+      DRAKE_ASSERT(Jt_ptr_ != nullptr);
       return *Jt_ptr_;
     }
     Eigen::Ref<const VectorX<T>> p_star() const {
@@ -887,11 +982,14 @@ class TamsiSolver {
       DRAKE_DEMAND(coupling_scheme_ != kInvalidScheme);
     }
 
-    // The mass matrix of the system.
+    // The mass matrix of the system. nullptr for problems with block-sparse
+    // Jacobians.
     EigenPtr<const MatrixX<T>> M_ptr_{nullptr};
-    // The normal separation velocities Jacobian.
+    // The normal separation velocities Jacobian. nullptr for problems with
+    // block-sparse Jacobians.
     EigenPtr<const MatrixX<T>> Jn_ptr_{nullptr};
-    // The tangential velocities Jacobian.
+    // The tangential velocities Jacobian. nullptr for problems with
+    // block-sparse Jacobians.
     EigenPtr<const MatrixX<T>> Jt_ptr_{nullptr};
     // The generalized momentum vector **before** contact is applied.
     EigenPtr<const VectorX<T>> p_star_ptr_{nullptr};
@@ -978,6 +1076,7 @@ class TamsiSolver {
       v_slip_.resize(nc);
       mus_.resize(nc);
       dft_dv_.resize(nc);
+      dfn_dvn_.resize(nc);
       Gn_.resize(nc, nv);
     }
 
@@ -1072,6 +1171,13 @@ class TamsiSolver {
       return Gn_.block(0, 0, nc_, nv_);
     }
 
+    // Returns a mutable reference to the vector containing the derivative
+    // dfₙ/dvₙ of the normal force with respect to the normal velocity at each
+    // contact point, of size nc.
+    Eigen::VectorBlock<VectorX<T>> mutable_dfn_dvn() {
+      return dfn_dvn_.segment(0, nc_);
+    }
+
     // Returns a mutable reference to the vector storing ∂fₜ/∂vₜ (in ℝ²ˣ²)
     // for each contact point, of size nc.
     std::vector<Matrix2<T>>& mutable_dft_dvt() {
@@ -1092,9 +1198,34 @@ class TamsiSolver {
     VectorX<T> mus_;       // (modified) regularized friction, in ℝⁿᶜ.
     // Vector of size nc storing ∂fₜ/∂vₜ (in ℝ²ˣ²) for each contact point.
     std::vector<Matrix2<T>> dft_dv_;
+    VectorX<T> dfn_dvn_;   // dfₙ/dvₙ, in ℝⁿᶜ.
     MatrixX<T> Gn_;        // ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹), in ℝⁿᶜˣⁿᵛ
   };
 
+  // Versions of SetOneWayCoupledProblemData() and
+  // SetTwoWayCoupledProblemData() for problems with block-sparse Jacobians,
+  // see internal::TamsiSolverBlockSparseAttorney. Like the dense versions,
+  // they store references to the problem data.
+  void SetBlockSparseOneWayCoupledProblemData(
+      const std::vector<MatrixX<T>>* M,
+      const internal::TamsiBlockSparseJacobians<T>* jacobians,
+      EigenPtr<const VectorX<T>> p_star, EigenPtr<const VectorX<T>> fn,
+      EigenPtr<const VectorX<T>> mu);
+  void SetBlockSparseTwoWayCoupledProblemData(
+      const std::vector<MatrixX<T>>* M,
+      const internal::TamsiBlockSparseJacobians<T>* jacobians,
+      EigenPtr<const VectorX<T>> p_star, EigenPtr<const VectorX<T>> fn0,
+      EigenPtr<const VectorX<T>> stiffness,
+      EigenPtr<const VectorX<T>> dissipation, EigenPtr<const VectorX<T>> mu);
+
+  // Helper for the two methods above to set block_diagonal_M_ and
+  // block_sparse_jacobians_, and to update the sparsity pattern of
+  // sparse_newton_solver_. It throws if the diagonal blocks of M are not
+  // square matrices with the size of each tree of `jacobians`.
+  void SetBlockSparseJacobians(
+      const std::vector<MatrixX<T>>& M,
+      const internal::TamsiBlockSparseJacobians<T>& jacobians);
+
   // Returns true if the solver is solving the two-way coupled problem.
   bool has_two_way_coupling() const {
     return problem_data_aliases_.has_two_way_coupling_data();
@@ -1115,6 +1246,16 @@ class TamsiSolver {
       EigenPtr<VectorX<T>> fn,
       EigenPtr<MatrixX<T>> Gn) const;
 
+  // Same as above, but instead of Gn it computes the derivative dfn_dvn =
+  // dfₙ/dvₙ at each contact point, such that Gn = diag(dfn_dvn) Jn. For the
+  // one-way coupled scheme fn is simply the input normal force and dfn_dvn is
+  // not modified.
+  void CalcNormalForces(
+      const Eigen::Ref<const VectorX<T>>& vn,
+      double dt,
+      EigenPtr<VectorX<T>> fn,
+      EigenPtr<VectorX<T>> dfn_dvn) const;
+
   // Helper to compute fₜ(vₜ) = −vₜ/‖vₜ‖ₛ μ(‖vₜ‖ₛ) fₙ, where ‖vₜ‖ₛ
   // is the "soft norm" of vₜ. In addition this method computes
   // v_slip = ‖vₜ‖ₛ, t_hat = vₜ/‖vₜ‖ₛ and mu_regularized = μ(‖vₜ‖ₛ).
@@ -1151,6 +1292,36 @@ class TamsiSolver {
       const Eigen::Ref<const VectorX<T>>& mu_vt, double dt,
       EigenPtr<MatrixX<T>> J) const;
 
+  // For problems with block-sparse Jacobians, the Newton-Raphson Jacobian
+  // can be written as a sum of contributions from each contact point (see
+  // tamsi_solver.cc), J = M + δt ∑ Jcᵀ Wc Jc. This computes into
+  // weighted_jacobian_blocks_ the product δt Wc Jc,b for each block b of Jc.
+  // The gradient of the normal forces is provided as dfn_dvn = dfₙ/dvₙ, see
+  // CalcNormalForces().
+  void CalcWeightedJacobianBlocks(
+      const Eigen::Ref<const VectorX<T>>& dfn_dvn,
+      const std::vector<Matrix2<T>>& dft_dvt,
+      const Eigen::Ref<const VectorX<T>>& t_hat,
+      const Eigen::Ref<const VectorX<T>>& mu_vt, double dt) const;
+
+  // Block-sparse version of CalcJacobian() for problems with block-sparse
+  // Jacobians, computing the dense Newton-Raphson Jacobian J from the blocks
+  // computed by CalcWeightedJacobianBlocks().
+  void CalcBlockSparseJacobian(EigenPtr<MatrixX<T>> J) const;
+
+  // For problems with block-sparse Jacobians and T = double, computes the
+  // Newton-Raphson update Delta_v = −J⁻¹ residual with J assembled into a
+  // sparse matrix from the blocks computed by CalcWeightedJacobianBlocks()
+  // and factorized by sparse_newton_solver_. Returns false if the
+  // factorization fails.
+  bool SolveWithSparseNewtonSolver(
+      const Eigen::Ref<const VectorX<T>>& residual,
+      VectorX<T>* Delta_v) const;
+
+  // Returns the number of symbolic analyses performed by
+  // sparse_newton_solver_, see TamsiSolverBlockSparseAttorney.
+  int num_sparse_symbolic_analyses() const;
+
   // Limit the per-iteration angle change between vₜᵏ⁺¹ and vₜᵏ for
   // all contact points. The angle change θ is defined by the dot product
   // between vₜᵏ⁺¹ and vₜᵏ as: cos(θ) = vₜᵏ⁺¹⋅vₜᵏ/(‖vₜᵏ⁺¹‖‖vₜᵏ‖).
@@ -1199,6 +1370,21 @@ class TamsiSolver {
   mutable FixedSizeWorkspace fixed_size_workspace_;
   mutable VariableSizeWorkspace variable_size_workspace_;
 
+  // The Jacobians and the diagonal blocks of M for each tree for problems set
+  // with block-sparse Jacobians, nullptr otherwise.
+  const internal::TamsiBlockSparseJacobians<T>* block_sparse_jacobians_{};
+  const std::vector<MatrixX<T>>* block_diagonal_M_{};
+  // Scratch for CalcWeightedJacobianBlocks() storing, for each block of
+  // block_sparse_jacobians_, its product with the 3x3 per contact point
+  // weighting.
+  mutable std::vector<std::vector<Matrix3X<T>>> weighted_jacobian_blocks_;
+  // The factorization of the Newton-Raphson Jacobian for problems with
+  // block-sparse Jacobians and T = double, created on first use. It persists
+  // across problems so that its symbolic analysis is reused for as long as
+  // the sparsity pattern (the pairs of trees coupled by a contact point) is
+  // unchanged.
+  std::unique_ptr<internal::TamsiSparseNewtonSolver> sparse_newton_solver_;
+
   // Precomputed value of cos(theta_max), used by TalsLimiter.
   double cos_theta_max_{std::cos(parameters_.theta_max)};
 
@@ -1207,11 +1393,72 @@ class TamsiSolver {
   mutable TamsiSolverIterationStats statistics_;
 };
 
+namespace internal {
+// Gives MultibodyPlant (and unit tests) access to the TamsiSolver problem
+// setters for block-sparse contact Jacobians.
+//
+// For systems with many trees of bodies (e.g. many objects in a bin) and a
+// large number of contact points, the Jacobians Jₙ and Jₜ are very sparse
+// and the dense products Jₙᵀ Gₙ, Jₜᵀ Gₜ in the Newton-Raphson Jacobian
+// dominate the cost of the solver. These setters take the Jacobians per
+// contact point and tree (see TamsiBlockSparseJacobians) and the mass matrix
+// M, which must be block diagonal, as its diagonal block for each tree. The
+// Newton-Raphson Jacobian is then assembled one contact point at a time, in
+// parallel when OpenMP is available. For T = double, it is assembled into a
+// sparse matrix factorized with a sparse LU factorization, for both the
+// one-way and the (non-symmetric) two-way coupled schemes. The symbolic
+// analysis of this factorization is reused for as long as the pairs of trees
+// coupled by a contact point are unchanged, both across Newton-Raphson
+// iterations and across problems set on the same solver.
+//
+// Other than M and the Jacobians, the problem data are as documented for
+// TamsiSolver::SetOneWayCoupledProblemData() and
+// TamsiSolver::SetTwoWayCoupledProblemData(). References to all data,
+// including `M` and `jacobians`, are stored.
+// @throws std::exception if M doesn't have one square diagonal block of the
+// size of each tree of `jacobians`.
+template <typename T>
+class TamsiSolverBlockSparseAttorney {
+ public:
+  TamsiSolverBlockSparseAttorney() = delete;
+
+  static void SetOneWayCoupledProblemData(
+      TamsiSolver<T>* solver, const std::vector<MatrixX<T>>* M,
+      const TamsiBlockSparseJacobians<T>* jacobians,
+      EigenPtr<const VectorX<T>> p_star, EigenPtr<const VectorX<T>> fn,
+      EigenPtr<const VectorX<T>> mu) {
+    DRAKE_DEMAND(solver != nullptr);
+    solver->SetBlockSparseOneWayCoupledProblemData(M, jacobians, p_star, fn,
+                                                   mu);
+  }
+
+  static void SetTwoWayCoupledProblemData(
+      TamsiSolver<T>* solver, const std::vector<MatrixX<T>>* M,
+      const TamsiBlockSparseJacobians<T>* jacobians,
+      EigenPtr<const VectorX<T>> p_star, EigenPtr<const VectorX<T>> fn0,
+      EigenPtr<const VectorX<T>> stiffness,
+      EigenPtr<const VectorX<T>> dissipation, EigenPtr<const VectorX<T>> mu) {
+    DRAKE_DEMAND(solver != nullptr);
+    solver->SetBlockSparseTwoWayCoupledProblemData(
+        M, jacobians, p_star, fn0, stiffness, dissipation, mu);
+  }
+
+  // Returns the number of symbolic analyses of the sparse Newton-Raphson
+  // Jacobian performed by `solver` so far. Always zero unless T = double.
+  static int num_symbolic_analyses(const TamsiSolver<T>& solver) {
+    return solver.num_sparse_symbolic_analyses();
+  }
+};
+}  // namespace internal
+
 }  // namespace multibody
 }  // namespace drake
 
 DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     struct ::drake::multibody::internal::TalsLimiter)
 
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::internal::TamsiBlockSparseJacobians)
+
 DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::multibody::TamsiSolver)
@@ -0,0 +1,148 @@
+#include "drake/multibody/plant/contact_jacobian_blocks.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+using Eigen::Matrix3Xd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using geometry::GeometryId;
+
+/* Verifies the Jacobian blocks against the dense Jacobians computed with
+ MultibodyTree::CalcJacobianTranslationalVelocity() for a model with a free
+ body, a two-link pendulum (a single tree), and a body welded to the world. */
+class ContactJacobianBlocksTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const SpatialInertia<double> M = SpatialInertia<double>::MakeUnitary();
+    const RigidBody<double>& free_body = plant_.AddRigidBody("free", M);
+    const RigidBody<double>& link1 = plant_.AddRigidBody("link1", M);
+    const RigidBody<double>& link2 = plant_.AddRigidBody("link2", M);
+    const RigidBody<double>& welded = plant_.AddRigidBody("welded", M);
+    plant_.AddJoint<RevoluteJoint>("joint1", plant_.world_body(),
+                                   math::RigidTransformd(Vector3d(0, 0, 1)),
+                                   link1, std::nullopt, Vector3d::UnitY());
+    plant_.AddJoint<RevoluteJoint>("joint2", link1,
+                                   math::RigidTransformd(Vector3d(0, 0, -0.5)),
+                                   link2, std::nullopt, Vector3d::UnitX());
+    plant_.WeldFrames(plant_.world_frame(), welded.body_frame(),
+                      math::RigidTransformd(Vector3d(1, 0, 0)));
+    plant_.Finalize();
+
+    // Made up geometry ids for each body.
+    const std::vector<const Body<double>*> bodies = {
+        &plant_.world_body(), &free_body, &link1, &link2, &welded};
+    for (const Body<double>* body : bodies) {
+      const GeometryId id = GeometryId::get_new_id();
+      geometry_id_to_body_index_[id] = body->index();
+      body_geometry_[body->name()] = id;
+    }
+
+    context_ = plant_.CreateDefaultContext();
+    plant_.SetPositions(context_.get(),
+                        VectorXd::LinSpaced(plant_.num_positions(), 0.1, 0.9));
+  }
+
+  DiscreteContactPair<double> MakePair(const std::string& body_A,
+                                       const std::string& body_B,
+                                       const Vector3d& p_WC) const {
+    DiscreteContactPair<double> pair;
+    pair.id_A = body_geometry_.at(body_A);
+    pair.id_B = body_geometry_.at(body_B);
+    pair.p_WC = p_WC;
+    pair.nhat_BA_W = Vector3d::UnitZ();
+    return pair;
+  }
+
+  /* Dense Jacobian J_AcBc_W for `pair`. */
+  Matrix3Xd CalcDenseJacobian(const DiscreteContactPair<double>& pair) const {
+    const MultibodyTree<double>& tree = GetInternalTree(plant_);
+    const Frame<double>& frame_W = plant_.world_frame();
+    Matrix3Xd Jv_WAc_W(3, plant_.num_velocities());
+    Matrix3Xd Jv_WBc_W(3, plant_.num_velocities());
+    tree.CalcJacobianTranslationalVelocity(
+        *context_, JacobianWrtVariable::kV,
+        plant_.get_body(geometry_id_to_body_index_.at(pair.id_A)).body_frame(),
+        frame_W, pair.p_WC, frame_W, frame_W, &Jv_WAc_W);
+    tree.CalcJacobianTranslationalVelocity(
+        *context_, JacobianWrtVariable::kV,
+        plant_.get_body(geometry_id_to_body_index_.at(pair.id_B)).body_frame(),
+        frame_W, pair.p_WC, frame_W, frame_W, &Jv_WBc_W);
+    return Jv_WBc_W - Jv_WAc_W;
+  }
+
+  MultibodyPlant<double> plant_{0.0};
+  std::unique_ptr<systems::Context<double>> context_;
+  std::unordered_map<GeometryId, BodyIndex> geometry_id_to_body_index_;
+  std::unordered_map<std::string, GeometryId> body_geometry_;
+};
+
+TEST_F(ContactJacobianBlocksTest, CompareWithDenseJacobians) {
+  const std::vector<DiscreteContactPair<double>> pairs = {
+      MakePair("free", "WorldBody", Vector3d(0.1, 0.2, 0.3)),
+      MakePair("WorldBody", "link2", Vector3d(-0.4, 0.5, 0.6)),
+      // Both bodies in the same tree.
+      MakePair("link1", "link2", Vector3d(0.7, -0.8, 0.9)),
+      // Bodies in different trees, in both orders.
+      MakePair("link2", "free", Vector3d(1.0, 1.1, -1.2)),
+      MakePair("free", "link1", Vector3d(1.3, 1.4, 1.5)),
+      // The welded body has no tree.
+      MakePair("welded", "free", Vector3d(1.6, -1.7, 1.8)),
+      // Many points between the same two bodies, as for the quadrature points
+      // of hydroelastic contact.
+      MakePair("free", "link2", Vector3d(0.0, 0.0, 0.0)),
+      MakePair("free", "link2", Vector3d(0.1, 0.0, 0.0)),
+      MakePair("free", "link2", Vector3d(0.0, 0.1, 0.0))};
+
+  const MultibodyTree<double>& tree = GetInternalTree(plant_);
+  const MultibodyTreeTopology& topology = tree.get_topology();
+  const std::vector<
+      std::vector<ContactPairKinematics<double>::JacobianTreeBlock>>
+      blocks = CalcContactJacobianTreeBlocks(
+          tree, *context_, geometry_id_to_body_index_, pairs);
+  ASSERT_EQ(blocks.size(), pairs.size());
+
+  const std::vector<int> expected_num_blocks = {1, 1, 1, 2, 2, 1, 2, 2, 2};
+  const TreeIndex free_tree =
+      topology.body_to_tree_index(plant_.GetBodyByName("free").index());
+  for (int i = 0; i < static_cast<int>(pairs.size()); ++i) {
+    SCOPED_TRACE(i);
+    ASSERT_EQ(blocks[i].size(), expected_num_blocks[i]);
+    // Bodies with a tree contribute blocks in the order of bodies A and B.
+    if (pairs[i].id_A == body_geometry_.at("free")) {
+      EXPECT_EQ(blocks[i][0].tree, free_tree);
+    }
+    Matrix3Xd J = Matrix3Xd::Zero(3, plant_.num_velocities());
+    for (const auto& block : blocks[i]) {
+      const int start = topology.tree_velocities_start(block.tree);
+      const int nt = topology.num_tree_velocities(block.tree);
+      ASSERT_EQ(block.J.cols(), nt);
+      J.middleCols(start, nt) += block.J;
+    }
+    EXPECT_TRUE(CompareMatrices(J, CalcDenseJacobian(pairs[i]), 1.0e-14));
+  }
+}
+
+TEST_F(ContactJacobianBlocksTest, NoContacts) {
+  EXPECT_TRUE(CalcContactJacobianTreeBlocks(GetInternalTree(plant_), *context_,
+                                            geometry_id_to_body_index_, {})
+                  .empty());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
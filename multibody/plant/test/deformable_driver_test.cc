@@ -31,6 +31,7 @@ class DeformableDriverTest : public ::testing::Test {
     std::tie(plant_, scene_graph_) =
         AddMultibodyPlantSceneGraph(&builder_, kDt);
     auto deformable_model = make_unique<DeformableModel<double>>(plant_);
+    deformable_model->SetLinearSolver(linear_solver());
     constexpr double kRezHint = 0.5;
     body_id_ = RegisterSphere(deformable_model.get(), kRezHint);
     model_ = deformable_model.get();
@@ -45,6 +46,11 @@ class DeformableDriverTest : public ::testing::Test {
     context_ = plant_->CreateDefaultContext();
   }
 
+  /* The linear solver the deformable model is configured with. */
+  virtual const char* linear_solver() const {
+    return "petsc_conjugate_gradient";
+  }
+
   /* Forwarding calls to private member functions in DeformableDriver with the
    same name.
    @{ */
@@ -67,6 +73,34 @@ class DeformableDriverTest : public ::testing::Test {
   }
   /* @} */
 
+  /* Expects the free motion state after one time step from rest in the
+   reference configuration to be a free fall. */
+  void ExpectFreeFall() const {
+    const VectorX<double> q = model_->GetReferencePositions(body_id_);
+    const int num_dofs = q.size();
+    const VectorX<double> v = VectorX<double>::Zero(num_dofs);
+    const VectorX<double> a = VectorX<double>::Zero(num_dofs);
+    const FemState<double>& free_motion_fem_state =
+        EvalFreeMotionFemState(*context_, DeformableBodyIndex(0));
+    const Vector3<double> kGravity(0, 0, -9.81);
+    VectorX<double> next_a = a;
+    for (int dof = 0; dof < num_dofs; dof += 3) {
+      next_a.segment<3>(dof) += kGravity;
+    }
+    // We use the clear-box knowledge that we use midpoint rule for time
+    // integration.
+    const VectorX<double> next_v = v + next_a * kDt;
+    const VectorX<double> next_q = q + 0.5 * (v + next_v) * kDt;
+    // Tolerance has unit of velocity.
+    const double kTol = 1e-4;
+    EXPECT_TRUE(CompareMatrices(free_motion_fem_state.GetPositions(), next_q,
+                                kTol * kDt));
+    EXPECT_TRUE(
+        CompareMatrices(free_motion_fem_state.GetVelocities(), next_v, kTol));
+    EXPECT_TRUE(CompareMatrices(free_motion_fem_state.GetAccelerations(),
+                                next_a, kTol / kDt));
+  }
+
   systems::DiagramBuilder<double> builder_;
   MultibodyPlant<double>* plant_{nullptr};
   SceneGraph<double>* scene_graph_{nullptr};
@@ -118,29 +152,22 @@ TEST_F(DeformableDriverTest, FemState) {
 }
 
 TEST_F(DeformableDriverTest, FreeMotionFemState) {
-  const VectorX<double> q = model_->GetReferencePositions(body_id_);
-  const int num_dofs = q.size();
-  const VectorX<double> v = VectorX<double>::Zero(num_dofs);
-  const VectorX<double> a = VectorX<double>::Zero(num_dofs);
-  const FemState<double>& free_motion_fem_state =
-      EvalFreeMotionFemState(*context_, DeformableBodyIndex(0));
-  const Vector3<double> kGravity(0, 0, -9.81);
-  VectorX<double> next_a = a;
-  for (int dof = 0; dof < num_dofs; dof += 3) {
-    next_a.segment<3>(dof) += kGravity;
+  ExpectFreeFall();
+}
+
+/* Runs the FEM solver with the native block sparse Cholesky solver selected on
+ the deformable model instead of the default PETSc solver. */
+class DeformableDriverCholeskyTest : public DeformableDriverTest {
+ protected:
+  const char* linear_solver() const override {
+    return "block_sparse_cholesky";
   }
-  // We use the clear-box knowledge that we use midpoint rule for time
-  // integration.
-  const VectorX<double> next_v = v + next_a * kDt;
-  const VectorX<double> next_q = q + 0.5 * (v + next_v) * kDt;
-  // Tolerance has unit of velocity.
-  const double kTol = 1e-4;
-  EXPECT_TRUE(CompareMatrices(free_motion_fem_state.GetPositions(), next_q,
-                              kTol * kDt));
-  EXPECT_TRUE(
-      CompareMatrices(free_motion_fem_state.GetVelocities(), next_v, kTol));
-  EXPECT_TRUE(CompareMatrices(free_motion_fem_state.GetAccelerations(), next_a,
-                              kTol / kDt));
+};
+
+TEST_F(DeformableDriverCholeskyTest, FreeMotionFemState) {
+  EXPECT_EQ(model_->linear_solver_type(),
+            DeformableModel<double>::LinearSolverType::kBlockSparseCholesky);
+  ExpectFreeFall();
 }
 
 TEST_F(DeformableDriverTest, NextFemState) {
@@ -150,6 +150,30 @@ TEST_F(DeformableModelTest, GetGeometryId) {
       "GetGeometryId.*No deformable body with id.*");
 }
 
+TEST_F(DeformableModelTest, LinearSolver) {
+  using LinearSolverType = DeformableModel<double>::LinearSolverType;
+  EXPECT_EQ(deformable_model_ptr_->linear_solver_type(),
+            LinearSolverType::kPetscConjugateGradient);
+  deformable_model_ptr_->SetLinearSolver("block_sparse_cholesky");
+  EXPECT_EQ(deformable_model_ptr_->linear_solver_type(),
+            LinearSolverType::kBlockSparseCholesky);
+  deformable_model_ptr_->SetLinearSolver(
+      "block_sparse_conjugate_gradient_block_jacobi");
+  EXPECT_EQ(deformable_model_ptr_->linear_solver_type(),
+            LinearSolverType::kBlockSparseConjugateGradientBlockJacobi);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      deformable_model_ptr_->SetLinearSolver("conjugate_gradient"),
+      "Unknown linear_solver: 'conjugate_gradient'");
+  EXPECT_EQ(deformable_model_ptr_->linear_solver_type(),
+            LinearSolverType::kBlockSparseConjugateGradientBlockJacobi);
+
+  plant_->Finalize();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      deformable_model_ptr_->SetLinearSolver("block_sparse_cholesky"),
+      ".*SetLinearSolver.*after system resources have been declared.*");
+}
+
 TEST_F(DeformableModelTest, ToPhysicalModelPointerVariant) {
   PhysicalModelPointerVariant<double> variant =
       deformable_model_ptr_->ToPhysicalModelPointerVariant();
@@ -646,6 +646,29 @@ TEST_P(MultibodyPlantHydroelasticTractionTests,
   EXPECT_NEAR(tau_Bo_Y[2], 0.0, tol());
 }
 
+// Tests that the quadrature point data is optional, and that skipping it
+// doesn't change the computed force.
+TEST_P(MultibodyPlantHydroelasticTractionTests, QuadraturePointDataIsOptional) {
+  const double dissipation = 1.0;  // Units: s/m.
+  const double mu_coulomb = 1.0;
+  const math::RotationMatrix<double>& R_WY = GetPose().rotation();
+  SetBoxTranslationalVelocity(R_WY * Vector3<double>(1, 0, -1));
+  UpdateCalculatorData();
+
+  std::vector<HydroelasticQuadraturePointData<double>> quadrature_point_data;
+  SpatialForce<double> F_Ac_W;
+  traction_calculator().ComputeSpatialForcesAtCentroidFromHydroelasticModel(
+      calculator_data(), dissipation, mu_coulomb, &quadrature_point_data,
+      &F_Ac_W);
+  EXPECT_FALSE(quadrature_point_data.empty());
+
+  SpatialForce<double> F_Ac_W_without_data;
+  traction_calculator().ComputeSpatialForcesAtCentroidFromHydroelasticModel(
+      calculator_data(), dissipation, mu_coulomb, nullptr,
+      &F_Ac_W_without_data);
+  EXPECT_EQ(F_Ac_W.get_coeffs(), F_Ac_W_without_data.get_coeffs());
+}
+
 // Friend class which provides access to HydroelasticTractionCalculator's
 // private method.
 class HydroelasticTractionCalculatorTester {
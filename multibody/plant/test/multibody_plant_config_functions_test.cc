@@ -19,6 +19,8 @@ GTEST_TEST(MultibodyPlantConfigFunctionsTest, BasicTest) {
   config.stiction_tolerance = 0.004;
   config.contact_model = "hydroelastic";
   config.contact_surface_representation = "polygon";
+  config.contact_results_reporting_level = "pair_summary";
+  config.use_block_sparse_tamsi = true;
 
   drake::systems::DiagramBuilder<double> builder;
   auto result = AddMultibodyPlant(config, &builder);
@@ -27,6 +29,9 @@ GTEST_TEST(MultibodyPlantConfigFunctionsTest, BasicTest) {
             ContactModel::kHydroelasticsOnly);
   EXPECT_EQ(result.plant.get_contact_surface_representation(),
             geometry::HydroelasticContactRepresentation::kPolygon);
+  EXPECT_EQ(result.plant.get_contact_results_reporting_level(),
+            ContactResultsReportingLevel::kPairSummary);
+  EXPECT_TRUE(result.plant.get_use_block_sparse_tamsi());
   // There is no getter for penetration_allowance nor stiction_tolerance, so we
   // can't test them.
 }
@@ -38,6 +43,8 @@ stiction_tolerance: 0.004
 contact_model: hydroelastic
 discrete_contact_solver: sap
 contact_surface_representation: triangle
+contact_results_reporting_level: net_forces
+use_block_sparse_tamsi: true
 )""";
 
 GTEST_TEST(MultibodyPlantConfigFunctionsTest, YamlTest) {
@@ -51,6 +58,9 @@ GTEST_TEST(MultibodyPlantConfigFunctionsTest, YamlTest) {
             geometry::HydroelasticContactRepresentation::kTriangle);
   EXPECT_EQ(result.plant.get_discrete_contact_solver(),
             DiscreteContactSolver::kSap);
+  EXPECT_EQ(result.plant.get_contact_results_reporting_level(),
+            ContactResultsReportingLevel::kNetForces);
+  EXPECT_TRUE(result.plant.get_use_block_sparse_tamsi());
   // There is no getter for penetration_allowance nor stiction_tolerance, so we
   // can't test them.
 }
@@ -89,6 +99,24 @@ GTEST_TEST(MultibodyPlantConfigFunctionsTest, ContactRepresentationTest) {
       ".*Unknown.*nonsense.*");
 }
 
+GTEST_TEST(MultibodyPlantConfigFunctionsTest, ContactResultsReportingTest) {
+  std::vector<std::pair<const char*, ContactResultsReportingLevel>>
+      known_values{
+    std::pair("net_forces", ContactResultsReportingLevel::kNetForces),
+    std::pair("pair_summary", ContactResultsReportingLevel::kPairSummary),
+    std::pair("full", ContactResultsReportingLevel::kFull),
+  };
+
+  for (const auto& [name, value] : known_values) {
+    EXPECT_EQ(GetContactResultsReportingLevelFromString(name), value);
+    EXPECT_EQ(GetStringFromContactResultsReportingLevel(value), name);
+  }
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      GetContactResultsReportingLevelFromString("nonsense"),
+      ".*Unknown.*nonsense.*");
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace multibody
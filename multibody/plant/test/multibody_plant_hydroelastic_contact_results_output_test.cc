@@ -18,7 +18,11 @@ namespace {
 
 class HydroelasticContactResultsOutputTester : public ::testing::Test {
  protected:
-  void SetUp() {
+  void SetUp() { BuildDiagram(ContactResultsReportingLevel::kFull); }
+
+  // Builds a diagram with the ball resting on the ground, reporting contact
+  // results with the given level of detail.
+  void BuildDiagram(ContactResultsReportingLevel level) {
     const double radius = 1.0;  // sphere radius (m).
 
     // The vertical location of the sphere. Since this value is smaller than the
@@ -47,6 +51,7 @@ class HydroelasticContactResultsOutputTester : public ::testing::Test {
             friction, gravity_W, false /* rigid_sphere */,
             false /* compliant_ground */, plant_);
     plant_->set_contact_model(ContactModel::kHydroelastic);
+    plant_->set_contact_results_reporting_level(level);
     plant_->Finalize();
 
     diagram_ = builder.Build();
@@ -217,6 +222,82 @@ TEST_F(HydroelasticContactResultsOutputTester, Traction) {
   }
 }
 
+// Checks that copies of the contact results share their contact surfaces. Only
+// the output port value, the first copy of the results aliased from the plant's
+// cache, clones them.
+TEST_F(HydroelasticContactResultsOutputTester, CopiesShareContactSurfaces) {
+  const ContactResults<double>& port_results =
+      plant_->get_contact_results_output_port().Eval<ContactResults<double>>(
+          *plant_context_);
+  const ContactResults<double> copy(port_results);
+  const ContactResults<double> copy_of_copy(copy);
+  ASSERT_EQ(copy_of_copy.num_hydroelastic_contacts(), 1);
+  EXPECT_EQ(&copy.hydroelastic_contact_info(0),
+            &copy_of_copy.hydroelastic_contact_info(0));
+  EXPECT_EQ(&copy.hydroelastic_contact_info(0).contact_surface(),
+            &port_results.hydroelastic_contact_info(0).contact_surface());
+  EXPECT_EQ(copy_of_copy.hydroelastic_contact_info(0).quadrature_point_data()
+                .size(),
+            port_results.hydroelastic_contact_info(0).quadrature_point_data()
+                .size());
+
+  // Copying HydroelasticContactInfo also shares the owned surface.
+  const HydroelasticContactInfo<double> info_copy(
+      copy.hydroelastic_contact_info(0));
+  EXPECT_EQ(&info_copy.contact_surface(),
+            &copy.hydroelastic_contact_info(0).contact_surface());
+}
+
+// Checks that the per-pair summary has the same forces as the full results,
+// without quadrature point data.
+TEST_F(HydroelasticContactResultsOutputTester, PairSummaryReporting) {
+  const SpatialForce<double> F_Ac_W_full = contact_results().F_Ac_W();
+  BuildDiagram(ContactResultsReportingLevel::kPairSummary);
+  const HydroelasticContactInfo<double>& summary = contact_results();
+  EXPECT_TRUE(summary.quadrature_point_data().empty());
+  EXPECT_GT(summary.contact_surface().num_faces(), 0);
+  EXPECT_TRUE(CompareMatrices(summary.F_Ac_W().get_coeffs(),
+                              F_Ac_W_full.get_coeffs()));
+}
+
+// Checks that the net forces level reports the spatial force at the centroid
+// shifted to the origin of the body with the smaller index.
+TEST_F(HydroelasticContactResultsOutputTester, NetForcesReporting) {
+  const HydroelasticContactInfo<double>& full = contact_results();
+  const std::vector<geometry::GeometryId> ball_collision_geometries =
+      plant_->GetCollisionGeometriesForBody(plant_->GetBodyByName("Ball"));
+  const bool body_A_is_ball =
+      std::find(ball_collision_geometries.begin(),
+                ball_collision_geometries.end(),
+                full.contact_surface().id_M()) !=
+      ball_collision_geometries.end();
+  // The world has the smallest index and the expected force is that on the
+  // world (the ground) at the world origin.
+  const SpatialForce<double> F_Ac_W =
+      body_A_is_ball ? -full.F_Ac_W() : full.F_Ac_W();
+  const SpatialForce<double> F_Wo_W_expected =
+      F_Ac_W.Shift(-full.contact_surface().centroid());
+
+  BuildDiagram(ContactResultsReportingLevel::kNetForces);
+  const ContactResults<double>& results =
+      plant_->get_contact_results_output_port().Eval<ContactResults<double>>(
+          *plant_context_);
+  EXPECT_EQ(results.num_hydroelastic_contacts(), 0);
+  ASSERT_EQ(results.num_hydroelastic_body_pair_forces(), 1);
+  const BodyPairSpatialForce<double>& net_force =
+      results.hydroelastic_body_pair_force(0);
+  EXPECT_EQ(net_force.bodyA_index, plant_->world_body().index());
+  EXPECT_EQ(net_force.bodyB_index, plant_->GetBodyByName("Ball").index());
+  const double tol = 10 * F_Ac_W.translational().norm() *
+                     std::numeric_limits<double>::epsilon();
+  EXPECT_TRUE(CompareMatrices(net_force.F_Ao_W.get_coeffs(),
+                              F_Wo_W_expected.get_coeffs(), tol));
+
+  // Copies keep the net forces.
+  const ContactResults<double> copy(results);
+  EXPECT_EQ(copy.num_hydroelastic_body_pair_forces(), 1);
+}
+
 // TODO(amcastro-tri): Replace this *suggestive* test with an alternative test
 //  that tests for actual derivative values. See the comments in PR 15219 for
 //  discussion:
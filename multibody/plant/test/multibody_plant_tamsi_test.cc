@@ -1,10 +1,13 @@
 #include <memory>
+#include <string>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
+#include "drake/geometry/shape_specification.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/parsing/parser.h"
@@ -70,6 +73,66 @@ GTEST_TEST(MbpWithTamsiSolver, FixedWorld) {
       diagram->CalcDiscreteVariableUpdates(*context, new_discrete_state.get()));
 }
 
+// Makes a discrete plant with a ground half-space and a few free spheres
+// resting on it, and returns the discrete update of its state at a state
+// where every sphere is in contact and sliding.
+VectorX<double> CalcSpheresOnGroundDiscreteUpdate(bool use_block_sparse_tamsi) {
+  systems::DiagramBuilder<double> builder;
+  auto items = AddMultibodyPlantSceneGraph(&builder, 1.0e-3);
+  MultibodyPlant<double>& plant = items.plant;
+  plant.set_contact_model(ContactModel::kPoint);
+  plant.set_use_block_sparse_tamsi(use_block_sparse_tamsi);
+  const CoulombFriction<double> friction(0.5, 0.5);
+  plant.RegisterCollisionGeometry(
+      plant.world_body(), RigidTransformd(), geometry::HalfSpace(), "ground",
+      friction);
+  const double radius = 0.05;
+  const double mass = 0.1;
+  const int kNumSpheres = 4;
+  for (int i = 0; i < kNumSpheres; ++i) {
+    const RigidBody<double>& sphere = plant.AddRigidBody(
+        "sphere" + std::to_string(i),
+        SpatialInertia<double>::MakeFromCentralInertia(
+            mass, Vector3d::Zero(),
+            mass * UnitInertia<double>::SolidSphere(radius)));
+    plant.RegisterCollisionGeometry(sphere, RigidTransformd(),
+                                    geometry::Sphere(radius), "collision",
+                                    friction);
+  }
+  plant.Finalize();
+  auto diagram = builder.Build();
+
+  auto context = diagram->CreateDefaultContext();
+  Context<double>& plant_context =
+      plant.GetMyMutableContextFromRoot(context.get());
+  for (int i = 0; i < kNumSpheres; ++i) {
+    const Body<double>& sphere =
+        plant.GetBodyByName("sphere" + std::to_string(i));
+    // Spheres slightly penetrating the ground, with different velocities.
+    plant.SetFreeBodyPose(
+        &plant_context, sphere,
+        RigidTransformd(Vector3d(0.2 * i, 0.0, 0.99 * radius)));
+    plant.SetFreeBodySpatialVelocity(
+        &plant_context, sphere,
+        SpatialVelocity<double>(Vector3d(0.0, 0.0, 0.1 * i),
+                                Vector3d(0.1 * i, -0.05, -0.01)));
+  }
+  auto discrete_state = diagram->AllocateDiscreteVariables();
+  diagram->CalcDiscreteVariableUpdates(*context, discrete_state.get());
+  return discrete_state->get_vector().CopyToVector();
+}
+
+// The block-sparse TAMSI problem data is opt-in, and it leads to the same
+// discrete update as the dense problem data.
+GTEST_TEST(MbpWithTamsiSolver, BlockSparseMatchesDense) {
+  EXPECT_FALSE(MultibodyPlant<double>(1.0e-3).get_use_block_sparse_tamsi());
+  const VectorX<double> x_dense = CalcSpheresOnGroundDiscreteUpdate(false);
+  const VectorX<double> x_sparse = CalcSpheresOnGroundDiscreteUpdate(true);
+  // Both take the same Newton-Raphson iterations, up to round-off in the
+  // linear solves, so they agree well within TAMSI's velocity tolerance.
+  EXPECT_TRUE(CompareMatrices(x_sparse, x_dense, 1.0e-8));
+}
+
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
@@ -1,6 +1,8 @@
 #include "drake/multibody/plant/tamsi_solver.h"
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -63,6 +65,36 @@ class TamsiSolverTester {
     return J;
   }
 
+  // Same as CalcJacobian(), for a solver set with block-sparse Jacobians.
+  static MatrixX<double> CalcBlockSparseJacobian(
+      const TamsiSolver<double>& solver,
+      const Eigen::Ref<const VectorX<double>>& v,
+      double dt) {
+    const int nv = solver.nv_;
+    DRAKE_DEMAND(solver.block_sparse_jacobians_ != nullptr);
+
+    auto vn = solver.variable_size_workspace_.mutable_vn();
+    auto vt = solver.variable_size_workspace_.mutable_vt();
+    auto fn = solver.variable_size_workspace_.mutable_fn();
+    auto ft = solver.variable_size_workspace_.mutable_ft();
+    auto dfn_dvn = solver.variable_size_workspace_.mutable_dfn_dvn();
+    auto mus = solver.variable_size_workspace_.mutable_mu();
+    auto t_hat = solver.variable_size_workspace_.mutable_t_hat();
+    auto v_slip = solver.variable_size_workspace_.mutable_v_slip();
+    std::vector<Matrix2<double>>& dft_dvt =
+        solver.variable_size_workspace_.mutable_dft_dvt();
+
+    solver.block_sparse_jacobians_->Multiply(v, &vn, &vt);
+    solver.CalcNormalForces(vn, dt, &fn, &dfn_dvn);
+    solver.CalcFrictionForces(vt, fn, &v_slip, &t_hat, &mus, &ft);
+    solver.CalcFrictionForcesGradient(fn, mus, t_hat, v_slip, &dft_dvt);
+
+    MatrixX<double> J(nv, nv);
+    solver.CalcWeightedJacobianBlocks(dfn_dvn, dft_dvt, t_hat, mus, dt);
+    solver.CalcBlockSparseJacobian(&J);
+    return J;
+  }
+
   /// Returns the size of TAMSI's workspace that was last allocated. It is
   /// measured as the number of contact points since the last call to either
   /// SetOneWayCoupledProblemData() or SetTwoWayCoupledProblemData.
@@ -1100,6 +1132,247 @@ TEST_F(RollingCylinder, SlidingAfterImpact) {
       J, J_expected, J_tolerance, MatrixCompareType::absolute));
 }
 
+/* A system of several trees (e.g. independent objects) with contact points
+between pairs of trees, used to verify that the solver produces the same
+results when the contact Jacobians are provided block-sparse. The problem data
+are arbitrary but deterministic, with a block diagonal mass matrix and a few
+non-zero blocks in each row of the contact Jacobians. The last tree has no
+contact points. */
+class MultipleTrees : public ::testing::Test {
+ public:
+  using Attorney = internal::TamsiSolverBlockSparseAttorney<double>;
+  using Block = internal::TamsiBlockSparseJacobians<double>::Block;
+
+  /* Sets up the problem with nc contact points, each involving
+  `trees_per_contact` trees. */
+  void SetUpProblem(int trees_per_contact) {
+    nv_ = 0;
+    for (int size : tree_sizes_) {
+      tree_starts_.push_back(nv_);
+      nv_ += size;
+    }
+    const int num_trees = tree_sizes_.size();
+
+    M_ = MatrixX<double>::Zero(nv_, nv_);
+    for (int t = 0; t < num_trees; ++t) {
+      const int size = tree_sizes_[t];
+      const MatrixX<double> A = MakeMatrix(size, size, t);
+      M_blocks_.push_back(A.transpose() * A +
+                          MatrixX<double>::Identity(size, size));
+      M_.block(tree_starts_[t], tree_starts_[t], size, size) = M_blocks_[t];
+    }
+
+    Jn_ = MatrixX<double>::Zero(nc_, nv_);
+    Jt_ = MatrixX<double>::Zero(2 * nc_, nv_);
+    std::vector<std::vector<Block>> contact_blocks(nc_);
+    for (int ic = 0; ic < nc_; ++ic) {
+      for (int k = 0; k < trees_per_contact; ++k) {
+        const int t = (ic + 2 * k) % (num_trees - 1);
+        const int size = tree_sizes_[t];
+        const MatrixX<double> Jc = MakeMatrix(3, size, ic + 7 * k);
+        Jn_.block(ic, tree_starts_[t], 1, size) = Jc.row(0);
+        Jt_.block(2 * ic, tree_starts_[t], 2, size) = Jc.bottomRows(2);
+        contact_blocks[ic].push_back(Block{t, Jc});
+      }
+    }
+    jacobians_ = std::make_unique<internal::TamsiBlockSparseJacobians<double>>(
+        tree_sizes_, std::move(contact_blocks));
+
+    const VectorX<double> v0 = MakeMatrix(nv_, 1, 3);
+    const VectorX<double> tau = 10.0 * MakeMatrix(nv_, 1, 5);
+    p_star_ = M_ * v0 + dt_ * tau;
+    mu_ = VectorX<double>::Constant(nc_, 0.5);
+    fn_ = VectorX<double>::LinSpaced(nc_, 1.0, 10.0);
+    stiffness_ = VectorX<double>::Constant(nc_, 1.0e5);
+    dissipation_ = VectorX<double>::Constant(nc_, 1.0);
+    fn0_ = stiffness_.cwiseProduct(VectorX<double>::LinSpaced(nc_, 0.0, 1e-4));
+  }
+
+  /* Returns a rows x cols matrix with arbitrary entries in [-1, 1]. */
+  static MatrixX<double> MakeMatrix(int rows, int cols, int seed) {
+    MatrixX<double> A(rows, cols);
+    for (int i = 0; i < rows; ++i) {
+      for (int j = 0; j < cols; ++j) {
+        A(i, j) = std::sin(1.0 + seed + 1.3 * i + 2.1 * j * (seed + 1));
+      }
+    }
+    return A;
+  }
+
+  /* Verifies that the solution of `sparse` matches that of `dense`. */
+  void VerifySameSolution(const TamsiSolver<double>& dense,
+                          const TamsiSolver<double>& sparse) {
+    const double kTolerance = 1.0e-10;
+    EXPECT_EQ(sparse.get_iteration_statistics().num_iterations,
+              dense.get_iteration_statistics().num_iterations);
+    EXPECT_TRUE(CompareMatrices(sparse.get_generalized_velocities(),
+                                dense.get_generalized_velocities(), kTolerance,
+                                MatrixCompareType::relative));
+    EXPECT_TRUE(CompareMatrices(sparse.get_normal_velocities(),
+                                dense.get_normal_velocities(), kTolerance,
+                                MatrixCompareType::relative));
+    EXPECT_TRUE(CompareMatrices(sparse.get_tangential_velocities(),
+                                dense.get_tangential_velocities(), kTolerance,
+                                MatrixCompareType::relative));
+    EXPECT_TRUE(CompareMatrices(sparse.get_normal_forces(),
+                                dense.get_normal_forces(), kTolerance,
+                                MatrixCompareType::relative));
+    EXPECT_TRUE(CompareMatrices(sparse.get_friction_forces(),
+                                dense.get_friction_forces(), kTolerance,
+                                MatrixCompareType::relative));
+    EXPECT_TRUE(CompareMatrices(sparse.get_generalized_friction_forces(),
+                                dense.get_generalized_friction_forces(),
+                                kTolerance, MatrixCompareType::relative));
+    EXPECT_TRUE(CompareMatrices(sparse.get_generalized_contact_forces(),
+                                dense.get_generalized_contact_forces(),
+                                kTolerance, MatrixCompareType::relative));
+  }
+
+  void SolveOneWayCoupledProblem(int trees_per_contact) {
+    SetUpProblem(trees_per_contact);
+    TamsiSolver<double> dense(nv_);
+    TamsiSolver<double> sparse(nv_);
+    dense.SetOneWayCoupledProblemData(&M_, &Jn_, &Jt_, &p_star_, &fn_, &mu_);
+    Attorney::SetOneWayCoupledProblemData(&sparse, &M_blocks_,
+                                          jacobians_.get(), &p_star_, &fn_,
+                                          &mu_);
+    const VectorX<double> v_guess = VectorX<double>::Zero(nv_);
+    ASSERT_EQ(dense.SolveWithGuess(dt_, v_guess), TamsiSolverResult::kSuccess);
+    ASSERT_EQ(sparse.SolveWithGuess(dt_, v_guess),
+              TamsiSolverResult::kSuccess);
+    VerifySameSolution(dense, sparse);
+  }
+
+  void SolveTwoWayCoupledProblem(int trees_per_contact) {
+    SetUpProblem(trees_per_contact);
+    TamsiSolver<double> dense(nv_);
+    TamsiSolver<double> sparse(nv_);
+    dense.SetTwoWayCoupledProblemData(&M_, &Jn_, &Jt_, &p_star_, &fn0_,
+                                      &stiffness_, &dissipation_, &mu_);
+    Attorney::SetTwoWayCoupledProblemData(
+        &sparse, &M_blocks_, jacobians_.get(), &p_star_, &fn0_, &stiffness_,
+        &dissipation_, &mu_);
+    const VectorX<double> v_guess = VectorX<double>::Zero(nv_);
+    ASSERT_EQ(dense.SolveWithGuess(dt_, v_guess), TamsiSolverResult::kSuccess);
+    ASSERT_EQ(sparse.SolveWithGuess(dt_, v_guess),
+              TamsiSolverResult::kSuccess);
+    VerifySameSolution(dense, sparse);
+  }
+
+ protected:
+  const std::vector<int> tree_sizes_{3, 6, 2, 6, 1, 4};
+  std::vector<int> tree_starts_;
+  const int nc_{12};
+  const double dt_{1.0e-3};
+  int nv_{0};
+
+  MatrixX<double> M_;
+  MatrixX<double> Jn_;
+  MatrixX<double> Jt_;
+  std::vector<MatrixX<double>> M_blocks_;
+  std::unique_ptr<internal::TamsiBlockSparseJacobians<double>> jacobians_;
+  VectorX<double> p_star_;
+  VectorX<double> mu_;
+  VectorX<double> fn_;
+  VectorX<double> fn0_;
+  VectorX<double> stiffness_;
+  VectorX<double> dissipation_;
+};
+
+TEST_F(MultipleTrees, OneWayCoupled) {
+  SolveOneWayCoupledProblem(2);
+}
+
+TEST_F(MultipleTrees, OneWayCoupledWithThreeTreesPerContact) {
+  SolveOneWayCoupledProblem(3);
+}
+
+TEST_F(MultipleTrees, TwoWayCoupled) {
+  SolveTwoWayCoupledProblem(2);
+}
+
+TEST_F(MultipleTrees, TwoWayCoupledWithThreeTreesPerContact) {
+  SolveTwoWayCoupledProblem(3);
+}
+
+/* Verifies the Newton-Raphson Jacobian assembled from the blocks against the
+dense computation, for a velocity such that contact points are in stiction,
+sliding, in and out of contact. */
+TEST_F(MultipleTrees, NewtonRaphsonJacobian) {
+  SetUpProblem(2);
+  TamsiSolver<double> dense(nv_);
+  TamsiSolver<double> sparse(nv_);
+  TamsiSolverParameters parameters;
+  parameters.stiction_tolerance = 0.1;
+  dense.set_solver_parameters(parameters);
+  sparse.set_solver_parameters(parameters);
+  dense.SetTwoWayCoupledProblemData(&M_, &Jn_, &Jt_, &p_star_, &fn0_,
+                                    &stiffness_, &dissipation_, &mu_);
+  Attorney::SetTwoWayCoupledProblemData(&sparse, &M_blocks_, jacobians_.get(),
+                                        &p_star_, &fn0_, &stiffness_,
+                                        &dissipation_, &mu_);
+  const VectorX<double> v = 0.2 * MakeMatrix(nv_, 1, 11);
+  const MatrixX<double> J_expected =
+      TamsiSolverTester::CalcJacobian(dense, v, dt_);
+  const MatrixX<double> J =
+      TamsiSolverTester::CalcBlockSparseJacobian(sparse, v, dt_);
+  EXPECT_TRUE(CompareMatrices(
+      J, J_expected,
+      J_expected.norm() * 10 * std::numeric_limits<double>::epsilon(),
+      MatrixCompareType::absolute));
+}
+
+/* The symbolic analysis of the sparse Newton-Raphson Jacobian is reused across
+problems for as long as the pairs of trees coupled by a contact point don't
+change. */
+TEST_F(MultipleTrees, SymbolicAnalysisIsReused) {
+  SetUpProblem(2);
+  TamsiSolver<double> solver(nv_);
+  const VectorX<double> v_guess = VectorX<double>::Zero(nv_);
+  EXPECT_EQ(Attorney::num_symbolic_analyses(solver), 0);
+  Attorney::SetTwoWayCoupledProblemData(&solver, &M_blocks_, jacobians_.get(),
+                                        &p_star_, &fn0_, &stiffness_,
+                                        &dissipation_, &mu_);
+  ASSERT_EQ(solver.SolveWithGuess(dt_, v_guess), TamsiSolverResult::kSuccess);
+  ASSERT_GT(solver.get_iteration_statistics().num_iterations, 1);
+  EXPECT_EQ(Attorney::num_symbolic_analyses(solver), 1);
+
+  // New problem data with the same pattern, e.g. the next time step.
+  const VectorX<double> p_star = 2.0 * p_star_;
+  Attorney::SetTwoWayCoupledProblemData(&solver, &M_blocks_, jacobians_.get(),
+                                        &p_star, &fn0_, &stiffness_,
+                                        &dissipation_, &mu_);
+  ASSERT_EQ(solver.SolveWithGuess(dt_, v_guess), TamsiSolverResult::kSuccess);
+  EXPECT_EQ(Attorney::num_symbolic_analyses(solver), 1);
+
+  // A new pair of coupled trees changes the pattern.
+  std::vector<std::vector<Block>> contact_blocks;
+  for (int ic = 0; ic < nc_; ++ic) {
+    contact_blocks.push_back(jacobians_->contact_blocks(ic));
+  }
+  const int last_tree = tree_sizes_.size() - 1;
+  contact_blocks[0].push_back(
+      Block{last_tree, MakeMatrix(3, tree_sizes_[last_tree], 13)});
+  const internal::TamsiBlockSparseJacobians<double> new_jacobians(
+      tree_sizes_, std::move(contact_blocks));
+  Attorney::SetTwoWayCoupledProblemData(&solver, &M_blocks_, &new_jacobians,
+                                        &p_star_, &fn0_, &stiffness_,
+                                        &dissipation_, &mu_);
+  ASSERT_EQ(solver.SolveWithGuess(dt_, v_guess), TamsiSolverResult::kSuccess);
+  EXPECT_EQ(Attorney::num_symbolic_analyses(solver), 2);
+}
+
+TEST_F(MultipleTrees, MassMatrixBlocksMustMatchTrees) {
+  SetUpProblem(2);
+  M_blocks_[0] = MatrixX<double>::Identity(tree_sizes_[0] + 1,
+                                           tree_sizes_[0] + 1);
+  TamsiSolver<double> solver(nv_);
+  EXPECT_THROW(Attorney::SetOneWayCoupledProblemData(
+                   &solver, &M_blocks_, jacobians_.get(), &p_star_, &fn_,
+                   &mu_),
+               std::exception);
+}
+
 GTEST_TEST(EmptyWorld, Solve) {
   const int nv = 0;
   TamsiSolver<double> solver{nv};
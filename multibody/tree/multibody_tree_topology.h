@@ -22,6 +22,7 @@
 ///   topology can be validated against the stored topology in debug builds.
 
 #include <algorithm>
+#include <initializer_list>
 #include <set>
 #include <stack>
 #include <string>
@@ -1094,8 +1095,13 @@ class MultibodyTreeTopology {
   // connecting the frames with indexes `frame` and `frame2`.
   bool IsThereAMobilizerBetweenFrames(
       FrameIndex frame1, FrameIndex frame2) const {
-    for (const auto& mobilizer_topology : mobilizers_) {
-      if (mobilizer_topology.connects_frames(frame1, frame2)) return true;
+    // Such a mobilizer connects the frames' bodies; see below.
+    for (BodyIndex body : {frames_[frame1].body, frames_[frame2].body}) {
+      const MobilizerIndex mobilizer = bodies_[body].inboard_mobilizer;
+      if (mobilizer.is_valid() &&
+          mobilizers_[mobilizer].connects_frames(frame1, frame2)) {
+        return true;
+      }
     }
     return false;
   }
@@ -1104,8 +1110,15 @@ class MultibodyTreeTopology {
   // connecting the bodies with indexes `body2` and `body2`.
   bool IsThereAMobilizerBetweenBodies(
       BodyIndex body1, BodyIndex body2) const {
-    for (const auto& mobilizer_topology : mobilizers_) {
-      if (mobilizer_topology.connects_bodies(body1, body2)) return true;
+    // Every mobilizer is the inboard mobilizer of its outboard body, so only
+    // the inboard mobilizers of the two bodies need to be checked (rather than
+    // all of them, which made adding mobilizers quadratic in their number).
+    for (BodyIndex body : {body1, body2}) {
+      const MobilizerIndex mobilizer = bodies_[body].inboard_mobilizer;
+      if (mobilizer.is_valid() &&
+          mobilizers_[mobilizer].connects_bodies(body1, body2)) {
+        return true;
+      }
     }
     return false;
   }
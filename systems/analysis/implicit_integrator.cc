@@ -1,11 +1,21 @@
 #include "drake/systems/analysis/implicit_integrator.h"
 
+#include <algorithm>
 #include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
 #include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
+#include "drake/common/timer.h"
 #include "drake/math/autodiff_gradient.h"
 
 namespace drake {
@@ -16,12 +26,15 @@ void ImplicitIntegrator<T>::DoResetStatistics() {
   num_iter_factorizations_ = 0;
   num_jacobian_function_evaluations_ = 0;
   num_jacobian_evaluations_ = 0;
+  jacobian_computation_time_ = 0.0;
   DoResetImplicitIntegratorStatistics();
 }
 
 template <class T>
 void ImplicitIntegrator<T>::DoReset() {
   J_.resize(0, 0);
+  // A detected sparsity pattern is detected anew.
+  if (!jacobian_sparsity_given_) jacobian_sparsity_.reset();
   DoResetCachedJacobianRelatedMatrices();
   // Call any Reset() provided by child integrator classes.
   DoImplicitIntegratorReset();
@@ -73,9 +86,113 @@ void ImplicitIntegrator<T>::ComputeAutoDiffJacobian(
 }
 
 template <class T>
-void ImplicitIntegrator<T>::ComputeForwardDiffJacobian(
-    const System<T>&, const T& t, const VectorX<T>& xt, Context<T>* context,
+void ImplicitIntegrator<T>::ComputeColoredAutoDiffJacobian(
+    const System<T>& system, const T& t, const VectorX<T>& xt,
+    const internal::JacobianSparsity& sparsity, const Context<T>& context,
     MatrixX<T>* J) {
+  DRAKE_LOGGER_DEBUG(
+      "  ImplicitIntegrator Compute colored Autodiff {}-Jacobian with {} "
+      "colors t={}", xt.size(), sparsity.num_colors(), t);
+
+  // Seed one derivative per color: the gradient of each derivative is then
+  // the sum of the columns of one color of the Jacobian.
+  VectorX<AutoDiffXd> a_xt;
+  math::InitializeAutoDiff(xt, sparsity.MakeSeedMatrix(), &a_xt);
+
+  // See ComputeAutoDiffJacobian().
+  const auto adiff_system = system.ToAutoDiffXd();
+  std::unique_ptr<Context<AutoDiffXd>> adiff_context = adiff_system->
+      AllocateContext();
+  adiff_context->SetTimeStateAndParametersFrom(context);
+  adiff_system->FixInputPortsFrom(system, context, adiff_context.get());
+  adiff_context->SetTime(t);
+  adiff_context->SetContinuousState(a_xt);
+  const VectorX<AutoDiffXd> result =
+      this->EvalTimeDerivatives(*adiff_system, *adiff_context).CopyToVector();
+
+  // The derivatives are empty if they don't depend on the state.
+  MatrixX<T> compressed = math::ExtractGradient(result);
+  if (compressed.cols() == 0) {
+    compressed = MatrixX<T>::Zero(xt.size(), sparsity.num_colors());
+  }
+  sparsity.Decompress(compressed, J);
+}
+
+template <class T>
+void ImplicitIntegrator<T>::ComputeColoredDiffJacobian(
+    const T& t, const VectorX<T>& xt,
+    const internal::JacobianSparsity& sparsity, bool central_difference,
+    Context<T>* context, MatrixX<T>* J) {
+  // Use the same increments as ComputeForwardDiffJacobian() and
+  // ComputeCentralDiffJacobian().
+  const double eps =
+      central_difference
+          ? std::pow(std::numeric_limits<double>::epsilon(), 5.0 / 12)
+          : std::sqrt(std::numeric_limits<double>::epsilon());
+
+  DRAKE_LOGGER_DEBUG(
+      "  ImplicitIntegrator Compute colored {}diff {}-Jacobian with {} "
+      "colors t={}", central_difference ? "Central" : "Forward", xt.size(),
+      sparsity.num_colors(), t);
+
+  context->SetTimeAndContinuousState(t, xt);
+  const std::function<void(const VectorX<T>&, VectorX<T>*)> calc_f =
+      [this, context](const VectorX<T>& x, VectorX<T>* f) {
+        context->SetContinuousState(x);
+        *f = this->EvalTimeDerivatives(*context).CopyToVector();
+      };
+  internal::ComputeColoredNumericalJacobian(sparsity, calc_f, xt,
+                                            central_difference, eps, J);
+}
+
+template <class T>
+void ImplicitIntegrator<T>::ForEachJacobianColumn(int n,
+    int evaluations_per_column, const VectorX<T>& xt, Context<T>* context,
+    const std::function<void(int, Context<T>*, VectorX<T>*)>& calc_column) {
+#if defined(_OPENMP)
+  const int num_threads = std::min(num_jacobian_threads_, n);
+#else
+  const int num_threads = 1;
+#endif
+  if (num_threads <= 1) {
+    VectorX<T> xt_prime = xt;
+    for (int i = 0; i < n; ++i) calc_column(i, context, &xt_prime);
+    return;
+  }
+
+  DRAKE_LOGGER_DEBUG(
+      "  ImplicitIntegrator computing {} Jacobian columns on {} threads", n,
+      num_threads);
+
+  // Each thread works through its own clone of the context, so that its
+  // perturbations of the state don't disturb the others.
+  std::vector<std::unique_ptr<Context<T>>> contexts(num_threads);
+  for (int k = 0; k < num_threads; ++k) contexts[k] = context->Clone();
+
+  // Range k is computed through contexts[k], on whichever thread picks it up.
+  drake::internal::ParallelForOptions parallel_options;
+  parallel_options.num_threads = num_threads;
+  drake::internal::ParallelFor(num_threads, [&](int k) {
+    const int begin = static_cast<int>(static_cast<int64_t>(n) * k /
+                                       num_threads);
+    const int end = static_cast<int>(static_cast<int64_t>(n) * (k + 1) /
+                                     num_threads);
+    VectorX<T> xt_prime = xt;
+    for (int i = begin; i < end; ++i) {
+      calc_column(i, contexts[k].get(), &xt_prime);
+    }
+  }, parallel_options);
+
+  // The clones' evaluations weren't counted. Each perturbs the state, so none
+  // is served from the cache.
+  this->add_derivative_evaluations(
+      static_cast<double>(evaluations_per_column) * n);
+}
+
+template <class T>
+void ImplicitIntegrator<T>::ComputeForwardDiffJacobian(
+    const System<T>& system, const T& t, const VectorX<T>& xt,
+    Context<T>* context, MatrixX<T>* J) {
   using std::abs;
 
   // Set epsilon to the square root of machine precision.
@@ -96,9 +213,18 @@ void ImplicitIntegrator<T>::ComputeForwardDiffJacobian(
   context->SetTimeAndContinuousState(t, xt);
   const VectorX<T> f = this->EvalTimeDerivatives(*context).CopyToVector();
 
+  // Evaluates the derivatives, updating the statistics only when using the
+  // integrator's own context (see ForEachJacobianColumn()).
+  const auto eval_derivatives = [this, &system, context](
+      const Context<T>& column_context) -> const ContinuousState<T>& {
+    return &column_context == context
+               ? this->EvalTimeDerivatives(column_context)
+               : system.EvalTimeDerivatives(column_context);
+  };
+
   // Compute the Jacobian.
-  VectorX<T> xt_prime = xt;
-  for (int i = 0; i < n; ++i) {
+  const auto calc_column = [&](int i, Context<T>* column_context,
+                               VectorX<T>* xt_prime) {
     // Compute a good increment to the dimension using approximately 1/eps
     // digits of precision. Note that if |xt| is large, the increment will
     // be large as well. If |xt| is small, the increment will be no smaller
@@ -117,25 +243,27 @@ void ImplicitIntegrator<T>::ComputeForwardDiffJacobian(
     // x and dx differ by an exactly representable number. See p. 192 of
     // Press, W., Teukolsky, S., Vetterling, W., and Flannery, P. Numerical
     //   Recipes in C++, 2nd Ed., Cambridge University Press, 2002.
-    xt_prime(i) = xt(i) + dxi;
-    dxi = xt_prime(i) - xt(i);
+    (*xt_prime)(i) = xt(i) + dxi;
+    dxi = (*xt_prime)(i) - xt(i);
 
     // TODO(sherm1) This is invalidating q, v, and z but we only changed one.
     //              Switch to a method that invalides just the relevant
     //              partition, and ideally modify only the one changed element.
     // Compute f' and set the relevant column of the Jacobian matrix.
-    context->SetTimeAndContinuousState(t, xt_prime);
-    J->col(i) = (this->EvalTimeDerivatives(*context).CopyToVector() - f) / dxi;
+    column_context->SetTimeAndContinuousState(t, *xt_prime);
+    J->col(i) =
+        (eval_derivatives(*column_context).CopyToVector() - f) / dxi;
 
     // Reset xt' to xt.
-    xt_prime(i) = xt(i);
-  }
+    (*xt_prime)(i) = xt(i);
+  };
+  ForEachJacobianColumn(n, 1, xt, context, calc_column);
 }
 
 template <class T>
 void ImplicitIntegrator<T>::ComputeCentralDiffJacobian(
-    const System<T>&, const T& t, const VectorX<T>& xt, Context<T>* context,
-    MatrixX<T>* J) {
+    const System<T>& system, const T& t, const VectorX<T>& xt,
+    Context<T>* context, MatrixX<T>* J) {
   using std::abs;
 
   // Cube root of machine precision (indicated by theory) seems a bit coarse.
@@ -155,9 +283,18 @@ void ImplicitIntegrator<T>::ComputeCentralDiffJacobian(
   context->SetTimeAndContinuousState(t, xt);
   const VectorX<T> f = this->EvalTimeDerivatives(*context).CopyToVector();
 
+  // Evaluates the derivatives, updating the statistics only when using the
+  // integrator's own context (see ForEachJacobianColumn()).
+  const auto eval_derivatives = [this, &system, context](
+      const Context<T>& column_context) -> const ContinuousState<T>& {
+    return &column_context == context
+               ? this->EvalTimeDerivatives(column_context)
+               : system.EvalTimeDerivatives(column_context);
+  };
+
   // Compute the Jacobian.
-  VectorX<T> xt_prime = xt;
-  for (int i = 0; i < n; ++i) {
+  const auto calc_column = [&](int i, Context<T>* column_context,
+                               VectorX<T>* xt_prime) {
     // Compute a good increment to the dimension using approximately 1/eps
     // digits of precision. Note that if |xt| is large, the increment will
     // be large as well. If |xt| is small, the increment will be no smaller
@@ -176,43 +313,94 @@ void ImplicitIntegrator<T>::ComputeCentralDiffJacobian(
     // x and dx differ by an exactly representable number. See p. 192 of
     // Press, W., Teukolsky, S., Vetterling, W., and Flannery, P. Numerical
     //   Recipes in C++, 2nd Ed., Cambridge University Press, 2002.
-    xt_prime(i) = xt(i) + dxi;
-    const T dxi_plus = xt_prime(i) - xt(i);
+    (*xt_prime)(i) = xt(i) + dxi;
+    const T dxi_plus = (*xt_prime)(i) - xt(i);
 
     // TODO(sherm1) This is invalidating q, v, and z but we only changed one.
     //              Switch to a method that invalides just the relevant
     //              partition, and ideally modify only the one changed element.
     // Compute f(x+dx).
-    context->SetContinuousState(xt_prime);
-    VectorX<T> fprime_plus = this->EvalTimeDerivatives(*context).CopyToVector();
+    column_context->SetContinuousState(*xt_prime);
+    VectorX<T> fprime_plus =
+        eval_derivatives(*column_context).CopyToVector();
 
     // Update xt' again, minimizing the effect of roundoff error.
-    xt_prime(i) = xt(i) - dxi;
-    const T dxi_minus = xt(i) - xt_prime(i);
+    (*xt_prime)(i) = xt(i) - dxi;
+    const T dxi_minus = xt(i) - (*xt_prime)(i);
 
     // Compute f(x-dx).
-    context->SetContinuousState(xt_prime);
-    VectorX<T> fprime_minus = this->EvalTimeDerivatives(
-        *context).CopyToVector();
+    column_context->SetContinuousState(*xt_prime);
+    VectorX<T> fprime_minus =
+        eval_derivatives(*column_context).CopyToVector();
 
     // Set the Jacobian column.
     J->col(i) = (fprime_plus - fprime_minus) / (dxi_plus + dxi_minus);
 
     // Reset xt' to xt.
-    xt_prime(i) = xt(i);
-  }
+    (*xt_prime)(i) = xt(i);
+  };
+  ForEachJacobianColumn(n, 2, xt, context, calc_column);
 }
 
 template <class T>
 void ImplicitIntegrator<T>::IterationMatrix::SetAndFactorIterationMatrix(
     const MatrixX<T>& iteration_matrix) {
+  if (use_sparse_factorization_) {
+    SetAndFactorIterationMatrix(
+        Eigen::SparseMatrix<double>(iteration_matrix.sparseView()));
+    return;
+  }
   LU_.compute(iteration_matrix);
+  sparse_factored_ = false;
+  matrix_factored_ = true;
+}
+
+template <class T>
+void ImplicitIntegrator<T>::IterationMatrix::SetAndFactorIterationMatrix(
+    const Eigen::SparseMatrix<double>& iteration_matrix) {
+  Eigen::SparseMatrix<double> matrix = iteration_matrix;
+  matrix.makeCompressed();
+
+  // The symbolic analysis (which chooses the ordering that limits fill-in) is
+  // only needed when the pattern changes; the Jacobian's pattern doesn't, so
+  // that's usually only once.
+  if (sparse_LU_ == nullptr) {
+    sparse_LU_ =
+        std::make_unique<Eigen::SparseLU<Eigen::SparseMatrix<double>>>();
+  }
+  const bool same_pattern =
+      num_symbolic_factorizations_ > 0 &&
+      matrix.rows() == sparse_matrix_.rows() &&
+      matrix.cols() == sparse_matrix_.cols() &&
+      matrix.nonZeros() == sparse_matrix_.nonZeros() &&
+      std::equal(matrix.outerIndexPtr(),
+                 matrix.outerIndexPtr() + matrix.outerSize() + 1,
+                 sparse_matrix_.outerIndexPtr()) &&
+      std::equal(matrix.innerIndexPtr(),
+                 matrix.innerIndexPtr() + matrix.nonZeros(),
+                 sparse_matrix_.innerIndexPtr());
+  sparse_matrix_ = std::move(matrix);
+  if (!same_pattern) {
+    sparse_LU_->analyzePattern(sparse_matrix_);
+    ++num_symbolic_factorizations_;
+  }
+  sparse_LU_->factorize(sparse_matrix_);
+  if (sparse_LU_->info() == Eigen::Success) {
+    sparse_factored_ = true;
+  } else {
+    // The matrix is singular (to working precision). Fall back to the dense
+    // factorization, leaving the Newton-Raphson process to reject its
+    // solution just as it would without sparsity.
+    LU_.compute(MatrixX<double>(sparse_matrix_));
+    sparse_factored_ = false;
+  }
   matrix_factored_ = true;
 }
 
 template <class T>
 VectorX<T> ImplicitIntegrator<T>::IterationMatrix::Solve(
     const VectorX<T>& b) const {
+  if (sparse_factored_) return sparse_LU_->solve(b);
   return LU_.solve(b);
 }
 
@@ -286,6 +474,9 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
   const VectorX<T> x_current = context->get_continuous_state_vector().
       CopyToVector();
 
+  // Time the computation, for the statistics.
+  SteadyTimer timer;
+
   // Update the time and state.
   context->SetTimeAndContinuousState(t, x);
   num_jacobian_evaluations_++;
@@ -296,23 +487,53 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
   // Get a the system.
   const System<T>& system = this->get_system();
 
+  // In sparse mode, use the sparsity pattern once there is one.
+  const internal::JacobianSparsity* sparsity =
+      use_sparse_jacobian_ && jacobian_sparsity_.has_value()
+          ? &*jacobian_sparsity_
+          : nullptr;
+  if (sparsity != nullptr && sparsity->size() != x.size()) {
+    throw std::logic_error(fmt::format(
+        "The Jacobian sparsity pattern is {0}x{0}, but the system has {1} "
+        "continuous state variables.", sparsity->size(), x.size()));
+  }
+
   // TODO(edrumwri): Give the caller the option to provide their own Jacobian.
-  [this, context, &system, &t, &x]() {
+  [this, context, &system, &t, &x, sparsity]() {
     switch (jacobian_scheme_) {
       case JacobianComputationScheme::kForwardDifference:
-        ComputeForwardDiffJacobian(system, t, x, &*context, &J_);
+        if (sparsity != nullptr) {
+          ComputeColoredDiffJacobian(t, x, *sparsity, false, &*context, &J_);
+        } else {
+          ComputeForwardDiffJacobian(system, t, x, &*context, &J_);
+        }
         break;
 
       case JacobianComputationScheme::kCentralDifference:
-        ComputeCentralDiffJacobian(system, t, x, &*context, &J_);
+        if (sparsity != nullptr) {
+          ComputeColoredDiffJacobian(t, x, *sparsity, true, &*context, &J_);
+        } else {
+          ComputeCentralDiffJacobian(system, t, x, &*context, &J_);
+        }
         break;
 
       case JacobianComputationScheme::kAutomatic:
-        ComputeAutoDiffJacobian(system, t, x, *context, &J_);
+        if (sparsity != nullptr) {
+          ComputeColoredAutoDiffJacobian(system, t, x, *sparsity, *context,
+                                         &J_);
+        } else {
+          ComputeAutoDiffJacobian(system, t, x, *context, &J_);
+        }
         break;
     }
   }();
 
+  // In sparse mode without a pattern, detect the pattern from this (dense)
+  // Jacobian.
+  if (use_sparse_jacobian_ && !jacobian_sparsity_.has_value()) {
+    jacobian_sparsity_ = internal::JacobianSparsity::FromDenseMatrix(J_);
+  }
+
   // Use the new number of ODE evaluations to determine the number of Jacobian
   // evaluations.
   num_jacobian_function_evaluations_ += this->get_num_derivative_evaluations()
@@ -320,6 +541,7 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
 
   // Reset the time and state.
   context->SetTimeAndContinuousState(t_current, x_current);
+  jacobian_computation_time_ += timer.Tick();
 
   // Mark the Jacobian as fresh, so that we don't recompute it unnecessarily
   // during the step.
@@ -328,6 +550,21 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
   return J_;
 }
 
+template <class T>
+bool ImplicitIntegrator<T>::RedetectJacobianSparsity(const T& t,
+                                                     const VectorX<T>& x) {
+  DRAKE_DEMAND(jacobian_sparsity_.has_value());
+
+  // Without a pattern, CalcJacobian() computes the Jacobian matrix densely
+  // and detects a pattern from it.
+  internal::JacobianSparsity sparsity = std::move(*jacobian_sparsity_);
+  jacobian_sparsity_.reset();
+  CalcJacobian(t, x);
+  const bool grew = sparsity.Merge(*jacobian_sparsity_);
+  jacobian_sparsity_ = std::move(sparsity);
+  return grew;
+}
+
 template <class T>
 void ImplicitIntegrator<T>::FreshenMatricesIfFullNewton(
     const T& t, const VectorX<T>& xt, const T& h,
@@ -341,6 +578,7 @@ void ImplicitIntegrator<T>::FreshenMatricesIfFullNewton(
   if (!get_use_full_newton()) return;
 
   // Compute the initial Jacobian and iteration matrices and factor them.
+  iteration_matrix->set_use_sparse_factorization(use_sparse_jacobian_);
   MatrixX<T>& J = get_mutable_jacobian();
   J = CalcJacobian(t, xt);
   ++num_iter_factorizations_;
@@ -356,6 +594,7 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
     typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
   // Compute the initial Jacobian and iteration matrices and factor them, if
   // necessary.
+  iteration_matrix->set_use_sparse_factorization(use_sparse_jacobian_);
   MatrixX<T>& J = get_mutable_jacobian();
   if (!get_reuse() || J.rows() == 0 || IsBadJacobian(J)) {
     J = CalcJacobian(t, xt);
@@ -422,27 +661,38 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
       // exhausted all our options short of recomputing the Jacobian, have
       // failed.
 
-      // The Jacobian matrix may already be "fresh", meaning that there is
-      // nothing more that can be tried (Jacobian and iteration matrix are both
-      // fresh), and we need to indicate failure.
-      if (jacobian_is_fresh_)
+      // In sparse mode, a pattern detected from an earlier Jacobian matrix
+      // may miss entries that were exactly zero there, which a Jacobian
+      // matrix computed with it then lumps into other entries. So the
+      // Jacobian matrix is computed densely instead, and its nonzeros are
+      // added to the pattern.
+      const bool was_fresh = jacobian_is_fresh_;
+      const bool redetect = use_sparse_jacobian_ &&
+                            !jacobian_sparsity_given_ &&
+                            jacobian_sparsity_.has_value();
+      const bool grew = redetect && RedetectJacobianSparsity(t, xt);
+
+      // The Jacobian matrix may already have been "fresh", meaning that there
+      // is nothing more that can be tried (Jacobian and iteration matrix are
+      // both fresh) unless the pattern grew, and we need to indicate failure.
+      if (was_fresh && !grew)
         return false;
 
-      // Otherwise, we can reform the Jacobian matrix and refactor the
-      // iteration matrix.
-      J = CalcJacobian(t, xt);
+      // Otherwise, we can reform the Jacobian matrix (if it wasn't just
+      // recomputed densely) and refactor the iteration matrix.
+      if (!redetect) J = CalcJacobian(t, xt);
       ++num_iter_factorizations_;
       compute_and_factor_iteration_matrix(J, h, iteration_matrix);
       return true;
+    }
 
-      case 4: {
-        // Trial #4 indicates failure.
-        return false;
-      }
-
-      default:
-        throw std::domain_error("Unexpected trial number.");
+    case 4: {
+      // Trial #4 indicates failure.
+      return false;
     }
+
+    default:
+      throw std::domain_error("Unexpected trial number.");
   }
 }
 
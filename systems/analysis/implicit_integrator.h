@@ -1,16 +1,22 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include <Eigen/LU>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
 #include "drake/systems/analysis/integrator_base.h"
+#include "drake/systems/analysis/jacobian_sparsity.h"
 
 namespace drake {
 namespace systems {
@@ -123,6 +129,92 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   JacobianComputationScheme get_jacobian_computation_scheme() const {
     return jacobian_scheme_;
   }
+
+  /// Sets whether the integrator exploits the sparsity of the Jacobian matrix
+  /// (default is `false`). For systems with many state variables that are
+  /// each coupled to only a few others, this makes forming Jacobian matrices
+  /// and factoring iteration matrices far cheaper:
+  /// - The columns of the Jacobian matrix are colored such that no two
+  ///   columns of the same color have a nonzero in the same row, and all of
+  ///   the columns of one color are computed together. Forward differencing
+  ///   then takes one derivative evaluation per color (plus one) rather than
+  ///   one per state variable, central differencing two per color, and
+  ///   automatic differentiation propagates one derivative per color.
+  /// - When `T` is `double`, iteration matrices are factored using sparse LU
+  ///   factorization. The symbolic analysis (the fill-reducing ordering) is
+  ///   reused for as long as the iteration matrix's pattern doesn't change.
+  ///
+  /// The sparsity pattern is the one given to set_jacobian_sparsity_pattern()
+  /// if any. Otherwise, the integrator detects it from the first Jacobian
+  /// matrix it computes (densely) in this mode, and again after each
+  /// Reset(): entries of that matrix that are exactly zero are assumed to
+  /// remain zero. That assumption fails for couplings that merely happen to
+  /// vanish at the first state, e.g., a spring at rest. A pattern that misses
+  /// some entries doesn't just drop them: they are lumped into other entries
+  /// of their row that have the same color. Such a Jacobian matrix doesn't
+  /// affect the accuracy of the solution, which the Newton-Raphson process
+  /// checks against the true residual, but it can keep that process from
+  /// converging. So when the process fails even after refactoring the
+  /// iteration matrix, the integrator recomputes the Jacobian matrix densely
+  /// and adds its nonzeros to the detected pattern before giving up on the
+  /// step size. This fallback relies on Jacobian reuse (see get_reuse()); a
+  /// system whose couplings may vanish is better given a pattern with
+  /// set_jacobian_sparsity_pattern().
+  ///
+  /// @note The Jacobian matrix is still stored (and returned) as a dense
+  ///       matrix.
+  /// @note VelocityImplicitEulerIntegrator differentiates a function of only
+  ///       the velocity and miscellaneous state variables, so it ignores any
+  ///       pattern given to set_jacobian_sparsity_pattern() and always detects
+  ///       its own.
+  void set_use_sparse_jacobian(bool flag) { use_sparse_jacobian_ = flag; }
+
+  /// Gets whether the integrator exploits the sparsity of the Jacobian matrix.
+  /// @see set_use_sparse_jacobian()
+  bool get_use_sparse_jacobian() const { return use_sparse_jacobian_; }
+
+  /// Sets the sparsity pattern of the Jacobian matrix used when
+  /// get_use_sparse_jacobian() is `true` to the structural nonzeros of
+  /// @p pattern (their values are ignored), plus the diagonal. The pattern
+  /// must include every entry of ∂ẋ/∂x that may ever be nonzero; a System
+  /// that supports symbolic scalars can find it with SystemSymbolicInspector.
+  /// @throws std::exception if @p pattern isn't square.
+  /// @throws std::exception from the next Jacobian computation if the size of
+  ///         @p pattern doesn't match the number of continuous state
+  ///         variables.
+  void set_jacobian_sparsity_pattern(
+      const Eigen::SparseMatrix<double>& pattern) {
+    jacobian_sparsity_.emplace(pattern);
+    jacobian_sparsity_given_ = true;
+  }
+
+  /// Sets the number of threads used to compute each Jacobian matrix by
+  /// forward or central differencing (default is 1). The columns of the
+  /// Jacobian matrix are split into that many contiguous ranges, and each
+  /// range is computed concurrently through its own clone of the integrator's
+  /// Context. Each column is computed exactly as it would be serially, so the
+  /// result doesn't depend on the number of threads. This is most useful for
+  /// systems with many continuous state variables and expensive time
+  /// derivatives, where forming the Jacobian matrix dominates the cost of a
+  /// step.
+  /// @note This has no effect unless Drake was built with OpenMP.
+  /// @note The Context is cloned for each Jacobian matrix, so the System must
+  ///       support evaluating its time derivatives concurrently in separate
+  ///       Contexts (as all Systems should).
+  /// @note This only affects the dense differencing schemes; the colored
+  ///       differencing of set_use_sparse_jacobian() and the velocity
+  ///       Jacobian matrices of VelocityImplicitEulerIntegrator are always
+  ///       computed serially.
+  /// @throws std::exception if @p num_threads is less than one.
+  void set_num_jacobian_threads(int num_threads) {
+    DRAKE_THROW_UNLESS(num_threads >= 1);
+    num_jacobian_threads_ = num_threads;
+  }
+
+  /// Gets the number of threads used to compute each Jacobian matrix by
+  /// numerical differencing.
+  /// @see set_num_jacobian_threads()
+  int get_num_jacobian_threads() const { return num_jacobian_threads_; }
   /// @}
 
   /// @name Cumulative statistics functions.
@@ -147,6 +239,13 @@ class ImplicitIntegrator : public IntegratorBase<T> {
         num_jacobian_evaluations_;
   }
 
+  /// Gets the wall-clock time, in seconds, spent computing Jacobian matrices
+  /// since the last call to ResetStatistics(). This includes the time spent
+  /// computing Jacobian matrices during error estimation processes.
+  double get_jacobian_computation_time() const {
+    return jacobian_computation_time_;
+  }
+
   /// Gets the number of iterations used in the Newton-Raphson nonlinear systems
   /// of equation solving process since the last call to ResetStatistics(). This
   /// count includes those Newton-Raphson iterations used during error
@@ -219,9 +318,21 @@ class ImplicitIntegrator : public IntegratorBase<T> {
    public:
     /// Factors a dense matrix (the iteration matrix) using LU factorization,
     /// which should be faster than the QR factorization used in the specialized
-    /// template method for AutoDiffXd below.
+    /// template method for AutoDiffXd below. When get_use_sparse_factorization()
+    /// is `true`, only the nonzero entries of the matrix are factored, using
+    /// sparse LU factorization; forming the matrix and finding those entries
+    /// then costs O(n²), rather than the O(n³) of a dense factorization.
     void SetAndFactorIterationMatrix(const MatrixX<T>& iteration_matrix);
 
+    /// Factors a sparse matrix (the iteration matrix) using sparse LU
+    /// factorization, reusing the symbolic analysis of the previous sparse
+    /// factorization if the pattern of @p iteration_matrix is the same. This
+    /// lets an integrator whose iteration matrix is much larger than the
+    /// Jacobian matrix avoid ever forming it densely.
+    /// @throws std::exception if `T` is not `double`.
+    void SetAndFactorIterationMatrix(
+        const Eigen::SparseMatrix<double>& iteration_matrix);
+
     /// Solves a linear system Ax = b for x using the iteration matrix (A)
     /// factored using LU decomposition.
     /// @see Factor()
@@ -230,8 +341,33 @@ class ImplicitIntegrator : public IntegratorBase<T> {
     /// Returns whether the iteration matrix has been set and factored.
     bool matrix_factored() const { return matrix_factored_; }
 
+    /// Sets whether SetAndFactorIterationMatrix() uses sparse LU
+    /// factorization, which only considers the nonzero entries of the
+    /// iteration matrix. The symbolic analysis of those entries' pattern is
+    /// reused until the pattern changes. This has no effect unless `T` is
+    /// `double`.
+    void set_use_sparse_factorization(bool flag) {
+      use_sparse_factorization_ = flag;
+    }
+
+    /// Gets whether SetAndFactorIterationMatrix() uses sparse LU
+    /// factorization.
+    bool get_use_sparse_factorization() const {
+      return use_sparse_factorization_;
+    }
+
+    /// Returns how many times the sparse LU factorization analyzed the
+    /// pattern of the iteration matrix.
+    int64_t num_symbolic_factorizations() const {
+      return num_symbolic_factorizations_;
+    }
+
    private:
     bool matrix_factored_{false};
+    bool use_sparse_factorization_{false};
+
+    // Whether the current factorization is the sparse one (as opposed to LU_).
+    bool sparse_factored_{false};
 
     // A simple LU factorization is all that is needed for ImplicitIntegrator
     // templated on scalar type `double`; robustness in the solve
@@ -239,6 +375,14 @@ class ImplicitIntegrator : public IntegratorBase<T> {
     // serves to minimize heap allocations and deallocations.
     Eigen::PartialPivLU<MatrixX<double>> LU_;
 
+    // In sparse mode, the nonzero entries of the last iteration matrix, and
+    // their factorization. The factorization's symbolic analysis belongs to
+    // the pattern of sparse_matrix_. (Eigen's SparseLU can't be moved, so it
+    // is allocated when first needed.)
+    Eigen::SparseMatrix<double> sparse_matrix_;
+    std::unique_ptr<Eigen::SparseLU<Eigen::SparseMatrix<double>>> sparse_LU_;
+    int64_t num_symbolic_factorizations_{0};
+
     // The only factorization supported by automatic differentiation in Eigen is
     // currently QR. When ImplicitIntegrator is templated on type AutoDiffXd,
     // this will be the factorization that is used.
@@ -414,6 +558,13 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   //       that the Jacobian was computed from the most recent time t.
   const MatrixX<T>& CalcJacobian(const T& t, const VectorX<T>& x);
 
+  // Recomputes the Jacobian matrix densely around (t, x), as CalcJacobian()
+  // does, and adds its nonzeros to the detected sparsity pattern, which can
+  // miss entries that were exactly zero where it was detected. Returns
+  // whether the pattern grew.
+  // @pre jacobian_sparsity_ has a value.
+  bool RedetectJacobianSparsity(const T& t, const VectorX<T>& x);
+
   // Computes the Jacobian of the ordinary differential equations around time
   // and continuous state `(t, xt)` using a first-order forward difference
   // (i.e., numerical differentiation).
@@ -452,6 +603,49 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   void ComputeAutoDiffJacobian(const System<T>& system, const T& t,
       const VectorX<T>& xt, const Context<T>& context, MatrixX<T>* J);
 
+  // Computes the Jacobian of the ordinary differential equations around time
+  // and continuous state `(t, xt)` using numerical differencing of all of the
+  // columns of each color of `sparsity` at once.
+  // @param t the time around which to compute the Jacobian matrix.
+  // @param xt the continuous state around which to compute the Jacobian matrix.
+  // @param sparsity the sparsity pattern of the Jacobian matrix.
+  // @param central_difference whether to use a second-order central difference
+  //        rather than a first-order forward difference.
+  // @param context the Context of the system, at time and continuous state
+  //        unknown.
+  // @param[out] J the Jacobian matrix around time and state `(t, xt)`.
+  // @post The continuous state will be indeterminate on return.
+  void ComputeColoredDiffJacobian(const T& t, const VectorX<T>& xt,
+      const internal::JacobianSparsity& sparsity, bool central_difference,
+      Context<T>* context, MatrixX<T>* J);
+
+  // Computes the Jacobian of the ordinary differential equations around time
+  // and continuous state `(t, xt)` using automatic differentiation, with one
+  // derivative per color of `sparsity`.
+  // @param system The dynamical system.
+  // @param t the time around which to compute the Jacobian matrix.
+  // @param xt the continuous state around which to compute the Jacobian matrix.
+  // @param sparsity the sparsity pattern of the Jacobian matrix.
+  // @param context the Context of the system, at time and continuous state
+  //        unknown.
+  // @param[out] J the Jacobian matrix around time and state `(t, xt)`.
+  void ComputeColoredAutoDiffJacobian(const System<T>& system, const T& t,
+      const VectorX<T>& xt, const internal::JacobianSparsity& sparsity,
+      const Context<T>& context, MatrixX<T>* J);
+
+  // Calls `calc_column(i, column_context, &xt_prime)` for each column i of an
+  // n-column Jacobian matrix around continuous state `xt`. `xt_prime` equals
+  // `xt` on entry, and calc_column() must restore it. With more than one
+  // Jacobian thread, the columns are split into contiguous ranges that are
+  // computed concurrently, each through its own clone of `context`; the clones'
+  // derivative evaluations (`evaluations_per_column` per column) are added to
+  // the statistics afterward. Otherwise, `column_context` is `context`.
+  // @param context the Context of the system, at the time around which to
+  //        compute the Jacobian matrix.
+  void ForEachJacobianColumn(int n, int evaluations_per_column,
+      const VectorX<T>& xt, Context<T>* context,
+      const std::function<void(int, Context<T>*, VectorX<T>*)>& calc_column);
+
   /// @copydoc IntegratorBase::DoStep()
   virtual bool DoImplicitIntegratorStep(const T& h) = 0;
 
@@ -469,6 +663,10 @@ class ImplicitIntegrator : public IntegratorBase<T> {
     ++num_jacobian_evaluations_;
   }
 
+  void increment_jacobian_computation_time(double seconds) {
+    jacobian_computation_time_ += seconds;
+  }
+
   void set_jacobian_is_fresh(bool flag) {
     jacobian_is_fresh_ = flag;
   }
@@ -516,10 +714,25 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   // only ever be useful in debugging.
   bool use_full_newton_{false};
 
+  // If set to `true`, Jacobian matrices are computed using the sparsity
+  // pattern jacobian_sparsity_, and iteration matrices are factored using
+  // sparse LU factorization.
+  bool use_sparse_jacobian_{false};
+
+  // The sparsity pattern of the Jacobian matrix, either given by the user
+  // (jacobian_sparsity_given_ is `true`) or detected from the first Jacobian
+  // matrix computed in sparse mode.
+  std::optional<internal::JacobianSparsity> jacobian_sparsity_;
+  bool jacobian_sparsity_given_{false};
+
+  // The number of threads used by ForEachJacobianColumn().
+  int num_jacobian_threads_{1};
+
   // Various combined statistics.
   int64_t num_iter_factorizations_{0};
   int64_t num_jacobian_evaluations_{0};
   int64_t num_jacobian_function_evaluations_{0};
+  double jacobian_computation_time_{0.0};
 };
 
 // We do not support computing the Jacobian matrix using automatic
@@ -535,6 +748,16 @@ inline void ImplicitIntegrator<AutoDiffXd>::
                                      "AutoDiff'd ImplicitIntegrator");
 }
 
+template <>
+inline void ImplicitIntegrator<AutoDiffXd>::
+    ComputeColoredAutoDiffJacobian(const System<AutoDiffXd>&,
+      const AutoDiffXd&, const VectorX<AutoDiffXd>&,
+      const internal::JacobianSparsity&, const Context<AutoDiffXd>&,
+      MatrixX<AutoDiffXd>*) {
+        throw std::runtime_error("AutoDiff'd Jacobian not supported from "
+                                     "AutoDiff'd ImplicitIntegrator");
+}
+
 // Factors a dense matrix (the iteration matrix). This
 // AutoDiff-specialized method is necessary because Eigen's LU factorization,
 // which should be faster than the QR factorization used here, is not currently
@@ -544,10 +767,18 @@ inline void ImplicitIntegrator<AutoDiffXd>::
 template <>
 inline void ImplicitIntegrator<AutoDiffXd>::IterationMatrix::
     SetAndFactorIterationMatrix(const MatrixX<AutoDiffXd>& iteration_matrix) {
+  // Sparse factorization is not supported for AutoDiff'd iteration matrices.
   QR_.compute(iteration_matrix);
   matrix_factored_ = true;
 }
 
+template <>
+inline void ImplicitIntegrator<AutoDiffXd>::IterationMatrix::
+    SetAndFactorIterationMatrix(const Eigen::SparseMatrix<double>&) {
+  throw std::logic_error("Sparse iteration matrices are not supported from "
+                         "AutoDiff'd ImplicitIntegrator");
+}
+
 // Solves the linear system Ax = b for x using the iteration matrix (A)
 // factored using QR decomposition.
 // @see Factor()
@@ -0,0 +1,196 @@
+#include "drake/systems/analysis/jacobian_sparsity.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace systems {
+namespace internal {
+
+JacobianSparsity::JacobianSparsity(
+    const Eigen::SparseMatrix<double>& pattern)
+    : JacobianSparsity([&pattern]() {
+        DRAKE_THROW_UNLESS(pattern.rows() == pattern.cols());
+        std::vector<std::vector<int>> rows(pattern.cols());
+        for (int j = 0; j < pattern.outerSize(); ++j) {
+          for (Eigen::SparseMatrix<double>::InnerIterator it(pattern, j); it;
+               ++it) {
+            rows[j].push_back(static_cast<int>(it.row()));
+          }
+        }
+        return rows;
+      }()) {}
+
+template <typename T>
+JacobianSparsity JacobianSparsity::FromDenseMatrix(const MatrixX<T>& J) {
+  DRAKE_THROW_UNLESS(J.rows() == J.cols());
+  std::vector<std::vector<int>> rows(J.cols());
+  for (int j = 0; j < J.cols(); ++j) {
+    for (int i = 0; i < J.rows(); ++i) {
+      if (J(i, j) != 0.0) rows[j].push_back(i);
+    }
+  }
+  return JacobianSparsity(std::move(rows));
+}
+
+JacobianSparsity::JacobianSparsity(std::vector<std::vector<int>> rows)
+    : rows_(std::move(rows)) {
+  const int n = size();
+  for (int j = 0; j < n; ++j) {
+    std::vector<int>& column = rows_[j];
+    column.push_back(j);
+    std::sort(column.begin(), column.end());
+    column.erase(std::unique(column.begin(), column.end()), column.end());
+    num_nonzeros_ += static_cast<int>(column.size());
+  }
+  ColorColumns();
+}
+
+bool JacobianSparsity::Merge(const JacobianSparsity& other) {
+  DRAKE_DEMAND(other.size() == size());
+  const int old_num_nonzeros = num_nonzeros_;
+  num_nonzeros_ = 0;
+  for (int j = 0; j < size(); ++j) {
+    std::vector<int> column;
+    std::set_union(rows_[j].begin(), rows_[j].end(), other.rows_[j].begin(),
+                   other.rows_[j].end(), std::back_inserter(column));
+    rows_[j] = std::move(column);
+    num_nonzeros_ += static_cast<int>(rows_[j].size());
+  }
+  if (num_nonzeros_ == old_num_nonzeros) return false;
+  colors_.clear();
+  color_columns_.clear();
+  ColorColumns();
+  return true;
+}
+
+void JacobianSparsity::ColorColumns() {
+  const int n = size();
+
+  // The columns with a nonzero in each row.
+  std::vector<std::vector<int>> columns_of_row(n);
+  for (int j = 0; j < n; ++j) {
+    for (int i : rows_[j]) columns_of_row[i].push_back(j);
+  }
+
+  // Give each column the smallest color that no column sharing a row with it
+  // already has. forbidden[c] == j marks color c as taken for column j.
+  colors_.assign(n, -1);
+  std::vector<int> forbidden;
+  for (int j = 0; j < n; ++j) {
+    for (int i : rows_[j]) {
+      for (int k : columns_of_row[i]) {
+        if (colors_[k] >= 0) forbidden[colors_[k]] = j;
+      }
+    }
+    int c = 0;
+    while (c < static_cast<int>(forbidden.size()) && forbidden[c] == j) ++c;
+    if (c == static_cast<int>(forbidden.size())) {
+      forbidden.push_back(-1);
+      color_columns_.emplace_back();
+    }
+    colors_[j] = c;
+    color_columns_[c].push_back(j);
+  }
+}
+
+Eigen::MatrixXd JacobianSparsity::MakeSeedMatrix() const {
+  Eigen::MatrixXd seed = Eigen::MatrixXd::Zero(size(), num_colors());
+  for (int j = 0; j < size(); ++j) seed(j, colors_[j]) = 1.0;
+  return seed;
+}
+
+template <typename T>
+void JacobianSparsity::Decompress(const MatrixX<T>& compressed,
+                                  MatrixX<T>* J) const {
+  DRAKE_DEMAND(J != nullptr);
+  DRAKE_DEMAND(compressed.rows() == size());
+  DRAKE_DEMAND(compressed.cols() == num_colors());
+  J->setZero(size(), size());
+  for (int j = 0; j < size(); ++j) {
+    for (int i : rows_[j]) (*J)(i, j) = compressed(i, colors_[j]);
+  }
+}
+
+template <typename T>
+void ComputeColoredNumericalJacobian(
+    const JacobianSparsity& sparsity,
+    const std::function<void(const VectorX<T>&, VectorX<T>*)>& calc_f,
+    const VectorX<T>& x, bool central_difference, double perturbation,
+    MatrixX<T>* J) {
+  using std::abs;
+  DRAKE_DEMAND(J != nullptr);
+  const int n = sparsity.size();
+  DRAKE_DEMAND(x.size() == n);
+
+  // Chooses the increment to x(j), as in the dense differencing schemes: no
+  // smaller than `perturbation`, and a fraction of |x(j)| when that's large.
+  const auto calc_increment = [&x, perturbation](int j) {
+    const T abs_xj = abs(x(j));
+    return abs_xj <= 1 ? T(perturbation) : T(perturbation * abs_xj);
+  };
+
+  J->setZero(n, n);
+  VectorX<T> f;
+  VectorX<T> x_prime = x;
+  VectorX<T> dx_plus(n);
+  if (!central_difference) {
+    VectorX<T> f0;
+    calc_f(x, &f0);
+    DRAKE_DEMAND(f0.size() == n);
+    for (int c = 0; c < sparsity.num_colors(); ++c) {
+      const std::vector<int>& columns = sparsity.columns_of_color(c);
+      // Make sure that x and x' differ by an exactly representable number, to
+      // minimize the effect of roundoff error.
+      for (int j : columns) {
+        x_prime(j) = x(j) + calc_increment(j);
+        dx_plus(j) = x_prime(j) - x(j);
+      }
+      calc_f(x_prime, &f);
+      for (int j : columns) {
+        for (int i : sparsity.rows(j)) {
+          (*J)(i, j) = (f(i) - f0(i)) / dx_plus(j);
+        }
+        x_prime(j) = x(j);
+      }
+    }
+    return;
+  }
+
+  VectorX<T> f_minus;
+  VectorX<T> dx_minus(n);
+  for (int c = 0; c < sparsity.num_colors(); ++c) {
+    const std::vector<int>& columns = sparsity.columns_of_color(c);
+    for (int j : columns) {
+      x_prime(j) = x(j) + calc_increment(j);
+      dx_plus(j) = x_prime(j) - x(j);
+    }
+    calc_f(x_prime, &f);
+    for (int j : columns) {
+      x_prime(j) = x(j) - calc_increment(j);
+      dx_minus(j) = x(j) - x_prime(j);
+    }
+    calc_f(x_prime, &f_minus);
+    for (int j : columns) {
+      for (int i : sparsity.rows(j)) {
+        (*J)(i, j) = (f(i) - f_minus(i)) / (dx_plus(j) + dx_minus(j));
+      }
+      x_prime(j) = x(j);
+    }
+  }
+}
+
+DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS((
+    &JacobianSparsity::FromDenseMatrix<T>,
+    &JacobianSparsity::Decompress<T>,
+    &ComputeColoredNumericalJacobian<T>
+))
+
+}  // namespace internal
+}  // namespace systems
+}  // namespace drake
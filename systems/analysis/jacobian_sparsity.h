@@ -0,0 +1,99 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include <Eigen/SparseCore>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace systems {
+namespace internal {
+
+/* The sparsity pattern of a square Jacobian matrix, along with a coloring of
+its columns such that no two columns of the same color have a nonzero in the
+same row. All of the columns of one color can be differentiated with a single
+(perturbed, or AutoDiff) function evaluation, since each row of the result
+depends on at most one of them [Curtis 1974]. The colors are assigned greedily,
+which isn't optimal but does well on the banded and block-structured patterns
+that are typical of physical systems.
+
+The diagonal is always part of the pattern, since the iteration matrices formed
+from the Jacobian always have a nonzero diagonal.
+
+- [Curtis 1974] A. Curtis, M. Powell, and J. Reid. On the Estimation of Sparse
+                Jacobian Matrices. IMA Journal of Applied Mathematics, 13(1),
+                1974. */
+class JacobianSparsity {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(JacobianSparsity)
+
+  /* Creates the pattern of the structural nonzeros of the square matrix
+  `pattern` (whose values are ignored). */
+  explicit JacobianSparsity(const Eigen::SparseMatrix<double>& pattern);
+
+  /* Creates the pattern of the entries of the square matrix `J` that aren't
+  exactly zero. */
+  template <typename T>
+  static JacobianSparsity FromDenseMatrix(const MatrixX<T>& J);
+
+  int size() const { return static_cast<int>(rows_.size()); }
+  int num_nonzeros() const { return num_nonzeros_; }
+  int num_colors() const { return static_cast<int>(color_columns_.size()); }
+
+  /* Adds the nonzeros of `other` to this pattern and colors the columns
+  anew if the pattern grew. Returns whether it grew.
+  @pre other.size() == size(). */
+  bool Merge(const JacobianSparsity& other);
+
+  /* Returns the rows of the nonzeros in column `j`, in increasing order. */
+  const std::vector<int>& rows(int j) const { return rows_[j]; }
+
+  /* Returns the color of column `j`. */
+  int color(int j) const { return colors_[j]; }
+
+  /* Returns the columns of color `c`, in increasing order. */
+  const std::vector<int>& columns_of_color(int c) const {
+    return color_columns_[c];
+  }
+
+  /* Returns the size() × num_colors() matrix S with S(j, color(j)) = 1 and
+  zeros elsewhere. Each column of J S, for a Jacobian J with this pattern, is
+  the sum of the columns of J of one color; Decompress() recovers J. */
+  Eigen::MatrixXd MakeSeedMatrix() const;
+
+  /* Sets `J` to the Jacobian with this pattern whose product with
+  MakeSeedMatrix() is `compressed`. */
+  template <typename T>
+  void Decompress(const MatrixX<T>& compressed, MatrixX<T>* J) const;
+
+ private:
+  explicit JacobianSparsity(std::vector<std::vector<int>> rows);
+
+  void ColorColumns();
+
+  std::vector<std::vector<int>> rows_;
+  int num_nonzeros_{};
+  std::vector<int> colors_;
+  std::vector<std::vector<int>> color_columns_;
+};
+
+/* Computes the Jacobian J = ∂f/∂x at `x` with the pattern `sparsity` using
+numerical differencing, perturbing all of the columns of one color at once.
+This takes num_colors() + 1 evaluations of f for forward differencing, or
+2 num_colors() for central differencing. Each x(j) is perturbed by
+max(|x(j)|, 1) * `perturbation`.
+@param calc_f calc_f(x, &f) sets f to f(x). */
+template <typename T>
+void ComputeColoredNumericalJacobian(
+    const JacobianSparsity& sparsity,
+    const std::function<void(const VectorX<T>&, VectorX<T>*)>& calc_f,
+    const VectorX<T>& x, bool central_difference, double perturbation,
+    MatrixX<T>* J);
+
+}  // namespace internal
+}  // namespace systems
+}  // namespace drake
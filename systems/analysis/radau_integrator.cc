@@ -1,6 +1,8 @@
 #include "drake/systems/analysis/radau_integrator.h"
 
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 #include "drake/common/autodiff.h"
 
@@ -629,6 +631,34 @@ void RadauIntegrator<T, num_stages>::ComputeRadauIterationMatrix(
     const MatrixX<double>& A,
     typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
   const int n = J.rows() * num_stages;
+  if constexpr (std::is_same_v<T, double>) {
+    if (iteration_matrix->get_use_sparse_factorization()) {
+      // Computes I - h A ⊗ J from the nonzeros of J, without forming the
+      // (much larger) dense matrix.
+      const Eigen::SparseMatrix<double> J_sparse = J.sparseView();
+      const int state_dim = J.rows();
+      std::vector<Eigen::Triplet<double>> triplets;
+      triplets.reserve(num_stages * num_stages * J_sparse.nonZeros() + n);
+      for (int i = 0; i < n; ++i) triplets.emplace_back(i, i, 1.0);
+      for (int k = 0; k < J_sparse.outerSize(); ++k) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(J_sparse, k); it;
+             ++it) {
+          for (int i = 0; i < num_stages; ++i) {
+            for (int j = 0; j < num_stages; ++j) {
+              triplets.emplace_back(i * state_dim + it.row(),
+                                    j * state_dim + it.col(),
+                                    -h * A(i, j) * it.value());
+            }
+          }
+        }
+      }
+      Eigen::SparseMatrix<double> iteration(n, n);
+      iteration.setFromTriplets(triplets.begin(), triplets.end());
+      iteration_matrix->SetAndFactorIterationMatrix(iteration);
+      return;
+    }
+  }
+
   // TODO(edrumwri) Investigate how to do the below operation with a move.
   // Computes I - h A ⊗ J.
   iteration_matrix->SetAndFactorIterationMatrix(
@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/systems/analysis/test_utilities/spring_mass_system.h"
 
 using Eigen::VectorXd;
@@ -22,6 +23,7 @@ class DummyImplicitIntegrator final : public ImplicitIntegrator<double> {
   int get_error_estimate_order() const override { return 0; }
 
   using ImplicitIntegrator<double>::IsUpdateZero;
+  using ImplicitIntegrator<double>::IterationMatrix;
 
   // Returns whether DoResetCachedMatrices() has been called.
   bool get_has_reset_cached_matrices() {
@@ -135,6 +137,50 @@ GTEST_TEST(ImplicitIntegratorTest, SetComputationSchemeResetsCachedMatrices) {
             ImplicitIntegrator<double>
             ::JacobianComputationScheme::kAutomatic);
 }
+
+// Verifies that sparse factorization of the iteration matrix solves the same
+// systems as dense factorization, and only analyzes the pattern of the matrix
+// when it changes.
+GTEST_TEST(ImplicitIntegratorTest, SparseIterationMatrix) {
+  const int n = 6;
+  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(n, n);
+  for (int i = 0; i < n; ++i) {
+    A(i, i) = 4.0 + i;
+    if (i > 0) A(i, i - 1) = -1.0;
+    if (i + 1 < n) A(i, i + 1) = -2.0;
+  }
+  const VectorXd b = VectorXd::LinSpaced(n, 1.0, 2.0);
+
+  DummyImplicitIntegrator::IterationMatrix dense;
+  dense.SetAndFactorIterationMatrix(A);
+  DummyImplicitIntegrator::IterationMatrix sparse;
+  EXPECT_FALSE(sparse.get_use_sparse_factorization());
+  sparse.set_use_sparse_factorization(true);
+  EXPECT_TRUE(sparse.get_use_sparse_factorization());
+  sparse.SetAndFactorIterationMatrix(A);
+  EXPECT_TRUE(sparse.matrix_factored());
+  EXPECT_TRUE(CompareMatrices(sparse.Solve(b), dense.Solve(b), 1e-14));
+  EXPECT_EQ(sparse.num_symbolic_factorizations(), 1);
+
+  // New values in the same pattern reuse the analysis.
+  A *= 2.0;
+  sparse.SetAndFactorIterationMatrix(A);
+  EXPECT_TRUE(CompareMatrices(sparse.Solve(b), dense.Solve(b) / 2, 1e-14));
+  EXPECT_EQ(sparse.num_symbolic_factorizations(), 1);
+
+  // A new pattern is analyzed anew.
+  A(0, n - 1) = 1.0;
+  dense.SetAndFactorIterationMatrix(A);
+  sparse.SetAndFactorIterationMatrix(A);
+  EXPECT_TRUE(CompareMatrices(sparse.Solve(b), dense.Solve(b), 1e-14));
+  EXPECT_EQ(sparse.num_symbolic_factorizations(), 2);
+
+  // A singular matrix still gets factored (densely), as without sparsity.
+  const Eigen::MatrixXd singular = Eigen::MatrixXd::Ones(n, n);
+  sparse.SetAndFactorIterationMatrix(singular);
+  EXPECT_TRUE(sparse.matrix_factored());
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -0,0 +1,157 @@
+#include "drake/systems/analysis/jacobian_sparsity.h"
+
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace systems {
+namespace internal {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+// The tridiagonal pattern of a chain of n elements, each coupled to its
+// neighbors.
+Eigen::SparseMatrix<double> MakeTridiagonalPattern(int n) {
+  std::vector<Eigen::Triplet<double>> triplets;
+  for (int i = 0; i < n; ++i) {
+    if (i > 0) triplets.emplace_back(i, i - 1, 1.0);
+    if (i + 1 < n) triplets.emplace_back(i, i + 1, 1.0);
+  }
+  Eigen::SparseMatrix<double> pattern(n, n);
+  pattern.setFromTriplets(triplets.begin(), triplets.end());
+  return pattern;
+}
+
+// f(x) for a chain of n elements, with the tridiagonal Jacobian pattern.
+void CalcChain(const VectorXd& x, VectorXd* f) {
+  const int n = x.size();
+  f->resize(n);
+  for (int i = 0; i < n; ++i) {
+    (*f)(i) = -std::sin(x(i)) * (i + 1);
+    if (i > 0) (*f)(i) += x(i - 1) * x(i - 1);
+    if (i + 1 < n) (*f)(i) += 3 * x(i + 1);
+  }
+}
+
+MatrixXd CalcChainJacobian(const VectorXd& x) {
+  const int n = x.size();
+  MatrixXd J = MatrixXd::Zero(n, n);
+  for (int i = 0; i < n; ++i) {
+    J(i, i) = -std::cos(x(i)) * (i + 1);
+    if (i > 0) J(i, i - 1) = 2 * x(i - 1);
+    if (i + 1 < n) J(i, i + 1) = 3;
+  }
+  return J;
+}
+
+// Verifies that no two columns of the same color share a row.
+void CheckColoring(const JacobianSparsity& dut) {
+  for (int c = 0; c < dut.num_colors(); ++c) {
+    std::set<int> rows;
+    for (int j : dut.columns_of_color(c)) {
+      EXPECT_EQ(dut.color(j), c);
+      for (int i : dut.rows(j)) {
+        EXPECT_TRUE(rows.insert(i).second);
+      }
+    }
+  }
+}
+
+GTEST_TEST(JacobianSparsityTest, Tridiagonal) {
+  const JacobianSparsity dut(MakeTridiagonalPattern(100));
+  EXPECT_EQ(dut.size(), 100);
+  // The pattern doesn't include the diagonal, but the diagonal is implied.
+  EXPECT_EQ(dut.num_nonzeros(), 3 * 100 - 2);
+  EXPECT_EQ(dut.rows(5), std::vector<int>({4, 5, 6}));
+  // Columns j and j + 3 never share a row.
+  EXPECT_EQ(dut.num_colors(), 3);
+  CheckColoring(dut);
+}
+
+GTEST_TEST(JacobianSparsityTest, Dense) {
+  const MatrixXd J = MatrixXd::Ones(4, 4);
+  const JacobianSparsity dut = JacobianSparsity::FromDenseMatrix(J);
+  EXPECT_EQ(dut.num_nonzeros(), 16);
+  EXPECT_EQ(dut.num_colors(), 4);
+  CheckColoring(dut);
+}
+
+GTEST_TEST(JacobianSparsityTest, FromDenseMatrix) {
+  MatrixXd J = MatrixXd::Zero(3, 3);
+  J(0, 2) = 1.0;
+  J(2, 0) = -1.0;
+  const JacobianSparsity dut = JacobianSparsity::FromDenseMatrix(J);
+  EXPECT_EQ(dut.num_nonzeros(), 5);
+  EXPECT_EQ(dut.rows(0), std::vector<int>({0, 2}));
+  EXPECT_EQ(dut.rows(1), std::vector<int>({1}));
+  EXPECT_EQ(dut.rows(2), std::vector<int>({0, 2}));
+  CheckColoring(dut);
+
+  const MatrixXd not_square = MatrixXd::Zero(2, 3);
+  EXPECT_THROW(JacobianSparsity::FromDenseMatrix(not_square), std::exception);
+}
+
+GTEST_TEST(JacobianSparsityTest, Merge) {
+  // A diagonal pattern, all of whose columns share a color.
+  const MatrixXd J = MatrixXd::Zero(4, 4);
+  JacobianSparsity dut = JacobianSparsity::FromDenseMatrix(J);
+  EXPECT_EQ(dut.num_colors(), 1);
+  EXPECT_FALSE(dut.Merge(dut));
+
+  const JacobianSparsity tridiagonal(MakeTridiagonalPattern(4));
+  EXPECT_TRUE(dut.Merge(tridiagonal));
+  EXPECT_EQ(dut.num_nonzeros(), tridiagonal.num_nonzeros());
+  EXPECT_EQ(dut.rows(1), std::vector<int>({0, 1, 2}));
+  EXPECT_EQ(dut.num_colors(), 3);
+  CheckColoring(dut);
+  EXPECT_FALSE(dut.Merge(tridiagonal));
+}
+
+GTEST_TEST(JacobianSparsityTest, Decompress) {
+  const int n = 10;
+  const JacobianSparsity dut(MakeTridiagonalPattern(n));
+  const VectorXd x = VectorXd::LinSpaced(n, -1.0, 2.0);
+  const MatrixXd J_expected = CalcChainJacobian(x);
+  const MatrixXd compressed = J_expected * dut.MakeSeedMatrix();
+  EXPECT_EQ(compressed.cols(), 3);
+  MatrixXd J;
+  dut.Decompress(compressed, &J);
+  EXPECT_TRUE(CompareMatrices(J, J_expected, 0.0));
+}
+
+GTEST_TEST(JacobianSparsityTest, ColoredNumericalJacobian) {
+  const int n = 50;
+  const JacobianSparsity dut(MakeTridiagonalPattern(n));
+  const VectorXd x = VectorXd::LinSpaced(n, -3.0, 5.0);
+  const MatrixXd J_expected = CalcChainJacobian(x);
+
+  int num_evaluations = 0;
+  const std::function<void(const VectorXd&, VectorXd*)> calc_f =
+      [&num_evaluations](const VectorXd& x_in, VectorXd* f) {
+        ++num_evaluations;
+        CalcChain(x_in, f);
+      };
+
+  MatrixXd J;
+  ComputeColoredNumericalJacobian(dut, calc_f, x, false /* forward */,
+                                  std::sqrt(1e-16), &J);
+  EXPECT_EQ(num_evaluations, dut.num_colors() + 1);
+  EXPECT_TRUE(CompareMatrices(J, J_expected, 1e-5));
+
+  num_evaluations = 0;
+  ComputeColoredNumericalJacobian(dut, calc_f, x, true /* central */,
+                                  std::cbrt(1e-16), &J);
+  EXPECT_EQ(num_evaluations, 2 * dut.num_colors());
+  EXPECT_TRUE(CompareMatrices(J, J_expected, 1e-8));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace systems
+}  // namespace drake
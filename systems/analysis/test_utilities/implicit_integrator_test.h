@@ -2,14 +2,17 @@
 
 #include <limits>
 #include <memory>
+#include <type_traits>
 
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
 #include "drake/systems/analysis/implicit_integrator.h"
 #include "drake/systems/analysis/test_utilities/discontinuous_spring_mass_damper_system.h"
 #include "drake/systems/analysis/test_utilities/linear_scalar_system.h"
 #include "drake/systems/analysis/test_utilities/robertson_system.h"
+#include "drake/systems/analysis/test_utilities/spring_mass_damper_chain_system.h"
 #include "drake/systems/analysis/test_utilities/spring_mass_damper_system.h"
 #include "drake/systems/analysis/test_utilities/spring_mass_system.h"
 #include "drake/systems/analysis/test_utilities/stationary_system.h"
@@ -1089,6 +1092,147 @@ TYPED_TEST_P(ImplicitIntegratorTest, LinearTest) {
   }
 }
 
+// Tests that exploiting the sparsity of the Jacobian matrix yields the same
+// solution as not exploiting it, from fewer derivative evaluations.
+TYPED_TEST_P(ImplicitIntegratorTest, SparseJacobian) {
+  using Integrator = TypeParam;
+  using Scheme = typename Integrator::JacobianComputationScheme;
+  const analysis::test::SpringMassDamperChainSystem<double> chain(30);
+  const double t_final = 0.1;
+
+  for (Scheme scheme : {Scheme::kForwardDifference, Scheme::kCentralDifference,
+                        Scheme::kAutomatic}) {
+    VectorX<double> x_final[2];
+    double evaluations_per_jacobian[2];
+    for (bool sparse : {false, true}) {
+      std::unique_ptr<Context<double>> context = chain.CreateDefaultContext();
+      Integrator integrator(chain, context.get());
+      integrator.set_jacobian_computation_scheme(scheme);
+      integrator.set_use_sparse_jacobian(sparse);
+      EXPECT_EQ(integrator.get_use_sparse_jacobian(), sparse);
+      // The Jacobian matrix of this linear system never goes stale; form it
+      // anew at every iteration so that most of them use the pattern.
+      integrator.set_use_full_newton(true);
+      integrator.set_maximum_step_size(1e-3);
+      integrator.set_fixed_step_mode(true);
+      integrator.Initialize();
+      integrator.IntegrateWithMultipleStepsToTime(t_final);
+      x_final[sparse] = context->get_continuous_state_vector().CopyToVector();
+      ASSERT_GT(integrator.get_num_jacobian_evaluations(), 0);
+      evaluations_per_jacobian[sparse] =
+          static_cast<double>(
+              integrator.get_num_derivative_evaluations_for_jacobian()) /
+          integrator.get_num_jacobian_evaluations();
+    }
+    // Only roundoff distinguishes the Jacobian matrices of this (linear)
+    // system.
+    EXPECT_TRUE(CompareMatrices(x_final[true], x_final[false], 1e-10));
+    // The first Jacobian matrix, which detects the pattern, is dense.
+    if (scheme != Scheme::kAutomatic) {
+      EXPECT_LT(evaluations_per_jacobian[true],
+                evaluations_per_jacobian[false] / 2);
+    }
+  }
+}
+
+// Tests that a sparsity pattern detected where some couplings of the state
+// variables vanish exactly (here, where all of the cubic springs of a chain
+// are at rest) is grown when the Newton-Raphson process fails with it, so
+// that the integrator still takes the steps it takes without sparsity.
+TYPED_TEST_P(ImplicitIntegratorTest, SparseJacobianFromZeroCouplings) {
+  using Integrator = TypeParam;
+  const int n = 10;
+  const analysis::test::SpringMassDamperChainSystem<double> chain(
+      n, true /* cubic springs */);
+  const double h = 1e-2;
+
+  VectorX<double> x_final[2];
+  for (bool sparse : {false, true}) {
+    std::unique_ptr<Context<double>> context = chain.CreateDefaultContext();
+    ContinuousState<double>& state =
+        context->get_mutable_continuous_state();
+    state.get_mutable_generalized_position().SetZero();
+    VectorX<double> v(n);
+    for (int i = 0; i < n; ++i) v(i) = 10 * std::sin(i + 1.0);
+    state.get_mutable_generalized_velocity().SetFromVector(v);
+
+    Integrator integrator(chain, context.get());
+    integrator.set_use_sparse_jacobian(sparse);
+    integrator.set_maximum_step_size(h);
+    integrator.set_fixed_step_mode(true);
+    integrator.Initialize();
+    // The first Jacobian matrix, from which the pattern is detected, has no
+    // position couplings. Over the first step, the springs stretch enough
+    // that the Newton-Raphson process of the second step can't converge
+    // without them.
+    ASSERT_TRUE(integrator.IntegrateWithSingleFixedStepToTime(h));
+    ASSERT_TRUE(integrator.IntegrateWithSingleFixedStepToTime(2 * h));
+    x_final[sparse] = context->get_continuous_state_vector().CopyToVector();
+  }
+  EXPECT_TRUE(CompareMatrices(x_final[true], x_final[false], 1e-6));
+}
+
+// Tests that a sparsity pattern that doesn't match the system is rejected.
+TYPED_TEST_P(ImplicitIntegratorTest, SparseJacobianPatternMismatch) {
+  using Integrator = TypeParam;
+  if (std::is_same_v<Integrator, VelocityImplicitEulerIntegrator<double>>) {
+    // This integrator detects its own pattern.
+    GTEST_SKIP();
+  }
+  const analysis::test::SpringMassDamperChainSystem<double> chain(3);
+  std::unique_ptr<Context<double>> context = chain.CreateDefaultContext();
+  Integrator integrator(chain, context.get());
+  integrator.set_use_sparse_jacobian(true);
+  integrator.set_jacobian_sparsity_pattern(Eigen::SparseMatrix<double>(5, 5));
+  integrator.set_maximum_step_size(1e-3);
+  integrator.set_fixed_step_mode(true);
+  integrator.Initialize();
+  EXPECT_THROW(integrator.IntegrateWithSingleFixedStepToTime(1e-3),
+               std::logic_error);
+}
+
+// Tests that computing Jacobian matrices on several threads yields exactly
+// the same solution and statistics as computing them on one.
+TYPED_TEST_P(ImplicitIntegratorTest, ParallelJacobian) {
+  using Integrator = TypeParam;
+  using Scheme = typename Integrator::JacobianComputationScheme;
+  const analysis::test::SpringMassDamperChainSystem<double> chain(10);
+  const double t_final = 0.01;
+
+  for (Scheme scheme :
+       {Scheme::kForwardDifference, Scheme::kCentralDifference}) {
+    VectorX<double> x_final[2];
+    int64_t num_derivative_evaluations[2];
+    for (int num_threads : {1, 4}) {
+      std::unique_ptr<Context<double>> context = chain.CreateDefaultContext();
+      Integrator integrator(chain, context.get());
+      integrator.set_jacobian_computation_scheme(scheme);
+      EXPECT_EQ(integrator.get_num_jacobian_threads(), 1);
+      integrator.set_num_jacobian_threads(num_threads);
+      EXPECT_EQ(integrator.get_num_jacobian_threads(), num_threads);
+      integrator.set_use_full_newton(true);
+      integrator.set_maximum_step_size(1e-3);
+      integrator.set_fixed_step_mode(true);
+      integrator.Initialize();
+      integrator.IntegrateWithMultipleStepsToTime(t_final);
+      const int index = num_threads > 1;
+      x_final[index] = context->get_continuous_state_vector().CopyToVector();
+      num_derivative_evaluations[index] =
+          integrator.get_num_derivative_evaluations();
+      ASSERT_GT(integrator.get_num_jacobian_evaluations(), 0);
+      EXPECT_GT(integrator.get_jacobian_computation_time(), 0.0);
+      integrator.ResetStatistics();
+      EXPECT_EQ(integrator.get_jacobian_computation_time(), 0.0);
+    }
+    EXPECT_TRUE(CompareMatrices(x_final[1], x_final[0], 0.0));
+    EXPECT_EQ(num_derivative_evaluations[1], num_derivative_evaluations[0]);
+  }
+
+  std::unique_ptr<Context<double>> context = chain.CreateDefaultContext();
+  Integrator integrator(chain, context.get());
+  EXPECT_THROW(integrator.set_num_jacobian_threads(0), std::exception);
+}
+
 TYPED_TEST_P(ImplicitIntegratorTest, DoubleSpringMassDamperNoReuse) {
   this->DoubleSpringMassDamperTest(kNoReuse);
 }
@@ -1145,7 +1289,9 @@ REGISTER_TYPED_TEST_SUITE_P(
     SpringMassDamperStiffReuse, DiscontinuousSpringMassDamperNoReuse,
     DiscontinuousSpringMassDamperReuse, SpringMassStepNoReuse,
     SpringMassStepReuse, ErrorEstimationNoReuse, ErrorEstimationReuse,
-    SpringMassStepAccuracyEffectsNoReuse, SpringMassStepAccuracyEffectsReuse);
+    SpringMassStepAccuracyEffectsNoReuse, SpringMassStepAccuracyEffectsReuse,
+    SparseJacobian, SparseJacobianFromZeroCouplings,
+    SparseJacobianPatternMismatch, ParallelJacobian);
 
 }  // namespace analysis_test
 }  // namespace systems
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cmath>
+
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+namespace test {
+
+/// A chain of n point masses, each connected to its neighbors by a stiff
+/// spring and damper, and the masses at either end connected to "the world".
+/// Each acceleration depends only on the states of the mass and its two
+/// neighbors, so this is a stiff system with a sparse Jacobian matrix, for
+/// testing implicit integration that exploits sparsity.
+///
+/// The system of ODEs follows:<pre>
+/// ẍᵢ = (fᵢ - fᵢ₊₁)/m
+/// </pre>
+/// where <pre>
+/// fᵢ = -k(xᵢ - xᵢ₋₁) - b(ẋᵢ - ẋᵢ₋₁)
+/// </pre>
+/// is the force of the spring and damper between masses i-1 and i, and
+/// x₋₁ = xₙ = 0 is the world. The springs' rest lengths are zero.
+///
+/// Optionally, the springs are cubic, fᵢ = -k(xᵢ - xᵢ₋₁)³ - b(ẋᵢ - ẋᵢ₋₁),
+/// so that the accelerations don't depend on the positions (to first order)
+/// wherever the springs are at rest, but do elsewhere.
+template <class T>
+class SpringMassDamperChainSystem : public LeafSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SpringMassDamperChainSystem)
+
+  explicit SpringMassDamperChainSystem(int num_masses,
+                                       bool cubic_springs = false)
+      : LeafSystem<T>(SystemTypeTag<SpringMassDamperChainSystem>{}),
+        num_masses_(num_masses),
+        cubic_springs_(cubic_springs) {
+    this->DeclareContinuousState(num_masses /* num_q */,
+                                 num_masses /* num_v */, 0 /* num_z */);
+  }
+
+  /// Scalar-converting copy constructor.
+  template <typename U>
+  explicit SpringMassDamperChainSystem(
+      const SpringMassDamperChainSystem<U>& other)
+      : SpringMassDamperChainSystem(other.num_masses(),
+                                    other.cubic_springs()) {}
+
+  int num_masses() const { return num_masses_; }
+  bool cubic_springs() const { return cubic_springs_; }
+
+  double get_spring_constant() const { return 1e5; }
+  double get_damping_constant() const { return 1e1; }
+  double get_mass() const { return 1.0; }
+
+  void DoCalcTimeDerivatives(const Context<T>& context,
+                             ContinuousState<T>* deriv) const override {
+    const VectorX<T> x =
+        context.get_continuous_state().get_generalized_position()
+            .CopyToVector();
+    const VectorX<T> v =
+        context.get_continuous_state().get_generalized_velocity()
+            .CopyToVector();
+    const double k = get_spring_constant();
+    const double b = get_damping_constant();
+
+    // The force of the spring and damper between masses i-1 and i.
+    const int n = num_masses_;
+    const bool cubic = cubic_springs_;
+    const auto calc_force = [&x, &v, k, b, n, cubic](int i) -> T {
+      const T x_i = i < n ? x(i) : T(0);
+      const T v_i = i < n ? v(i) : T(0);
+      const T x_prev = i > 0 ? x(i - 1) : T(0);
+      const T v_prev = i > 0 ? v(i - 1) : T(0);
+      const T stretch = x_i - x_prev;
+      const T spring_force =
+          cubic ? -k * stretch * stretch * stretch : -k * stretch;
+      return spring_force - b * (v_i - v_prev);
+    };
+
+    VectorX<T> a(n);
+    for (int i = 0; i < n; ++i) {
+      a(i) = (calc_force(i) - calc_force(i + 1)) / get_mass();
+    }
+
+    deriv->get_mutable_generalized_position().SetFromVector(v);
+    deriv->get_mutable_generalized_velocity().SetFromVector(a);
+  }
+
+  /// Sets the initial conditions for the system: the masses are displaced
+  /// from rest, and have no initial velocity.
+  void SetDefaultState(const Context<T>&,
+                       State<T>* state) const override {
+    VectorX<T> x(num_masses_);
+    for (int i = 0; i < num_masses_; ++i) {
+      x(i) = 0.1 * std::sin(i + 1.0);
+    }
+    state->get_mutable_continuous_state().get_mutable_generalized_position().
+        SetFromVector(x);
+    state->get_mutable_continuous_state().get_mutable_generalized_velocity().
+        SetZero();
+  }
+
+ private:
+  const int num_masses_;
+  const bool cubic_springs_;
+};
+
+}  // namespace test
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
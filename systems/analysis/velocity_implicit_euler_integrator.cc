@@ -8,6 +8,7 @@
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/text_logging.h"
+#include "drake/common/timer.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
 #include "drake/math/compute_numerical_gradient.h"
@@ -62,6 +63,7 @@ void VelocityImplicitEulerIntegrator<T>::DoInitialize() {
 
   // Reset the Jacobian matrix (so that recomputation is forced).
   this->Jy_vie_.resize(0, 0);
+  Jy_sparsity_.reset();
 }
 
 template <class T>
@@ -87,6 +89,9 @@ void VelocityImplicitEulerIntegrator<T>::CalcVelocityJacobian(const T& t,
   // StepVelocityImplicitEuler() does not require the context to be restored.
   this->increment_jacobian_evaluations();
 
+  // Time the computation, for the statistics.
+  SteadyTimer timer;
+
   // Get the existing number of ODE evaluations.
   int64_t existing_ODE_evals = this->get_num_derivative_evaluations();
 
@@ -111,6 +116,19 @@ void VelocityImplicitEulerIntegrator<T>::CalcVelocityJacobian(const T& t,
         math::NumericalGradientMethod::kCentral :
         math::NumericalGradientMethod::kForward);
 
+    // In sparse mode, perturb all of the columns of one color at once.
+    if (this->get_use_sparse_jacobian() && Jy_sparsity_.has_value()) {
+      internal::ComputeColoredNumericalJacobian(
+          *Jy_sparsity_, l_of_y, y,
+          numerical_gradient_method.method() ==
+              math::NumericalGradientMethod::kCentral,
+          numerical_gradient_method.perturbation_size(), Jy);
+      this->increment_jacobian_computation_derivative_evaluations(
+          this->get_num_derivative_evaluations() - existing_ODE_evals);
+      this->increment_jacobian_computation_time(timer.Tick());
+      return;
+    }
+
     // Compute Jy by passing ℓ(y) to math::ComputeNumericalGradient().
     // TODO(antequ): Right now we modify the context twice each time we call
     // ℓ(y): once when we calculate qⁿ + h N(qₖ) v
@@ -130,10 +148,17 @@ void VelocityImplicitEulerIntegrator<T>::CalcVelocityJacobian(const T& t,
     throw new std::logic_error("Invalid Jacobian computation scheme.");
   }
 
+  // In sparse mode without a pattern, detect the pattern from this (dense)
+  // Jacobian.
+  if (this->get_use_sparse_jacobian() && !Jy_sparsity_.has_value()) {
+    Jy_sparsity_ = internal::JacobianSparsity::FromDenseMatrix(*Jy);
+  }
+
   // Use the new number of ODE evaluations to determine the number of ODE
   // evaluations used in computing Jacobians.
   this->increment_jacobian_computation_derivative_evaluations(
       this->get_num_derivative_evaluations() - existing_ODE_evals);
+  this->increment_jacobian_computation_time(timer.Tick());
 }
 
 template <class T>
@@ -164,8 +189,17 @@ void VelocityImplicitEulerIntegrator<T>::ComputeAutoDiffVelocityJacobian(
     qdot_ad_ = std::make_unique<BasicVector<AutoDiffXd>>(qn.size());
   }
 
-  // Initialize an AutoDiff version of the variable y.
-  VectorX<AutoDiffXd> y_ad = math::InitializeAutoDiff(y);
+  // Initialize an AutoDiff version of the variable y. In sparse mode, seed one
+  // derivative per color of the pattern; the gradient of each element of ℓ(y)
+  // is then the sum of the columns of one color of the Jacobian.
+  const bool compressed = this->get_use_sparse_jacobian() &&
+                          Jy_sparsity_.has_value();
+  VectorX<AutoDiffXd> y_ad;
+  if (compressed) {
+    math::InitializeAutoDiff(y, Jy_sparsity_->MakeSeedMatrix(), &y_ad);
+  } else {
+    y_ad = math::InitializeAutoDiff(y);
+  }
 
   // Evaluate the AutoDiff system with y_ad.
   const VectorX<AutoDiffXd> result = this->ComputeLOfY(
@@ -181,6 +215,9 @@ void VelocityImplicitEulerIntegrator<T>::ComputeAutoDiffVelocityJacobian(
   const int ny = y.size();
   if (Jy->cols() == 0) {
     *Jy = MatrixX<T>::Zero(ny, ny);
+  } else if (compressed) {
+    const MatrixX<T> Jy_compressed = std::move(*Jy);
+    Jy_sparsity_->Decompress(Jy_compressed, Jy);
   }
 
   DRAKE_ASSERT(Jy->rows() == ny);
@@ -198,6 +235,8 @@ bool VelocityImplicitEulerIntegrator<T>::MaybeFreshenVelocityMatrices(
     MatrixX<T>* Jy) {
   DRAKE_DEMAND(Jy != nullptr);
   DRAKE_DEMAND(iteration_matrix != nullptr);
+  iteration_matrix->set_use_sparse_factorization(
+      this->get_use_sparse_jacobian());
   // Compute the initial Jacobian and iteration matrices and factor them, if
   // necessary.
   if (!this->get_reuse() || Jy->rows() == 0 || this->IsBadJacobian(*Jy)) {
@@ -245,7 +284,20 @@ bool VelocityImplicitEulerIntegrator<T>::MaybeFreshenVelocityMatrices(
       // optimization to abort this trial when matrices are already fresh in
       // ImplicitIntegrator<T>::MaybeFreshenMatrices() does not significantly
       // help here, especially because our Jacobian depends on step size h.
-      CalcVelocityJacobian(t, h, y, qk, qn, Jy);
+      //
+      // In sparse mode, the detected sparsity pattern may miss entries that
+      // were exactly zero where it was detected, which is one reason for the
+      // failures. So the Jacobian matrix is computed densely here, and its
+      // nonzeros are added to the pattern.
+      if (this->get_use_sparse_jacobian() && Jy_sparsity_.has_value()) {
+        internal::JacobianSparsity sparsity = std::move(*Jy_sparsity_);
+        Jy_sparsity_.reset();
+        CalcVelocityJacobian(t, h, y, qk, qn, Jy);
+        sparsity.Merge(*Jy_sparsity_);
+        Jy_sparsity_ = std::move(sparsity);
+      } else {
+        CalcVelocityJacobian(t, h, y, qk, qn, Jy);
+      }
       this->increment_num_iter_factorizations();
       compute_and_factor_iteration_matrix(*Jy, h, iteration_matrix);
       return true;
@@ -277,6 +329,8 @@ void VelocityImplicitEulerIntegrator<T>::FreshenVelocityMatricesIfFullNewton(
   if (!this->get_use_full_newton()) return;
 
   // Compute the initial Jacobian and iteration matrices and factor them.
+  iteration_matrix->set_use_sparse_factorization(
+      this->get_use_sparse_jacobian());
   CalcVelocityJacobian(t, h, y, qk, qn, Jy);
   this->increment_num_iter_factorizations();
   compute_and_factor_iteration_matrix(*Jy, h, iteration_matrix);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <stdexcept>
 
 #include "drake/common/autodiff.h"
@@ -640,6 +641,10 @@ class VelocityImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
   // The last computed velocity+misc Jacobian matrix.
   MatrixX<T> Jy_vie_;
 
+  // The sparsity pattern of the velocity+misc Jacobian matrix, detected from
+  // the first one computed when get_use_sparse_jacobian() is true.
+  std::optional<internal::JacobianSparsity> Jy_sparsity_;
+
   // Various statistics.
   int64_t num_nr_iterations_{0};
 
@@ -0,0 +1,89 @@
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/lcm/drake_lcm.h"
+#include "drake/lcmt_drake_signal.hpp"
+#include "drake/systems/lcm/lcm_subscriber_system.h"
+#include "drake/tools/performance/fixture_common.h"
+
+/* Latency of LcmSubscriberSystem: the time from publishing a message over an
+in-process (memq://) DrakeLcm loopback until the subscriber's output holds the
+decoded message, as the Simulator would deliver it. The first benchmark
+argument is the number of values in each lcmt_drake_signal message. */
+
+namespace drake {
+namespace systems {
+namespace lcm {
+namespace {
+
+class SubscriberFixture : public benchmark::Fixture {
+ public:
+  SubscriberFixture() {
+    tools::performance::AddMinMaxStatistics(this);
+  }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    lcm_ = std::make_unique<drake::lcm::DrakeLcm>("memq://");
+    dut_ = LcmSubscriberSystem::Make<lcmt_drake_signal>(kChannel, lcm_.get());
+    context_ = dut_->CreateDefaultContext();
+    events_ = dut_->AllocateCompositeEventCollection();
+    scratch_state_ = context_->CloneState();
+    const int n = state.range(0);
+    message_.dim = n;
+    message_.val.assign(n, 1.0);
+    message_.coord.assign(n, "coordinate");
+  }
+
+  using benchmark::Fixture::TearDown;
+  void TearDown(benchmark::State&) override {
+    scratch_state_.reset();
+    events_.reset();
+    context_.reset();
+    dut_.reset();
+    lcm_.reset();
+  }
+
+ protected:
+  static constexpr char kChannel[] = "STATE";
+
+  /* Publishes a message and delivers it to the subscriber's output. */
+  void PublishAndUpdate() {
+    ++message_.timestamp;
+    Publish(lcm_.get(), kChannel, message_);
+    lcm_->HandleSubscriptions(0);
+    // This is what the Simulator does for the subscriber's update event.
+    dut_->CalcNextUpdateTime(*context_, events_.get());
+    const auto& updates = events_->get_unrestricted_update_events();
+    dut_->CalcUnrestrictedUpdate(*context_, updates, scratch_state_.get());
+    dut_->ApplyUnrestrictedUpdate(updates, scratch_state_.get(),
+                                  context_.get());
+    benchmark::DoNotOptimize(
+        dut_->get_output_port().Eval<lcmt_drake_signal>(*context_));
+  }
+
+  std::unique_ptr<drake::lcm::DrakeLcm> lcm_;
+  std::unique_ptr<LcmSubscriberSystem> dut_;
+  std::unique_ptr<Context<double>> context_;
+  std::unique_ptr<CompositeEventCollection<double>> events_;
+  std::unique_ptr<State<double>> scratch_state_;
+  lcmt_drake_signal message_{};
+};
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(SubscriberFixture, PublishToOutput)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    PublishAndUpdate();
+  }
+}
+BENCHMARK_REGISTER_F(SubscriberFixture, PublishToOutput)
+    ->Arg(10)->Arg(100)->Arg(10000)->ArgName("values")
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace lcm
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,102 @@
+#include <memory>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/systems/controllers/linear_model_predictive_controller.h"
+#include "drake/systems/primitives/linear_system.h"
+#include "drake/tools/performance/fixture_common.h"
+
+/* Latency of LinearModelPredictiveController, regulating a discretized pair of
+masses coupled by a spring, versus the length of its horizon: both the one-time
+construction, which solves the QP, and each control update. The first
+benchmark argument is the number of samples in the horizon. */
+
+namespace drake {
+namespace systems {
+namespace controllers {
+namespace {
+
+constexpr double kTimeStep = 0.005;
+
+std::unique_ptr<LinearSystem<double>> MakeModel() {
+  // x = [q₁, q₂, v₁, v₂], with a unit force input on each mass, discretized
+  // by semi-implicit Euler.
+  Eigen::Matrix4d A_continuous = Eigen::Matrix4d::Zero();
+  A_continuous.topRightCorner<2, 2>().setIdentity();
+  A_continuous.bottomLeftCorner<2, 2>() << -2, 1, 1, -2;
+  Eigen::Matrix<double, 4, 2> B_continuous;
+  B_continuous << Eigen::Matrix2d::Zero(), Eigen::Matrix2d::Identity();
+  const Eigen::Matrix4d A =
+      Eigen::Matrix4d::Identity() + kTimeStep * A_continuous;
+  const Eigen::Matrix<double, 4, 2> B = kTimeStep * B_continuous;
+  return std::make_unique<LinearSystem<double>>(
+      A, B, Eigen::Matrix4d::Identity(), Eigen::Matrix<double, 4, 2>::Zero(),
+      kTimeStep);
+}
+
+std::unique_ptr<LinearModelPredictiveController<double>> MakeController(
+    int num_samples) {
+  std::unique_ptr<LinearSystem<double>> model = MakeModel();
+  std::unique_ptr<Context<double>> model_context =
+      model->CreateDefaultContext();
+  model->get_input_port().FixValue(model_context.get(),
+                                   Eigen::Vector2d::Zero());
+  return std::make_unique<LinearModelPredictiveController<double>>(
+      std::move(model), std::move(model_context),
+      Eigen::Matrix4d::Identity(), 0.01 * Eigen::Matrix2d::Identity(),
+      kTimeStep, num_samples * kTimeStep);
+}
+
+class MpcFixture : public benchmark::Fixture {
+ public:
+  MpcFixture() {
+    tools::performance::AddMinMaxStatistics(this);
+  }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    dut_ = MakeController(state.range(0));
+    context_ = dut_->CreateDefaultContext();
+  }
+
+  using benchmark::Fixture::TearDown;
+  void TearDown(benchmark::State&) override {
+    context_.reset();
+    dut_.reset();
+  }
+
+ protected:
+  std::unique_ptr<LinearModelPredictiveController<double>> dut_;
+  std::unique_ptr<Context<double>> context_;
+};
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(MpcFixture, Construct)(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(MakeController(state.range(0)));
+  }
+}
+BENCHMARK_REGISTER_F(MpcFixture, Construct)
+    ->Arg(10)->Arg(100)->Arg(1000)->ArgName("samples")
+    ->Unit(benchmark::kMicrosecond);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(MpcFixture, CalcControl)(benchmark::State& state) {
+  Eigen::Vector4d x(0.1, -0.2, 0.0, 0.3);
+  for (auto _ : state) {
+    // Change the state every time, as a controller running at a fixed rate
+    // would see, so that the output is never cached.
+    x(0) += 1e-6;
+    dut_->get_state_port().FixValue(context_.get(), x);
+    benchmark::DoNotOptimize(dut_->get_control_port().Eval(*context_));
+  }
+}
+BENCHMARK_REGISTER_F(MpcFixture, CalcControl)
+    ->Arg(10)->Arg(100)->Arg(1000)->ArgName("samples")
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace controllers
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,121 @@
+#include <cmath>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/systems/controllers/discrete_time_riccati_recursion.h"
+#include "drake/tools/performance/fixture_common.h"
+
+/* Latency of DiscreteTimeRiccatiRecursion's backward pass (Solve) and forward
+pass (Rollout) on a time-varying chain of masses, versus the length of the
+horizon, for fixed-size and dynamic-size matrices. The first benchmark argument
+is the number of steps in the horizon. */
+
+namespace drake {
+namespace systems {
+namespace controllers {
+namespace {
+
+// A chain of kNumInputs masses, each coupled to its neighbors by a spring
+// whose stiffness varies over the horizon, discretized by semi-implicit Euler.
+template <int kNumStates, int kNumInputs>
+void SetProblem(DiscreteTimeRiccatiRecursion<kNumStates, kNumInputs>* dut) {
+  const double h = 0.01;
+  const int num_masses = dut->num_inputs();
+  for (int k = 0; k < dut->num_steps(); ++k) {
+    const double stiffness = 1.0 + 0.5 * std::sin(0.01 * k);
+    auto& A = dut->A(k);
+    A.setIdentity();
+    A.topRightCorner(num_masses, num_masses).diagonal().setConstant(h);
+    for (int i = 0; i < num_masses; ++i) {
+      A(num_masses + i, i) -= 2 * h * stiffness;
+      if (i > 0) A(num_masses + i, i - 1) += h * stiffness;
+      if (i + 1 < num_masses) A(num_masses + i, i + 1) += h * stiffness;
+    }
+    dut->B(k).setZero();
+    dut->B(k).bottomRows(num_masses).diagonal().setConstant(h);
+    dut->Q(k).setIdentity();
+    dut->R(k).setIdentity() *= 0.01;
+    dut->q(k).setConstant(0.1);
+  }
+  dut->Qf().setIdentity() *= 10;
+}
+
+template <int kNumStates, int kNumInputs>
+class RecursionFixture : public benchmark::Fixture {
+ public:
+  RecursionFixture() {
+    tools::performance::AddMinMaxStatistics(this);
+  }
+
+ protected:
+  using Recursion = DiscreteTimeRiccatiRecursion<kNumStates, kNumInputs>;
+
+  void DoSolve(benchmark::State& state, int num_masses) {  // NOLINT
+    Recursion dut(2 * num_masses, num_masses, state.range(0));
+    SetProblem(&dut);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(dut.Solve());
+    }
+  }
+
+  void DoRollout(benchmark::State& state, int num_masses) {  // NOLINT
+    Recursion dut(2 * num_masses, num_masses, state.range(0));
+    SetProblem(&dut);
+    if (!dut.Solve()) state.SkipWithError("Solve() failed");
+    const typename Recursion::StateVector x0 =
+        Recursion::StateVector::Ones(2 * num_masses);
+    std::vector<typename Recursion::StateVector> x;
+    std::vector<typename Recursion::InputVector> u;
+    for (auto _ : state) {
+      dut.Rollout(x0, &x, &u);
+      benchmark::DoNotOptimize(u.back());
+    }
+  }
+};
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_TEMPLATE_DEFINE_F(RecursionFixture, SolveFixed4x2, 4, 2)
+(benchmark::State& state) { DoSolve(state, 2); }
+// NOLINTNEXTLINE(runtime/references)
+BENCHMARK_TEMPLATE_DEFINE_F(RecursionFixture, SolveDynamic4x2,
+                            Eigen::Dynamic, Eigen::Dynamic)
+(benchmark::State& state) { DoSolve(state, 2); }
+// NOLINTNEXTLINE(runtime/references)
+BENCHMARK_TEMPLATE_DEFINE_F(RecursionFixture, SolveFixed12x6, 12, 6)
+(benchmark::State& state) { DoSolve(state, 6); }
+// NOLINTNEXTLINE(runtime/references)
+BENCHMARK_TEMPLATE_DEFINE_F(RecursionFixture, SolveDynamic12x6,
+                            Eigen::Dynamic, Eigen::Dynamic)
+(benchmark::State& state) { DoSolve(state, 6); }
+// NOLINTNEXTLINE(runtime/references)
+BENCHMARK_TEMPLATE_DEFINE_F(RecursionFixture, RolloutFixed12x6, 12, 6)
+(benchmark::State& state) { DoRollout(state, 6); }
+// NOLINTNEXTLINE(runtime/references)
+BENCHMARK_TEMPLATE_DEFINE_F(RecursionFixture, RolloutDynamic12x6,
+                            Eigen::Dynamic, Eigen::Dynamic)
+(benchmark::State& state) { DoRollout(state, 6); }
+
+BENCHMARK_REGISTER_F(RecursionFixture, SolveFixed4x2)
+    ->Arg(10)->Arg(100)->Arg(1000)->ArgName("steps")
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(RecursionFixture, SolveDynamic4x2)
+    ->Arg(10)->Arg(100)->Arg(1000)->ArgName("steps")
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(RecursionFixture, SolveFixed12x6)
+    ->Arg(10)->Arg(100)->Arg(1000)->ArgName("steps")
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(RecursionFixture, SolveDynamic12x6)
+    ->Arg(10)->Arg(100)->Arg(1000)->ArgName("steps")
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(RecursionFixture, RolloutFixed12x6)
+    ->Arg(10)->Arg(100)->Arg(1000)->ArgName("steps")
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(RecursionFixture, RolloutDynamic12x6)
+    ->Arg(10)->Arg(100)->Arg(1000)->ArgName("steps")
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace controllers
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,305 @@
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Cholesky>
+#include <Eigen/Core>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace systems {
+namespace controllers {
+
+/// Solves the finite-horizon, discrete-time, time-varying linear quadratic
+/// (LQ) tracking problem
+///
+///   @f[ \min_u x[N]'Q_fx[N] + 2q_f'x[N] + \sum_{k=0}^{N-1} x[k]'Q[k]x[k] +
+///          u[k]'R[k]u[k] + 2x[k]'N[k]u[k] + 2q[k]'x[k] + 2r[k]'u[k] @f]
+///   @f[ \mathrm{s.t. } x[k+1] = A[k]x[k] + B[k]u[k] + c[k] @f]
+///
+/// by a backward Riccati recursion, which takes O(N) time rather than the
+/// O(N³) of factoring the problem's KKT system as a whole. The optimal input is
+/// u[k] = -K[k]x[k] - k₀[k], and the optimal cost-to-go from x[k] is
+/// x[k]'S[k]x[k] + 2s[k]'x[k] + s₀[k].
+///
+/// This is the stage-wise subproblem of linear model predictive control and of
+/// iterative LQR / differential dynamic programming, both of which solve it
+/// repeatedly for the same dimensions. All of the problem data, solution, and
+/// workspace storage is therefore allocated at construction; the problem data
+/// are written in place through the mutable accessors (which default to zero,
+/// except for R[k] = I), and Solve() and Rollout() don't allocate memory.
+///
+/// @tparam kNumStates the number of states, or Eigen::Dynamic. Fixed sizes
+/// let Eigen unroll and vectorize the small matrix products that dominate the
+/// recursion for systems with only a few states.
+/// @tparam kNumInputs the number of inputs, or Eigen::Dynamic.
+template <int kNumStates = Eigen::Dynamic, int kNumInputs = Eigen::Dynamic>
+class DiscreteTimeRiccatiRecursion {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(DiscreteTimeRiccatiRecursion)
+
+  using StateVector = Eigen::Matrix<double, kNumStates, 1>;
+  using InputVector = Eigen::Matrix<double, kNumInputs, 1>;
+  using StateMatrix = Eigen::Matrix<double, kNumStates, kNumStates>;
+  using InputMatrix = Eigen::Matrix<double, kNumInputs, kNumInputs>;
+  /// The type of B[k] and N[k].
+  using StateInputMatrix = Eigen::Matrix<double, kNumStates, kNumInputs>;
+  /// The type of K[k].
+  using GainMatrix = Eigen::Matrix<double, kNumInputs, kNumStates>;
+
+  /// Allocates a problem with @p num_steps steps (N above).
+  /// @throws std::exception if @p num_states or @p num_inputs doesn't match a
+  ///         fixed size, or if any argument is negative.
+  DiscreteTimeRiccatiRecursion(int num_states, int num_inputs, int num_steps);
+
+  int num_states() const { return num_states_; }
+  int num_inputs() const { return num_inputs_; }
+  int num_steps() const { return static_cast<int>(A_.size()); }
+
+  /// @name Problem data
+  /// The problem data for step k, for 0 ≤ k < num_steps().
+  /// @{
+  StateMatrix& A(int k) { return A_[check(k)]; }
+  StateInputMatrix& B(int k) { return B_[check(k)]; }
+  StateVector& c(int k) { return c_[check(k)]; }
+  StateMatrix& Q(int k) { return Q_[check(k)]; }
+  InputMatrix& R(int k) { return R_[check(k)]; }
+  StateInputMatrix& N(int k) { return N_[check(k)]; }
+  StateVector& q(int k) { return q_[check(k)]; }
+  InputVector& r(int k) { return r_[check(k)]; }
+  StateMatrix& Qf() { return S_.back(); }
+  StateVector& qf() { return s_.back(); }
+  /// @}
+
+  /// Sets the problem data of every step to that of a time-invariant problem
+  /// with no linear terms.
+  void SetTimeInvariant(const Eigen::Ref<const Eigen::MatrixXd>& A,
+                        const Eigen::Ref<const Eigen::MatrixXd>& B,
+                        const Eigen::Ref<const Eigen::MatrixXd>& Q,
+                        const Eigen::Ref<const Eigen::MatrixXd>& R);
+
+  /// Computes K[k], k₀[k], S[k], s[k], and s₀[k] for every step, by backward
+  /// recursion from S[N] = Q_f, s[N] = q_f, and s₀[N] = 0.
+  ///
+  /// Each step minimizes a quadratic in u[k] whose Hessian is
+  /// R[k] + B[k]'S[k+1]B[k]. Iterative LQR adds @p regularization times the
+  /// identity to it, to keep it positive definite when the problem is only a
+  /// local, possibly nonconvex, approximation. The regularization only
+  /// changes the gains K[k] and k₀[k]: S[k], s[k], and s₀[k] are still the
+  /// exact cost-to-go of the returned policy (which is then no longer
+  /// optimal), so that x[0]'S[0]x[0] + 2s[0]'x[0] + s₀[0] remains the cost that
+  /// the policy achieves.
+  /// @returns `false` if that Hessian (with the regularization) isn't
+  ///          positive definite at some step, in which case the solution is
+  ///          only valid for the later steps.
+  [[nodiscard]] bool Solve(double regularization = 0.0);
+
+  /// @name Solution
+  /// The solution for step k, for 0 ≤ k ≤ num_steps() (S, s, and s₀) or
+  /// 0 ≤ k < num_steps() (K and k₀), as computed by the last Solve().
+  /// @{
+  const GainMatrix& K(int k) const { return K_[check(k)]; }
+  const InputVector& k0(int k) const { return k0_[check(k)]; }
+  const StateMatrix& S(int k) const { return S_[check(k, 1)]; }
+  const StateVector& s(int k) const { return s_[check(k, 1)]; }
+  double s0(int k) const { return s0_[check(k, 1)]; }
+  /// @}
+
+  /// Computes the optimal state and input sequences from the initial state
+  /// @p x0, by forward simulation of the dynamics in closed loop with the
+  /// optimal policy.
+  /// @param[out] x the states x[0], ..., x[N]; resized only if needed.
+  /// @param[out] u the inputs u[0], ..., u[N-1]; resized only if needed.
+  void Rollout(const Eigen::Ref<const StateVector>& x0,
+               std::vector<StateVector>* x,
+               std::vector<InputVector>* u) const;
+
+ private:
+  int check(int k, int extra = 0) const {
+    DRAKE_ASSERT(k >= 0 && k < num_steps() + extra);
+    return k;
+  }
+
+  int num_states_{};
+  int num_inputs_{};
+
+  // Problem data.
+  std::vector<StateMatrix> A_;
+  std::vector<StateInputMatrix> B_;
+  std::vector<StateVector> c_;
+  std::vector<StateMatrix> Q_;
+  std::vector<InputMatrix> R_;
+  std::vector<StateInputMatrix> N_;
+  std::vector<StateVector> q_;
+  std::vector<InputVector> r_;
+
+  // Solution. The last elements of S_ and s_ hold Q_f and q_f.
+  std::vector<GainMatrix> K_;
+  std::vector<InputVector> k0_;
+  std::vector<StateMatrix> S_;
+  std::vector<StateVector> s_;
+  std::vector<double> s0_;
+
+  // Workspace for Solve(): the coefficients of the quadratic that each step
+  // minimizes over u[k], and products with S[k+1].
+  StateMatrix SA_;
+  StateInputMatrix SB_;
+  StateVector Sc_plus_s_;
+  StateMatrix Qxx_;
+  InputMatrix Quu_;
+  GainMatrix Qux_;
+  StateVector qx_;
+  InputVector qu_;
+  Eigen::LLT<InputMatrix> Quu_llt_;
+};
+
+template <int kNumStates, int kNumInputs>
+DiscreteTimeRiccatiRecursion<kNumStates, kNumInputs>::
+    DiscreteTimeRiccatiRecursion(int num_states, int num_inputs, int num_steps)
+    : num_states_(num_states), num_inputs_(num_inputs) {
+  DRAKE_THROW_UNLESS(num_states >= 0 && num_inputs >= 0 && num_steps >= 0);
+  DRAKE_THROW_UNLESS(kNumStates == Eigen::Dynamic || kNumStates == num_states);
+  DRAKE_THROW_UNLESS(kNumInputs == Eigen::Dynamic || kNumInputs == num_inputs);
+  const int n = num_states;
+  const int m = num_inputs;
+  A_.assign(num_steps, StateMatrix::Zero(n, n));
+  B_.assign(num_steps, StateInputMatrix::Zero(n, m));
+  c_.assign(num_steps, StateVector::Zero(n));
+  Q_.assign(num_steps, StateMatrix::Zero(n, n));
+  R_.assign(num_steps, InputMatrix::Identity(m, m));
+  N_.assign(num_steps, StateInputMatrix::Zero(n, m));
+  q_.assign(num_steps, StateVector::Zero(n));
+  r_.assign(num_steps, InputVector::Zero(m));
+  K_.assign(num_steps, GainMatrix::Zero(m, n));
+  k0_.assign(num_steps, InputVector::Zero(m));
+  S_.assign(num_steps + 1, StateMatrix::Zero(n, n));
+  s_.assign(num_steps + 1, StateVector::Zero(n));
+  s0_.assign(num_steps + 1, 0.0);
+  SA_.resize(n, n);
+  SB_.resize(n, m);
+  Sc_plus_s_.resize(n);
+  Qxx_.resize(n, n);
+  Quu_.resize(m, m);
+  Qux_.resize(m, n);
+  qx_.resize(n);
+  qu_.resize(m);
+  if constexpr (kNumInputs == Eigen::Dynamic) {
+    Quu_llt_ = Eigen::LLT<InputMatrix>(m);
+  }
+}
+
+template <int kNumStates, int kNumInputs>
+void DiscreteTimeRiccatiRecursion<kNumStates, kNumInputs>::SetTimeInvariant(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R) {
+  const int n = num_states_;
+  const int m = num_inputs_;
+  DRAKE_THROW_UNLESS(A.rows() == n && A.cols() == n);
+  DRAKE_THROW_UNLESS(B.rows() == n && B.cols() == m);
+  DRAKE_THROW_UNLESS(Q.rows() == n && Q.cols() == n);
+  DRAKE_THROW_UNLESS(R.rows() == m && R.cols() == m);
+  for (int k = 0; k < num_steps(); ++k) {
+    A_[k] = A;
+    B_[k] = B;
+    c_[k].setZero();
+    Q_[k] = Q;
+    R_[k] = R;
+    N_[k].setZero();
+    q_[k].setZero();
+    r_[k].setZero();
+  }
+}
+
+template <int kNumStates, int kNumInputs>
+bool DiscreteTimeRiccatiRecursion<kNumStates, kNumInputs>::Solve(
+    double regularization) {
+  s0_.back() = 0.0;
+  for (int k = num_steps() - 1; k >= 0; --k) {
+    const StateMatrix& S_next = S_[k + 1];
+    const StateVector& s_next = s_[k + 1];
+
+    // Substituting the dynamics into the cost-to-go from x[k+1] gives a
+    // quadratic in (x[k], u[k]):
+    //   x'Qxx x + u'Quu u + 2u'Qux x + 2qx'x + 2qu'u + const.
+    SA_.noalias() = S_next * A_[k];
+    SB_.noalias() = S_next * B_[k];
+    Sc_plus_s_ = s_next;
+    Sc_plus_s_.noalias() += S_next * c_[k];
+    Qxx_ = Q_[k];
+    Qxx_.noalias() += A_[k].transpose() * SA_;
+    Quu_ = R_[k];
+    Quu_.noalias() += B_[k].transpose() * SB_;
+    Quu_.diagonal().array() += regularization;
+    Qux_ = N_[k].transpose();
+    Qux_.noalias() += B_[k].transpose() * SA_;
+    qx_ = q_[k];
+    qx_.noalias() += A_[k].transpose() * Sc_plus_s_;
+    qu_ = r_[k];
+    qu_.noalias() += B_[k].transpose() * Sc_plus_s_;
+
+    // Minimizing over u[k] gives u[k] = -Quu⁻¹(Qux x[k] + qu).
+    Quu_llt_.compute(Quu_);
+    if (Quu_llt_.info() != Eigen::Success) return false;
+    K_[k] = Qux_;
+    Quu_llt_.solveInPlace(K_[k]);
+    k0_[k] = qu_;
+    Quu_llt_.solveInPlace(k0_[k]);
+
+    // And the cost-to-go from x[k] under that policy. Substituting
+    // u = -Kx - k₀ into the quadratic, with its unregularized Hessian
+    // Quu - μI, gives S = Qxx + K'(Quu - μI)K - K'Qux - Qux'K. Since
+    // Quu K = Qux, that is Qxx - Qux'K - μK'K, and likewise for s and s₀.
+    StateMatrix& S = S_[k];
+    S = Qxx_;
+    S.noalias() -= Qux_.transpose() * K_[k];
+    if (regularization != 0.0) {
+      S.noalias() -= regularization * K_[k].transpose() * K_[k];
+    }
+    // Symmetrize, so that roundoff doesn't accumulate over long horizons.
+    for (int j = 0; j < num_states_; ++j) {
+      for (int i = j + 1; i < num_states_; ++i) {
+        S(i, j) = S(j, i) = 0.5 * (S(i, j) + S(j, i));
+      }
+    }
+    s_[k] = qx_;
+    s_[k].noalias() -= Qux_.transpose() * k0_[k];
+    // c'S c + 2s'c = c'(S c + s) + s'c.
+    s0_[k] = s0_[k + 1] + c_[k].dot(Sc_plus_s_) + s_next.dot(c_[k]) -
+             qu_.dot(k0_[k]);
+    if (regularization != 0.0) {
+      s_[k].noalias() -= regularization * K_[k].transpose() * k0_[k];
+      s0_[k] -= regularization * k0_[k].squaredNorm();
+    }
+  }
+  return true;
+}
+
+template <int kNumStates, int kNumInputs>
+void DiscreteTimeRiccatiRecursion<kNumStates, kNumInputs>::Rollout(
+    const Eigen::Ref<const StateVector>& x0, std::vector<StateVector>* x,
+    std::vector<InputVector>* u) const {
+  DRAKE_THROW_UNLESS(x != nullptr && u != nullptr);
+  DRAKE_THROW_UNLESS(x0.size() == num_states_);
+  const int num_steps = this->num_steps();
+  x->resize(num_steps + 1);
+  u->resize(num_steps);
+  (*x)[0] = x0;
+  for (int k = 0; k < num_steps; ++k) {
+    InputVector& u_k = (*u)[k];
+    u_k = -k0_[k];
+    u_k.noalias() -= K_[k] * (*x)[k];
+    StateVector& x_next = (*x)[k + 1];
+    x_next = c_[k];
+    x_next.noalias() += A_[k] * (*x)[k];
+    x_next.noalias() += B_[k] * u_k;
+  }
+}
+
+}  // namespace controllers
+}  // namespace systems
+}  // namespace drake
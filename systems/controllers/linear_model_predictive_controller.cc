@@ -4,16 +4,12 @@
 #include <utility>
 
 #include "drake/common/eigen_types.h"
-#include "drake/solvers/solve.h"
-#include "drake/systems/trajectory_optimization/direct_transcription.h"
+#include "drake/systems/controllers/discrete_time_riccati_recursion.h"
 
 namespace drake {
 namespace systems {
 namespace controllers {
 
-using solvers::VectorXDecisionVariable;
-using trajectory_optimization::DirectTranscription;
-
 template <typename T>
 LinearModelPredictiveController<T>::LinearModelPredictiveController(
     std::unique_ptr<systems::System<double>> model,
@@ -66,51 +62,43 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
 
   if (base_context_ != nullptr) {
     linear_model_ = Linearize(*model_, *base_context_);
+    CalcFeedbackGain();
   }
 }
 
 template <typename T>
 void LinearModelPredictiveController<T>::CalcControl(
     const Context<T>& context, BasicVector<T>* control) const {
-  const VectorX<T>& current_state = get_state_port().Eval(context);
+  DRAKE_DEMAND(linear_model_ != nullptr);
 
-  const Eigen::VectorXd current_input =
-      SetupAndSolveQp(*base_context_, current_state);
+  const VectorX<T>& current_state = get_state_port().Eval(context);
+  const VectorX<T> state_ref =
+      base_context_->get_discrete_state().get_vector().CopyToVector();
 
   const VectorX<T> input_ref = model_->get_input_port(0).Eval(*base_context_);
 
-  control->SetFromVector(current_input + input_ref);
+  control->SetFromVector(input_ref - K_ * (current_state - state_ref));
 
   // TODO(jadecastro) Implement the time-varying case.
 }
 
 template <typename T>
-VectorX<T> LinearModelPredictiveController<T>::SetupAndSolveQp(
-    const Context<T>& base_context, const VectorX<T>& current_state) const {
-  DRAKE_DEMAND(linear_model_ != nullptr);
-
-  const int kNumSampleTimes =
+void LinearModelPredictiveController<T>::CalcFeedbackGain() {
+  const int num_sample_times =
       static_cast<int>(time_horizon_ / time_period_ + 0.5);
-
-  DirectTranscription dirtran(linear_model_.get(), *base_context_,
-                              kNumSampleTimes);
-  auto& prog = dirtran.prog();
-
-  const auto state_error = dirtran.state();
-  const auto input_error = dirtran.input();
-
-  dirtran.AddRunningCost(state_error.transpose() * Q_ * state_error +
-                         input_error.transpose() * R_ * input_error);
-
-  const VectorX<T> state_ref =
-      base_context.get_discrete_state().get_vector().CopyToVector();
-  prog.AddLinearConstraint(dirtran.initial_state() ==
-                           current_state - state_ref);
-
-  const auto result = Solve(prog);
-  DRAKE_DEMAND(result.is_success());
-
-  return dirtran.GetInputSamples(result).col(0);
+  DRAKE_DEMAND(num_sample_times >= 2);
+
+  // This is the QP that a DirectTranscription of the linear model with
+  // num_sample_times samples would pose: the running cost applies to the
+  // first num_sample_times - 1 samples, and the final state is free (i.e.,
+  // has no cost).
+  DiscreteTimeRiccatiRecursion<> recursion(num_states_, num_inputs_,
+                                           num_sample_times - 1);
+  recursion.SetTimeInvariant(linear_model_->A(), linear_model_->B(), Q_, R_);
+  // R + B'SB is positive definite, since R is.
+  const bool success = recursion.Solve();
+  DRAKE_DEMAND(success);
+  K_ = recursion.K(0);
 }
 
 template class LinearModelPredictiveController<double>;
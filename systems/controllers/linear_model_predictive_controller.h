@@ -23,9 +23,14 @@ namespace controllers {
 ///
 /// and subject to linear inequality constraints on the inputs and states, where
 /// N is the horizon length, Q and R are cost matrices, and xd and ud are the
-/// desired states and inputs, respectively.  Note that the present
-/// implementation solves the QP in whole at every time step, discarding any
-/// information between steps.
+/// desired states and inputs, respectively.
+///
+/// Since the present implementation imposes no inequality constraints, the
+/// optimal u(k) is a linear function of the state error x(k) - xd(k). The
+/// controller therefore solves the QP once, at construction, by a backward
+/// Riccati recursion over the horizon (which costs O(N) rather than the O(N³)
+/// of a general-purpose QP solver), and each control update only multiplies
+/// the current state error by the resulting gain.
 ///
 /// @system
 /// name: LinearModelPredictiveController
@@ -84,10 +89,10 @@ class LinearModelPredictiveController : public LeafSystem<T> {
  private:
   void CalcControl(const Context<T>& context, BasicVector<T>* control) const;
 
-  // Sets up a DirectTranscription problem and solves for the current control
-  // input.
-  VectorX<T> SetupAndSolveQp(const Context<T>& base_context,
-                             const VectorX<T>& current_state) const;
+  // Solves the QP, for every initial state at once, using
+  // DiscreteTimeRiccatiRecursion, setting K_ such that the optimal first input
+  // is u(k) = -K_ (x(k) - xd(k)).
+  void CalcFeedbackGain();
 
   const int state_input_index_{-1};
   const int control_output_index_{-1};
@@ -107,6 +112,9 @@ class LinearModelPredictiveController : public LeafSystem<T> {
 
   // Descrption of the linearized plant model.
   std::unique_ptr<LinearSystem<double>> linear_model_;
+
+  // The gain of the optimal first input, see CalcFeedbackGain().
+  Eigen::MatrixXd K_;
 };
 
 }  // namespace controllers
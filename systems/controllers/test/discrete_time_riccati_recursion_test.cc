@@ -0,0 +1,207 @@
+#include "drake/systems/controllers/discrete_time_riccati_recursion.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace systems {
+namespace controllers {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+constexpr int kNumStates = 3;
+constexpr int kNumInputs = 2;
+constexpr int kNumSteps = 8;
+
+// Fills in a time-varying problem, with every term present.
+template <int kN, int kM>
+void SetProblem(DiscreteTimeRiccatiRecursion<kN, kM>* dut) {
+  for (int k = 0; k < dut->num_steps(); ++k) {
+    const double phase = 0.3 * k;
+    dut->A(k) << 1.0, 0.1, 0.0,
+                 -0.1 * std::cos(phase), 1.0, 0.1,
+                 0.0, 0.05, 0.9 + 0.01 * k;
+    dut->B(k) << 0.0, 0.1,
+                 0.1, 0.0,
+                 0.02 * std::sin(phase), 0.1;
+    dut->c(k) << 0.01, -0.02 * k, 0.005;
+    dut->Q(k) = Eigen::Vector3d(1.0, 0.5 + 0.1 * k, 2.0).asDiagonal();
+    dut->R(k) << 0.5, 0.1, 0.1, 1.0;
+    dut->N(k) << 0.1, 0.0, 0.0, 0.05, -0.02, 0.0;
+    dut->q(k) << 0.3, -0.1, 0.2 * std::sin(phase);
+    dut->r(k) << -0.05, 0.1;
+  }
+  dut->Qf() = 10 * Eigen::Matrix3d::Identity();
+  dut->qf() << -1.0, 0.0, 0.5;
+}
+
+// Solves the problem as a whole, by factoring its KKT system, and returns the
+// optimal cost along with the optimal states and inputs.
+double SolveKkt(DiscreteTimeRiccatiRecursion<>* dut, const VectorXd& x0,
+                std::vector<VectorXd>* x, std::vector<VectorXd>* u) {
+  const int n = dut->num_states();
+  const int m = dut->num_inputs();
+  const int N = dut->num_steps();
+  // The decision variables are [x[0], ..., x[N], u[0], ..., u[N-1]], and
+  // the cost is ½z'Hz + g'z.
+  const int num_vars = (N + 1) * n + N * m;
+  const int num_constraints = (N + 1) * n;
+  const auto x_index = [n](int k) { return k * n; };
+  const auto u_index = [n, m, N](int k) { return (N + 1) * n + k * m; };
+  MatrixXd H = MatrixXd::Zero(num_vars, num_vars);
+  VectorXd g = VectorXd::Zero(num_vars);
+  MatrixXd Aeq = MatrixXd::Zero(num_constraints, num_vars);
+  VectorXd beq = VectorXd::Zero(num_constraints);
+  for (int k = 0; k < N; ++k) {
+    H.block(x_index(k), x_index(k), n, n) = 2 * dut->Q(k);
+    H.block(u_index(k), u_index(k), m, m) = 2 * dut->R(k);
+    H.block(x_index(k), u_index(k), n, m) = 2 * dut->N(k);
+    H.block(u_index(k), x_index(k), m, n) = 2 * dut->N(k).transpose();
+    g.segment(x_index(k), n) = 2 * dut->q(k);
+    g.segment(u_index(k), m) = 2 * dut->r(k);
+    // A x[k] + B u[k] - x[k+1] = -c.
+    Aeq.block(k * n, x_index(k), n, n) = dut->A(k);
+    Aeq.block(k * n, u_index(k), n, m) = dut->B(k);
+    Aeq.block(k * n, x_index(k + 1), n, n) = -MatrixXd::Identity(n, n);
+    beq.segment(k * n, n) = -dut->c(k);
+  }
+  H.block(x_index(N), x_index(N), n, n) = 2 * dut->Qf();
+  g.segment(x_index(N), n) = 2 * dut->qf();
+  Aeq.block(N * n, x_index(0), n, n) = MatrixXd::Identity(n, n);
+  beq.segment(N * n, n) = x0;
+
+  MatrixXd kkt = MatrixXd::Zero(num_vars + num_constraints,
+                                num_vars + num_constraints);
+  kkt.topLeftCorner(num_vars, num_vars) = H;
+  kkt.topRightCorner(num_vars, num_constraints) = Aeq.transpose();
+  kkt.bottomLeftCorner(num_constraints, num_vars) = Aeq;
+  VectorXd rhs(num_vars + num_constraints);
+  rhs << -g, beq;
+  const VectorXd z = kkt.fullPivLu().solve(rhs).head(num_vars);
+
+  x->resize(N + 1);
+  u->resize(N);
+  for (int k = 0; k <= N; ++k) (*x)[k] = z.segment(x_index(k), n);
+  for (int k = 0; k < N; ++k) (*u)[k] = z.segment(u_index(k), m);
+  return 0.5 * z.dot(H * z) + g.dot(z);
+}
+
+GTEST_TEST(DiscreteTimeRiccatiRecursionTest, MatchesKkt) {
+  DiscreteTimeRiccatiRecursion<> dut(kNumStates, kNumInputs, kNumSteps);
+  EXPECT_EQ(dut.num_states(), kNumStates);
+  EXPECT_EQ(dut.num_inputs(), kNumInputs);
+  EXPECT_EQ(dut.num_steps(), kNumSteps);
+  SetProblem(&dut);
+  ASSERT_TRUE(dut.Solve());
+
+  const Eigen::Vector3d x0(0.5, -1.0, 2.0);
+  std::vector<VectorXd> x, u;
+  dut.Rollout(x0, &x, &u);
+  std::vector<VectorXd> x_expected, u_expected;
+  const double cost = SolveKkt(&dut, x0, &x_expected, &u_expected);
+
+  const double kTolerance = 1e-10;
+  ASSERT_EQ(static_cast<int>(x.size()), kNumSteps + 1);
+  ASSERT_EQ(static_cast<int>(u.size()), kNumSteps);
+  for (int k = 0; k <= kNumSteps; ++k) {
+    EXPECT_TRUE(CompareMatrices(x[k], x_expected[k], kTolerance));
+  }
+  for (int k = 0; k < kNumSteps; ++k) {
+    EXPECT_TRUE(CompareMatrices(u[k], u_expected[k], kTolerance));
+  }
+
+  // The cost-to-go from x[0] is the optimal cost.
+  EXPECT_NEAR(x0.dot(dut.S(0) * x0) + 2 * dut.s(0).dot(x0) + dut.s0(0), cost,
+              kTolerance * std::abs(cost));
+  EXPECT_TRUE(CompareMatrices(dut.S(kNumSteps), dut.Qf()));
+  EXPECT_TRUE(CompareMatrices(dut.s(kNumSteps), dut.qf()));
+  EXPECT_EQ(dut.s0(kNumSteps), 0.0);
+}
+
+GTEST_TEST(DiscreteTimeRiccatiRecursionTest, FixedSize) {
+  DiscreteTimeRiccatiRecursion<> dynamic(kNumStates, kNumInputs, kNumSteps);
+  DiscreteTimeRiccatiRecursion<kNumStates, kNumInputs> fixed(
+      kNumStates, kNumInputs, kNumSteps);
+  SetProblem(&dynamic);
+  SetProblem(&fixed);
+  ASSERT_TRUE(dynamic.Solve());
+  ASSERT_TRUE(fixed.Solve());
+  for (int k = 0; k < kNumSteps; ++k) {
+    EXPECT_TRUE(CompareMatrices(fixed.K(k), dynamic.K(k), 1e-12));
+    EXPECT_TRUE(CompareMatrices(fixed.k0(k), dynamic.k0(k), 1e-12));
+  }
+
+  using FixedRecursion = DiscreteTimeRiccatiRecursion<kNumStates, kNumInputs>;
+  EXPECT_THROW(FixedRecursion(kNumStates + 1, kNumInputs, 1), std::exception);
+  EXPECT_THROW(FixedRecursion(kNumStates, kNumInputs + 1, 1), std::exception);
+}
+
+GTEST_TEST(DiscreteTimeRiccatiRecursionTest, TimeInvariant) {
+  // With a long horizon, the gain at the first step approaches the
+  // infinite-horizon gain, i.e., the Riccati recursion converges to the
+  // solution of the discrete algebraic Riccati equation.
+  Eigen::Matrix2d A;
+  A << 1, 0.1, 0, 1;
+  const Eigen::Vector2d B(0.005, 0.1);
+  DiscreteTimeRiccatiRecursion<2, 1> dut(2, 1, 500);
+  dut.SetTimeInvariant(A, B, Eigen::Matrix2d::Identity(), Vector1d(1.0));
+  ASSERT_TRUE(dut.Solve());
+  const Eigen::Matrix2d& S = dut.S(0);
+  // S = Q + A'SA - A'SB(R + B'SB)⁻¹B'SA.
+  const Eigen::Vector2d ASB = A.transpose() * S * B;
+  const Eigen::Matrix2d S_next = Eigen::Matrix2d::Identity() +
+                                 A.transpose() * S * A -
+                                 ASB * ASB.transpose() / (1.0 + B.dot(S * B));
+  EXPECT_TRUE(CompareMatrices(S, S_next, 1e-8 * S.norm()));
+  EXPECT_TRUE(CompareMatrices(dut.K(0), dut.K(1), 1e-8));
+}
+
+GTEST_TEST(DiscreteTimeRiccatiRecursionTest, Regularization) {
+  DiscreteTimeRiccatiRecursion<> dut(1, 1, 3);
+  dut.SetTimeInvariant(Vector1d(1.0), Vector1d(1.0), Vector1d(1.0),
+                       Vector1d(-2.0));
+  // With a negative R, the quadratic in the last input is concave.
+  EXPECT_FALSE(dut.Solve());
+  EXPECT_TRUE(dut.Solve(3.0));
+}
+
+// With regularization, the gains are no longer optimal, but S, s, and s₀ are
+// still the cost-to-go of the policy that Solve() returns.
+GTEST_TEST(DiscreteTimeRiccatiRecursionTest, RegularizedCostToGo) {
+  DiscreteTimeRiccatiRecursion<> dut(kNumStates, kNumInputs, kNumSteps);
+  SetProblem(&dut);
+  ASSERT_TRUE(dut.Solve(0.7));
+
+  // Simulates the policy from x0 and returns its cost.
+  auto policy_cost = [&dut](const VectorXd& x0) {
+    std::vector<VectorXd> x, u;
+    dut.Rollout(x0, &x, &u);
+    double cost = x[kNumSteps].dot(dut.Qf() * x[kNumSteps]) +
+                  2 * dut.qf().dot(x[kNumSteps]);
+    for (int k = 0; k < kNumSteps; ++k) {
+      cost += x[k].dot(dut.Q(k) * x[k]) + u[k].dot(dut.R(k) * u[k]) +
+              2 * x[k].dot(dut.N(k) * u[k]) + 2 * dut.q(k).dot(x[k]) +
+              2 * dut.r(k).dot(u[k]);
+    }
+    return cost;
+  };
+  const Eigen::Vector3d x0(0.5, -1.0, 2.0);
+  const double cost = policy_cost(x0);
+  EXPECT_NEAR(x0.dot(dut.S(0) * x0) + 2 * dut.s(0).dot(x0) + dut.s0(0), cost,
+              1e-10 * std::abs(cost));
+  // From the origin, only s₀ contributes.
+  const double cost_from_origin = policy_cost(Eigen::Vector3d::Zero());
+  EXPECT_NEAR(dut.s0(0), cost_from_origin,
+              1e-10 * std::abs(cost_from_origin));
+}
+
+}  // namespace
+}  // namespace controllers
+}  // namespace systems
+}  // namespace drake
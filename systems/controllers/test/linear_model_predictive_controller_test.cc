@@ -4,10 +4,12 @@
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/math/discrete_algebraic_riccati_equation.h"
+#include "drake/solvers/solve.h"
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/diagram.h"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/primitives/linear_system.h"
+#include "drake/systems/trajectory_optimization/direct_transcription.h"
 
 namespace drake {
 namespace systems {
@@ -15,6 +17,7 @@ namespace controllers {
 namespace {
 
 using math::DiscreteAlgebraicRiccatiEquation;
+using trajectory_optimization::DirectTranscription;
 
 class TestMpcWithDoubleIntegrator : public ::testing::Test {
  protected:
@@ -81,6 +84,54 @@ TEST_F(TestMpcWithDoubleIntegrator, TestAgainstInfiniteHorizonSolution) {
                               kTolerance));
 }
 
+// Compares the controller against a DirectTranscription of the same QP over a
+// short horizon, where it differs substantially from the infinite-horizon
+// solution, and about a nonzero reference.
+GTEST_TEST(TestMpcAgainstQp, ShortHorizon) {
+  const double kTimeStep = 0.1;
+  const int kNumSampleTimes = 6;
+
+  Eigen::Matrix3d A;
+  A << 1.1, 0.2, 0, -0.1, 0.9, 0.3, 0, 0.2, 1.0;
+  Eigen::Matrix<double, 3, 2> B;
+  B << 0.1, 0, 0.05, 0.1, 0, 0.2;
+  const Eigen::Matrix3d C = Eigen::Matrix3d::Identity();
+  const Eigen::Matrix<double, 3, 2> D = Eigen::Matrix<double, 3, 2>::Zero();
+  const Eigen::Matrix3d Q = Eigen::Vector3d(1, 2, 0.5).asDiagonal();
+  const Eigen::Matrix2d R = Eigen::Vector2d(0.5, 2).asDiagonal();
+  const LinearSystem<double> model(A, B, C, D, kTimeStep);
+
+  // The reference must be an equilibrium: x = A x + B u.
+  const Eigen::Vector2d u_ref(0.3, -0.2);
+  const Eigen::Vector3d x_ref =
+      (Eigen::Matrix3d::Identity() - A).lu().solve(B * u_ref);
+  auto model_context = model.CreateDefaultContext();
+  model.get_input_port().FixValue(model_context.get(), u_ref);
+  model_context->SetDiscreteState(0, x_ref);
+
+  const LinearModelPredictiveController<double> dut(
+      std::make_unique<LinearSystem<double>>(A, B, C, D, kTimeStep),
+      model_context->Clone(), Q, R, kTimeStep,
+      kNumSampleTimes * kTimeStep);
+
+  const Eigen::Vector3d x0(1, -2, 0.5);
+  auto context = dut.CreateDefaultContext();
+  dut.get_state_port().FixValue(context.get(), x0);
+  const Eigen::VectorXd u = dut.get_control_port().Eval(*context);
+
+  DirectTranscription dirtran(&model, *model_context, kNumSampleTimes);
+  const auto x = dirtran.state();
+  const auto v = dirtran.input();
+  dirtran.AddRunningCost(x.transpose() * Q * x + v.transpose() * R * v);
+  dirtran.prog().AddLinearConstraint(dirtran.initial_state() == x0 - x_ref);
+  const auto result = solvers::Solve(dirtran.prog());
+  ASSERT_TRUE(result.is_success());
+  const Eigen::VectorXd u_expected =
+      dirtran.GetInputSamples(result).col(0) + u_ref;
+
+  EXPECT_TRUE(CompareMatrices(u, u_expected, 1e-6));
+}
+
 namespace {
 
 // A discrete-time cubic polynomial system.
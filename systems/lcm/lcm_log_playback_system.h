@@ -15,6 +15,9 @@ namespace lcm {
  * This is useful when a simulated Diagram contains LcmSubscriberSystem(s)
  * whose outputs should be determined by logged data and when the log's cursor
  * should advance automatically during simulation.
+ *
+ * To play back only the end of a log, call DrakeLcmLog::Seek() before
+ * simulating, with a time later than the Context's initial time.
  */
 class LcmLogPlaybackSystem : public LeafSystem<double> {
  public:
@@ -71,18 +71,32 @@ LcmSubscriberSystem::~LcmSubscriberSystem() {
 systems::EventStatus LcmSubscriberSystem::ProcessMessageAndStoreToAbstractState(
     const Context<double>&, State<double>* state) const {
   AbstractValues& abstract_state = state->get_mutable_abstract_state();
-  std::lock_guard<std::mutex> lock(received_message_mutex_);
-  if (!received_message_.empty()) {
-    serializer_->Deserialize(
-        received_message_.data(), received_message_.size(),
-        &abstract_state.get_mutable_value(kStateIndexMessage));
-  }
+  const int message_count = DecodeNewestMessage(
+      &abstract_state.get_mutable_value(kStateIndexMessage));
   abstract_state.get_mutable_value(kStateIndexMessageCount)
-      .get_mutable_value<int>() = received_message_count_;
+      .get_mutable_value<int>() = message_count;
 
   return systems::EventStatus::Succeeded();
 }
 
+int LcmSubscriberSystem::DecodeNewestMessage(AbstractValue* message) const {
+  std::lock_guard<std::mutex> decoding_lock(decoding_message_mutex_);
+  {
+    // Take the newest message, if we don't have it already. Swapping (rather
+    // than copying) leaves our previous buffer for the handler to reuse.
+    std::lock_guard<std::mutex> lock(received_message_mutex_);
+    if (received_message_count_ > decoding_message_count_) {
+      received_message_.swap(decoding_message_);
+      decoding_message_count_ = received_message_count_;
+    }
+  }
+  if (!decoding_message_.empty()) {
+    serializer_->Deserialize(decoding_message_.data(),
+                             decoding_message_.size(), message);
+  }
+  return decoding_message_count_;
+}
+
 int LcmSubscriberSystem::GetMessageCount(const Context<double>& context) const {
   return context.get_abstract_state<int>(kStateIndexMessageCount);
 }
@@ -140,9 +154,12 @@ void LcmSubscriberSystem::HandleMessage(const void* buffer, int size) {
 
   const uint8_t* const rbuf_begin = static_cast<const uint8_t*>(buffer);
   const uint8_t* const rbuf_end = rbuf_begin + size;
+  // Copy the message into our spare buffer, reusing its storage, and then swap
+  // it in. The copy happens outside of received_message_mutex_.
+  std::lock_guard<std::mutex> incoming_lock(incoming_message_mutex_);
+  incoming_message_.assign(rbuf_begin, rbuf_end);
   std::lock_guard<std::mutex> lock(received_message_mutex_);
-  received_message_.clear();
-  received_message_.insert(received_message_.begin(), rbuf_begin, rbuf_end);
+  received_message_.swap(incoming_message_);
   received_message_count_++;
   received_message_condition_variable_.notify_all();
 }
@@ -190,8 +207,8 @@ int LcmSubscriberSystem::WaitForMessage(
   }
 
   if (message) {
-      serializer_->Deserialize(
-          received_message_.data(), received_message_.size(), message);
+    lock.unlock();
+    return DecodeNewestMessage(message);
   }
 
   return received_message_count_;
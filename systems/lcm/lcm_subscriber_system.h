@@ -33,6 +33,17 @@ namespace lcm {
  * all these operations are taken care of by the Simulator. On the other hand,
  * the user needs to manually replicate this process without the Simulator.
  *
+ * Received messages are double-buffered: the LCM receive thread copies each
+ * message into a spare buffer (whose storage is reused from message to
+ * message) and then swaps it in, and a message is decoded directly into the
+ * existing message object in the State, outside of the lock that the receive
+ * thread uses. Thus, once the buffers have grown to the size of the messages,
+ * receiving and processing a message doesn't allocate memory (beyond what the
+ * message type's own decoding allocates), and the receive thread never waits
+ * for a message to be decoded. When several messages arrive between updates,
+ * only the newest is decoded; the older ones are dropped without being
+ * decoded.
+ *
  * If LCM service in use is a drake::lcm::DrakeLcmLog (not live operation),
  * then see drake::systems::lcm::LcmLogPlaybackSystem for a helper to advance
  * the log cursor in concert with the simulation.
@@ -129,6 +140,11 @@ class LcmSubscriberSystem : public LeafSystem<double> {
   systems::EventStatus ProcessMessageAndStoreToAbstractState(
       const Context<double>&, State<double>* state) const;
 
+  // Decodes the newest received message into `message` (unless no message has
+  // been received yet, or it was empty), and returns the number of messages
+  // received up to and including it.
+  int DecodeNewestMessage(AbstractValue* message) const;
+
   // The channel on which to receive LCM messages.
   const std::string channel_;
 
@@ -137,17 +153,36 @@ class LcmSubscriberSystem : public LeafSystem<double> {
   const std::unique_ptr<SerializerInterface> serializer_;
 
   // The mutex that guards received_message_ and received_message_count_.
+  // It is only ever held briefly, to swap buffers or read the counter.
   mutable std::mutex received_message_mutex_;
 
   // A condition variable that's signaled every time the handler is called.
   mutable std::condition_variable received_message_condition_variable_;
 
-  // The bytes of the most recently received LCM message.
-  std::vector<uint8_t> received_message_;
+  // The bytes of the most recently received LCM message, unless it has since
+  // been moved to decoding_message_.
+  mutable std::vector<uint8_t> received_message_;
 
   // A message counter that's incremented every time the handler is called.
   int received_message_count_{0};
 
+  // Guards incoming_message_, so that the handler is safe to call from more
+  // than one thread.
+  std::mutex incoming_message_mutex_;
+
+  // The buffer that the handler copies each message into, before swapping it
+  // with received_message_.
+  std::vector<uint8_t> incoming_message_;
+
+  // Guards decoding_message_ and decoding_message_count_. Decoding happens
+  // while holding only this mutex, so it never blocks the handler.
+  mutable std::mutex decoding_message_mutex_;
+
+  // The bytes of the newest message that has been moved out of
+  // received_message_ for decoding, and the message count as of that message.
+  mutable std::vector<uint8_t> decoding_message_;
+  mutable int decoding_message_count_{0};
+
   // When we are destroyed, our subscription will be automatically removed
   // (if the DrakeLcmInterface supports removal).
   std::shared_ptr<drake::lcm::DrakeSubscriptionInterface> subscription_;
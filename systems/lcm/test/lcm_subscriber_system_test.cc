@@ -102,6 +102,41 @@ GTEST_TEST(LcmSubscriberSystemTest, ReceiveTest) {
   EXPECT_TRUE(CompareLcmtDrakeSignalMessages(value, sample_data.value));
 }
 
+// When several messages arrive between updates, only the newest is decoded,
+// and each context gets the newest message no matter which context processed
+// it first.
+GTEST_TEST(LcmSubscriberSystemTest, NewestMessageTest) {
+  drake::lcm::DrakeLcm lcm;
+  const std::string channel_name = "channel_name";
+  auto dut = LcmSubscriberSystem::Make<lcmt_drake_signal>(channel_name, &lcm);
+  std::unique_ptr<Context<double>> context1 = dut->CreateDefaultContext();
+  std::unique_ptr<Context<double>> context2 = dut->CreateDefaultContext();
+  std::unique_ptr<SystemOutput<double>> output = dut->AllocateOutput();
+
+  SampleData sample_data;
+  for (int i = 0; i < 3; ++i) {
+    sample_data.value.timestamp = i;
+    sample_data.PublishAndHandle(&lcm, channel_name);
+  }
+  EvalOutputHelper(*dut, context1.get(), output.get());
+  EXPECT_EQ(dut->GetMessageCount(*context1), 3);
+  EXPECT_EQ(output->get_data(0)->get_value<lcmt_drake_signal>().timestamp, 2);
+
+  // Messages of different sizes reuse the buffers.
+  sample_data.value.dim = 3;
+  sample_data.value.val.push_back(3.0);
+  sample_data.value.coord.push_back("z");
+  sample_data.value.timestamp = 3;
+  sample_data.PublishAndHandle(&lcm, channel_name);
+  for (Context<double>* context : {context2.get(), context1.get()}) {
+    EvalOutputHelper(*dut, context, output.get());
+    EXPECT_EQ(dut->GetMessageCount(*context), 4);
+    EXPECT_TRUE(CompareLcmtDrakeSignalMessages(
+        output->get_data(0)->get_value<lcmt_drake_signal>(),
+        sample_data.value));
+  }
+}
+
 GTEST_TEST(LcmSubscriberSystemTest, WaitTest) {
   // Ensure that `WaitForMessage` works as expected.
   drake::lcm::DrakeLcm lcm;
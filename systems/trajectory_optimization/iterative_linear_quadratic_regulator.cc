@@ -0,0 +1,457 @@
+#include "drake/systems/trajectory_optimization/iterative_linear_quadratic_regulator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
+#include "drake/common/text_logging.h"
+#include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
+
+namespace drake {
+namespace systems {
+namespace trajectory_optimization {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+struct IterativeLinearQuadraticRegulator::Workspace {
+  std::unique_ptr<Context<double>> context;
+  FixedInputPortValue* input{};
+  std::unique_ptr<DiscreteValues<double>> discrete_state;
+
+  // Only allocated if the system supports AutoDiffXd.
+  std::unique_ptr<Context<AutoDiffXd>> autodiff_context;
+  FixedInputPortValue* autodiff_input{};
+  std::unique_ptr<DiscreteValues<AutoDiffXd>> autodiff_discrete_state;
+
+  // The candidate trajectory of one line search step.
+  std::vector<VectorXd> x;
+  std::vector<VectorXd> u;
+  double cost{};
+};
+
+namespace {
+
+double get_period(const System<double>* system) {
+  std::optional<PeriodicEventData> periodic_data =
+      system->GetUniquePeriodicDiscreteUpdateAttribute();
+  DRAKE_THROW_UNLESS(periodic_data.has_value());
+  DRAKE_THROW_UNLESS(periodic_data->offset_sec() == 0.0);
+  return periodic_data->period_sec();
+}
+
+int get_input_port_size(
+    const System<double>* system,
+    const std::variant<InputPortSelection, InputPortIndex>& input_port_index) {
+  const InputPort<double>* input_port =
+      system->get_input_port_selection(input_port_index);
+  DRAKE_THROW_UNLESS(input_port != nullptr);
+  DRAKE_THROW_UNLESS(input_port->get_data_type() == kVectorValued);
+  return input_port->size();
+}
+
+}  // namespace
+
+IterativeLinearQuadraticRegulator::IterativeLinearQuadraticRegulator(
+    const System<double>* system, const Context<double>& context,
+    int num_time_samples,
+    const std::variant<InputPortSelection, InputPortIndex>& input_port_index)
+    : IterativeLinearQuadraticRegulator(
+          system, context, num_time_samples, true, get_period(system),
+          input_port_index) {
+  DRAKE_THROW_UNLESS(system->IsDifferenceEquationSystem());
+}
+
+IterativeLinearQuadraticRegulator::IterativeLinearQuadraticRegulator(
+    const System<double>* system, const Context<double>& context,
+    int num_time_samples, TimeStep fixed_timestep,
+    const std::variant<InputPortSelection, InputPortIndex>& input_port_index)
+    : IterativeLinearQuadraticRegulator(
+          system, context, num_time_samples, false, fixed_timestep.value,
+          input_port_index) {
+  DRAKE_THROW_UNLESS(context.has_only_continuous_state());
+}
+
+IterativeLinearQuadraticRegulator::IterativeLinearQuadraticRegulator(
+    const System<double>* system, const Context<double>& context,
+    int num_time_samples, bool discrete_time_system, double timestep,
+    const std::variant<InputPortSelection, InputPortIndex>& input_port_index)
+    : system_(system),
+      autodiff_system_(system->ToAutoDiffXdMaybe()),
+      context_(context.Clone()),
+      input_port_index_(input_port_index),
+      discrete_time_system_(discrete_time_system),
+      timestep_(timestep),
+      num_states_(discrete_time_system
+                      ? context.get_discrete_state(0).size()
+                      : context.num_continuous_states()),
+      num_inputs_(get_input_port_size(system, input_port_index)),
+      num_time_samples_(num_time_samples),
+      Q_(MatrixXd::Zero(num_states_, num_states_)),
+      R_(MatrixXd::Identity(num_inputs_, num_inputs_)),
+      Qf_(MatrixXd::Zero(num_states_, num_states_)),
+      xd_(VectorXd::Zero(num_states_)),
+      ud_(VectorXd::Zero(num_inputs_)),
+      x_(std::max(num_time_samples, 0), VectorXd::Zero(num_states_)),
+      u_(std::max(num_time_samples - 1, 0), VectorXd::Zero(num_inputs_)),
+      lq_(num_states_, num_inputs_, std::max(num_time_samples - 1, 0)) {
+  DRAKE_THROW_UNLESS(num_time_samples >= 2);
+  DRAKE_THROW_UNLESS(timestep > 0);
+  DRAKE_THROW_UNLESS(num_states_ > 0);
+  DRAKE_THROW_UNLESS(num_inputs_ > 0);
+  ReserveWorkspaces(1);
+}
+
+IterativeLinearQuadraticRegulator::~IterativeLinearQuadraticRegulator() =
+    default;
+
+void IterativeLinearQuadraticRegulator::SetQuadraticCost(
+    const Eigen::Ref<const MatrixXd>& Q, const Eigen::Ref<const MatrixXd>& R,
+    const Eigen::Ref<const MatrixXd>& Qf, const Eigen::Ref<const VectorXd>& xd,
+    const Eigen::Ref<const VectorXd>& ud) {
+  DRAKE_THROW_UNLESS(Q.rows() == num_states_ && Q.cols() == num_states_);
+  DRAKE_THROW_UNLESS(R.rows() == num_inputs_ && R.cols() == num_inputs_);
+  DRAKE_THROW_UNLESS(Qf.rows() == num_states_ && Qf.cols() == num_states_);
+  DRAKE_THROW_UNLESS(xd.size() == num_states_);
+  DRAKE_THROW_UNLESS(ud.size() == num_inputs_);
+  Q_ = Q;
+  R_ = R;
+  Qf_ = Qf;
+  xd_ = xd;
+  ud_ = ud;
+}
+
+void IterativeLinearQuadraticRegulator::ReserveWorkspaces(int num_threads) {
+  const InputPort<double>* input_port =
+      system_->get_input_port_selection(input_port_index_);
+  while (static_cast<int>(workspaces_.size()) < num_threads) {
+    auto workspace = std::make_unique<Workspace>();
+    workspace->context = context_->Clone();
+    workspace->input = &input_port->FixValue(workspace->context.get(),
+                                             VectorXd::Zero(num_inputs_));
+    if (discrete_time_system_) {
+      workspace->discrete_state = system_->AllocateDiscreteVariables();
+    }
+    if (autodiff_system_ != nullptr) {
+      workspace->autodiff_context = autodiff_system_->CreateDefaultContext();
+      workspace->autodiff_context->SetTimeStateAndParametersFrom(*context_);
+      autodiff_system_->FixInputPortsFrom(*system_, *context_,
+                                          workspace->autodiff_context.get());
+      workspace->autodiff_input =
+          &autodiff_system_->get_input_port_selection(input_port_index_)
+               ->FixValue(workspace->autodiff_context.get(),
+                          VectorX<AutoDiffXd>::Zero(num_inputs_).eval());
+      if (discrete_time_system_) {
+        workspace->autodiff_discrete_state =
+            autodiff_system_->AllocateDiscreteVariables();
+      }
+    }
+    workspace->x.resize(num_time_samples_, VectorXd::Zero(num_states_));
+    workspace->u.resize(num_time_samples_ - 1, VectorXd::Zero(num_inputs_));
+    workspaces_.push_back(std::move(workspace));
+  }
+}
+
+void IterativeLinearQuadraticRegulator::ParallelFor(
+    int count, int num_threads,
+    const std::function<void(int, Workspace*)>& body) {
+  num_threads = std::min(num_threads, count);
+  if (num_threads <= 1) {
+    for (int i = 0; i < count; ++i) body(i, workspaces_[0].get());
+    return;
+  }
+  DRAKE_DEMAND(static_cast<int>(workspaces_.size()) >= num_threads);
+
+  drake::internal::ParallelForOptions parallel_options;
+  parallel_options.num_threads = num_threads;
+  drake::internal::ParallelFor(num_threads, [&](int t) {
+    const int begin = static_cast<int>(static_cast<int64_t>(count) * t /
+                                       num_threads);
+    const int end = static_cast<int>(static_cast<int64_t>(count) * (t + 1) /
+                                     num_threads);
+    for (int i = begin; i < end; ++i) body(i, workspaces_[t].get());
+  }, parallel_options);
+}
+
+template <typename T>
+VectorX<T> IterativeLinearQuadraticRegulator::CalcNextState(
+    const System<T>& system, int k, const VectorX<T>& x, const VectorX<T>& u,
+    Context<T>* context, FixedInputPortValue* input,
+    DiscreteValues<T>* discrete_state) const {
+  context->SetTime(k * timestep_);
+  input->GetMutableVectorData<T>()->SetFromVector(u);
+  if (discrete_time_system_) {
+    context->SetDiscreteState(x);
+    system.CalcDiscreteVariableUpdates(*context, discrete_state);
+    return discrete_state->get_vector(0).get_value();
+  }
+  context->SetContinuousState(x);
+  return x + timestep_ * system.EvalTimeDerivatives(*context).CopyToVector();
+}
+
+void IterativeLinearQuadraticRegulator::Linearize(int k, bool use_autodiff,
+                                                  Workspace* workspace) {
+  const int n = num_states_;
+  const int m = num_inputs_;
+  if (use_autodiff) {
+    VectorXd xu(n + m);
+    xu << x_[k], u_[k];
+    const VectorX<AutoDiffXd> xu_autodiff = math::InitializeAutoDiff(xu);
+    const VectorX<AutoDiffXd> next = CalcNextState<AutoDiffXd>(
+        *autodiff_system_, k, xu_autodiff.head(n), xu_autodiff.tail(m),
+        workspace->autodiff_context.get(), workspace->autodiff_input,
+        workspace->autodiff_discrete_state.get());
+    const MatrixXd gradient = math::ExtractGradient(next, n + m);
+    lq_.A(k) = gradient.leftCols(n);
+    lq_.B(k) = gradient.rightCols(m);
+    return;
+  }
+
+  // Forward differences, with the increments of
+  // ImplicitIntegrator::ComputeForwardDiffJacobian().
+  const double eps = std::sqrt(std::numeric_limits<double>::epsilon());
+  const auto calc_next_state = [&](const VectorXd& x, const VectorXd& u) {
+    return CalcNextState<double>(*system_, k, x, u, workspace->context.get(),
+                                 workspace->input,
+                                 workspace->discrete_state.get());
+  };
+  const VectorXd next = calc_next_state(x_[k], u_[k]);
+  VectorXd x = x_[k];
+  for (int i = 0; i < n; ++i) {
+    const double dx = eps * std::max(1.0, std::abs(x(i)));
+    x(i) += dx;
+    lq_.A(k).col(i) = (calc_next_state(x, u_[k]) - next) / dx;
+    x(i) = x_[k](i);
+  }
+  VectorXd u = u_[k];
+  for (int i = 0; i < m; ++i) {
+    const double du = eps * std::max(1.0, std::abs(u(i)));
+    u(i) += du;
+    lq_.B(k).col(i) = (calc_next_state(x_[k], u) - next) / du;
+    u(i) = u_[k](i);
+  }
+}
+
+double IterativeLinearQuadraticRegulator::RunningCost(
+    const VectorXd& x, const VectorXd& u) const {
+  const VectorXd x_error = x - xd_;
+  const VectorXd u_error = u - ud_;
+  return timestep_ *
+         (x_error.dot(Q_ * x_error) + u_error.dot(R_ * u_error));
+}
+
+double IterativeLinearQuadraticRegulator::FinalCost(const VectorXd& x) const {
+  const VectorXd x_error = x - xd_;
+  return x_error.dot(Qf_ * x_error);
+}
+
+double IterativeLinearQuadraticRegulator::Rollout(
+    double alpha, std::vector<VectorXd>* x, std::vector<VectorXd>* u,
+    Workspace* workspace) const {
+  const double kInfinity = std::numeric_limits<double>::infinity();
+  (*x)[0] = x_[0];
+  double cost = 0;
+  for (int k = 0; k < num_time_samples_ - 1; ++k) {
+    (*u)[k] = u_[k] - alpha * lq_.k0(k) - lq_.K(k) * ((*x)[k] - x_[k]);
+    (*x)[k + 1] = CalcNextState<double>(
+        *system_, k, (*x)[k], (*u)[k], workspace->context.get(),
+        workspace->input, workspace->discrete_state.get());
+    if (!(*x)[k + 1].allFinite()) return kInfinity;
+    cost += RunningCost((*x)[k], (*u)[k]);
+  }
+  cost += FinalCost(x->back());
+  return std::isfinite(cost) ? cost : kInfinity;
+}
+
+double IterativeLinearQuadraticRegulator::CalcCost(
+    const Eigen::Ref<const VectorXd>& x0, const std::vector<VectorXd>& u,
+    std::vector<VectorXd>* x) {
+  DRAKE_THROW_UNLESS(x0.size() == num_states_);
+  DRAKE_THROW_UNLESS(static_cast<int>(u.size()) == num_time_samples_ - 1);
+  Workspace* workspace = workspaces_[0].get();
+  VectorXd state = x0;
+  if (x != nullptr) x->resize(num_time_samples_);
+  double cost = 0;
+  for (int k = 0; k < num_time_samples_ - 1; ++k) {
+    DRAKE_THROW_UNLESS(u[k].size() == num_inputs_);
+    if (x != nullptr) (*x)[k] = state;
+    cost += RunningCost(state, u[k]);
+    state = CalcNextState<double>(*system_, k, state, u[k],
+                                  workspace->context.get(), workspace->input,
+                                  workspace->discrete_state.get());
+  }
+  if (x != nullptr) x->back() = state;
+  return cost + FinalCost(state);
+}
+
+IterativeLinearQuadraticRegulatorResult IterativeLinearQuadraticRegulator::
+    Solve(const Eigen::Ref<const VectorXd>& x0,
+          const std::vector<VectorXd>& u_initial, const Options& options) {
+  DRAKE_THROW_UNLESS(x0.size() == num_states_);
+  DRAKE_THROW_UNLESS(static_cast<int>(u_initial.size()) ==
+                     num_time_samples_ - 1);
+  for (const VectorXd& u : u_initial) {
+    DRAKE_THROW_UNLESS(u.size() == num_inputs_);
+  }
+  DRAKE_THROW_UNLESS(options.max_iterations >= 0);
+  DRAKE_THROW_UNLESS(options.num_threads >= 1);
+  DRAKE_THROW_UNLESS(options.max_line_search_steps >= 1);
+  DRAKE_THROW_UNLESS(options.regularization_factor > 1);
+  if (options.use_autodiff && autodiff_system_ == nullptr) {
+    throw std::logic_error(
+        "IterativeLinearQuadraticRegulator: the system doesn't support "
+        "AutoDiffXd; set use_autodiff to false to linearize it by finite "
+        "differences.");
+  }
+#if defined(_OPENMP)
+  const int num_threads = options.num_threads;
+#else
+  const int num_threads = 1;
+#endif
+  ReserveWorkspaces(num_threads);
+
+  const int num_steps = num_time_samples_ - 1;
+  u_ = u_initial;
+  double cost = CalcCost(x0, u_, &x_);
+  if (!std::isfinite(cost)) {
+    throw std::runtime_error(
+        "IterativeLinearQuadraticRegulator: the cost of the initial "
+        "trajectory isn't finite.");
+  }
+
+  // The LQ problem is in the deviations from the current trajectory; only its
+  // dynamics and linear cost terms change from one iteration to the next.
+  for (int k = 0; k < num_steps; ++k) {
+    lq_.Q(k) = timestep_ * Q_;
+    lq_.R(k) = timestep_ * R_;
+  }
+
+  double regularization = 0;
+  // Sets up the LQ problem about the current trajectory.
+  auto linearize = [&]() {
+    ParallelFor(num_steps, num_threads, [&](int k, Workspace* workspace) {
+      Linearize(k, options.use_autodiff, workspace);
+    });
+    for (int k = 0; k < num_steps; ++k) {
+      lq_.q(k) = timestep_ * Q_ * (x_[k] - xd_);
+      lq_.r(k) = timestep_ * R_ * (u_[k] - ud_);
+    }
+    lq_.Qf() = Qf_;
+    lq_.qf() = Qf_ * (x_.back() - xd_);
+  };
+  // Solves the LQ problem, raising the regularization as needed. Returns false
+  // if it exceeds the maximum.
+  auto backward_pass = [&]() {
+    while (!lq_.Solve(regularization)) {
+      regularization = std::max(regularization * options.regularization_factor,
+                                options.min_regularization);
+      if (regularization > options.max_regularization) return false;
+    }
+    return true;
+  };
+
+  Result result;
+  // Whether lq_ is about the current trajectory, and whether it was solved.
+  bool linearized = false;
+  bool solved = false;
+  int iteration = 0;
+  while (iteration < options.max_iterations) {
+    ++iteration;
+    if (!linearized) {
+      linearize();
+      linearized = true;
+    }
+    solved = backward_pass();
+    if (!solved) break;
+
+    // With no deviation of the initial state, s₀[0] is the change in cost
+    // that the LQ model predicts for a full step.
+    const double expected_decrease = -lq_.s0(0);
+    if (expected_decrease <= options.convergence_tolerance * std::abs(cost)) {
+      result.converged = true;
+      break;
+    }
+
+    // Forward pass: line search over the step sizes 1, ½, ¼, ..., rolling out
+    // up to num_threads of them at a time. The first acceptable step size is
+    // taken, as a serial line search would. The LQ model predicts a decrease
+    // of (2α - α²) times that of a full step for step size α; with
+    // regularization that scaling is only approximate, as the gains are no
+    // longer the model's minimizer, but it stays exact for the full step.
+    std::optional<int> accepted;
+    for (int first = 0;
+         first < options.max_line_search_steps && !accepted.has_value();
+         first += num_threads) {
+      const int count =
+          std::min(num_threads, options.max_line_search_steps - first);
+      ParallelFor(count, num_threads, [&](int i, Workspace* workspace) {
+        workspace->cost = Rollout(std::ldexp(1.0, -(first + i)),
+                                  &workspace->x, &workspace->u, workspace);
+      });
+      // Since count doesn't exceed num_threads, ParallelFor() rolls out
+      // candidate i in workspace i.
+      for (int i = 0; i < count; ++i) {
+        const double alpha = std::ldexp(1.0, -(first + i));
+        const double new_cost = workspaces_[i]->cost;
+        if (cost - new_cost >= options.line_search_sufficient_decrease *
+                                   (2 * alpha - alpha * alpha) *
+                                   expected_decrease) {
+          accepted = i;
+          break;
+        }
+      }
+    }
+
+    if (!accepted.has_value()) {
+      regularization = std::max(regularization * options.regularization_factor,
+                                options.min_regularization);
+      if (regularization > options.max_regularization) break;
+      continue;
+    }
+
+    Workspace* step = workspaces_[*accepted].get();
+    const double decrease = cost - step->cost;
+    cost = step->cost;
+    x_.swap(step->x);
+    u_.swap(step->u);
+    linearized = false;
+    regularization /= options.regularization_factor;
+    if (regularization < options.min_regularization) regularization = 0;
+    DRAKE_LOGGER_TRACE(
+        "IterativeLinearQuadraticRegulator iteration {}: cost {}", iteration,
+        cost);
+    if (decrease <= options.convergence_tolerance * std::abs(cost)) {
+      result.converged = true;
+      break;
+    }
+  }
+
+  result.x = x_;
+  result.u = u_;
+  if (options.compute_feedback_gains) {
+    // After an accepted step, the last backward pass was about the previous
+    // trajectory, so it's redone about the returned one for the gains.
+    if (!linearized) {
+      linearize();
+      solved = backward_pass();
+    }
+    if (solved) {
+      result.K.resize(num_steps);
+      for (int k = 0; k < num_steps; ++k) result.K[k] = lq_.K(k);
+    }
+  }
+  result.cost = cost;
+  result.num_iterations = iteration;
+  return result;
+}
+
+}  // namespace trajectory_optimization
+}  // namespace systems
+}  // namespace drake
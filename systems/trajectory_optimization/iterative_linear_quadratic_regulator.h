@@ -0,0 +1,251 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <variant>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/controllers/discrete_time_riccati_recursion.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/system.h"
+#include "drake/systems/trajectory_optimization/direct_transcription.h"
+
+namespace drake {
+namespace systems {
+namespace trajectory_optimization {
+
+/// Options for IterativeLinearQuadraticRegulator::Solve().
+struct IterativeLinearQuadraticRegulatorOptions {
+  /// The maximum number of iterations, each of which linearizes the dynamics
+  /// about the current trajectory, solves the resulting LQ problem, and line
+  /// searches along its solution.
+  int max_iterations{100};
+
+  /// The solver has converged when an iteration reduces the cost, or the LQ
+  /// model predicts that it could reduce the cost, by less than this fraction
+  /// of the cost.
+  double convergence_tolerance{1e-6};
+
+  /// When true, linearizes the dynamics by automatic differentiation of the
+  /// system's AutoDiffXd version; otherwise by forward finite differences.
+  bool use_autodiff{true};
+
+  /// The number of threads used to linearize the dynamics at the knot points,
+  /// and to roll out the line search's candidate step sizes. Values greater
+  /// than one take effect only when Drake is built with OpenMP. The result
+  /// doesn't depend on the number of threads.
+  int num_threads{1};
+
+  /// The line search tries the step sizes 1, ½, ¼, ... up to this many.
+  int max_line_search_steps{10};
+
+  /// A step is accepted when it reduces the cost by at least this fraction of
+  /// the reduction predicted by the LQ model.
+  double line_search_sufficient_decrease{0.1};
+
+  /// The backward pass adds a multiple μ of the identity to the Hessian of
+  /// each step's quadratic in the input. μ is multiplied by
+  /// `regularization_factor` (and raised to at least `min_regularization`)
+  /// when the Hessian isn't positive definite or the line search fails, and
+  /// divided by it (and dropped to zero below `min_regularization`) after an
+  /// accepted step. The solver gives up once μ exceeds `max_regularization`.
+  double min_regularization{1e-6};
+  double max_regularization{1e10};
+  double regularization_factor{10.0};
+
+  /// When true, the result includes the feedback gains K of the LQ problem
+  /// about the returned trajectory. When the last iteration took a step, this
+  /// costs one more linearization and backward pass.
+  bool compute_feedback_gains{false};
+};
+
+/// The result of IterativeLinearQuadraticRegulator::Solve().
+struct IterativeLinearQuadraticRegulatorResult {
+  /// The states at the time samples, x[0], ..., x[N-1].
+  std::vector<Eigen::VectorXd> x;
+  /// The inputs u[0], ..., u[N-2].
+  std::vector<Eigen::VectorXd> u;
+  /// The time-varying feedback gains of the LQ problem about the returned
+  /// trajectory, for which the locally optimal input near it is
+  /// u[k] - K[k](x - x[k]). Empty unless Options::compute_feedback_gains is
+  /// set, or if that problem's backward pass fails.
+  std::vector<Eigen::MatrixXd> K;
+  /// The cost of the trajectory.
+  double cost{};
+  int num_iterations{};
+  bool converged{false};
+};
+
+/// IterativeLinearQuadraticRegulator (iLQR) is a shooting method for
+/// trajectory optimization that exploits the stage-wise structure of the
+/// problem, rather than handing it to a general nonlinear program solver as
+/// DirectTranscription and DirectCollocation do. It minimizes
+///
+///   @f[ (x[N-1] - x_d)'Q_f(x[N-1] - x_d) + \sum_{k=0}^{N-2} h \left(
+///       (x[k] - x_d)'Q(x[k] - x_d) + (u[k] - u_d)'R(u[k] - u_d) \right) @f]
+///
+/// over the inputs, where the states follow from x[0] by the same one-step
+/// dynamics as DirectTranscription (the discrete update of a discrete-time
+/// system, or an explicit Euler step of length h of a continuous-time one),
+/// and h is the time step. The running cost is weighted by h, as in
+/// DirectTranscription::AddRunningCost(), so that the two optimize the same
+/// objective.
+///
+/// Each iteration linearizes the dynamics about the current trajectory (in
+/// parallel across the time samples), solves the resulting time-varying LQ
+/// problem by a backward Riccati recursion (see
+/// controllers::DiscreteTimeRiccatiRecursion), and line searches along the
+/// closed-loop forward rollout of its solution (rolling out several step
+/// sizes in parallel). Every iteration's cost is O(N), and Solve() can be
+/// warm-started from the previous solution, which suits it to real-time
+/// model predictive control. It doesn't support state or input constraints.
+///
+/// The LQ problem and the contexts that one thread uses to evaluate and
+/// linearize the dynamics are allocated at construction. The contexts of any
+/// additional threads are allocated by the first call to Solve() that uses
+/// them. All of them are reused by later calls.
+///
+/// The feedback gains K of the result, which are only computed on request
+/// (see Options::compute_feedback_gains), are those of the LQ problem about
+/// the returned trajectory.
+/// @ingroup planning
+class IterativeLinearQuadraticRegulator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(IterativeLinearQuadraticRegulator)
+
+  using Options = IterativeLinearQuadraticRegulatorOptions;
+  using Result = IterativeLinearQuadraticRegulatorResult;
+
+  /// Constructs the optimizer for a simple discrete-time system (with a single
+  /// periodic discrete update, whose period is the time step).
+  ///
+  /// @param system A dynamical system, which must support
+  ///    System::ToAutoDiffXd to linearize by automatic differentiation.
+  ///    Note that this is aliased for the lifetime of this object.
+  /// @param context Required to describe any parameters of the system.  The
+  ///    values of the state in this context do not have any effect.  This
+  ///    context is cloned; changes to it after calling this method will NOT
+  ///    impact the optimization.
+  /// @param num_time_samples The number of time samples N, at least two.
+  /// @param input_port_index A valid input port index or valid
+  /// InputPortSelection for @p system, which selects a vector-valued input.
+  /// All other inputs on the system will be left disconnected (if they are
+  /// disconnected in @p context) or will be set to their current values (if
+  /// they are connected/fixed in @p context).
+  /// @default kUseFirstInputIfItExists.
+  IterativeLinearQuadraticRegulator(
+      const System<double>* system, const Context<double>& context,
+      int num_time_samples,
+      const std::variant<InputPortSelection, InputPortIndex>& input_port_index =
+          InputPortSelection::kUseFirstInputIfItExists);
+
+  /// Constructs the optimizer for a continuous-time system, which is
+  /// discretized by explicit Euler steps of length @p fixed_timestep. See the
+  /// discrete-time constructor for the other parameters.
+  IterativeLinearQuadraticRegulator(
+      const System<double>* system, const Context<double>& context,
+      int num_time_samples, TimeStep fixed_timestep,
+      const std::variant<InputPortSelection, InputPortIndex>& input_port_index =
+          InputPortSelection::kUseFirstInputIfItExists);
+
+  ~IterativeLinearQuadraticRegulator();
+
+  int num_states() const { return num_states_; }
+  int num_inputs() const { return num_inputs_; }
+  int num_time_samples() const { return num_time_samples_; }
+  double fixed_timestep() const { return timestep_; }
+
+  /// Sets the quadratic cost (see the class documentation). The default is
+  /// Q = 0, R = I, Qf = 0, x_d = 0, and u_d = 0.
+  /// @throws std::exception if any argument has the wrong size.
+  void SetQuadraticCost(const Eigen::Ref<const Eigen::MatrixXd>& Q,
+                        const Eigen::Ref<const Eigen::MatrixXd>& R,
+                        const Eigen::Ref<const Eigen::MatrixXd>& Qf,
+                        const Eigen::Ref<const Eigen::VectorXd>& xd,
+                        const Eigen::Ref<const Eigen::VectorXd>& ud);
+
+  /// Optimizes the trajectory from the initial state @p x0, starting from the
+  /// inputs @p u_initial, u[0], ..., u[N-2]. To warm-start a receding-horizon
+  /// controller, pass the previous solution's inputs shifted by one step.
+  /// @throws std::exception if an argument has the wrong size, or if the
+  ///         initial trajectory's cost isn't finite.
+  Result Solve(const Eigen::Ref<const Eigen::VectorXd>& x0,
+               const std::vector<Eigen::VectorXd>& u_initial,
+               const Options& options = {});
+
+  /// Returns the cost of the trajectory from @p x0 under the inputs @p u, and
+  /// the trajectory's states in @p x (if not null).
+  double CalcCost(const Eigen::Ref<const Eigen::VectorXd>& x0,
+                  const std::vector<Eigen::VectorXd>& u,
+                  std::vector<Eigen::VectorXd>* x = nullptr);
+
+ private:
+  // The contexts and scratch storage that one thread uses to evaluate and
+  // linearize the dynamics.
+  struct Workspace;
+
+  IterativeLinearQuadraticRegulator(
+      const System<double>* system, const Context<double>& context,
+      int num_time_samples, bool discrete_time_system, double timestep,
+      const std::variant<InputPortSelection, InputPortIndex>& input_port_index);
+
+  // Allocates the workspaces of up to @p num_threads threads.
+  void ReserveWorkspaces(int num_threads);
+
+  // Calls body(i, workspace) for each i in [0, count), on up to num_threads
+  // threads, each of which handles a contiguous range of i with its own
+  // workspace.
+  void ParallelFor(int count, int num_threads,
+                   const std::function<void(int, Workspace*)>& body);
+
+  // Returns the state that follows x[k] = @p x under the input @p u.
+  template <typename T>
+  VectorX<T> CalcNextState(const System<T>& system, int k, const VectorX<T>& x,
+                           const VectorX<T>& u, Context<T>* context,
+                           FixedInputPortValue* input,
+                           DiscreteValues<T>* discrete_state) const;
+
+  // Sets A(k) and B(k) of the LQ problem to the Jacobians of the dynamics at
+  // x_[k], u_[k].
+  void Linearize(int k, bool use_autodiff, Workspace* workspace);
+
+  // Rolls out the policy u = u_[k] - α k₀[k] - K[k](x - x_[k]) from x_[0],
+  // and returns the cost (infinite if the rollout diverges).
+  double Rollout(double alpha, std::vector<Eigen::VectorXd>* x,
+                 std::vector<Eigen::VectorXd>* u, Workspace* workspace) const;
+
+  double RunningCost(const Eigen::VectorXd& x, const Eigen::VectorXd& u) const;
+  double FinalCost(const Eigen::VectorXd& x) const;
+
+  const System<double>* const system_;
+  std::unique_ptr<System<AutoDiffXd>> autodiff_system_;
+  std::unique_ptr<Context<double>> context_;
+  const std::variant<InputPortSelection, InputPortIndex> input_port_index_;
+  const bool discrete_time_system_;
+  const double timestep_;
+  const int num_states_;
+  const int num_inputs_;
+  const int num_time_samples_;
+
+  Eigen::MatrixXd Q_;
+  Eigen::MatrixXd R_;
+  Eigen::MatrixXd Qf_;
+  Eigen::VectorXd xd_;
+  Eigen::VectorXd ud_;
+
+  std::vector<std::unique_ptr<Workspace>> workspaces_;
+
+  // The current trajectory and the LQ problem about it, in the deviations
+  // from it.
+  std::vector<Eigen::VectorXd> x_;
+  std::vector<Eigen::VectorXd> u_;
+  controllers::DiscreteTimeRiccatiRecursion<> lq_;
+};
+
+}  // namespace trajectory_optimization
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,234 @@
+#include "drake/systems/trajectory_optimization/iterative_linear_quadratic_regulator.h"
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/systems/controllers/discrete_time_riccati_recursion.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/primitives/linear_system.h"
+
+namespace drake {
+namespace systems {
+namespace trajectory_optimization {
+
+// A damped pendulum with a torque input, with unit mass and length.
+template <typename T>
+class TorquePendulum final : public LeafSystem<T> {
+ public:
+  TorquePendulum()
+      : LeafSystem<T>(
+            SystemTypeTag<trajectory_optimization::TorquePendulum>{}) {
+    this->DeclareContinuousState(1, 1, 0);
+    this->DeclareVectorInputPort("torque", 1);
+  }
+
+  // Scalar-converting copy constructor.
+  template <typename U>
+  explicit TorquePendulum(const TorquePendulum<U>&) : TorquePendulum() {}
+
+ private:
+  void DoCalcTimeDerivatives(const Context<T>& context,
+                             ContinuousState<T>* derivatives) const final {
+    using std::sin;
+    const VectorX<T> x = context.get_continuous_state_vector().CopyToVector();
+    const T& u = this->get_input_port(0).Eval(context)[0];
+    Vector2<T> xdot(x(1), u - 0.1 * x(1) - 9.81 * sin(x(0)));
+    derivatives->SetFromVector(xdot);
+  }
+};
+
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+constexpr double kTimeStep = 0.1;
+constexpr int kNumTimeSamples = 21;
+
+class IterativeLinearQuadraticRegulatorTest : public ::testing::Test {
+ protected:
+  IterativeLinearQuadraticRegulatorTest() {
+    A_ << 0, 1, 0, 0;
+    B_ << 0, 1;
+    Q_ = Eigen::Vector2d(1.0, 0.5).asDiagonal();
+    R_ = 0.2 * MatrixXd::Identity(1, 1);
+    Qf_ = 10 * MatrixXd::Identity(2, 2);
+    xd_ << 1.0, 0.0;
+    ud_ = VectorXd::Zero(1);
+  }
+
+  // Returns the optimal inputs of the LQ problem with the discrete dynamics
+  // x[k+1] = Ad x[k] + Bd u[k], in the deviations from xd, ud.
+  std::vector<VectorXd> SolveRiccati(const MatrixXd& Ad, const MatrixXd& Bd,
+                                     const VectorXd& x0) const {
+    controllers::DiscreteTimeRiccatiRecursion<> lq(2, 1, kNumTimeSamples - 1);
+    lq.SetTimeInvariant(Ad, Bd, kTimeStep * Q_, kTimeStep * R_);
+    lq.Qf() = Qf_;
+    // Since Ad xd = xd and ud = 0, the deviations have the same dynamics.
+    EXPECT_TRUE(CompareMatrices(Ad * xd_, xd_));
+    EXPECT_TRUE(lq.Solve());
+    std::vector<VectorXd> x, u;
+    lq.Rollout(x0 - xd_, &x, &u);
+    return u;
+  }
+
+  void CheckMatchesRiccati(IterativeLinearQuadraticRegulator* dut,
+                           const MatrixXd& Ad, const MatrixXd& Bd,
+                           const IterativeLinearQuadraticRegulatorOptions&
+                               options,
+                           double tolerance) {
+    dut->SetQuadraticCost(Q_, R_, Qf_, xd_, ud_);
+    const Eigen::Vector2d x0(-0.5, 0.2);
+    const std::vector<VectorXd> u_initial(kNumTimeSamples - 1,
+                                          VectorXd::Zero(1));
+    const auto result = dut->Solve(x0, u_initial, options);
+    EXPECT_TRUE(result.converged);
+    // The first iteration solves the problem; the second confirms it.
+    EXPECT_LE(result.num_iterations, 2);
+
+    const std::vector<VectorXd> u_expected = SolveRiccati(Ad, Bd, x0);
+    ASSERT_EQ(result.u.size(), u_expected.size());
+    for (int k = 0; k < kNumTimeSamples - 1; ++k) {
+      EXPECT_TRUE(CompareMatrices(result.u[k], u_expected[k], tolerance));
+    }
+    ASSERT_EQ(static_cast<int>(result.x.size()), kNumTimeSamples);
+    EXPECT_TRUE(CompareMatrices(result.x[0], x0));
+    // The gains aren't requested.
+    EXPECT_TRUE(result.K.empty());
+    EXPECT_NEAR(result.cost, dut->CalcCost(x0, result.u), 1e-12);
+  }
+
+  Eigen::Matrix2d A_;
+  Eigen::Vector2d B_;
+  MatrixXd Q_;
+  MatrixXd R_;
+  MatrixXd Qf_;
+  Eigen::Vector2d xd_;
+  VectorXd ud_;
+};
+
+TEST_F(IterativeLinearQuadraticRegulatorTest, DiscreteTimeLinearSystem) {
+  const Eigen::Matrix2d Ad = Eigen::Matrix2d::Identity() + kTimeStep * A_;
+  const Eigen::Vector2d Bd = kTimeStep * B_;
+  const LinearSystem<double> system(Ad, Bd, MatrixXd::Zero(0, 2),
+                                    MatrixXd::Zero(0, 1), kTimeStep);
+  auto context = system.CreateDefaultContext();
+  IterativeLinearQuadraticRegulator dut(&system, *context, kNumTimeSamples);
+  EXPECT_EQ(dut.num_states(), 2);
+  EXPECT_EQ(dut.num_inputs(), 1);
+  EXPECT_EQ(dut.num_time_samples(), kNumTimeSamples);
+  EXPECT_EQ(dut.fixed_timestep(), kTimeStep);
+  CheckMatchesRiccati(&dut, Ad, Bd, {}, 1e-10);
+
+  IterativeLinearQuadraticRegulatorOptions options;
+  options.use_autodiff = false;
+  CheckMatchesRiccati(&dut, Ad, Bd, options, 1e-6);
+}
+
+TEST_F(IterativeLinearQuadraticRegulatorTest, ContinuousTimeLinearSystem) {
+  const LinearSystem<double> system(A_, B_, MatrixXd::Zero(0, 2),
+                                    MatrixXd::Zero(0, 1));
+  auto context = system.CreateDefaultContext();
+  IterativeLinearQuadraticRegulator dut(&system, *context, kNumTimeSamples,
+                                        TimeStep(kTimeStep));
+  // Explicit Euler steps.
+  CheckMatchesRiccati(&dut, Eigen::Matrix2d::Identity() + kTimeStep * A_,
+                      kTimeStep * B_, {}, 1e-10);
+}
+
+GTEST_TEST(IterativeLinearQuadraticRegulatorPendulumTest, SwingUp) {
+  const TorquePendulum<double> system;
+  auto context = system.CreateDefaultContext();
+  const int kNumSamples = 61;
+  const double kStep = 0.05;
+  IterativeLinearQuadraticRegulator dut(&system, *context, kNumSamples,
+                                        TimeStep(kStep));
+  const Eigen::Vector2d xd(M_PI, 0.0);
+  const Eigen::Matrix2d Q = Eigen::Vector2d(1.0, 0.1).asDiagonal();
+  dut.SetQuadraticCost(Q, 0.1 * MatrixXd::Identity(1, 1),
+                       100 * MatrixXd::Identity(2, 2), xd, VectorXd::Zero(1));
+
+  const Eigen::Vector2d x0 = Eigen::Vector2d::Zero();
+  const std::vector<VectorXd> u_initial(kNumSamples - 1, VectorXd::Zero(1));
+  const double initial_cost = dut.CalcCost(x0, u_initial);
+  const auto result = dut.Solve(x0, u_initial);
+  ASSERT_TRUE(result.converged);
+  EXPECT_LT(result.cost, 0.1 * initial_cost);
+  EXPECT_TRUE(CompareMatrices(result.x.back(), xd, 0.1));
+  std::vector<VectorXd> x;
+  EXPECT_NEAR(result.cost, dut.CalcCost(x0, result.u, &x), 1e-12);
+  for (int k = 0; k < kNumSamples; ++k) {
+    EXPECT_TRUE(CompareMatrices(x[k], result.x[k]));
+  }
+
+  // Finite differences reach nearly the same trajectory.
+  IterativeLinearQuadraticRegulatorOptions options;
+  options.use_autodiff = false;
+  const auto fd_result = dut.Solve(x0, u_initial, options);
+  ASSERT_TRUE(fd_result.converged);
+  EXPECT_NEAR(fd_result.cost, result.cost, 1e-3 * result.cost);
+
+  // The result doesn't depend on the number of threads.
+  options.use_autodiff = true;
+  options.num_threads = 3;
+  const auto threaded_result = dut.Solve(x0, u_initial, options);
+  EXPECT_EQ(threaded_result.num_iterations, result.num_iterations);
+  EXPECT_EQ(threaded_result.cost, result.cost);
+  for (int k = 0; k < kNumSamples - 1; ++k) {
+    EXPECT_TRUE(CompareMatrices(threaded_result.u[k], result.u[k]));
+  }
+
+  // Warm-started from its own solution, the solver converges immediately.
+  options = {};
+  options.compute_feedback_gains = true;
+  const auto warm_result = dut.Solve(x0, result.u, options);
+  EXPECT_TRUE(warm_result.converged);
+  EXPECT_EQ(warm_result.num_iterations, 1);
+  EXPECT_LE(warm_result.cost, result.cost);
+
+  // Its only backward pass is about the same trajectory as the one that
+  // produced the requested gains of the first solution.
+  const auto gains_result = dut.Solve(x0, u_initial, options);
+  EXPECT_EQ(gains_result.cost, result.cost);
+  ASSERT_EQ(static_cast<int>(gains_result.K.size()), kNumSamples - 1);
+  ASSERT_EQ(warm_result.K.size(), gains_result.K.size());
+  for (int k = 0; k < kNumSamples - 1; ++k) {
+    EXPECT_TRUE(CompareMatrices(gains_result.K[k], warm_result.K[k], 1e-10));
+  }
+
+  // Without any iterations, the gains are those about the initial trajectory.
+  options.max_iterations = 0;
+  const auto initial_result = dut.Solve(x0, u_initial, options);
+  EXPECT_EQ(initial_result.num_iterations, 0);
+  EXPECT_EQ(static_cast<int>(initial_result.K.size()), kNumSamples - 1);
+}
+
+GTEST_TEST(IterativeLinearQuadraticRegulatorPendulumTest, BadArguments) {
+  const TorquePendulum<double> system;
+  auto context = system.CreateDefaultContext();
+  EXPECT_THROW(IterativeLinearQuadraticRegulator(&system, *context, 1,
+                                                 TimeStep(0.1)),
+               std::exception);
+  // The pendulum isn't a discrete-time system.
+  EXPECT_THROW(IterativeLinearQuadraticRegulator(&system, *context, 10),
+               std::exception);
+
+  IterativeLinearQuadraticRegulator dut(&system, *context, 10, TimeStep(0.1));
+  EXPECT_THROW(dut.SetQuadraticCost(MatrixXd::Identity(3, 3),
+                                    MatrixXd::Identity(1, 1),
+                                    MatrixXd::Identity(2, 2),
+                                    VectorXd::Zero(2), VectorXd::Zero(1)),
+               std::exception);
+  const std::vector<VectorXd> u(9, VectorXd::Zero(1));
+  EXPECT_THROW(dut.Solve(VectorXd::Zero(3), u), std::exception);
+  EXPECT_THROW(dut.Solve(VectorXd::Zero(2), {u.begin(), u.end() - 1}),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace trajectory_optimization
+}  // namespace systems
+}  // namespace drake